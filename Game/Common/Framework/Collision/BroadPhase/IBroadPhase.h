@@ -0,0 +1,55 @@
+/*****************************************************************//**
+ * @file    IBroadPhase.h
+ * @brief   L攻iu[htF[Yj̃C^[tF[XɊւwb_[t@C
+ *
+ * ڍה̑OɋE{bNXm̏dȂŌyAi荞
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionTypes/CollisionTypes.h"
+
+// NX̑O錾 ===================================================
+
+// NX̒` ===============================================================
+/**
+ * @brief L攻̃C^[tF[X
+ */
+class IBroadPhase
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	IBroadPhase() = default;
+
+	// fXgN^
+	virtual ~IBroadPhase() = default;
+
+
+// 
+public:
+	// E{bNXdȂyA̎ZoiyA͈xo͂j
+	virtual void ComputePairs(const std::vector<BroadCollision>& entries, std::vector<BroadPhasePair>* pOutPairs) = 0;
+
+};
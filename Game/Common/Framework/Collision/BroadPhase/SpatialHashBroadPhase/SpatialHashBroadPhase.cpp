@@ -0,0 +1,204 @@
+/*****************************************************************//**
+ * @file    SpatialHashBroadPhase.cpp
+ * @brief   ψiq̋ԃnbVɂL攻Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "SpatialHashBroadPhase.h"
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int		CELL_COORD_BITS		= 21;								///< ZW1̃rbg
+	constexpr int		CELL_COORD_BIAS		= 1 << (CELL_COORD_BITS - 1);		///< ̃ZW𐳂Ɋ񂹂
+	constexpr int		CELL_COORD_LIMIT	= CELL_COORD_BIAS - 1;				///< ZW̏
+	constexpr uint64_t	CELL_COORD_MASK		= (1ull << CELL_COORD_BITS) - 1;	///< ZW̃}XN
+}
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * @param[in] cellSize Z̑傫
+ */
+SpatialHashBroadPhase::SpatialHashBroadPhase(float cellSize)
+	: m_cellSize{ DEFAULT_CELL_SIZE }
+	, m_inverseCellSize{ 1.0f / DEFAULT_CELL_SIZE }
+{
+	SetCellSize(cellSize);
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+SpatialHashBroadPhase::~SpatialHashBroadPhase()
+{
+
+}
+
+/**
+ * @brief E{bNXdȂyA̎Zo
+ *
+ * @param[in]  entries	 Ef[^Q
+ * @param[out] pOutPairs yA
+ */
+void SpatialHashBroadPhase::ComputePairs(const std::vector<BroadCollision>& entries, std::vector<BroadPhasePair>* pOutPairs)
+{
+	pOutPairs->clear();
+	m_cellEntries.clear();
+	m_largeEntries.clear();
+	m_entryRanges.resize(entries.size());
+
+	if (entries.size() < 2) return;
+
+	// vfZɓo^
+	for (uint32_t i = 0; i < static_cast<uint32_t>(entries.size()); i++)
+	{
+		const BroadCollision& entry = entries[i];
+		CellRange& range = m_entryRanges[i];
+		range.isLarge = false;
+
+		// EȂvf͑^vfƂ
+		if (entry.isUnbounded)
+		{
+			range.isLarge = true;
+			m_largeEntries.push_back(i);
+			continue;
+		}
+
+		range.minX = ToCell(entry.min.x);
+		range.minY = ToCell(entry.min.y);
+		range.minZ = ToCell(entry.min.z);
+		range.maxX = ToCell(entry.max.x);
+		range.maxY = ToCell(entry.max.y);
+		range.maxZ = ToCell(entry.max.z);
+
+		// ܂Zvf͑^vfƂ
+		uint64_t cellCount =
+			static_cast<uint64_t>(range.maxX - range.minX + 1) *
+			static_cast<uint64_t>(range.maxY - range.minY + 1) *
+			static_cast<uint64_t>(range.maxZ - range.minZ + 1);
+		if (cellCount > MAX_CELLS_PER_ENTRY)
+		{
+			range.isLarge = true;
+			m_largeEntries.push_back(i);
+			continue;
+		}
+
+		for (int x = range.minX; x <= range.maxX; x++)
+		{
+			for (int y = range.minY; y <= range.maxY; y++)
+			{
+				for (int z = range.minZ; z <= range.maxZ; z++)
+				{
+					m_cellEntries.push_back({ MakeKey(x, y, z), i });
+				}
+			}
+		}
+	}
+
+	// Z̗vfׂ荇悤ɕבւ
+	std::sort(m_cellEntries.begin(), m_cellEntries.end());
+
+	// ZƂɗvfm𒲂ׂ
+	size_t runBegin = 0;
+	while (runBegin < m_cellEntries.size())
+	{
+		const uint64_t key = m_cellEntries[runBegin].key;
+		size_t runEnd = runBegin + 1;
+		while (runEnd < m_cellEntries.size() && m_cellEntries[runEnd].key == key) runEnd++;
+
+		for (size_t p = runBegin; p < runEnd; p++)
+		{
+			const uint32_t indexA = m_cellEntries[p].entry;
+			const CellRange& rangeA = m_entryRanges[indexA];
+
+			for (size_t q = p + 1; q < runEnd; q++)
+			{
+				const uint32_t indexB = m_cellEntries[q].entry;
+				const CellRange& rangeB = m_entryRanges[indexB];
+
+				// dȂ͈͂̍ŏ̃Zł̂ݏo͂Adh
+				uint64_t firstSharedKey = MakeKey(
+					std::max(rangeA.minX, rangeB.minX),
+					std::max(rangeA.minY, rangeB.minY),
+					std::max(rangeA.minZ, rangeB.minZ));
+				if (firstSharedKey != key) continue;
+
+				if (entries[indexA].Overlaps(entries[indexB]))
+				{
+					pOutPairs->emplace_back(entries[indexA].proxyIndex, entries[indexB].proxyIndex);
+				}
+			}
+		}
+
+		runBegin = runEnd;
+	}
+
+	// ^vf͑SĂ̗vfƒׂ
+	for (uint32_t largeIndex : m_largeEntries)
+	{
+		for (uint32_t i = 0; i < static_cast<uint32_t>(entries.size()); i++)
+		{
+			if (i == largeIndex) continue;
+			// ^vfm͕Е̂ݒׂ
+			if (m_entryRanges[i].isLarge && i < largeIndex) continue;
+
+			if (entries[largeIndex].Overlaps(entries[i]))
+			{
+				pOutPairs->emplace_back(entries[largeIndex].proxyIndex, entries[i].proxyIndex);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Z̑傫̐ݒ
+ *
+ * @param[in] cellSize Z̑傫
+ */
+void SpatialHashBroadPhase::SetCellSize(float cellSize)
+{
+	if (cellSize <= 0.0f) return;
+
+	m_cellSize = cellSize;
+	m_inverseCellSize = 1.0f / cellSize;
+}
+
+/**
+ * @brief WZWɕϊ
+ *
+ * @param[in] value W
+ *
+ * @return ZW
+ */
+int SpatialHashBroadPhase::ToCell(float value) const
+{
+	float cell = std::floor(value * m_inverseCellSize);
+	cell = std::max(static_cast<float>(-CELL_COORD_LIMIT), std::min(cell, static_cast<float>(CELL_COORD_LIMIT)));
+	return static_cast<int>(cell);
+}
+
+/**
+ * @brief ZWL[ɕϊ
+ *
+ * @param[in] x ZWX
+ * @param[in] y ZWY
+ * @param[in] z ZWZ
+ *
+ * @return L[
+ */
+uint64_t SpatialHashBroadPhase::MakeKey(int x, int y, int z)
+{
+	return	((static_cast<uint64_t>(x + CELL_COORD_BIAS) & CELL_COORD_MASK) << (CELL_COORD_BITS * 2)) |
+			((static_cast<uint64_t>(y + CELL_COORD_BIAS) & CELL_COORD_MASK) << CELL_COORD_BITS) |
+			 (static_cast<uint64_t>(z + CELL_COORD_BIAS) & CELL_COORD_MASK);
+}
@@ -0,0 +1,107 @@
+/*****************************************************************//**
+ * @file    SpatialHashBroadPhase.h
+ * @brief   ψiq̋ԃnbVɂL攻Ɋւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include "Game/Common/Framework/Collision/BroadPhase/IBroadPhase.h"
+
+
+// NX̑O錾 ===================================================
+
+// NX̒` ===============================================================
+/**
+ * @brief ԃnbVɂL攻
+ *
+ * Ԃ cellSize ̗̂̊iqɕAZɓvfmƂB
+ * ZW 64bit ̃L[ɋl߂ĕבւ邽߁At[̃nbV\̊mۂsv
+ */
+class SpatialHashBroadPhase
+	: public IBroadPhase
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr float		DEFAULT_CELL_SIZE		= 25.0f;	///< ̃Z̑傫i̔zuԊuj
+	static constexpr uint32_t	MAX_CELLS_PER_ENTRY		= 64;		///< 𒴂Zɂ܂vf͑^vfƂĈ
+
+// \̂̐錾
+private:
+
+	/**
+	 * @brief ZW͈̔
+	 */
+	struct CellRange
+	{
+		int minX, minY, minZ;	///< ŏZW
+		int maxX, maxY, maxZ;	///< őZW
+		bool isLarge;			///< ^vfǂ
+	};
+
+	/**
+	 * @brief Zւ̓o^
+	 */
+	struct CellEntry
+	{
+		uint64_t key;		///< ZWl߂L[
+		uint32_t entry;		///< vfԍ
+
+		bool operator<(const CellEntry& other) const
+		{
+			return (key != other.key) ? (key < other.key) : (entry < other.entry);
+		}
+	};
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	float m_cellSize;			///< Z̑傫
+	float m_inverseCellSize;	///< Z̑傫̋t
+
+	std::vector<CellEntry>	m_cellEntries;		///< Zւ̓o^
+	std::vector<CellRange>	m_entryRanges;		///< vfƂ̃ZW͈̔
+	std::vector<uint32_t>	m_largeEntries;		///< iqɓo^Ȃ^vf
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	SpatialHashBroadPhase(float cellSize = DEFAULT_CELL_SIZE);
+
+	// fXgN^
+	~SpatialHashBroadPhase() override;
+
+
+// 
+public:
+	// E{bNXdȂyA̎Zo
+	void ComputePairs(const std::vector<BroadCollision>& entries, std::vector<BroadPhasePair>* pOutPairs) override;
+
+
+// 擾/ݒ
+public:
+	// Z̑傫̐ݒ
+	void SetCellSize(float cellSize);
+	// Z̑傫̎擾
+	float GetCellSize() const { return m_cellSize; }
+
+
+// 
+private:
+
+	// WZWɕϊ
+	int ToCell(float value) const;
+
+	// ZWL[ɕϊ
+	static uint64_t MakeKey(int x, int y, int z);
+};
@@ -0,0 +1,434 @@
+/*****************************************************************//**
+ * @file    StaticColliderBVH.cpp
+ * @brief   ÓIRC_[̋E{[KwɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "StaticColliderBVH.h"
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * @param[in] Ȃ
+ */
+StaticColliderBVH::StaticColliderBVH()
+	: m_nodes{}
+	, m_entries{}
+	, m_unboundedEntries{}
+{
+
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+StaticColliderBVH::~StaticColliderBVH()
+{
+
+}
+
+/**
+ * @brief \z
+ *
+ * @param[in] entries ÓIRC_[̋Ef[^Q
+ */
+void StaticColliderBVH::Build(const std::vector<BroadCollision>& entries)
+{
+	Clear();
+
+	// EȂvf͊KwɊ܂߂Ȃ
+	for (const auto& entry : entries)
+	{
+		if (entry.isUnbounded)
+		{
+			m_unboundedEntries.push_back(entry);
+		}
+		else
+		{
+			m_entries.push_back(entry);
+		}
+	}
+
+	if (m_entries.empty()) return;
+
+	// ߓ_͍őŗvf2{
+	m_nodes.reserve(m_entries.size() * 2);
+
+	Node root{};
+	root.leftOrFirst = 0;
+	root.count = static_cast<uint32_t>(m_entries.size());
+	m_nodes.push_back(root);
+
+	UpdateNodeBounds(0);
+	Subdivide(0, 1);
+}
+
+/**
+ * @brief E{bNXƏdȂvf̃vLVԍ擾
+ *
+ * @param[in]  bounds			ׂ鋫E{bNX
+ * @param[out] pOutProxyIndices dȂvf̃vLVԍiǋLj
+ */
+void StaticColliderBVH::Query(const BroadCollision& bounds, std::vector<uint32_t>* pOutProxyIndices) const
+{
+	for (const auto& entry : m_unboundedEntries)
+	{
+		pOutProxyIndices->push_back(entry.proxyIndex);
+	}
+
+	if (m_nodes.empty()) return;
+
+	// ߓ_E{bNXƏdȂĂ邩ǂ
+	auto overlapsNode = [&](const Node& node)
+		{
+			if (bounds.isUnbounded) return true;
+
+			return (bounds.min.x <= node.max.x && node.min.x <= bounds.max.x)
+				&& (bounds.min.y <= node.max.y && node.min.y <= bounds.max.y)
+				&& (bounds.min.z <= node.max.z && node.min.z <= bounds.max.z);
+		};
+
+	uint32_t stack[MAX_DEPTH + 1];
+	int stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+
+		if (!overlapsNode(node)) continue;
+
+		// tȂvf𒲂ׂ
+		if (node.count > 0)
+		{
+			for (uint32_t i = node.leftOrFirst; i < node.leftOrFirst + node.count; i++)
+			{
+				if (m_entries[i].Overlaps(bounds))
+				{
+					pOutProxyIndices->push_back(m_entries[i].proxyIndex);
+				}
+			}
+			continue;
+		}
+
+		stack[stackSize++] = node.leftOrFirst;
+		stack[stackSize++] = node.leftOrFirst + 1;
+	}
+}
+
+/**
+ * @brief ƌvfO̐ߓ_珇ɒׂ
+ *
+ * ߂̎qHAcallback Ԃő勗艜̐ߓ_ׂ͒ȂB
+ * ł߂Փ˂KvȂAՓ˂ԂΑɑł؂
+ *
+ * @param[in] origin		̎n_
+ * @param[in] direction		̌iKς݁j
+ * @param[in] maxDistance	ő勗
+ * @param[in] callback		E{bNXƌvfƂɌĂԊ֐iXV̍ő勗Ԃj
+ */
+void StaticColliderBVH::Raycast(
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	const std::function<float(uint32_t proxyIndex, float maxDistance)>& callback) const
+{
+	using namespace DirectX::SimpleMath;
+
+	// EȂvf͋ōi荞߂Ȃ
+	for (const auto& entry : m_unboundedEntries)
+	{
+		maxDistance = callback(entry.proxyIndex, maxDistance);
+	}
+
+	if (m_nodes.empty()) return;
+
+	// 0 Z͖ƂĈi̎̔Ƃ͕sj
+	const Vector3 inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+	uint32_t stack[MAX_DEPTH + 1];
+	int stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const Node& node = m_nodes[stack[--stackSize]];
+
+		float enterDistance = 0.0f;
+
+		// ς񂾌ɍő勗kłꍇ邽ߎoɂׂ
+		if (!IntersectRayBounds(origin, inverseDirection, node.min, node.max, maxDistance, &enterDistance)) continue;
+
+		// tȂvf𒲂ׂ
+		if (node.count > 0)
+		{
+			for (uint32_t i = node.leftOrFirst; i < node.leftOrFirst + node.count; i++)
+			{
+				float entryDistance = 0.0f;
+				if (IntersectRayBounds(origin, inverseDirection, m_entries[i].min, m_entries[i].max, maxDistance, &entryDistance))
+				{
+					maxDistance = callback(m_entries[i].proxyIndex, maxDistance);
+				}
+			}
+			continue;
+		}
+
+		// ߂̎qɐςŐɒׂ
+		float leftDistance = 0.0f;
+		float rightDistance = 0.0f;
+		const bool isLeftHit = IntersectRayBounds(origin, inverseDirection, m_nodes[node.leftOrFirst].min, m_nodes[node.leftOrFirst].max, maxDistance, &leftDistance);
+		const bool isRightHit = IntersectRayBounds(origin, inverseDirection, m_nodes[node.leftOrFirst + 1].min, m_nodes[node.leftOrFirst + 1].max, maxDistance, &rightDistance);
+
+		if (isLeftHit && isRightHit)
+		{
+			const bool isLeftNear = leftDistance <= rightDistance;
+			stack[stackSize++] = isLeftNear ? node.leftOrFirst + 1 : node.leftOrFirst;
+			stack[stackSize++] = isLeftNear ? node.leftOrFirst : node.leftOrFirst + 1;
+		}
+		else if (isLeftHit)
+		{
+			stack[stackSize++] = node.leftOrFirst;
+		}
+		else if (isRightHit)
+		{
+			stack[stackSize++] = node.leftOrFirst + 1;
+		}
+	}
+}
+
+/**
+ * @brief 폜
+ */
+void StaticColliderBVH::Clear()
+{
+	m_nodes.clear();
+	m_entries.clear();
+	m_unboundedEntries.clear();
+}
+
+/**
+ * @brief ߓ_̋E{bNXXV
+ *
+ * @param[in] nodeIndex ߓ_̔ԍ
+ */
+void StaticColliderBVH::UpdateNodeBounds(uint32_t nodeIndex)
+{
+	using namespace DirectX::SimpleMath;
+
+	Node& node = m_nodes[nodeIndex];
+	node.min = Vector3(FLT_MAX);
+	node.max = Vector3(-FLT_MAX);
+
+	for (uint32_t i = node.leftOrFirst; i < node.leftOrFirst + node.count; i++)
+	{
+		node.min = Vector3::Min(node.min, m_entries[i].min);
+		node.max = Vector3::Max(node.max, m_entries[i].max);
+	}
+}
+
+/**
+ * @brief ߓ_𕪊
+ *
+ * dSrɐU蕪A (vf ~ \ʐ) ̘aŏɂȂʒuŕ
+ *
+ * @param[in] nodeIndex ߓ_̔ԍ
+ * @param[in] depth		ߓ_̐[
+ */
+void StaticColliderBVH::Subdivide(uint32_t nodeIndex, int depth)
+{
+	using namespace DirectX::SimpleMath;
+
+	const uint32_t first = m_nodes[nodeIndex].leftOrFirst;
+	const uint32_t count = m_nodes[nodeIndex].count;
+
+	if (count <= MAX_LEAF_SIZE || depth >= MAX_DEPTH) return;
+
+	// dS͈̔͂߂
+	auto centroid = [&](uint32_t i) { return (m_entries[i].min + m_entries[i].max) * 0.5f; };
+
+	Vector3 centroidMin(FLT_MAX);
+	Vector3 centroidMax(-FLT_MAX);
+	for (uint32_t i = first; i < first + count; i++)
+	{
+		centroidMin = Vector3::Min(centroidMin, centroid(i));
+		centroidMax = Vector3::Max(centroidMax, centroid(i));
+	}
+
+	// r
+	struct Bin
+	{
+		Vector3 min = Vector3(FLT_MAX);
+		Vector3 max = Vector3(-FLT_MAX);
+		uint32_t count = 0;
+	};
+
+	int bestAxis = -1;
+	int bestSplit = 0;
+	float bestCost = FLT_MAX;
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		const float axisMin = (&centroidMin.x)[axis];
+		const float extent = (&centroidMax.x)[axis] - axisMin;
+		if (extent <= 0.0f) continue;
+
+		const float scale = BIN_NUM / extent;
+
+		Bin bins[BIN_NUM];
+		for (uint32_t i = first; i < first + count; i++)
+		{
+			const Vector3 center = centroid(i);
+			int binIndex = std::min(BIN_NUM - 1, static_cast<int>(((&center.x)[axis] - axisMin) * scale));
+			bins[binIndex].count++;
+			bins[binIndex].min = Vector3::Min(bins[binIndex].min, m_entries[i].min);
+			bins[binIndex].max = Vector3::Max(bins[binIndex].max, m_entries[i].max);
+		}
+
+		// Eݐς\ʐςƗvf
+		float		leftArea[BIN_NUM - 1];
+		float		rightArea[BIN_NUM - 1];
+		uint32_t	leftCount[BIN_NUM - 1];
+		uint32_t	rightCount[BIN_NUM - 1];
+
+		Bin leftBox;
+		Bin rightBox;
+		for (int i = 0; i < BIN_NUM - 1; i++)
+		{
+			leftBox.count += bins[i].count;
+			leftBox.min = Vector3::Min(leftBox.min, bins[i].min);
+			leftBox.max = Vector3::Max(leftBox.max, bins[i].max);
+			leftCount[i] = leftBox.count;
+			leftArea[i] = (leftBox.count > 0) ? CalcHalfArea(leftBox.min, leftBox.max) : 0.0f;
+
+			const int j = BIN_NUM - 1 - i;
+			rightBox.count += bins[j].count;
+			rightBox.min = Vector3::Min(rightBox.min, bins[j].min);
+			rightBox.max = Vector3::Max(rightBox.max, bins[j].max);
+			rightCount[j - 1] = rightBox.count;
+			rightArea[j - 1] = (rightBox.count > 0) ? CalcHalfArea(rightBox.min, rightBox.max) : 0.0f;
+		}
+
+		// ʒu̕]
+		for (int i = 0; i < BIN_NUM - 1; i++)
+		{
+			if (leftCount[i] == 0 || rightCount[i] == 0) continue;
+
+			float cost = leftCount[i] * leftArea[i] + rightCount[i] * rightArea[i];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = i + 1;
+			}
+		}
+	}
+
+	// ȂΗt̂܂܂ɂ
+	const float leafCost = count * CalcHalfArea(m_nodes[nodeIndex].min, m_nodes[nodeIndex].max);
+	if (bestAxis < 0 || bestCost >= leafCost) return;
+
+	// ʒuŗvfבւ
+	const float axisMin = (&centroidMin.x)[bestAxis];
+	const float scale = BIN_NUM / ((&centroidMax.x)[bestAxis] - axisMin);
+	auto middle = std::partition(m_entries.begin() + first, m_entries.begin() + first + count, [&](const BroadCollision& entry)
+		{
+			float center = ((&entry.min.x)[bestAxis] + (&entry.max.x)[bestAxis]) * 0.5f;
+			int binIndex = std::min(BIN_NUM - 1, static_cast<int>((center - axisMin) * scale));
+			return binIndex < bestSplit;
+		});
+
+	const uint32_t leftCountTotal = static_cast<uint32_t>(middle - m_entries.begin()) - first;
+	if (leftCountTotal == 0 || leftCountTotal == count) return;
+
+	// q̍쐬
+	const uint32_t leftIndex = static_cast<uint32_t>(m_nodes.size());
+
+	Node left{};
+	left.leftOrFirst = first;
+	left.count = leftCountTotal;
+	m_nodes.push_back(left);
+
+	Node right{};
+	right.leftOrFirst = first + leftCountTotal;
+	right.count = count - leftCountTotal;
+	m_nodes.push_back(right);
+
+	m_nodes[nodeIndex].leftOrFirst = leftIndex;
+	m_nodes[nodeIndex].count = 0;
+
+	UpdateNodeBounds(leftIndex);
+	UpdateNodeBounds(leftIndex + 1);
+
+	Subdivide(leftIndex, depth + 1);
+	Subdivide(leftIndex + 1, depth + 1);
+}
+
+/**
+ * @brief ƋE{bNX̌߂iXu@j
+ *
+ * @param[in]  origin				̎n_
+ * @param[in]  inverseDirection		̌̋t
+ * @param[in]  min					E{bNX̍ŏ_
+ * @param[in]  max					E{bNX̍ő_
+ * @param[in]  maxDistance			ő勗
+ * @param[out] pOutEnterDistance	E{bNXɓ鋗in_Ȃ 0j
+ *
+ * @returns true  Ă
+ * @returns false ĂȂ
+ */
+bool StaticColliderBVH::IntersectRayBounds(
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& inverseDirection,
+	const DirectX::SimpleMath::Vector3& min,
+	const DirectX::SimpleMath::Vector3& max,
+	float maxDistance,
+	float* pOutEnterDistance)
+{
+	float enter = 0.0f;
+	float exit = maxDistance;
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		const float o = (&origin.x)[axis];
+		const float inverse = (&inverseDirection.x)[axis];
+
+		float t1 = ((&min.x)[axis] - o) * inverse;
+		float t2 = ((&max.x)[axis] - o) * inverse;
+
+		// sŔ̊Oɂꍇ t1, t2 ̖ɂȂA̔rŒe
+		// ̖ʏɂꍇ NaN ɂȂ邽߁A̎͐Ȃ
+		if (t1 != t1 || t2 != t2) continue;
+
+		if (t1 > t2) std::swap(t1, t2);
+
+		enter = std::max(enter, t1);
+		exit = std::min(exit, t2);
+		if (enter > exit) return false;
+	}
+
+	*pOutEnterDistance = enter;
+	return true;
+}
+
+/**
+ * @brief \ʐς̔߂
+ *
+ * @param[in] min ŏ_
+ * @param[in] max ő_
+ *
+ * @return \ʐς̔
+ */
+float StaticColliderBVH::CalcHalfArea(const DirectX::SimpleMath::Vector3& min, const DirectX::SimpleMath::Vector3& max)
+{
+	DirectX::SimpleMath::Vector3 extent = max - min;
+	return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
@@ -0,0 +1,127 @@
+/*****************************************************************//**
+ * @file    StaticColliderBVH.h
+ * @brief   ÓIRC_[̋E{[KwɊւwb_[t@C
+ *
+ * ȂRC_[ɑ΂Ĉx\zAȌ͎QƂ̂ݍs
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+#include <functional>
+
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionTypes/CollisionTypes.h"
+
+
+// NX̑O錾 ===================================================
+
+// NX̒` ===============================================================
+/**
+ * @brief ÓIRC_[̋E{[KwiBVHj
+ *
+ * r\ʐσq[XeBbNiSAHjō\zB\z͕ύXȂ߁A
+ * Xbh瓯 Query ĂяoĂ悢
+ */
+class StaticColliderBVH
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr int		BIN_NUM			= 12;	///< SAH]Ɏgpr̐
+	static constexpr uint32_t	MAX_LEAF_SIZE	= 4;	///< tɊi[vf̍ő吔
+	static constexpr int		MAX_DEPTH		= 64;	///< TpX^bN̐[
+
+// \̂̐錾
+private:
+
+	/**
+	 * @brief ߓ_
+	 */
+	struct Node
+	{
+		DirectX::SimpleMath::Vector3 min;	///< E{bNX̍ŏ_
+		DirectX::SimpleMath::Vector3 max;	///< E{bNX̍ő_
+		uint32_t leftOrFirst;				///< tȂŏ̗vfԍA߂Ȃ獶̎q̔ԍiE̎q +1j
+		uint32_t count;						///< t̗vfi0Ȃ߁j
+	};
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	std::vector<Node>			m_nodes;			///< ߓ_i0Ԃj
+	std::vector<BroadCollision>	m_entries;			///< t̏ɕׂvf
+	std::vector<BroadCollision>	m_unboundedEntries;	///< EȂvfiɌƂj
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	StaticColliderBVH();
+
+	// fXgN^
+	~StaticColliderBVH();
+
+
+// 
+public:
+	// \z
+	void Build(const std::vector<BroadCollision>& entries);
+
+	// E{bNXƏdȂvf̃vLVԍ擾
+	void Query(const BroadCollision& bounds, std::vector<uint32_t>* pOutProxyIndices) const;
+
+	// ƌvfO̐ߓ_珇ɒׂicallback ͍XV̍ő勗Ԃj
+	void Raycast(
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		const std::function<float(uint32_t proxyIndex, float maxDistance)>& callback) const;
+
+	// 폜
+	void Clear();
+
+
+// 擾/ݒ
+public:
+	// ߓ_̐̎擾
+	size_t GetNodeCount() const { return m_nodes.size(); }
+	// vf̐̎擾
+	size_t GetEntryCount() const { return m_entries.size() + m_unboundedEntries.size(); }
+	// mۂĂ郁̃oCg̎擾
+	size_t GetAllocatedBytes() const
+	{
+		return	m_nodes.capacity() * sizeof(Node) +
+				(m_entries.capacity() + m_unboundedEntries.capacity()) * sizeof(BroadCollision);
+	}
+
+
+// 
+private:
+
+	// ߓ_̋E{bNXXV
+	void UpdateNodeBounds(uint32_t nodeIndex);
+
+	// ߓ_𕪊
+	void Subdivide(uint32_t nodeIndex, int depth);
+
+	// ƋE{bNX̌߂
+	static bool IntersectRayBounds(
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& inverseDirection,
+		const DirectX::SimpleMath::Vector3& min,
+		const DirectX::SimpleMath::Vector3& max,
+		float maxDistance,
+		float* pOutEnterDistance);
+
+	// \ʐς̔߂
+	static float CalcHalfArea(const DirectX::SimpleMath::Vector3& min, const DirectX::SimpleMath::Vector3& max);
+};
@@ -0,0 +1,123 @@
+/*****************************************************************//**
+ * @file    SweepAndPruneBroadPhase.cpp
+ * @brief   |Ɗ荞݁iSweep and PrunejɂL攻Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "SweepAndPruneBroadPhase.h"
+
+#include <numeric>
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * @param[in] Ȃ
+ */
+SweepAndPruneBroadPhase::SweepAndPruneBroadPhase()
+	: m_sortedEntries{}
+	, m_sortAxis{ 0 }
+{
+
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+SweepAndPruneBroadPhase::~SweepAndPruneBroadPhase()
+{
+
+}
+
+/**
+ * @brief E{bNXdȂyA̎Zo
+ *
+ * @param[in]  entries	 Ef[^Q
+ * @param[out] pOutPairs yA
+ */
+void SweepAndPruneBroadPhase::ComputePairs(const std::vector<BroadCollision>& entries, std::vector<BroadPhasePair>* pOutPairs)
+{
+	pOutPairs->clear();
+
+	if (entries.size() < 2) return;
+
+	// Ԃ̎n_EI_ƂɎo
+	m_sortAxis = SelectSortAxis(entries);
+	auto axisMin = [&](const BroadCollision& entry) { return (entry.isUnbounded) ? -FLT_MAX : (&entry.min.x)[m_sortAxis]; };
+	auto axisMax = [&](const BroadCollision& entry) { return (entry.isUnbounded) ?  FLT_MAX : (&entry.max.x)[m_sortAxis]; };
+
+	// Ԃ̎n_ŕבւ
+	m_sortedEntries.resize(entries.size());
+	std::iota(m_sortedEntries.begin(), m_sortedEntries.end(), 0u);
+	std::sort(m_sortedEntries.begin(), m_sortedEntries.end(), [&](uint32_t a, uint32_t b)
+		{
+			return axisMin(entries[a]) < axisMin(entries[b]);
+		});
+
+	// |
+	for (size_t i = 0; i < m_sortedEntries.size(); i++)
+	{
+		const BroadCollision& entryA = entries[m_sortedEntries[i]];
+		const float maxA = axisMax(entryA);
+
+		for (size_t j = i + 1; j < m_sortedEntries.size(); j++)
+		{
+			const BroadCollision& entryB = entries[m_sortedEntries[j]];
+
+			// ȍ~̋Ԃ͑SĎn_I_ɂ̂őł؂
+			if (axisMin(entryB) > maxA) break;
+
+			// c̎܂߂ďdȂĂΌƂ
+			if (entryA.Overlaps(entryB))
+			{
+				pOutPairs->emplace_back(entryA.proxyIndex, entryB.proxyIndex);
+			}
+		}
+	}
+}
+
+/**
+ * @brief בւɎgp鎲̑I
+ *
+ * E{bNX̒SłU΂Ă鎲IԂƂŁAԂ̏dȂȂ
+ *
+ * @param[in] entries Ef[^Q
+ *
+ * @return ԍi0:x 1:y 2:zj
+ */
+int SweepAndPruneBroadPhase::SelectSortAxis(const std::vector<BroadCollision>& entries) const
+{
+	using namespace DirectX::SimpleMath;
+
+	Vector3 sum = Vector3::Zero;
+	Vector3 sumSq = Vector3::Zero;
+	float count = 0.0f;
+
+	for (const auto& entry : entries)
+	{
+		if (entry.isUnbounded) continue;
+
+		Vector3 center = (entry.min + entry.max) * 0.5f;
+		sum += center;
+		sumSq += center * center;
+		count += 1.0f;
+	}
+
+	if (count <= 0.0f) return m_sortAxis;
+
+	// U̎Zo
+	Vector3 mean = sum / count;
+	Vector3 variance = sumSq / count - mean * mean;
+
+	if (variance.x >= variance.y && variance.x >= variance.z) return 0;
+	if (variance.y >= variance.z) return 1;
+	return 2;
+}
@@ -0,0 +1,63 @@
+/*****************************************************************//**
+ * @file    SweepAndPruneBroadPhase.h
+ * @brief   |Ɗ荞݁iSweep and PrunejɂL攻Ɋւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include "Game/Common/Framework/Collision/BroadPhase/IBroadPhase.h"
+
+
+// NX̑O錾 ===================================================
+
+// NX̒` ===============================================================
+/**
+ * @brief |Ɗ荞݂ɂL攻
+ *
+ * E{bNX̋ԂłU΂Ă鎲ŕבւAԂdȂ͈͂𑖍
+ */
+class SweepAndPruneBroadPhase
+	: public IBroadPhase
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	std::vector<uint32_t>	m_sortedEntries;	///< Ԃ̎n_ŕבւvfԍ
+	int						m_sortAxis;			///< בւɎgp鎲i0:x 1:y 2:zj
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	SweepAndPruneBroadPhase();
+
+	// fXgN^
+	~SweepAndPruneBroadPhase() override;
+
+
+// 
+public:
+	// E{bNXdȂyA̎Zo
+	void ComputePairs(const std::vector<BroadCollision>& entries, std::vector<BroadPhasePair>* pOutPairs) override;
+
+
+// 
+private:
+
+	// בւɎgp鎲̑I
+	int SelectSortAxis(const std::vector<BroadCollision>& entries) const;
+};
@@ -27,6 +27,106 @@
 // OtBbN֘A
 
 
+// \̒` ===============================================================
+namespace
+{
+	using DetectFunction = CollisionDispatcher::DetectFunction;
+	constexpr int TYPE_NUM = CollisionDispatcher::COLLIDER_TYPE_NUM;
+
+	/**
+	 * @brief ނm肵i\1vfj
+	 *
+	 * ނ͕\̓YŊm肵Ă邽 static_cast ōςށB
+	 * isSwapped Ȃւ IsHit Ăԁit̑gݍ킹pj
+	 */
+	template <typename ColliderA, typename ColliderB, bool isSwapped>
+	bool DetectTyped(const ICollider* pColliderA, const ICollider* pColliderB)
+	{
+		if constexpr (isSwapped)
+		{
+			return IsHit(*static_cast<const ColliderA*>(pColliderB), *static_cast<const ColliderB*>(pColliderA));
+		}
+		else
+		{
+			return IsHit(*static_cast<const ColliderA*>(pColliderA), *static_cast<const ColliderB*>(pColliderB));
+		}
+	}
+
+	/**
+	 * @brief Ή̑gݍ킹iɓȂj
+	 */
+	bool DetectNothing(const ICollider*, const ICollider*)
+	{
+		return false;
+	}
+
+	/**
+	 * @brief \
+	 */
+	struct DispatchTable
+	{
+		DetectFunction functions[TYPE_NUM][TYPE_NUM];	///< ֐
+		bool isSupported[TYPE_NUM][TYPE_NUM];			///< łgݍ킹ǂ
+
+		/**
+		 * @brief gݍ킹̓o^itɓo^j
+		 */
+		template <typename ColliderA, typename ColliderB>
+		constexpr void Register(ColliderType typeA, ColliderType typeB)
+		{
+			const int a = static_cast<int>(typeA);
+			const int b = static_cast<int>(typeB);
+
+			functions[a][b] = &DetectTyped<ColliderA, ColliderB, false>;
+			isSupported[a][b] = true;
+
+			if (a != b)
+			{
+				functions[b][a] = &DetectTyped<ColliderA, ColliderB, true>;
+				isSupported[b][a] = true;
+			}
+		}
+	};
+
+	/**
+	 * @brief \̍쐬
+	 *
+	 * gݍ킹Ƃ IsHit 1o^Bt͎Ŗ܂Ac͉Ȃ֐ɂȂ
+	 */
+	constexpr DispatchTable CreateDispatchTable()
+	{
+		DispatchTable table{};
+		for (int a = 0; a < TYPE_NUM; a++)
+		{
+			for (int b = 0; b < TYPE_NUM; b++)
+			{
+				table.functions[a][b] = &DetectNothing;
+				table.isSupported[a][b] = false;
+			}
+		}
+
+		table.Register<Plane,		Sphere	>(ColliderType::Plane,		ColliderType::Sphere);
+		table.Register<Plane,		Segment	>(ColliderType::Plane,		ColliderType::Segment);
+		table.Register<Sphere,		Sphere	>(ColliderType::Sphere,		ColliderType::Sphere);
+		table.Register<Sphere,		Triangle>(ColliderType::Sphere,		ColliderType::Triangle);
+		table.Register<Segment,		Sphere	>(ColliderType::Segment,	ColliderType::Sphere);
+		table.Register<Triangle,	Segment	>(ColliderType::Triangle,	ColliderType::Segment);
+		table.Register<Box2D,		Sphere	>(ColliderType::BOX2D,		ColliderType::Sphere);
+		table.Register<Box2D,		Segment	>(ColliderType::BOX2D,		ColliderType::Segment);
+		table.Register<AABB,		AABB	>(ColliderType::AABB,		ColliderType::AABB);
+		table.Register<AABB,		Sphere	>(ColliderType::AABB,		ColliderType::Sphere);
+		table.Register<AABB,		Segment	>(ColliderType::AABB,		ColliderType::Segment);
+		table.Register<Cylinder,	AABB	>(ColliderType::Cylinder,	ColliderType::AABB);
+		table.Register<Capsule,		AABB	>(ColliderType::Capsule,	ColliderType::AABB);
+		table.Register<Capsule,		Sphere	>(ColliderType::Capsule,	ColliderType::Sphere);
+
+		return table;
+	}
+
+	constexpr DispatchTable DISPATCH_TABLE = CreateDispatchTable();	///< \
+}
+
+
 // o֐̒` ===========================================================
 /**
  * @brief RXgN^
@@ -52,6 +152,8 @@ CollisionDispatcher::~CollisionDispatcher()
 /**
  * @brief Փ˔
  *
+ * ނ̑gݍ킹ŕ\ŁARTTI ̘AgȂ
+ *
  * @param[in] pColliderA RC_[A
  * @param[in] pColliderB RC_[B
  *
@@ -59,337 +161,21 @@ CollisionDispatcher::~CollisionDispatcher()
  */
 bool CollisionDispatcher::DetectCollision(const ICollider* pColliderA, const ICollider* pColliderB)
 {
-	// RC_[̎ނʂȂ
-	if (pColliderA->GetColliderType() == ColliderType::Plane)
-	{
-		// ʂɃLXg
-		const Plane* pPlane = dynamic_cast<const Plane*>(pColliderA);
-		if (pPlane == nullptr) return false;
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Sphere)
-		{
-			// ɃLXg
-			const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
-			if (pSphere == nullptr) return false;
-
-			return (pPlane->CheckHit(*pSphere));
-
-		}
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Segment)
-		{
-			// ɃLXg
-			const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
-			if (pSegment == nullptr) return false;
-
-			return (pPlane->CheckHit(*pSegment));
-
-		}
-	}
-
-	// RC_[̎ނȂ
-	if (pColliderA->GetColliderType() == ColliderType::Sphere)
-	{
-		// ʂɃLXg
-		const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderA);
-		if (pSphere == nullptr) return false;
-
-		// Е̃RC_[̎ނʂȂ
-		if (pColliderB->GetColliderType() == ColliderType::Plane)
-		{
-			// ɃLXg
-			const Plane* pPlane = dynamic_cast<const Plane*>(pColliderB);
-			if (pPlane == nullptr) return false;
-
-			return (pSphere->CheckHit(*pPlane));
-
-		}
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Segment)
-		{
-			// ɃLXg
-			const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
-			if (pSegment == nullptr) return false;
-
-			return (pSphere->CheckHit(*pSegment));
-		}
-		// Е̃RC_[̎ނOp`Ȃ
-		if (pColliderB->GetColliderType() == ColliderType::Triangle)
-		{
-			// ɃLXg
-			const Triangle* pTriangle = dynamic_cast<const Triangle*>(pColliderB);
-			if (pTriangle == nullptr) return false;
-
-			return (pSphere->CheckHit(*pTriangle));
-		}
-
-		// Е̃RC_[̎ނOp`Ȃ
-		if (pColliderB->GetColliderType() == ColliderType::BOX2D)
-		{
-			// ɃLXg
-			const Box2D* pBox = dynamic_cast<const Box2D*>(pColliderB);
-			if (pBox == nullptr) return false;
-
-			return (pSphere->CheckHit(*pBox));
-		}
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Sphere)
-		{
-			// ɃLXg
-			const Sphere* pSphereB = dynamic_cast<const Sphere*>(pColliderB);
-			if (pSphereB == nullptr) return false;
-
-			return (pSphere->CheckHit(*pSphereB));
-		}
-
-		// Е̃RC_[AABBȂ
-		if (pColliderB->GetColliderType() == ColliderType::AABB)
-		{
-			// AABBɃLXg
-			const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
-			if (pAABB == nullptr) return false;
-
-			return (pSphere->CheckHit(*pAABB));
-		}
-		// Е̃RC_[̃JvZȂ
-		if (pColliderB->GetColliderType() == ColliderType::Capsule)
-		{
-			// CapsuleɃLXg
-			const Capsule* pCapsule = dynamic_cast<const Capsule*>(pColliderB);
-			if (pCapsule == nullptr) return false;
-
-			return (pSphere->CheckHit(*pCapsule));
-		}
-	}
-
-	// RC_[̎ނOp`Ȃ
-	if (pColliderA->GetColliderType() == ColliderType::Triangle)
-	{
-		// Op`ɃLXg
-		const Triangle* pTriangle = dynamic_cast<const Triangle*>(pColliderA);
-		if (pTriangle == nullptr) return false;
-
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Sphere)
-		{
-			// ɃLXg
-			const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
-			if (pSphere == nullptr) return false;
-
-			return (pTriangle->CheckHit(*pSphere));
-
-		}
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Segment)
-		{
-			// ɃLXg
-			const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
-			if (pSegment == nullptr) return false;
-
-			return (pTriangle->CheckHit(*pSegment));
-
-		}
-	}
-
-	// RC_[̎ނlp`Ȃ
-	if (pColliderA->GetColliderType() == ColliderType::BOX2D)
-	{
-		// Op`ɃLXg
-		const Box2D* pBox = dynamic_cast<const Box2D*>(pColliderA);
-		if (pBox == nullptr) return false;
-
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Sphere)
-		{
-			// ɃLXg
-			const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
-			if (pSphere == nullptr) return false;
-
-			return (pBox->CheckHit(*pSphere));
+	const int typeA = static_cast<int>(pColliderA->GetColliderType());
+	const int typeB = static_cast<int>(pColliderB->GetColliderType());
 
-		}
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Segment)
-		{
-			// ɃLXg
-			const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
-			if (pSegment == nullptr) return false;
-
-			return (pBox->CheckHit(*pSegment));
-
-		}
-	}
-
-	// RC_[̎ނȂ
-	if (pColliderA->GetColliderType() == ColliderType::Segment)
-	{
-		// Op`ɃLXg
-		const Segment* pSegment = dynamic_cast<const Segment*>(pColliderA);
-		if (pSegment == nullptr) return false;
-
-
-		// Е̃RC_[̎ނʂȂ
-		if (pColliderB->GetColliderType() == ColliderType::Plane)
-		{
-			// ɃLXg
-			const Plane* pPlane = dynamic_cast<const Plane*>(pColliderB);
-			if (pPlane == nullptr) return false;
-
-			return (pSegment->CheckHit(*pPlane));
-
-		}
-
-
-		// Е̃RC_[̎ނOp`Ȃ
-		if (pColliderB->GetColliderType() == ColliderType::Triangle)
-		{
-			// ɃLXg
-			const Triangle* pTriangle = dynamic_cast<const Triangle*>(pColliderB);
-			if (pTriangle == nullptr) return false;
-
-			return (pSegment->CheckHit(*pTriangle));
-		}
-
-		// Е̃RC_[̎ނlp`Ȃ
-		if (pColliderB->GetColliderType() == ColliderType::BOX2D)
-		{
-			// ɃLXg
-			const Box2D* pBox = dynamic_cast<const Box2D*>(pColliderB);
-			if (pBox == nullptr) return false;
-
-			return (pSegment->CheckHit(*pBox));
-		}
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Sphere)
-		{
-			// ɃLXg
-			const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
-			if (pSphere == nullptr) return false;
-
-			return (pSegment->CheckHit(*pSphere));
-		}
-
-
-		// Е̃RC_[AABBȂ
-		if (pColliderB->GetColliderType() == ColliderType::AABB)
-		{
-			// AABBɃLXg
-			const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
-			if (pAABB == nullptr) return false;
-
-			return (pSegment->CheckHit(*pAABB));
-		}
-
-	}
-
-	// RC_[̎ނAABBȂ
-	if (pColliderA->GetColliderType() == ColliderType::AABB)
-	{	// AABBɃLXg
-		const AABB* pAABB = dynamic_cast<const AABB*>(pColliderA);
-
-		// Е̃RC_[AABBȂ
-		if (pColliderB->GetColliderType() == ColliderType::AABB)
-		{
-			// AABBɃLXg
-			const AABB* pAABB_B = dynamic_cast<const AABB*>(pColliderB);
-			if (pAABB_B == nullptr) return false;
-
-			return (pAABB->CheckHit(*pAABB_B));
-		}
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Segment)
-		{
-			// ɃLXg
-			const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
-			if (pSegment == nullptr) return false;
-
-			return (pAABB->CheckHit(*pSegment));
-
-		}
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Sphere)
-		{
-			// ɃLXg
-			const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
-			if (pSphere == nullptr) return false;
-
-			return (pAABB->CheckHit(*pSphere));
-
-		}
-
-		// Е̃RC_[̎ނȂ
-		if (pColliderB->GetColliderType() == ColliderType::Cylinder)
-		{
-			// ɃLXg
-			const Cylinder* pCylinder = dynamic_cast<const Cylinder*>(pColliderB);
-			if (pCylinder == nullptr) return false;
-
-			return (pAABB->CheckHit(*pCylinder));
-
-		}
-
-		// Е̃RC_[̎ނJvZȂ
-		if (pColliderB->GetColliderType() == ColliderType::Capsule)
-		{
-			// JvZɃLXg
-			const Capsule* pCapsule = dynamic_cast<const Capsule*>(pColliderB);
-			if (pCapsule == nullptr) return false;
-
-			return (pAABB->CheckHit(*pCapsule));
-
-		}
-	}
-
-	// RC_[̎ނȂ
-	if (pColliderA->GetColliderType() == ColliderType::Cylinder)
-	{	// AABBɃLXg
-		const Cylinder* pCylinder = dynamic_cast<const Cylinder*>(pColliderA);
-
-		// Е̃RC_[AABBȂ
-		if (pColliderB->GetColliderType() == ColliderType::AABB)
-		{
-			// AABBɃLXg
-			const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
-			if (pAABB == nullptr) return false;
-
-			return (pAABB->CheckHit(*pCylinder));
-		}
-	}
-
-	// RC_[̎ނJvZȂ
-	if (pColliderA->GetColliderType() == ColliderType::Capsule)
-	{	// AABBɃLXg
-		const Capsule* pCapsule = dynamic_cast<const Capsule*>(pColliderA);
-
-		// Е̃RC_[SphereȂ
-		if (pColliderB->GetColliderType() == ColliderType::Sphere)
-		{
-			// SphereɃLXg
-			const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
-			if (pSphere == nullptr) return false;
-
-			return (pSphere->CheckHit(*pCapsule));
-		}
-
-		// Е̃RC_[AABBȂ
-		if (pColliderB->GetColliderType() == ColliderType::AABB)
-		{
-			// AABBɃLXg
-			const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
-			if (pAABB == nullptr) return false;
-
-			return (pAABB->CheckHit(*pCapsule));
-		}
-	}
+	return DISPATCH_TABLE.functions[typeA][typeB](pColliderA, pColliderB);
+}
 
-	return false;
+/**
+ * @brief łgݍ킹ǂ
+ *
+ * @param[in] typeA RC_[A̎
+ * @param[in] typeB RC_[B̎
+ *
+ * @return true ł
+ */
+bool CollisionDispatcher::IsSupported(ColliderType typeA, ColliderType typeB)
+{
+	return DISPATCH_TABLE.isSupported[static_cast<int>(typeA)][static_cast<int>(typeB)];
 }
@@ -13,6 +13,9 @@
 
 
 // wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
+
+#include "Game/Common/Utillities/Collision/ICollider.h"
 
 
 // NX̑O錾 ===================================================
@@ -21,13 +24,22 @@ class ICollider;// 
 // NX̒` ===============================================================
 /**
  * @brief RC_[Ƃ̏Փ˔NX
+ *
+ * RC_[̎ނ̑gݍ킹Ƃɔ֐\ɕׁA2̓YŐU蕪B
+ * \͋NɈx쐬At̑gݍ킹ƖΉ̑gݍ킹̎ɖ߂
  */
 class CollisionDispatcher
 {
 // NX萔̐錾 -------------------------------------------------
 public:
 
+	static constexpr int COLLIDER_TYPE_NUM = static_cast<int>(ColliderType::Capsule) + 1;	///< RC_[̎ނ̐
+
+// GCAX錾
+public:
 
+	/// ނƂ̔֐
+	using DetectFunction = bool (*)(const ICollider* pColliderA, const ICollider* pColliderB);
 
 // f[^o̐錾 -----------------------------------------------
 private:
@@ -49,4 +61,8 @@ public:
 	
 	// Փ˔
 	static bool DetectCollision(const ICollider* pColliderA, const ICollider* pColliderB);
+
+	// łgݍ킹ǂ
+	static bool IsSupported(ColliderType typeA, ColliderType typeB);
+
 };
@@ -11,11 +11,11 @@
 // wb_t@C̓ǂݍ ===================================================
 #include "pch.h"
 #include "CollisionDetectionWorker.h"
-#include "../../CollisionDispatcher/CollisionDispatcher.h"
 
 // t[[N֘A
 #include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
 #include "Game/Common/Framework/Collision/CollisionMatrix/CollisionMatrix.h"
+#include "Game/Common/Framework/Collision/BroadPhase/SweepAndPruneBroadPhase/SweepAndPruneBroadPhase.h"
 
 // o֐̒` ===========================================================
 /**
@@ -27,8 +27,15 @@ CollisionDetectionWorker::CollisionDetectionWorker()
 	: m_detectionResults{}
 	, m_isCalculating{ false }
 	, m_isReady{ false }
+	, m_threadNum{ std::clamp(std::thread::hardware_concurrency() / 2, 1u, MAX_THREAD_NUM) }
+	, m_helperThreads{}
+	, m_chunks{}
+	, m_poolGeneration{ 0 }
+	, m_pendingChunkNum{ 0 }
+	, m_stopHelpers{ false }
 {
 	m_collisionMatrix = std::make_unique<CollisionMatrix>();
+	m_broadPhase = std::make_unique<SweepAndPruneBroadPhase>();
 }
 
 
@@ -44,28 +51,41 @@ CollisionDetectionWorker::~CollisionDetectionWorker()
 		m_cv.notify_one();
 		m_workerThread->join();
 	}
+
+	StopHelperThreads();
 }
 
 /**
  * @brief 񓯊̊Jn
  * 
- * @param[in] proxies@vLV
+ * @param[in] snapshot	IȃXibvVbg
+ * @param[in] staticSet	ÓIȃXibvVbg̏WiQƂL邾ŕȂj
+ * 
+ * @return O̔ɎgXibvVbgĩt[Ŏg񂷁j
  */
-void CollisionDetectionWorker::StartAsync(std::unique_ptr<std::vector<ThreadCollisionObjectProxy>> proxies)
+std::unique_ptr<CollisionSnapshot> CollisionDetectionWorker::StartAsync(std::unique_ptr<CollisionSnapshot> snapshot, std::shared_ptr<const StaticCollisionSet> staticSet)
 {
 	if (!m_workerThread)
 	{
 		m_workerThread = std::make_unique<std::thread>(&CollisionDetectionWorker::DetectionThreadLoop, this);
 	}
 
+	// ÕXibvVbgQƒɍւȂ悤ɏI҂
+	WaitForEndCalculation();
+
+	std::unique_ptr<CollisionSnapshot> previousSnapshot;
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 		m_detectionResults.clear();
-		m_proxies = std::move(proxies);
+		previousSnapshot = std::move(m_snapshot);
+		m_snapshot = std::move(snapshot);
+		m_staticSet = std::move(staticSet);
 		m_isReady = true;       // d̏
 		m_isCalculating = true; // vZɂ
 	}
 	m_cv.notify_one(); // ҋ@̃Xbh@N
+
+	return previousSnapshot;
 }
 
 /**
@@ -107,6 +127,64 @@ void CollisionDetectionWorker::SetCollisionMatrix(const CollisionMatrix& matrix)
 	*m_collisionMatrix = matrix;
 }
 
+/**
+ * @brief L攻̐ݒ
+ * 
+ * @param[in] broadPhase L攻inullptrȂ瑍j
+ */
+void CollisionDetectionWorker::SetBroadPhase(std::unique_ptr<IBroadPhase> broadPhase)
+{
+	// 蒆ɍւȂ悤ɏI҂
+	WaitForEndCalculation();
+
+	m_broadPhase = std::move(broadPhase);
+}
+
+/**
+ * @brief ڍהɎgXbh̐ݒ
+ * 
+ * XbhςĂ茋ʂƂ͕̏ςȂ
+ * 
+ * @param[in] threadNum XbhiƃXbh܂ށB1 ŕ񉻂Ȃj
+ */
+void CollisionDetectionWorker::SetThreadNum(uint32_t threadNum)
+{
+	// ̔̊JnɎ`Xbh̐낦
+	m_threadNum = std::clamp(threadNum, 1u, MAX_THREAD_NUM);
+}
+
+/**
+ * @brief ÓIȃXibvVbg̏W̍쐬
+ * 
+ * @param[in] staticSnapshot ÓIȃXibvVbg
+ * 
+ * @return E{[Kw\zς݂̏W
+ */
+std::shared_ptr<const StaticCollisionSet> CollisionDetectionWorker::CreateStaticCollisionSet(CollisionSnapshot staticSnapshot)
+{
+	auto staticSet = std::make_shared<StaticCollisionSet>();
+	staticSet->snapshot = std::move(staticSnapshot);
+
+	// [g̋Ef[^̍쐬
+	ColliderScratch scratch;
+	const uint32_t rootNum = staticSet->snapshot.GetRootCount();
+	std::vector<BroadCollision> entries;
+	entries.reserve(rootNum);
+	for (uint32_t i = 0; i < rootNum; i++)
+	{
+		BroadCollision entry;
+		if (CreateBroadCollision(staticSet->snapshot.GetNode(i), i, &scratch, &entry))
+		{
+			entries.push_back(entry);
+		}
+	}
+
+	// Kw̍\z
+	staticSet->bvh.Build(entries);
+
+	return staticSet;
+}
+
 /**
  * @brief mXbh̃[v
  */
@@ -133,24 +211,41 @@ void CollisionDetectionWorker::DetectionThreadLoop()
 			m_isReady = false; // t
 		}
 
-		if (m_proxies->size() >= 2)
-		{
-			for (size_t i = 0; i < m_proxies->size() - 1; i++)
-			{
-				for (size_t j = i + 1; j < m_proxies->size(); j++)
-				{
-					// 1. bN؋CɂA[Jobt@ɂǂǂ񗭂߂
-					CheckDetectionPair((*m_proxies)[i], (*m_proxies)[j], &m_detectionResults);
-
-						m_cv.notify_one();
-					
-				}
-			}
-		}
+#ifdef COLLISIONMANAGER_DEBUG	
+		auto broadPhaseStart = std::chrono::high_resolution_clock::now();
+#endif 
+
+		// L攻ŌyAi荞
+		CollectCandidatePairs();
+
+#ifdef COLLISIONMANAGER_DEBUG	
+		auto broadPhaseDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - broadPhaseStart);
+		size_t rootNum = m_snapshot->GetRootCount() + ((m_staticSet) ? m_staticSet->snapshot.GetRootCount() : 0);
+		size_t bruteForcePairNum = (rootNum * (rootNum - 1)) / 2;
+
+		wchar_t buffer[128];
+		swprintf_s(buffer, L"broad phase : %zu / %zu pairs, %lld us\n", m_candidatePairs.size(), bruteForcePairNum, broadPhaseDuration.count());
+		OutputDebugString(buffer);
+#endif 
+
+#ifdef COLLISIONMANAGER_DEBUG	
+		auto narrowPhaseStart = std::chrono::high_resolution_clock::now();
+#endif 
+
+		// ڍה
+		RunNarrowPhase();
 
-		
+#ifdef COLLISIONMANAGER_DEBUG	
+		auto narrowPhaseDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - narrowPhaseStart);
+
+		swprintf_s(buffer, L"narrow phase : %zu hits, %zu chunks, %u threads, %lld us\n", m_detectionResults.size(), m_chunks.size(), m_threadNum.load(), narrowPhaseDuration.count());
+		OutputDebugString(buffer);
+#endif 
 
-		m_isCalculating = false;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isCalculating = false;
+		}
 
 #ifdef COLLISIONMANAGER_DEBUG	
 		OutputDebugString(L"!!!! Փˏ̏I !!!! \n");
@@ -159,18 +254,307 @@ void CollisionDetectionWorker::DetectionThreadLoop()
 	}
 }
 
+/**
+ * @brief ڍהsyA̎W
+ *
+ * E{bNXdȂȂyAƏՓˑΉ\ŌmȂyAOA
+ * Ɠiʂԍ̏jɕׂB
+ * ÓIȃvLVm݂͌ɓȂߔ肵Ȃ
+ */
+void CollisionDetectionWorker::CollectCandidatePairs()
+{
+	m_broadEntries.clear();
+	m_candidatePairs.clear();
+
+	if (!m_snapshot) return;
+
+	m_broadScratch.Reset();
+
+	const uint32_t dynamicNum = m_snapshot->GetRootCount();
+
+	// Iȃ[g̋Ef[^̍쐬
+	for (uint32_t i = 0; i < dynamicNum; i++)
+	{
+		BroadCollision entry;
+		if (CreateBroadCollision(m_snapshot->GetNode(i), i, &m_broadScratch, &entry))
+		{
+			m_broadEntries.push_back(entry);
+		}
+	}
+
+	// IȃvLVmE{bNX̏dȂōi荞
+	if (m_broadPhase)
+	{
+		m_broadPhase->ComputePairs(m_broadEntries, &m_candidatePairs);
+	}
+	else
+	{
+		// L攻肪ꍇ͑
+		for (size_t i = 0; i < m_broadEntries.size(); i++)
+		{
+			for (size_t j = i + 1; j < m_broadEntries.size(); j++)
+			{
+				m_candidatePairs.emplace_back(m_broadEntries[i].proxyIndex, m_broadEntries[j].proxyIndex);
+			}
+		}
+	}
+
+	// IȃvLVƐÓIȃvLV͊Kwči荞
+	if (m_staticSet)
+	{
+		for (const auto& entry : m_broadEntries)
+		{
+			m_staticHits.clear();
+			m_staticSet->bvh.Query(entry, &m_staticHits);
+
+			for (uint32_t staticIndex : m_staticHits)
+			{
+				m_candidatePairs.emplace_back(entry.proxyIndex, dynamicNum + staticIndex);
+			}
+		}
+	}
+
+	// f[^mƁAՓˑΉ\ŌmȂyAO
+	m_candidatePairs.erase(
+		std::remove_if(m_candidatePairs.begin(), m_candidatePairs.end(), [&](const BroadPhasePair& pair)
+			{
+				const CollisionSnapshotNode& rootA = GetRoot(pair.indexA);
+				const CollisionSnapshotNode& rootB = GetRoot(pair.indexB);
+				return (rootA.id == rootB.id) || !CanDetect(rootA, rootB);
+			}),
+		m_candidatePairs.end());
+
+	// ƓŔ肷邽߂ɕבւ
+	std::sort(m_candidatePairs.begin(), m_candidatePairs.end());
+}
+
+/**
+ * @brief ڍה
+ *
+ * בւς݂̌yAA͈͂ɕĊeXbhɊ蓖āA
+ * ͈͂̏ɌʂȂB̂߃XbhɊւ炸ʂ̏͑ƓɂȂ
+ */
+void CollisionDetectionWorker::RunNarrowPhase()
+{
+	const uint32_t threadNum = m_threadNum;
+	ResizeHelperThreads(threadNum - 1);
+
+	// yAȂΎgXbh炷
+	const size_t pairNum = m_candidatePairs.size();
+	const size_t usedChunkNum = std::max<size_t>(1, std::min<size_t>(threadNum, pairNum / MIN_PAIRS_PER_CHUNK));
+
+	// S͈͂̊蓖āigȂ͈͂͋ɂj
+	m_chunks.resize(threadNum);
+	for (size_t i = 0; i < m_chunks.size(); i++)
+	{
+		m_chunks[i].results.clear();
+		m_chunks[i].begin	= (i < usedChunkNum) ? pairNum * i / usedChunkNum : pairNum;
+		m_chunks[i].end		= (i < usedChunkNum) ? pairNum * (i + 1) / usedChunkNum : pairNum;
+	}
+
+	// `Xbhɔzz
+	if (!m_helperThreads.empty())
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_poolMutex);
+			m_pendingChunkNum = static_cast<uint32_t>(m_helperThreads.size());
+			m_poolGeneration++;
+		}
+		m_poolCv.notify_all();
+	}
+
+	// 擪͈͍̔͂ƃXbhg肷
+	ProcessChunk(0);
+
+	// SĂ͈̔͂̊҂
+	if (!m_helperThreads.empty())
+	{
+		std::unique_lock<std::mutex> lock(m_poolMutex);
+		m_poolDoneCv.wait(lock, [this] { return m_pendingChunkNum == 0; });
+	}
+
+	// ͈͂̏ɌʂȂibN͍Ō̈xj
+	size_t resultNum = 0;
+	for (const auto& chunk : m_chunks)
+	{
+		resultNum += chunk.results.size();
+	}
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_detectionResults.reserve(resultNum);
+	for (const auto& chunk : m_chunks)
+	{
+		m_detectionResults.insert(m_detectionResults.end(), chunk.results.begin(), chunk.results.end());
+	}
+}
+
+/**
+ * @brief S͈͂̏ڍה
+ *
+ * @param[in] chunkIndex S͈͂̔ԍ
+ */
+void CollisionDetectionWorker::ProcessChunk(size_t chunkIndex)
+{
+	NarrowPhaseChunk& chunk = m_chunks[chunkIndex];
+	chunk.scratch.Reset();
+
+	for (size_t i = chunk.begin; i < chunk.end; i++)
+	{
+		const BroadPhasePair& pair = m_candidatePairs[i];
+		CheckDetectionPair(
+			GetSnapshot(pair.indexA), GetRoot(pair.indexA),
+			GetSnapshot(pair.indexB), GetRoot(pair.indexB),
+			&chunk.scratch, &chunk.results);
+	}
+}
+
+/**
+ * @brief `Xbh̐낦
+ *
+ * @param[in] helperNum `Xbh̐
+ */
+void CollisionDetectionWorker::ResizeHelperThreads(uint32_t helperNum)
+{
+	if (m_helperThreads.size() == helperNum) return;
+
+	StopHelperThreads();
+
+	std::lock_guard<std::mutex> lock(m_poolMutex);
+	m_stopHelpers = false;
+	m_helperThreads.reserve(helperNum);
+	for (uint32_t i = 0; i < helperNum; i++)
+	{
+		// 0Ԃ͈͍̔͂ƃXbhŜ 1 Ԃ犄蓖Ă
+		m_helperThreads.emplace_back(&CollisionDetectionWorker::HelperThreadLoop, this, i + 1, m_poolGeneration);
+	}
+}
+
+/**
+ * @brief `Xbh̃[v
+ *
+ * @param[in] chunkIndex		S͈͂̔ԍ
+ * @param[in] startGeneration	쐬̎d̐
+ */
+void CollisionDetectionWorker::HelperThreadLoop(size_t chunkIndex, uint64_t startGeneration)
+{
+	uint64_t generation = startGeneration;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_poolMutex);
+			// uVdvu~v܂ŃX[v
+			m_poolCv.wait(lock, [&] { return m_stopHelpers || m_poolGeneration != generation; });
+
+			if (m_stopHelpers) return;
+
+			generation = m_poolGeneration;
+		}
+
+		ProcessChunk(chunkIndex);
+
+		{
+			std::lock_guard<std::mutex> lock(m_poolMutex);
+			m_pendingChunkNum--;
+		}
+		m_poolDoneCv.notify_one();
+	}
+}
+
+/**
+ * @brief `Xbh̒~
+ */
+void CollisionDetectionWorker::StopHelperThreads()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_poolMutex);
+		m_stopHelpers = true;
+	}
+	m_poolCv.notify_all();
+
+	for (auto& thread : m_helperThreads)
+	{
+		thread.join();
+	}
+	m_helperThreads.clear();
+}
+
+/**
+ * @brief ʂԍ烋[ĝXibvVbg擾
+ *
+ * @param[in] index ʂԍiIȃ[ǧɐÓIȃ[gj
+ *
+ * @return XibvVbg
+ */
+const CollisionSnapshot& CollisionDetectionWorker::GetSnapshot(uint32_t index) const
+{
+	if (index < m_snapshot->GetRootCount()) return *m_snapshot;
+
+	return m_staticSet->snapshot;
+}
+
+/**
+ * @brief ʂԍ烋[g擾
+ *
+ * @param[in] index ʂԍiIȃ[ǧɐÓIȃ[gj
+ *
+ * @return [g
+ */
+const CollisionSnapshotNode& CollisionDetectionWorker::GetRoot(uint32_t index) const
+{
+	const uint32_t dynamicNum = m_snapshot->GetRootCount();
+	if (index < dynamicNum) return m_snapshot->GetNode(index);
+
+	return m_staticSet->snapshot.GetNode(index - dynamicNum);
+}
+
+/**
+ * @brief L攻p̋Ef[^̍쐬
+ *
+ * @param[in]  node			[g
+ * @param[in]  rootIndex	[g̔ԍ
+ * @param[in]  pScratch		RC_[̕pƗ̈
+ * @param[out] pOutEntry	Ef[^
+ *
+ * @returns true  쐬
+ * @returns false ΏۊOiĂȂA`󂪖j
+ */
+bool CollisionDetectionWorker::CreateBroadCollision(const CollisionSnapshotNode& node, uint32_t rootIndex, ColliderScratch* pScratch, BroadCollision* pOutEntry)
+{
+	using namespace DirectX::SimpleMath;
+
+	// ĂȂ͔̂肵Ȃ
+	if (node.isActive == false) return false;
+
+	const ICollider* pCollider = pScratch->Restore(node.shape, 0);
+	if (!pCollider) return false;
+
+	pOutEntry->proxyIndex = rootIndex;
+	pOutEntry->isUnbounded = !CalcBoundingBox(*pCollider, &pOutEntry->min, &pOutEntry->max);
+	pOutEntry->min -= Vector3(BOUNDS_MARGIN);
+	pOutEntry->max += Vector3(BOUNDS_MARGIN);
+
+	return true;
+}
+
 /**
  * @brief yȀՓ˃`FbN
  *
+ * @param[in] snapshotA		Փ˃f[^ÂXibvVbg
  * @param[in] collisionDataA	Փ˃f[^A
+ * @param[in] snapshotB		Փ˃f[^B̂XibvVbg
  * @param[in] collisionDataB	Փ˃f[^B
+ * @param[in] pScratch			RC_[̕pƗ̈iĂяoXbhpj
  *
- * @param[out] pOutResults mꂽՓ˂i[
+ * @param[out] pOutResults mꂽՓ˂i[iĂяoXbhp̊i[j
  */
 void CollisionDetectionWorker::CheckDetectionPair(
-    const ThreadCollisionObjectProxy& collisionDataA, 
-    const ThreadCollisionObjectProxy& collisionDataB, 
-	std::vector<DetectedCollisonData>* pOutResultStack)
+	const CollisionSnapshot& snapshotA,
+    const CollisionSnapshotNode& collisionDataA, 
+	const CollisionSnapshot& snapshotB,
+    const CollisionSnapshotNode& collisionDataB, 
+	ColliderScratch* pScratch,
+	std::vector<DetectedCollisonData>* pOutResultStack) const
 {
 	if (collisionDataA.id == collisionDataB.id) return;
 
@@ -189,21 +573,19 @@ void CollisionDetectionWorker::CheckDetectionPair(
 	}
 
 	// Փ˂Ă邩ǂ
-	if (CollisionDispatcher::DetectCollision(collisionDataA.collider.get(), collisionDataB.collider.get()))
+	if (pScratch->DetectCollision(collisionDataA.shape, collisionDataB.shape))
 	{
-		{
-			std::unique_lock<std::mutex> lock(m_mutex);
-			pOutResultStack->push_back({ collisionDataA.id, collisionDataB.id });
-		}
+		// ʂ̊i[̓XbhƂɕĂ̂ŃbNȂ
+		pOutResultStack->push_back({ collisionDataA.id, collisionDataB.id });
 
 		// qĂꍇ̎qm
-		for (auto& child : collisionDataA.children)
+		for (uint32_t i = 0; i < collisionDataA.childCount; i++)
 		{
-			CheckDetectionPair(child, collisionDataB, pOutResultStack);
+			CheckDetectionPair(snapshotA, snapshotA.GetNode(collisionDataA.childBegin + i), snapshotB, collisionDataB, pScratch, pOutResultStack);
 		}
-		for (auto& child : collisionDataB.children)
+		for (uint32_t i = 0; i < collisionDataB.childCount; i++)
 		{
-			CheckDetectionPair(child, collisionDataA, pOutResultStack);
+			CheckDetectionPair(snapshotB, snapshotB.GetNode(collisionDataB.childBegin + i), snapshotA, collisionDataA, pScratch, pOutResultStack);
 		}
 	}
 }
@@ -217,8 +599,8 @@ void CollisionDetectionWorker::CheckDetectionPair(
  * @returns false s\
  */
 bool CollisionDetectionWorker::CanDetect(
-    const ThreadCollisionObjectProxy& collisionDataA, 
-    const ThreadCollisionObjectProxy& collisionDataB)
+    const CollisionSnapshotNode& collisionDataA, 
+    const CollisionSnapshotNode& collisionDataB) const
 {
     // Q[IuWFNg^ÕrbgCfbNX
     uint32_t gameObjectTagIndexA = collisionDataA.tagBitIndex;
@@ -17,9 +17,24 @@
 // wb_t@C̓ǂݍ ===================================================
 #include <thread>
 #include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+#include "Game/Common/Framework/Collision/BroadPhase/StaticColliderBVH/StaticColliderBVH.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionSnapshot/CollisionSnapshot.h"
 
 
 // NX̑O錾 ===================================================
+class IBroadPhase;	// L攻
+
+// \̂̒` ===============================================================
+/**
+ * @brief ÓIRC_[̏W
+ *
+ * ÓIȃf[^̓o^Ɉx쐬AƃXbh͎QƂ̂ݍsit[Ȃj
+ */
+struct StaticCollisionSet
+{
+	CollisionSnapshot	snapshot;	///< ÓIȃXibvVbg
+	StaticColliderBVH	bvh;		///< ÓIȃ[g̋E{[Kw
+};
 
 // NX̒` ===============================================================
 /**
@@ -30,7 +45,23 @@ class CollisionDetectionWorker
 // NX萔̐錾 -------------------------------------------------
 public:
 
+	static constexpr float		BOUNDS_MARGIN			= 0.01f;	///< E{bNX̗]iڍהƂ̌vZ덷zj
+	static constexpr uint32_t	MAX_THREAD_NUM			= 8;		///< ڍהɎgXbh̍ő吔
+	static constexpr size_t		MIN_PAIRS_PER_CHUNK		= 64;		///< 1XbhɊ蓖ĂyA̍ŏiȂƋNׂ̕j
+
+// \̂̐錾
+private:
 
+	/**
+	 * @brief ڍה̒S͈
+	 */
+	struct NarrowPhaseChunk
+	{
+		size_t begin;								///< yÅJnԍ
+		size_t end;									///< yȀIԍi܂܂Ȃj
+		std::vector<DetectedCollisonData> results;	///< S͈͂̏ՓˌʁiXbhpȂ̂ŃbNsvj
+		ColliderScratch scratch;					///< RC_[̕pƗ̈iXbhpj
+	};
 
 // f[^o̐錾 -----------------------------------------------
 private:
@@ -47,10 +78,29 @@ private:
 
 	std::condition_variable m_cv;
 
-	std::unique_ptr<std::vector<ThreadCollisionObjectProxy>> m_proxies;
+	std::unique_ptr<CollisionSnapshot> m_snapshot;			///< IȃXibvVbg
+	std::shared_ptr<const StaticCollisionSet> m_staticSet;	///< ÓIȃXibvVbg̏W
 
 	std::unique_ptr<CollisionMatrix> m_collisionMatrix;
 
+	// L攻֘A
+	std::unique_ptr<IBroadPhase>	m_broadPhase;		///< L攻
+	std::vector<BroadCollision>		m_broadEntries;		///< L攻p̋Ef[^
+	std::vector<BroadPhasePair>		m_candidatePairs;	///< ڍהsyA
+	std::vector<uint32_t>			m_staticHits;		///< ÓIȊKw̌
+	ColliderScratch					m_broadScratch;		///< E{bNX̎ZoɎgRC_[̕pƗ̈
+
+	// ڍה̕񉻊֘A
+	std::atomic<uint32_t>			m_threadNum;			///< ڍהɎgXbhiƃXbh܂ށj
+	std::vector<std::thread>		m_helperThreads;		///< ڍה`Xbh
+	std::vector<NarrowPhaseChunk>	m_chunks;				///< XbhƂ̒S͈
+	std::mutex						m_poolMutex;			///< `XbhƂ̓p
+	std::condition_variable			m_poolCv;				///< d̔zzʒm
+	std::condition_variable			m_poolDoneCv;			///< S͈͂̊ʒm
+	uint64_t						m_poolGeneration;		///< zzd̐
+	uint32_t						m_pendingChunkNum;		///< ĂȂS͈͂̐
+	bool							m_stopHelpers;			///< `Xbh̒~
+
 
 // o֐̐錾 -------------------------------------------------
 // RXgN^/fXgN^
@@ -64,8 +114,8 @@ public:
 
 // 
 public:
-	// 񓹋C̊Jn
-	void StartAsync(std::unique_ptr<std::vector<ThreadCollisionObjectProxy>> proxies);
+	// 񓹋C̊JniÕXibvVbgԂj
+	std::unique_ptr<CollisionSnapshot> StartAsync(std::unique_ptr<CollisionSnapshot> snapshot, std::shared_ptr<const StaticCollisionSet> staticSet = nullptr);
 	// I܂őҋ@
 	void WaitForEndCalculation();
 
@@ -79,6 +129,17 @@ public:
 	// ՓˑΉ\̐ݒ
 	void SetCollisionMatrix(const CollisionMatrix& matrix);
 
+	// L攻̐ݒ
+	void SetBroadPhase(std::unique_ptr<IBroadPhase> broadPhase);
+
+	// ڍהɎgXbh̐ݒ
+	void SetThreadNum(uint32_t threadNum);
+	// ڍהɎgXbh̎擾
+	uint32_t GetThreadNum() const { return m_threadNum; }
+
+	// ÓIȃXibvVbg̏W̍쐬
+	static std::shared_ptr<const StaticCollisionSet> CreateStaticCollisionSet(CollisionSnapshot staticSnapshot);
+
 
 // 
 private:
@@ -86,10 +147,39 @@ private:
 	// mXbh̃[v
 	void DetectionThreadLoop();
 
+	// ڍהsyA̎W
+	void CollectCandidatePairs();
+
+	// ڍהiyA𕪊ĕɔ肷j
+	void RunNarrowPhase();
+
+	// S͈͂̏ڍה
+	void ProcessChunk(size_t chunkIndex);
+
+	// `Xbh̐낦
+	void ResizeHelperThreads(uint32_t helperNum);
+
+	// `Xbh̃[v
+	void HelperThreadLoop(size_t chunkIndex, uint64_t startGeneration);
+
+	// `Xbh̒~
+	void StopHelperThreads();
+
+	// ʂԍ烋[ĝXibvVbg擾iIȃ[ǧɐÓIȃ[gj
+	const CollisionSnapshot& GetSnapshot(uint32_t index) const;
+	// ʂԍ烋[g擾
+	const CollisionSnapshotNode& GetRoot(uint32_t index) const;
+
+	// L攻p̋Ef[^̍쐬
+	static bool CreateBroadCollision(const CollisionSnapshotNode& node, uint32_t rootIndex, ColliderScratch* pScratch, BroadCollision* pOutEntry);
+
 	// yȀՓ˃`FbN
-	void CheckDetectionPair(const ThreadCollisionObjectProxy& collisionDataA, const ThreadCollisionObjectProxy& collisionDataB, std::vector<DetectedCollisonData>* pOutResults);
+	void CheckDetectionPair(
+		const CollisionSnapshot& snapshotA, const CollisionSnapshotNode& collisionDataA,
+		const CollisionSnapshot& snapshotB, const CollisionSnapshotNode& collisionDataB,
+		ColliderScratch* pScratch, std::vector<DetectedCollisonData>* pOutResults) const;
 
 	// mł邩ǂ
-	bool CanDetect(const ThreadCollisionObjectProxy& collisionDataA, const ThreadCollisionObjectProxy& collisionDataB);
+	bool CanDetect(const CollisionSnapshotNode& collisionDataA, const CollisionSnapshotNode& collisionDataB) const;
 
 };
@@ -13,7 +13,9 @@
 
 #include "CollisionManager.h"
 #include "CollisionDetectionWorker/CollisionDetectionWorker.h"
+#include "CollisionSnapshot/CollisionSnapshot.h"
 #include "../CollisionDispatcher/CollisionDispatcher.h"
+#include "../BroadPhase/IBroadPhase.h"
 #include <set>
 
 
@@ -27,6 +29,15 @@
 CollisionManager::CollisionManager()
 	: m_rootCollisionDataId{}
 	, m_pCollisionMatrix{ nullptr }
+	, m_frameSnapshot{}
+	, m_staticCollisionSet{}
+	, m_isStaticSetDirty{ false }
+	, m_submitStats{}
+	, m_contactPairCache{}
+	, m_exitPairs{}
+	, m_query{}
+	, m_isQueryStaticDirty{ true }
+	, m_isQueryDynamicDirty{ true }
 
 
 #ifdef COLLISIONMANAGER_DEBUG	
@@ -36,6 +47,8 @@ CollisionManager::CollisionManager()
 {
 
 	 m_collisionDetectionWorker = std::make_unique<CollisionDetectionWorker>();
+	 m_frameSnapshot = std::make_unique<CollisionSnapshot>();
+	 m_query = std::make_unique<CollisionQuery>();
 
 	//m_detectionThread = std::make_unique<std::thread>(&CollisionManager::UpdateDetection, this, &m_detectionResults);
 
@@ -115,23 +128,47 @@ bool CollisionManager::UpdateTask(float deltaTime)
  */
 void CollisionManager::Finalize()
 {
+	m_collisionDataTable.Clear();
 	m_rootCollisionDataId.clear();
-	m_collisionIdLookupTable.clear();
-
+	m_rootColliderLookup.clear();
+	m_contactPairCache.Clear();
+	m_staticCollisionSet.reset();
+	m_isStaticSetDirty = false;
+
+	m_query->Clear();
+	MarkQueryDirty(true);
+	MarkQueryDirty(false);
 }
 
 /**
  * @brief Փ˃f[^̒ǉ
  * 
  * @param[in] collisionData@Փ˃f[^
+ *
+ * @return Փ˃f[^̃nhio^łȂ͖ȃnhj
  */
-void CollisionManager::AddCollisionData(const CollisionData& collisionData)
+CollisionHandle CollisionManager::AddCollisionData(const CollisionData& collisionData)
 {
+	CollisionData rootData = collisionData;
+	rootData.parentId	= -1;
+	rootData.rootIndex	= static_cast<uint32_t>(m_rootCollisionDataId.size());
 
-	auto newId = RegisterIdLookUpTable(collisionData);
+	const CollisionHandle handle = RegisterIdLookUpTable(std::move(rootData));
+	if (handle.IsNull()) return handle;
 
+	const int newId = static_cast<int>(handle.value);
 	m_rootCollisionDataId.push_back(newId);
+	m_rootColliderLookup.emplace(collisionData.pCollider, newId);
+
+	// ÓIȃf[^ÓIȃvLV̏W蒼
+	if (collisionData.isStatic)
+	{
+		m_isStaticSetDirty = true;
+	}
 
+	MarkQueryDirty(collisionData.isStatic);
+
+	return handle;
 }
 
 /**
@@ -139,26 +176,52 @@ void CollisionManager::AddCollisionData(const CollisionData& collisionData)
  * 
  * @param[in] childCollisionData	qf[^
  * @param[in] parent				o^ĂeRC_[
+ *
+ * @return qf[^̃nhieȂ͖ȃnhj
  */
-void CollisionManager::AddCollisionData(const CollisionData& childCollisionData, ICollider* parent)
+CollisionHandle CollisionManager::AddCollisionData(const CollisionData& childCollisionData, ICollider* parent)
 {
-	if (parent)
-	{
-		auto it = std::find_if(m_rootCollisionDataId.begin(), m_rootCollisionDataId.end(), [&](const unsigned int& id)
-			{
-				return  m_collisionIdLookupTable[static_cast<size_t>(id)].pCollider == parent;
-			});
+	if (!parent) return CollisionHandle();
 
-		if (it != m_rootCollisionDataId.end())
-		{
-			auto& parentData = m_collisionIdLookupTable[*it];
-			// ʔԍ̐ݒ
-			auto newId = RegisterIdLookUpTable(childCollisionData);
+	auto it = m_rootColliderLookup.find(parent);
+	if (it == m_rootColliderLookup.end()) return CollisionHandle();
 
-			parentData.children.push_back(newId);
+	return AddCollisionData(childCollisionData, CollisionHandle(static_cast<uint32_t>(it->second)));
+}
 
-		}
+/**
+ * @brief Փ˃f[^̒ǉ
+ * 
+ * @param[in] childCollisionData	qf[^
+ * @param[in] parent				ẽnh
+ *
+ * @return qf[^̃nhieȎ͖ȃnhj
+ */
+CollisionHandle CollisionManager::AddCollisionData(const CollisionData& childCollisionData, CollisionHandle parent)
+{
+	if (!m_collisionDataTable.IsValid(parent)) return CollisionHandle();
+
+	CollisionData childData = childCollisionData;
+	childData.parentId	= static_cast<int>(parent.value);
+	childData.rootIndex	= CollisionData::NOT_ROOT;
+
+	// ʔԍ̐ݒ
+	const CollisionHandle handle = RegisterIdLookUpTable(std::move(childData));
+	if (handle.IsNull()) return handle;
+
+	// o^ŕ\̗vfړ邽߁Ae͓o^Ɉ
+	CollisionData* pParentData = m_collisionDataTable.Get(parent);
+	pParentData->children.push_back(static_cast<int>(handle.value));
+
+	// ÓIȐe̎qÓIȃvLV̏W蒼
+	if (pParentData->isStatic)
+	{
+		m_isStaticSetDirty = true;
 	}
+
+	MarkQueryDirty(pParentData->isStatic);
+
+	return handle;
 }
 
 /**
@@ -171,23 +234,61 @@ void CollisionManager::RemoveCollisionObjectData(GameObject* pRemoveGameObject,
 {
 	if (!pRemoveGameObject || !pCollider) return;
 
+	// RC_[烋[gf[^iRC_[o^ĂĂŌj
+	auto range = m_rootColliderLookup.equal_range(pCollider);
+	for (auto it = range.first; it != range.second; it++)
+	{
+		const CollisionData* pData = FindCollisionData(it->second);
+		if (pData && pData->pGameObject == pRemoveGameObject)
+		{
+			RemoveCollisionData(CollisionHandle(static_cast<uint32_t>(it->second)));
+			return;
+		}
+	}
+}
 
-	auto findIt = std::find_if(m_rootCollisionDataId.begin(), m_rootCollisionDataId.end(),
-		[&](const UINT& id) {
-			auto it = m_collisionIdLookupTable.find(id);
-			if (it == m_collisionIdLookupTable.end()) return false;
-			return (pRemoveGameObject == it->second.pGameObject && pCollider == it->second.pCollider);
-		});
+/**
+ * @brief 폜
+ *
+ * qf[^킹č폜
+ *
+ * @param[in] handle 폜Փ˃f[^̃nh
+ *
+ * @returns true  폜
+ * @returns false ȃnhi폜ς݂܂ށj
+ */
+bool CollisionManager::RemoveCollisionData(CollisionHandle handle)
+{
+	const CollisionData* pData = m_collisionDataTable.Get(handle);
+	if (!pData) return false;
 
-	if (findIt != m_rootCollisionDataId.end()) {
-		UINT idToRemove = *findIt;
+	// ̋L^cĂԂɁAڐGĂ֐ڐG̏I𑗂
+	NotifyRemovedContacts(static_cast<int>(handle.value));
 
-		// p֐ĂԁiċA̒œdbNȂ悤Ɂj
-		UnregisterIdLookUpTable(idToRemove);
+	// ʒmœo^ςƕ\̗vfړ邽߈iʒmō폜ꂽꍇ͍폜ς݁j
+	pData = m_collisionDataTable.Get(handle);
+	if (!pData) return true;
 
-		// ID̃TCNi{͒xԋp]܂j
-		m_idPool.RecycleID(idToRemove);
+	// qf[^͐e̎qXgO
+	CollisionData* pParentData = FindCollisionData(pData->parentId);
+	if (pParentData)
+	{
+		auto& children = pParentData->children;
+		children.erase(std::remove(children.begin(), children.end(), pData->id), children.end());
 	}
+
+	// ÓIȃf[^ÓIȃvLV̏W蒼
+	const bool isStatic = (pParentData) ? pParentData->isStatic : pData->isStatic;
+	if (isStatic)
+	{
+		m_isStaticSetDirty = true;
+	}
+
+	MarkQueryDirty(isStatic);
+
+	UnregisterIdLookUpTable(static_cast<int>(handle.value));
+
+	return true;
 }
 
 /**
@@ -195,14 +296,23 @@ void CollisionManager::RemoveCollisionObjectData(GameObject* pRemoveGameObject,
  */
 void CollisionManager::RemoveAll()
 {
-	m_collisionIdLookupTable.clear();
+	m_collisionDataTable.Clear();
 	m_rootCollisionDataId.clear();
-
+	m_rootColliderLookup.clear();
+	m_contactPairCache.Clear();
+	m_staticCollisionSet.reset();
+	m_isStaticSetDirty = false;
+
+	m_query->Clear();
+	MarkQueryDirty(true);
+	MarkQueryDirty(false);
 }
 
 /**
  * @brief w肵RC_[̏Փˏ擾
  *
+ * o^ĂSẴRC_[𑖍AԌ̊KwŌi荞
+ *
  * @param[in] pCheckCollider	ׂRC_[
  * @param[in] pHitGameObjects	Փ˃f[^
  *
@@ -212,54 +322,211 @@ bool CollisionManager::RetrieveCollisionData(const ICollider* pCheckCollider, st
 {
 	if (!pCheckCollider) return false;
 
-	bool isHit = false;
+	std::vector<QueryHit> hits;
+	if (UpdateQuery()->Overlap(*pCheckCollider, QueryFilter(), &hits) == 0) return false;
 
-	// e[uQƒ̕ύXh߃bN擾
+	// |C^nĂꍇ̂݁AXgɒǉ
+	for (const auto& hit : hits)
+	{
+		if (pHitGameObjects)
+		{
+			pHitGameObjects->push_back(hit.pGameObject);
+		}
+		if (pHitColliders)
+		{
+			pHitColliders->push_back(hit.pCollider);
+		}
+	}
 
-	// ċAIɏՓ˂𒲂ׂ郉_֐
-	auto retrieveRecursive = [&](auto& self, const CollisionData& currentData) -> void {
-		// IuWFNg̗LEԂ̃`FbN
-		if (!currentData.pGameObject || !currentData.pCollider) return;
-		if (!currentData.pGameObject->IsActive()) return;
+	return true;
+}
 
-		// Փ˔s
-		if (CollisionDispatcher::DetectCollision(currentData.pCollider, pCheckCollider))
-		{
-			isHit = true;
+/**
+ * @brief ƍŏɓRC_[߂
+ *
+ * @param[in]  origin		n_
+ * @param[in]  direction	
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutHit		ł߂Փˁinullptr j
+ * @param[in]  filter		i荞ݏi^OAOIuWFNgj
+ *
+ * @return true ǂ
+ */
+bool CollisionManager::Raycast(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance, QueryHit* pOutHit, const QueryFilter& filter)
+{
+	return UpdateQuery()->Raycast(origin, direction, maxDistance, filter, pOutHit);
+}
 
-			// |C^nĂꍇ̂݁AXgɒǉ
-			if (pHitGameObjects)
+/**
+ * @brief ƓSẴRC_[߂ɋ߂
+ *
+ * @param[in]  origin		n_
+ * @param[in]  direction	
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutHits		ՓˁiǋLj
+ * @param[in]  filter		i荞ݏi^OAOIuWFNgj
+ *
+ * @return RC_[̐
+ */
+size_t CollisionManager::RaycastAll(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance, std::vector<QueryHit>* pOutHits, const QueryFilter& filter)
+{
+	return UpdateQuery()->RaycastAll(origin, direction, maxDistance, filter, pOutHits);
+}
+
+/**
+ * @brief ƏdȂRC_[߂
+ *
+ * @param[in]  center	SW
+ * @param[in]  radius	a
+ * @param[out] pOutHits	ՓˁiǋLBnullptr Ȃ琔邾j
+ * @param[in]  filter	i荞ݏi^OAOIuWFNgj
+ *
+ * @return dȂRC_[̐
+ */
+size_t CollisionManager::OverlapSphere(const DirectX::SimpleMath::Vector3& center, float radius, std::vector<QueryHit>* pOutHits, const QueryFilter& filter)
+{
+	return UpdateQuery()->OverlapSphere(center, radius, filter, pOutHits);
+}
+
+/**
+ * @brief AABB ƏdȂRC_[߂
+ *
+ * @param[in]  center	SW
+ * @param[in]  extend	傫iӂ̒j
+ * @param[out] pOutHits	ՓˁiǋLBnullptr Ȃ琔邾j
+ * @param[in]  filter	i荞ݏi^OAOIuWFNgj
+ *
+ * @return dȂRC_[̐
+ */
+size_t CollisionManager::OverlapAABB(const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& extend, std::vector<QueryHit>* pOutHits, const QueryFilter& filter)
+{
+	return UpdateQuery()->OverlapAABB(center, extend, filter, pOutHits);
+}
+
+/**
+ * @brief JvZ𓮂čŏɓRC_[߂
+ *
+ * @param[in]  capsule		JvZin_̈ʒuj
+ * @param[in]  direction	
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutHit		ł߂Փˁinullptr j
+ * @param[in]  filter		i荞ݏi^OAOIuWFNgj
+ *
+ * @return true ǂ
+ */
+bool CollisionManager::SweepCapsule(const Capsule& capsule, const DirectX::SimpleMath::Vector3& direction, float maxDistance, QueryHit* pOutHit, const QueryFilter& filter)
+{
+	return UpdateQuery()->SweepCapsule(capsule, direction, maxDistance, filter, pOutHit);
+}
+
+/**
+ * @brief 𓮂čŏɓRC_[߂
+ *
+ * @param[in]  center		̒Sin_j
+ * @param[in]  radius		a
+ * @param[in]  direction	
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutHit		ł߂Փˁinullptr j
+ * @param[in]  filter		i荞ݏi^OAOIuWFNgj
+ *
+ * @return true ǂ
+ */
+bool CollisionManager::SweepSphere(const DirectX::SimpleMath::Vector3& center, float radius, const DirectX::SimpleMath::Vector3& direction, float maxDistance, QueryHit* pOutHit, const QueryFilter& filter)
+{
+	return UpdateQuery()->SweepSphere(center, radius, direction, maxDistance, filter, pOutHit);
+}
+
+/**
+ * @brief AIȏՓ˔gړʂ߂
+ *
+ * `ړÖʒu|AŎ~߂Bc̈ړƑx͖ʂɌA
+ * ʂɉĊ点B͖ʂɏ߂荞܂Ao▀C͒ʏ̏Փ˒ʒmɔCB
+ * Ή`͋ƃJvZŁAȊO͂̂܂ܓ
+ *
+ * @param[in]     shape			`iړÖʒuj
+ * @param[in]     displacement	̃t[̈ړ
+ * @param[in]     filter		i荞ݏin`̃^OAgj
+ * @param[in,out] pVelocity		xiʂɌBnullptr j
+ * @param[out]    pOutHit		ŏ̏Փˁitime ͈ړʑŜɑ΂銄Bnullptr j
+ *
+ * @return ۂ̈ړ
+ */
+DirectX::SimpleMath::Vector3 CollisionManager::CalcContinuousMove(const ICollider& shape, const DirectX::SimpleMath::Vector3& displacement, const QueryFilter& filter, DirectX::SimpleMath::Vector3* pVelocity, QueryHit* pOutHit)
+{
+	using namespace DirectX::SimpleMath;
+
+	const CollisionQuery* pQuery = UpdateQuery();
+
+	// `炵ʒu|
+	auto sweep = [&](const Vector3& offset, const Vector3& direction, float distance, QueryHit* pHit)
+		{
+			switch (shape.GetColliderType())
+			{
+			case ColliderType::Sphere:
 			{
-				pHitGameObjects->push_back(currentData.pGameObject);
+				const Sphere& sphere = static_cast<const Sphere&>(shape);
+				return pQuery->SweepSphere(sphere.GetPosition() + offset, sphere.GetRadius(), direction, distance, filter, pHit);
 			}
-			if (pHitColliders)
+			case ColliderType::Capsule:
 			{
-				pHitColliders->push_back(currentData.pCollider);
+				Capsule capsule = static_cast<const Capsule&>(shape);
+				capsule.SetPosition(capsule.GetPosition() + offset);
+				return pQuery->SweepCapsule(capsule, direction, distance, filter, pHit);
 			}
+			default:
+				return false;
+			}
+		};
+
+	Vector3 moved = Vector3::Zero;
+	Vector3 remaining = displacement;
+	Vector3 contactNormal = Vector3::Zero;
+	bool isHit = false;
+	bool isNewContact = false;
+
+	// 点񐔂g؂̎c̈ړ͎̂Ă
+	for (int i = 0; i < CONTINUOUS_MAX_SLIDE_NUM; i++)
+	{
+		const float distance = remaining.Length();
+		if (distance <= 0.0f) break;
+
+		QueryHit hit;
+		if (!sweep(moved, remaining, distance, &hit))
+		{
+			moved += remaining;
+			break;
 		}
 
-		// qIuWFNgɑ΂Ălɔs
-		for (const auto& childId : currentData.children)
+		// ŏ̑|͈ړʑŜȂ̂ŁA͂̂܂ܑŜɑ΂銄ɂȂ
+		if (!isHit && pOutHit)
 		{
-			auto itChild = m_collisionIdLookupTable.find(childId);
-			if (itChild != m_collisionIdLookupTable.end())
-			{
-				self(self, itChild->second);
-			}
+			*pOutHit = hit;
 		}
-		};
+		isHit = true;
 
-	// [gXgɓo^Ă邷ׂẴIuWFNg瑖Jn
-	for (const auto& id : m_rootCollisionDataId)
-	{
-		auto it = m_collisionIdLookupTable.find(id);
-		if (it != m_collisionIdLookupTable.end())
+		// n߂ڂĂʂ͊ɂ߂荞܂Ă邽߁Aꂽʒu瓖ʂo
+		if (hit.distance > 0.0f)
 		{
-			retrieveRecursive(retrieveRecursive, it->second);
+			isNewContact = true;
+			contactNormal = hit.normal;
+		}
+
+		moved += remaining * hit.time;
+		remaining *= (1.0f - hit.time);
+		remaining -= hit.normal * std::min(0.0f, remaining.Dot(hit.normal));
+
+		if (pVelocity)
+		{
+			*pVelocity -= hit.normal * std::min(0.0f, pVelocity->Dot(hit.normal));
 		}
 	}
 
-	return isHit;
+	if (isNewContact)
+	{
+		moved -= contactNormal * CONTINUOUS_CONTACT_DEPTH;
+	}
+
+	return moved;
 }
 
 /**
@@ -275,19 +542,44 @@ void CollisionManager::RequestCollisionDetection()
 	auto start = std::chrono::high_resolution_clock::now();
 #endif 
 
+	m_submitStats = CollisionSubmitStats();
+
 	if (m_rootCollisionDataId.empty()) return ;
 
+	// ÓIȃf[^ςÓIȃvLV̏W蒼
+	if (m_isStaticSetDirty)
+	{
+		CreateStaticProxy();
+	}
+
+#ifdef COLLISIONMANAGER_DEBUG	
+	auto snapshotStart = std::chrono::high_resolution_clock::now();
+#endif 
 
 	// pf[^̍쐬i̓CXbhňSɍsj
-	auto nextProxy = std::make_unique<std::vector<ThreadCollisionObjectProxy>>();
+	// OgXibvVbgɏ㏑邽߁AeʂĂΊmۂȂ
+	if (!m_frameSnapshot)
+	{
+		m_frameSnapshot = std::make_unique<CollisionSnapshot>();
+		CountSubmitAllocation(sizeof(CollisionSnapshot), false);
+	}
+	const size_t allocatedBytes = m_frameSnapshot->GetAllocatedBytes();
+
+	// IȃXibvVbg̍쐬iÓIȃXibvVbg͕AWLj
+	CreateWorkerProxy(m_frameSnapshot.get(), false);
+
+	if (m_frameSnapshot->GetAllocatedBytes() > allocatedBytes)
+	{
+		CountSubmitAllocation(m_frameSnapshot->GetAllocatedBytes() - allocatedBytes, false);
+	}
 
-	// vLV̍쐬
-	CreateWorkerProxy(nextProxy.get(), false);
+#ifdef COLLISIONMANAGER_DEBUG	
+	auto snapshotDuration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - snapshotStart);
+	const uint32_t snapshotNodeNum = m_frameSnapshot->GetNodeCount();
+#endif 
 
-	// IuWFNgRs[
-	nextProxy->insert(nextProxy->end(), m_staticProxies.begin(), m_staticProxies.end());
-	// m̊Jn
-	m_collisionDetectionWorker->StartAsync(std::move(nextProxy));
+	// m̊Jni߂ĂÕXibvVbg̃t[Ŏgj
+	m_frameSnapshot = m_collisionDetectionWorker->StartAsync(std::move(m_frameSnapshot), m_staticCollisionSet);
 
 
 #ifdef COLLISIONMANAGER_DEBUG	
@@ -301,6 +593,14 @@ void CollisionManager::RequestCollisionDetection()
 	m_totalDuration = 0;
 	m_totalDuration += duration.count();
 
+	wchar_t buffer[128];
+	swprintf_s(buffer, L"snapshot : %u nodes, %lld us\n", snapshotNodeNum, snapshotDuration.count());
+	OutputDebugString(buffer);
+
+	swprintf_s(buffer, L"submit : dynamic %zu bytes, static %zu bytes, %zu allocations\n",
+		m_submitStats.dynamicAllocatedBytes, m_submitStats.staticAllocatedBytes, m_submitStats.allocationCount);
+	OutputDebugString(buffer);
+
 #endif 
 
 }
@@ -310,8 +610,15 @@ void CollisionManager::RequestCollisionDetection()
  */
 void CollisionManager::CreateStaticProxy()
 {
-	m_staticProxies.clear();
-	CreateWorkerProxy(&m_staticProxies, true);
+	// ƃXbhÂWQƂĂĂAQƂO܂ł͔jȂ
+	CollisionSnapshot staticSnapshot;
+	CreateWorkerProxy(&staticSnapshot, true);
+
+	m_staticCollisionSet = CollisionDetectionWorker::CreateStaticCollisionSet(std::move(staticSnapshot));
+	m_isStaticSetDirty = false;
+
+	CountSubmitAllocation(
+		sizeof(StaticCollisionSet) + m_staticCollisionSet->snapshot.GetAllocatedBytes() + m_staticCollisionSet->bvh.GetAllocatedBytes(), true);
 }
 
 /**
@@ -324,6 +631,26 @@ void CollisionManager::SetCollisionMatrix(const CollisionMatrix* pCollisionMatri
 	m_collisionDetectionWorker->SetCollisionMatrix(*pCollisionMatrix);
 }
 
+/**
+ * @brief L攻̐ݒ
+ * 
+ * @param[in] broadPhase@L攻iԃnbVA|Ɗ荞݂Ȃǁj
+ */
+void CollisionManager::SetBroadPhase(std::unique_ptr<IBroadPhase> broadPhase)
+{
+	m_collisionDetectionWorker->SetBroadPhase(std::move(broadPhase));
+}
+
+/**
+ * @brief ڍהɎgXbh̐ݒ
+ * 
+ * @param[in] threadNum@Xbhi1 ŕ񉻂ȂBʂƏ̓XbhɈ˂Ȃj
+ */
+void CollisionManager::SetNarrowPhaseThreadNum(uint32_t threadNum)
+{
+	m_collisionDetectionWorker->SetThreadNum(threadNum);
+}
+
 /**
  * @brief ăUgf[^XV
  */
@@ -339,12 +666,13 @@ std::vector<DetectedCollisonData> CollisionManager::SyncAndFetchResults()
 void CollisionManager::PreCollision()
 {
 	// Փ˔̑Ȍ
-	for (auto& id : m_rootCollisionDataId)
+	// Ăяoœo^ςĂȂ悤Aԍő
+	for (size_t i = 0; i < m_rootCollisionDataId.size(); i++)
 	{
-		auto pGameObject = m_collisionIdLookupTable.at(id).pGameObject;
-		if (pGameObject)
+		const CollisionData* pData = FindCollisionData(m_rootCollisionDataId[i]);
+		if (pData && pData->pGameObject)
 		{
-			pGameObject->PreCollision();
+			pData->pGameObject->PreCollision();
 		}
 	}
 }
@@ -353,28 +681,123 @@ void CollisionManager::PreCollision()
 /**
  * @brief Փ˒ʒm
  * 
+ * ڐGĂgL^A󂯎ނɉĖt[̒ʒmƁAڐG̊JnEpEI̒ʒm𑗂
+ *
  * @param[in] pDetectedCollisions@Փ˂mꂽf[^
  */
 void CollisionManager::NotifyCollisionEvents(std::vector<DetectedCollisonData>* pDetectedCollisions)
 {
+	m_contactPairCache.BeginFrame();
+
 	// ɂ͂bN wait svBȒʒmWbN̂݁B
 	for (const auto& data : (*pDetectedCollisions))
 	{
-		auto itA = m_collisionIdLookupTable.find(data.collisionDataIdA);
-		auto itB = m_collisionIdLookupTable.find(data.collisionDataIdB);
+		// 蒆ɍ폜ꂽf[^͐オςĂ邽ߌȂ
+		if (!FindCollisionData(data.collisionDataIdA) || !FindCollisionData(data.collisionDataIdB)) continue;
 
-		if (itA != m_collisionIdLookupTable.end() && itB != m_collisionIdLookupTable.end())
-		{
-			CollisionData& collA = itA->second;
-			CollisionData& collB = itB->second;
+		// g񌟒mĂAJnEp1xʒm
+		const ContactPairCache::ContactState state = m_contactPairCache.Touch(data.collisionDataIdA, data.collisionDataIdB);
 
-			if (collA.pGameObject && collB.pGameObject)
-			{
-				collA.pGameObject->OnCollision(CollisionInfo(collB.pCollider, collB.pGameObject, collA.pCollider));
-				collB.pGameObject->OnCollision(CollisionInfo(collA.pCollider, collA.pGameObject, collB.pCollider));
-			}
+		SendCollisionEvent(CollisionEventFlag::ON_COLLISION, &ICollision::OnCollision, data.collisionDataIdA, data.collisionDataIdB);
+
+		if (state == ContactPairCache::ContactState::ENTER)
+		{
+			SendCollisionEvent(CollisionEventFlag::ENTER, &ICollision::OnCollisionEnter, data.collisionDataIdA, data.collisionDataIdB);
+		}
+		else if (state == ContactPairCache::ContactState::STAY)
+		{
+			SendCollisionEvent(CollisionEventFlag::STAY, &ICollision::OnCollisionStay, data.collisionDataIdA, data.collisionDataIdB);
 		}
 	}
+
+	// 񌟒mȂg͐ڐG̏I
+	m_exitPairs.clear();
+	m_contactPairCache.EndFrame(&m_exitPairs);
+
+	for (const auto& pair : m_exitPairs)
+	{
+		// 폜Փ˃f[^̑g͍폜̎ɒʒmċL^OĂ
+		SendCollisionEvent(CollisionEventFlag::EXIT, &ICollision::OnCollisionExit, pair.idA, pair.idB);
+	}
+}
+
+/**
+ * @brief 1g̏Փ˒ʒm𑗂
+ * 
+ * ʒmœo^ςƕ\̗vfړ邽߁AxID
+ *
+ * @param[in] event		ʒm̎
+ * @param[in] callback	Ăяo֐
+ * @param[in] idA		Փ˃f[^AID
+ * @param[in] idB		Փ˃f[^BID
+ */
+void CollisionManager::SendCollisionEvent(CollisionEventFlag event, CollisionCallback callback, int idA, int idB)
+{
+	const CollisionData* pDataA = FindCollisionData(idA);
+	const CollisionData* pDataB = FindCollisionData(idB);
+	if (!pDataA || !pDataB) return;
+
+	// ɒlo
+	GameObject* pGameObjectA = pDataA->pGameObject;
+	GameObject* pGameObjectB = pDataB->pGameObject;
+	ICollider* pColliderA = pDataA->pCollider;
+	ICollider* pColliderB = pDataB->pCollider;
+	const bool isNotifyA = (pDataA->eventFlags & event) == event;
+	const bool isNotifyB = (pDataB->eventFlags & event) == event;
+
+	if (!pGameObjectA || !pGameObjectB) return;
+
+	if (isNotifyA)
+	{
+		(pGameObjectA->*callback)(CollisionInfo(pColliderB, pGameObjectB, pColliderA));
+	}
+	if (isNotifyB)
+	{
+		(pGameObjectB->*callback)(CollisionInfo(pColliderA, pGameObjectA, pColliderB));
+	}
+}
+
+/**
+ * @brief 폜Փ˃f[^ƐڐGĂɐڐG̏Iʒm
+ *
+ * qf[^̑g킹ċL^OB
+ * 폜鑤͎傪jĂr̉\邽ߒʒmAc鑊肾1x
+ *
+ * @param[in] dataID 폜Փ˃f[^ID
+ */
+void CollisionManager::NotifyRemovedContacts(int dataID)
+{
+	// qf[^IDW߂
+	std::vector<int> removedIds{ dataID };
+	for (size_t i = 0; i < removedIds.size(); i++)
+	{
+		const CollisionData* pData = FindCollisionData(removedIds[i]);
+		if (pData) { removedIds.insert(removedIds.end(), pData->children.begin(), pData->children.end()); }
+	}
+
+	// ʒmō폜qɂȂĂȂ悤AɑSĂ̑gL^O
+	std::vector<ContactPairCache::ContactPair> removedPairs;
+	for (const int id : removedIds)
+	{
+		m_contactPairCache.RemovePairs(id, &removedPairs);
+	}
+
+	auto isRemoved = [&removedIds](int id) { return std::find(removedIds.begin(), removedIds.end(), id) != removedIds.end(); };
+
+	for (const auto& pair : removedPairs)
+	{
+		// ǂ폜g͒ʒmȂ
+		const bool isRemovedA = isRemoved(pair.idA);
+		if (isRemovedA == isRemoved(pair.idB)) continue;
+
+		// xID
+		const CollisionData* pSurvivor = FindCollisionData(isRemovedA ? pair.idB : pair.idA);
+		const CollisionData* pRemoved = FindCollisionData(isRemovedA ? pair.idA : pair.idB);
+		if (!pSurvivor || !pRemoved || !pSurvivor->pGameObject) continue;
+		if ((pSurvivor->eventFlags & CollisionEventFlag::EXIT) != CollisionEventFlag::EXIT) continue;
+
+		pSurvivor->pGameObject->OnCollisionExit(CollisionInfo(pRemoved->pCollider, pRemoved->pGameObject, pSurvivor->pCollider));
+	}
 }
 
 /**
@@ -383,11 +806,13 @@ void CollisionManager::NotifyCollisionEvents(std::vector<DetectedCollisonData>*
 void CollisionManager::FinalizeCollision()
 {
 	// Փ˔̒̏
-	for (auto& data : m_collisionIdLookupTable)
+	// Ăяoœo^ςĂȂ悤Aԍő
+	for (size_t i = 0; i < m_collisionDataTable.GetSize(); i++)
 	{
-		if (data.second.pGameObject)
+		GameObject* pGameObject = m_collisionDataTable.GetAt(i).pGameObject;
+		if (pGameObject)
 		{
-			data.second.pGameObject->PostCollision();
+			pGameObject->PostCollision();
 
 		}
 
@@ -397,106 +822,281 @@ void CollisionManager::FinalizeCollision()
 
 
 
-UINT CollisionManager::RegisterIdLookUpTable(CollisionData data)
+/**
+ * @brief ANZXpe[uɓo^
+ *
+ * @param[in] data Փ˃f[^
+ *
+ * @return Փ˃f[^̃nhinh̒lIDƂďށj
+ */
+CollisionHandle CollisionManager::RegisterIdLookUpTable(CollisionData data)
 {
-	auto newId = m_idPool();
-	data.id = newId;
-
-
+	const CollisionHandle handle = m_collisionDataTable.Add(std::move(data));
 
-	m_collisionIdLookupTable[data.id] = data;
-
-	return newId;
+	if (!handle.IsNull())
+	{
+		m_collisionDataTable.Get(handle)->id = static_cast<int>(handle.value);
+	}
 
+	return handle;
 }
 
-void CollisionManager::UnregisterIdLookUpTable(UINT dataID)
+/**
+ * @brief ANZXpe[u폜
+ *
+ * qf[^ɍ폜B[g̈ꗗ͖Ɠւċl߂
+ *
+ * @param[in] dataID 폜Փ˃f[^ID
+ */
+void CollisionManager::UnregisterIdLookUpTable(int dataID)
 {
-	auto it = m_collisionIdLookupTable.find(dataID);
-	if (it == m_collisionIdLookupTable.end()) return;
+	CollisionData* pData = FindCollisionData(dataID);
+	if (!pData) return;
 
-	// 1. ɎqIDXgRs[ĕێiQƂ̖΍j
-	std::vector<int> childrenCopy = it->second.children;
+	// 1. ɎqIDXgoi폜ŕ\̗vfړ邽߁j
+	std::vector<int> children = std::move(pData->children);
 
 	// 2. qɍċAIɍ폜i{gAbvj
-	for (auto childId : childrenCopy)
+	for (auto childId : children)
 	{
 		UnregisterIdLookUpTable(childId);
 	}
 
-	// 3. ge[u폜
-	m_collisionIdLookupTable.erase(dataID);
+	pData = FindCollisionData(dataID);
+
+	// 3. [gȂꗗƋt\O
+	if (pData->rootIndex != CollisionData::NOT_ROOT)
+	{
+		const uint32_t rootIndex = pData->rootIndex;
+		const int lastId = m_rootCollisionDataId.back();
+
+		m_rootCollisionDataId[rootIndex] = lastId;
+		FindCollisionData(lastId)->rootIndex = rootIndex;
+		m_rootCollisionDataId.pop_back();
+
+		auto range = m_rootColliderLookup.equal_range(pData->pCollider);
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (it->second == dataID)
+			{
+				m_rootColliderLookup.erase(it);
+				break;
+			}
+		}
+	}
 
-	// 4. [gXg폜
-	m_rootCollisionDataId.erase(
-		std::remove(m_rootCollisionDataId.begin(), m_rootCollisionDataId.end(), dataID),
-		m_rootCollisionDataId.end()
-	);
+	// 4. ge[u폜inh̐オi݁AÂID͖ɂȂj
+	m_collisionDataTable.Remove(CollisionHandle(static_cast<uint32_t>(dataID)));
 }
 
+/**
+ * @brief IDՓ˃f[^
+ *
+ * @param[in] dataID Փ˃f[^ID
+ *
+ * @return Փ˃f[^i폜ς݁EIDȂ nullptrj
+ */
+CollisionData* CollisionManager::FindCollisionData(int dataID)
+{
+	if (dataID <= 0) return nullptr;
 
-void CollisionManager::CreateWorkerProxy(std::vector<ThreadCollisionObjectProxy>* collisionObjectProxy, bool isStaticProxy)
+	return m_collisionDataTable.Get(CollisionHandle(static_cast<uint32_t>(dataID)));
+}
+
+const CollisionData* CollisionManager::FindCollisionData(int dataID) const
 {
-	std::vector<ThreadCollisionObjectProxy> localProxies;
+	if (dataID <= 0) return nullptr;
+
+	return m_collisionDataTable.Get(CollisionHandle(static_cast<uint32_t>(dataID)));
+}
+
 
+/**
+ * @brief [J[vLViXibvVbgj쐬
+ *
+ * [g擪ɕׁAȍ~͕DŎqvfǉB
+ * Dɂ邱ƂŁAeߓ_̎qvfzŘA
+ *
+ * @param[out] pSnapshot		ݐ̃XibvVbgie͏㏑j
+ * @param[in]  isStaticProxy	ÓIȃf[^Ώۂɂ邩ǂ
+ */
+void CollisionManager::CreateWorkerProxy(CollisionSnapshot* pSnapshot, bool isStaticProxy)
+{
 #ifdef COLLISIONMANAGER_DEBUG	
 	OutputDebugString(L"============ vLV̍쐬 ============\n");
 #endif 
-	
-	// ǂݎJnOɃbN擾I
-	localProxies.reserve(m_rootCollisionDataId.size());
 
+	pSnapshot->Clear();
+
+	// [g̒ǉ
 	for (auto& id : m_rootCollisionDataId) {
-		auto it = m_collisionIdLookupTable.find(id);
-		if (it == m_collisionIdLookupTable.end()) continue;
+		const CollisionData* pData = FindCollisionData(id);
+		if (!pData) continue;
 
-		ThreadCollisionObjectProxy proxy;
-		// CreateProxył find g߁ÃXR[vňCɏ
-		if (CreateProxy(&proxy, it->second, isStaticProxy)) {
-			localProxies.emplace_back(std::move(proxy));
+		CollisionSnapshotNode node;
+		if (CreateProxy(&node, *pData, isStaticProxy)) {
+			pSnapshot->AddNode(node);
 		}
 	}
+	pSnapshot->SetRootCount(pSnapshot->GetNodeCount());
+
+	// qvf̒ǉiǉߓ_ɏj
+	for (uint32_t nodeIndex = 0; nodeIndex < pSnapshot->GetNodeCount(); nodeIndex++)
+	{
+		const CollisionData& collisionData = *FindCollisionData(pSnapshot->GetNode(nodeIndex).id);
 
-	// ̂܂܋Lf[^֑
-	*collisionObjectProxy = std::move(localProxies);
-	 // ŃAbN
+		const uint32_t childBegin = pSnapshot->GetNodeCount();
+		for (auto& childId : collisionData.children)
+		{
+			// q ID e[uɑ݂邩`FbN
+			const CollisionData* pChildData = FindCollisionData(childId);
+			if (!pChildData) continue;
+
+			CollisionSnapshotNode childNode;
+			if (CreateProxy(&childNode, *pChildData, isStaticProxy))
+			{
+				pSnapshot->AddNode(childNode);
+			}
+		}
+
+		// ǉŔz񂪍Ċmۂ邽߁A͈͍͂Ōɏ
+		CollisionSnapshotNode& node = pSnapshot->GetNode(nodeIndex);
+		node.childBegin = childBegin;
+		node.childCount = pSnapshot->GetNodeCount() - childBegin;
+	}
 }
 
-bool CollisionManager::CreateProxy(ThreadCollisionObjectProxy* pProxy, const CollisionData& collisionData, bool isStaticCreation)
+/**
+ * @brief vLViXibvVbg̐ߓ_j̍쐬
+ *
+ * @param[out] pNode			ߓ_iqvf͈̔͂͌ĂяoŐݒ肷j
+ * @param[in]  collisionData	Փ˃f[^
+ * @param[in]  isStaticCreation	ÓIȃf[^Ώۂɂ邩ǂ
+ *
+ * @returns true  쐬
+ * @returns false ΏۊO
+ */
+bool CollisionManager::CreateProxy(CollisionSnapshotNode* pNode, const CollisionData& collisionData, bool isStaticCreation)
 {
 	if (collisionData.isStatic != isStaticCreation) { return false; }
 
 	// IuWFNgł玸s
 	if (collisionData.pCollider		== nullptr) return false;
 
+	// `͒lƂďށiRC_[͕Ȃj
+	if (!CollisionSnapshot::WriteShape(*collisionData.pCollider, &pNode->shape)) return false;
 
-	pProxy->id			= collisionData.id;
-	pProxy->collider	= collisionData.pCollider->GetClone(); // moveƌ̃f[^̂ŒӁI
-	pProxy->tagBitIndex = collisionData.tagBitIndex;
+	pNode->id			= collisionData.id;
+	pNode->tagBitIndex	= collisionData.tagBitIndex;
 
-	pProxy->tag			= (collisionData.pGameObject) ? collisionData.pGameObject->GetTag() : GameObjectTag::DEFAULT;
-	pProxy->isActive	= (collisionData.pGameObject) ? collisionData.pGameObject->IsActive() : true;
+	pNode->tag			= (collisionData.pGameObject) ? collisionData.pGameObject->GetTag() : GameObjectTag::DEFAULT;
+	pNode->isActive		= (collisionData.pGameObject) ? collisionData.pGameObject->IsActive() : true;
 
-	pProxy->children.reserve(collisionData.children.size());
+	pNode->childBegin	= 0;
+	pNode->childCount	= 0;
 
+	return true;
+}
 
+/**
+ * @brief mۂ𓝌vɉ
+ *
+ * @param[in] bytes		mۂoCg
+ * @param[in] isStatic	ÓIȃvLV̏Ŵ߂̊mۂǂ
+ */
+void CollisionManager::CountSubmitAllocation(size_t bytes, bool isStatic)
+{
+	if (bytes == 0) return;
+
+	if (isStatic)
+	{
+		m_submitStats.staticAllocatedBytes += bytes;
+	}
+	else
+	{
+		m_submitStats.dynamicAllocatedBytes += bytes;
+	}
+	m_submitStats.allocationCount++;
+}
 
-	for (auto& childId : collisionData.children)
+/**
+ * @brief Ԍ̑ΏۂŐVɂ
+ *
+ * o^ς蒼BÓIȊKw̍č\z͐ÓIȃf[^ςɌ
+ *
+ * @return Ԍ
+ */
+CollisionQuery* CollisionManager::UpdateQuery()
+{
+	if (m_isQueryStaticDirty)
 	{
-		// q ID e[uɑ݂邩`FbN
-		auto it = m_collisionIdLookupTable.find(childId);
-		if (it == m_collisionIdLookupTable.end()) continue;
+		std::vector<CollisionQuery::Item> items;
+		CreateQueryItems(true, &items);
+		m_query->SetStaticItems(std::move(items));
+		m_isQueryStaticDirty = false;
+	}
 
-		ThreadCollisionObjectProxy childProxy;
-		if (CreateProxy(&childProxy, it->second, isStaticCreation))
-		{
-			pProxy->children.emplace_back(std::move(childProxy));
-		}
+	if (m_isQueryDynamicDirty)
+	{
+		std::vector<CollisionQuery::Item> items;
+		CreateQueryItems(false, &items);
+		m_query->SetDynamicItems(std::move(items));
+		m_isQueryDynamicDirty = false;
 	}
-	return true;
+
+	return m_query.get();
 }
 
+/**
+ * @brief Ԍ̑Ώۂ쐬
+ *
+ * q̓[g̐ÓItOɏ]BeqOɕׂ
+ *
+ * @param[in]  isStatic		ÓIȃf[^Ώۂɂ邩ǂ
+ * @param[out] pOutItems	Ώ
+ */
+void CollisionManager::CreateQueryItems(bool isStatic, std::vector<CollisionQuery::Item>* pOutItems) const
+{
+	auto addRecursive = [&](auto& self, const CollisionData& data, uint32_t parentIndex) -> void
+		{
+			// 傩RC_[͎̂q܂߂đΏۊO
+			if (!data.pGameObject || !data.pCollider) return;
+
+			const uint32_t index = static_cast<uint32_t>(pOutItems->size());
+			pOutItems->push_back({ data.pGameObject, data.pCollider, parentIndex });
 
+			for (const auto& childId : data.children)
+			{
+				const CollisionData* pChildData = FindCollisionData(childId);
+				if (pChildData)
+				{
+					self(self, *pChildData, index);
+				}
+			}
+		};
 
+	for (const auto& id : m_rootCollisionDataId)
+	{
+		const CollisionData* pData = FindCollisionData(id);
+		if (!pData || pData->isStatic != isStatic) continue;
 
+		addRecursive(addRecursive, *pData, CollisionQuery::NO_PARENT);
+	}
+}
 
+/**
+ * @brief o^̕ύXԌɓ`
+ *
+ * @param[in] isStatic ύXꂽ̂ÓIȃf[^ǂ
+ */
+void CollisionManager::MarkQueryDirty(bool isStatic)
+{
+	if (isStatic)
+	{
+		m_isQueryStaticDirty = true;
+	}
+	else
+	{
+		m_isQueryDynamicDirty = true;
+	}
+}
@@ -16,11 +16,12 @@
 #include <vector>
 #include <thread>
 #include <mutex>
+#include <unordered_map>
 
 // wb_t@C̓ǂݍ ===================================================
 
 // Cu֘A 
-#include "Library/MyLib/IdPool/IdPool.h"
+#include "Library/MyLib/HandleTable/HandleTable.h"
 
 // [eBeB֘A
 #include "Game/Common/Utillities/Collision/Collision.h"
@@ -34,9 +35,14 @@
 
 // Q[vCWbN֘A
 #include "CollisionTypes/CollisionTypes.h"
+#include "ContactPairCache/ContactPairCache.h"
+#include "Game/Common/Framework/Collision/CollisionQuery/CollisionQuery.h"
 
 class CollisionDetectionWorker;
 class CollisionMatrix;
+class IBroadPhase;
+struct StaticCollisionSet;
+class CollisionSnapshot;
 
 // NX̒` ===============================================================
 /**
@@ -51,6 +57,9 @@ class CollisionManager
 	// NX萔̐錾 -------------------------------------------------
 public:
 
+	static constexpr int	CONTINUOUS_MAX_SLIDE_NUM	= 3;		///< AIȈړŖʂɉĊ点񐔂̏
+	static constexpr float	CONTINUOUS_CONTACT_DEPTH	= 0.01f;	///< AIȈړœʂɂ߂荞܂[iʏ̔ŐڐGm邽߁j
+
 	// \̂̐錾
 private:
 
@@ -59,18 +68,33 @@ private:
 	// GCAX錾
 public:
 
+	using CollisionCallback = void (ICollision::*)(const CollisionInfo&);	///< Փ˒ʒm̊֐
+
 	// f[^o̐錾 -----------------------------------------------
 private:
 
 	// Փ˃f[^֘A
-	MyLib::IdPool<UINT> m_idPool;										///< ʎq̍쐬v[
-	std::vector<UINT>	m_rootCollisionDataId;							///< Փ˃f[^̃[gf[^Q
-	std::unordered_map<UINT, CollisionData>	m_collisionIdLookupTable;	///< ANZXpՓ˃f[^Q
+	MyLib::HandleTable<CollisionData> m_collisionDataTable;					///< Փ˃f[^Qinhňj
+	std::vector<int>	m_rootCollisionDataId;								///< Փ˃f[^̃[gf[^Q
+	std::unordered_multimap<const ICollider*, int> m_rootColliderLookup;	///< RC_[烋[gf[^\
 	const CollisionMatrix* m_pCollisionMatrix; ///< ՓˑΉ\
 
 	// Xbh֘A
 	std::unique_ptr<CollisionDetectionWorker> m_collisionDetectionWorker;	///< Փˌm
-	std::vector<ThreadCollisionObjectProxy> m_staticProxies;				///< ÓIȃvLVĩvLVȂ悤ɂ邽߁j
+	std::unique_ptr<CollisionSnapshot> m_frameSnapshot;					///< ̈˗ŏރXibvVbgiՓˌm҂ƌ݂Ɏg񂷁j
+	std::shared_ptr<const StaticCollisionSet> m_staticCollisionSet;		///< ÓIȃXibvVbg̏WĩvLVȂ悤ɂ邽߁j
+	bool m_isStaticSetDirty;												///< ÓIȃXibvVbg̏W蒼ǂ
+
+	CollisionSubmitStats m_submitStats;	///< Փ˔̈˗Ŋmۂ̓v
+
+	// Փ˒ʒm֘A
+	ContactPairCache m_contactPairCache;							///< ڐGĂg̋L^
+	std::vector<ContactPairCache::ContactPair> m_exitPairs;		///< ڐGIgiƗ̈j
+
+	// Ԍ֘A
+	std::unique_ptr<CollisionQuery> m_query;	///< Ԍ
+	bool m_isQueryStaticDirty;					///< ÓIȌΏۂ蒼ǂ
+	bool m_isQueryDynamicDirty;					///< IȌΏۂ蒼ǂ
 
 
 #ifdef COLLISIONMANAGER_DEBUG
@@ -99,24 +123,46 @@ public:
 	// 񓯊蔻̊Jni^XN̔j
 	void RequestCollisionDetection();
 
-	// ÓIȃvLV̍쐬
+	// ÓIȃvLV̍쐬iÓIȃf[^ς͈˗Ɏō蒼j
 	void CreateStaticProxy();
 
 	// I
 	void Finalize();
 
 	// Փ˔IuWFNg̒ǉ
-	void AddCollisionData(const CollisionData& collisionData);
-	void AddCollisionData(const CollisionData& childCollisionData, ICollider* parent);
+	CollisionHandle AddCollisionData(const CollisionData& collisionData);
+	CollisionHandle AddCollisionData(const CollisionData& childCollisionData, ICollider* parent);
+	CollisionHandle AddCollisionData(const CollisionData& childCollisionData, CollisionHandle parent);
 	// 폜
 	void RemoveCollisionObjectData(GameObject* pRemoveGameObject, ICollider* pCollider);
+	bool RemoveCollisionData(CollisionHandle handle);
 	void RemoveAll();
 
+	// nho^̏Փ˃f[^wĂ邩ǂ
+	bool IsRegistered(CollisionHandle handle) const { return m_collisionDataTable.IsValid(handle); }
+
 
 
 	// w肵RC_[̏Փˏ擾
 	bool RetrieveCollisionData(const ICollider* pCheckCollider, std::vector<const GameObject*>* pHitGameObjects, std::vector<const ICollider*>* pHitColliders = nullptr);
 
+	// Ԍ
+	// ƍŏɓRC_[߂
+	bool Raycast(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance, QueryHit* pOutHit, const QueryFilter& filter = QueryFilter());
+	// ƓSẴRC_[߂ɋ߂
+	size_t RaycastAll(const DirectX::SimpleMath::Vector3& origin, const DirectX::SimpleMath::Vector3& direction, float maxDistance, std::vector<QueryHit>* pOutHits, const QueryFilter& filter = QueryFilter());
+	// ƏdȂRC_[߂
+	size_t OverlapSphere(const DirectX::SimpleMath::Vector3& center, float radius, std::vector<QueryHit>* pOutHits, const QueryFilter& filter = QueryFilter());
+	// AABB ƏdȂRC_[߂
+	size_t OverlapAABB(const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& extend, std::vector<QueryHit>* pOutHits, const QueryFilter& filter = QueryFilter());
+	// JvZ𓮂čŏɓRC_[߂
+	bool SweepCapsule(const Capsule& capsule, const DirectX::SimpleMath::Vector3& direction, float maxDistance, QueryHit* pOutHit, const QueryFilter& filter = QueryFilter());
+	// 𓮂čŏɓRC_[߂
+	bool SweepSphere(const DirectX::SimpleMath::Vector3& center, float radius, const DirectX::SimpleMath::Vector3& direction, float maxDistance, QueryHit* pOutHit, const QueryFilter& filter = QueryFilter());
+
+	// AIȏՓ˔gړʂ߂i`󂪔n`ʂ蔲Ȃ悤ɂj
+	DirectX::SimpleMath::Vector3 CalcContinuousMove(const ICollider& shape, const DirectX::SimpleMath::Vector3& displacement, const QueryFilter& filter, DirectX::SimpleMath::Vector3* pVelocity = nullptr, QueryHit* pOutHit = nullptr);
+
 
 
 	// 擾/ݒ
@@ -125,6 +171,15 @@ public:
 	// Փˌm\̐ݒ
 	void SetCollisionMatrix(const CollisionMatrix* pCollisionMatrix);
 
+	// L攻̐ݒ
+	void SetBroadPhase(std::unique_ptr<IBroadPhase> broadPhase);
+
+	// ڍהɎgXbh̐ݒ
+	void SetNarrowPhaseThreadNum(uint32_t threadNum);
+
+	// ȌՓ˔̈˗Ŋmۂ̓v̎擾
+	const CollisionSubmitStats& GetSubmitStats() const { return m_submitStats; }
+
 	// 
 private:
 
@@ -136,17 +191,35 @@ private:
 
 	// Փ˂̒ʒm
 	void NotifyCollisionEvents(std::vector<DetectedCollisonData>* pDetectedCollisions);
+	// 1g̏Փ˒ʒm𑗂
+	void SendCollisionEvent(CollisionEventFlag event, CollisionCallback callback, int idA, int idB);
+	// 폜Փ˃f[^ƐڐGĂɐڐG̏Iʒm
+	void NotifyRemovedContacts(int dataID);
 
 	// ㏈
 	void FinalizeCollision();
 
 	// ANZXpe[uɓo^
-	UINT RegisterIdLookUpTable(CollisionData data);
+	CollisionHandle RegisterIdLookUpTable(CollisionData data);
 	// ANZXpe[u폜
-	void UnregisterIdLookUpTable(UINT dataID);
+	void UnregisterIdLookUpTable(int dataID);
+
+	// IDՓ˃f[^i폜ς݂Ȃ nullptrj
+	CollisionData* FindCollisionData(int dataID);
+	const CollisionData* FindCollisionData(int dataID) const;
 
 	//  [J[vLV쐬
-	void CreateWorkerProxy(std::vector<ThreadCollisionObjectProxy>* collisionObjectProxy, bool isStaticProxy);
-	// vLV̍쐬
-	bool CreateProxy(ThreadCollisionObjectProxy* pProxy, const CollisionData& collisionData, bool isStaticCreation);
+	void CreateWorkerProxy(CollisionSnapshot* pSnapshot, bool isStaticProxy);
+	// vLViXibvVbg̐ߓ_j̍쐬
+	bool CreateProxy(CollisionSnapshotNode* pNode, const CollisionData& collisionData, bool isStaticCreation);
+
+	// mۂ𓝌vɉ
+	void CountSubmitAllocation(size_t bytes, bool isStatic);
+
+	// Ԍ̑ΏۂŐVɂ
+	CollisionQuery* UpdateQuery();
+	// Ԍ̑Ώۂ쐬
+	void CreateQueryItems(bool isStatic, std::vector<CollisionQuery::Item>* pOutItems) const;
+	// o^̕ύXԌɓ`
+	void MarkQueryDirty(bool isStatic);
 };
@@ -0,0 +1,302 @@
+/*****************************************************************//**
+ * @file    CollisionSnapshot.cpp
+ * @brief   Փ˔pXibvVbgɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionSnapshot.h"
+
+#include "Game/Common/Framework/Collision/CollisionDispatcher/CollisionDispatcher.h"
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * @param[in] Ȃ
+ */
+CollisionSnapshot::CollisionSnapshot()
+	: m_nodes{}
+	, m_rootCount{ 0 }
+{
+
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+CollisionSnapshot::~CollisionSnapshot()
+{
+
+}
+
+/**
+ * @brief 폜ieʂ͎cj
+ */
+void CollisionSnapshot::Clear()
+{
+	m_nodes.clear();
+	m_rootCount = 0;
+}
+
+/**
+ * @brief ߓ_̒ǉ
+ *
+ * @param[in] node ߓ_
+ *
+ * @return ǉߓ_̔ԍ
+ */
+uint32_t CollisionSnapshot::AddNode(const CollisionSnapshotNode& node)
+{
+	m_nodes.push_back(node);
+	return static_cast<uint32_t>(m_nodes.size() - 1);
+}
+
+/**
+ * @brief RC_[`󃌃R[h쐬
+ *
+ * @param[in]  collider		RC_[
+ * @param[out] pOutShape	`󃌃R[h
+ *
+ * @returns true  쐬
+ * @returns false ΉĂȂ
+ */
+bool CollisionSnapshot::WriteShape(const ICollider& collider, CollisionShape* pOutShape)
+{
+	pOutShape->type = collider.GetColliderType();
+
+	switch (pOutShape->type)
+	{
+	case ColliderType::Sphere:
+	{
+		const Sphere& sphere = static_cast<const Sphere&>(collider);
+		pOutShape->sphere.center = sphere.GetPosition();
+		pOutShape->sphere.radius = sphere.GetRadius();
+		return true;
+	}
+	case ColliderType::Plane:
+	{
+		const Plane& plane = static_cast<const Plane&>(collider);
+		pOutShape->plane.plane = plane.GetVector4();
+		return true;
+	}
+	case ColliderType::Triangle:
+	{
+		const Triangle& triangle = static_cast<const Triangle&>(collider);
+		const auto& vertices = triangle.GetPosition();
+		for (int i = 0; i < 3; i++)
+		{
+			pOutShape->triangle.vertices[i] = vertices[i];
+		}
+		return true;
+	}
+	case ColliderType::BOX2D:
+	{
+		// ̎Op` ABC  CDA Ȃ̂ŁAABC  D oΌɖ߂
+		const Box2D& box = static_cast<const Box2D&>(collider);
+		const auto& verticesABC = box.GetTriangle(0).GetPosition();
+		const auto& verticesCDA = box.GetTriangle(1).GetPosition();
+		pOutShape->box2D.vertices[0] = verticesABC[0];
+		pOutShape->box2D.vertices[1] = verticesABC[1];
+		pOutShape->box2D.vertices[2] = verticesABC[2];
+		pOutShape->box2D.vertices[3] = verticesCDA[1];
+		return true;
+	}
+	case ColliderType::Segment:
+	{
+		const Segment& segment = static_cast<const Segment&>(collider);
+		pOutShape->segment.position = segment.GetPosition();
+		pOutShape->segment.vector = segment.GetVector();
+		return true;
+	}
+	case ColliderType::AABB:
+	{
+		const AABB& aabb = static_cast<const AABB&>(collider);
+		pOutShape->aabb.center = aabb.GetCenter();
+		pOutShape->aabb.extend = aabb.GetExtend();
+		return true;
+	}
+	case ColliderType::Cylinder:
+	{
+		const Cylinder& cylinder = static_cast<const Cylinder&>(collider);
+		pOutShape->capsule.position = cylinder.GetPosition();
+		pOutShape->capsule.axis = cylinder.GetAxis();
+		pOutShape->capsule.length = cylinder.GetLength();
+		pOutShape->capsule.radius = cylinder.GetRadius();
+		return true;
+	}
+	case ColliderType::Capsule:
+	{
+		const Capsule& capsule = static_cast<const Capsule&>(collider);
+		pOutShape->capsule.position = capsule.GetPosition();
+		pOutShape->capsule.axis = capsule.GetAxis();
+		pOutShape->capsule.length = capsule.GetLength();
+		pOutShape->capsule.radius = capsule.GetRadius();
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+
+
+/**
+ * @brief RXgN^
+ *
+ * @param[in] Ȃ
+ */
+ColliderScratch::Slot::Slot()
+	: sphere{}
+	, plane{}
+	, triangle{ DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::Zero }
+	, box2D{ DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::Zero }
+	, segment{}
+	, aabb{ DirectX::SimpleMath::Vector3::Zero, DirectX::SimpleMath::Vector3::Zero }
+	, cylinder{}
+	, capsule{}
+	, pShape{ nullptr }
+	, pCollider{ nullptr }
+{
+
+}
+
+/**
+ * @brief RXgN^
+ *
+ * @param[in] Ȃ
+ */
+ColliderScratch::ColliderScratch()
+	: m_slots{}
+{
+
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+ColliderScratch::~ColliderScratch()
+{
+
+}
+
+/**
+ * @brief `󃌃R[h̋L^̔j
+ *
+ * XibvVbg͎g񂷂߁AAhX̌`󃌃R[hłeςĂ
+ */
+void ColliderScratch::Reset()
+{
+	for (Slot& slot : m_slots)
+	{
+		slot.pShape		= nullptr;
+		slot.pCollider	= nullptr;
+	}
+}
+
+/**
+ * @brief `󃌃R[hRC_[𕜌
+ *
+ * Oɓ֓`󃌃R[h𕜌Ă΁A߂ɂ̃RC_[Ԃ
+ *
+ * @param[in] shape		`󃌃R[h
+ * @param[in] slotIndex	̔ԍiɓԍŕ܂ŗLj
+ *
+ * @return RC_[iΉĂȂނȂ nullptrj
+ */
+const ICollider* ColliderScratch::Restore(const CollisionShape& shape, int slotIndex)
+{
+	using namespace DirectX::SimpleMath;
+
+	Slot& slot = m_slots[slotIndex];
+
+	if (slot.pShape == &shape) return slot.pCollider;
+
+	const ICollider* pCollider = nullptr;
+	switch (shape.type)
+	{
+	case ColliderType::Sphere:
+		slot.sphere.Transform(shape.sphere.center);
+		slot.sphere.SetRadius(shape.sphere.radius);
+		pCollider = &slot.sphere;
+		break;
+
+	case ColliderType::Plane:
+		slot.plane.Set(Vector4(shape.plane.plane));
+		pCollider = &slot.plane;
+		break;
+
+	case ColliderType::Triangle:
+		slot.triangle.Set(shape.triangle.vertices[0], shape.triangle.vertices[1], shape.triangle.vertices[2]);
+		pCollider = &slot.triangle;
+		break;
+
+	case ColliderType::BOX2D:
+		slot.box2D.Set(shape.box2D.vertices[0], shape.box2D.vertices[1], shape.box2D.vertices[2], shape.box2D.vertices[3]);
+		pCollider = &slot.box2D;
+		break;
+
+	case ColliderType::Segment:
+		slot.segment.Set(shape.segment.position, shape.segment.vector);
+		pCollider = &slot.segment;
+		break;
+
+	case ColliderType::AABB:
+		slot.aabb.SetCenter(shape.aabb.center);
+		slot.aabb.SetExtend(shape.aabb.extend);
+		pCollider = &slot.aabb;
+		break;
+
+	case ColliderType::Cylinder:
+		slot.cylinder.SetPosition(shape.capsule.position);
+		slot.cylinder.SetAxis(shape.capsule.axis);
+		slot.cylinder.SetLength(shape.capsule.length);
+		slot.cylinder.SetRadius(shape.capsule.radius);
+		pCollider = &slot.cylinder;
+		break;
+
+	case ColliderType::Capsule:
+		slot.capsule.SetPosition(shape.capsule.position);
+		slot.capsule.SetAxis(shape.capsule.axis);
+		slot.capsule.SetLength(shape.capsule.length);
+		slot.capsule.SetRadius(shape.capsule.radius);
+		pCollider = &slot.capsule;
+		break;
+
+	default:
+		break;
+	}
+
+	slot.pShape		= &shape;
+	slot.pCollider	= pCollider;
+	return pCollider;
+}
+
+/**
+ * @brief `󃌃R[hm̏Փ˔
+ *
+ * @param[in] shapeA `󃌃R[hA
+ * @param[in] shapeB `󃌃R[hB
+ *
+ * @returns true Փ˂Ă
+ */
+bool ColliderScratch::DetectCollision(const CollisionShape& shapeA, const CollisionShape& shapeB)
+{
+	// ߓ_ςđ߁Aς݂̑͂̕g񂷁iq̔ł A  B ւj
+	const int slotA = (m_slots[1].pShape == &shapeA || m_slots[0].pShape == &shapeB) ? 1 : 0;
+
+	const ICollider* pColliderA = Restore(shapeA, slotA);
+	const ICollider* pColliderB = Restore(shapeB, 1 - slotA);
+	if (!pColliderA || !pColliderB) return false;
+
+	return CollisionDispatcher::DetectCollision(pColliderA, pColliderB);
+}
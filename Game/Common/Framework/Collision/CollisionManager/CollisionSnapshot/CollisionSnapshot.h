@@ -0,0 +1,147 @@
+/*****************************************************************//**
+ * @file    CollisionSnapshot.h
+ * @brief   Փ˔pXibvVbgɊւwb_[t@C
+ *
+ * RC_[𕡐A`󃌃R[hAzɏōƃXbh֓n
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionTypes/CollisionTypes.h"
+#include "Game/Common/Utillities/Collision/Collision.h"
+
+
+// NX̑O錾 ===================================================
+
+// NX̒` ===============================================================
+/**
+ * @brief Փ˔pXibvVbg
+ *
+ * 擪 rootCount [gAȍ~͕D̏ɎqvfԁB
+ * eߓ_̎qvf͘AĂ邽߁A͈͂ŎQƂłB
+ * Clear Ăeʂ͎ĉŁAg񂹂Ζt[̊mۂ͔Ȃ
+ */
+class CollisionSnapshot
+{
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	std::vector<CollisionSnapshotNode>	m_nodes;		///< ߓ_
+	uint32_t							m_rootCount;	///< [g̐
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	CollisionSnapshot();
+
+	// fXgN^
+	~CollisionSnapshot();
+
+
+// 
+public:
+	// 폜ieʂ͎cj
+	void Clear();
+
+	// ߓ_̒ǉ
+	uint32_t AddNode(const CollisionSnapshotNode& node);
+
+	// RC_[`󃌃R[h쐬
+	static bool WriteShape(const ICollider& collider, CollisionShape* pOutShape);
+
+
+// 擾/ݒ
+public:
+	// ߓ_̎擾
+	const CollisionSnapshotNode& GetNode(uint32_t index) const { return m_nodes[index]; }
+	CollisionSnapshotNode& GetNode(uint32_t index) { return m_nodes[index]; }
+
+	// ߓ_̐̎擾
+	uint32_t GetNodeCount() const { return static_cast<uint32_t>(m_nodes.size()); }
+
+	// [g̐̐ݒ
+	void SetRootCount(uint32_t rootCount) { m_rootCount = rootCount; }
+	// [g̐̎擾
+	uint32_t GetRootCount() const { return m_rootCount; }
+
+	// mۂĂ郁̃oCg̎擾
+	size_t GetAllocatedBytes() const { return m_nodes.capacity() * sizeof(CollisionSnapshotNode); }
+};
+
+
+/**
+ * @brief RC_[̕pƗ̈
+ *
+ * `󃌃R[h̃RC_[ɏ߂A]̏Փ˔̂܂܎gB
+ * RC_[͎g񂷂ߊmۂ͔ȂBXbhƂ1ƁB
+ * Oɕ`󃌃R[h͏߂Ɏg߁AXibvVbg蒼 Reset 邱
+ */
+class ColliderScratch
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr int SLOT_NUM = 2;	///< ɕłRC_[̐iyA̗j
+
+// \̂̐錾
+private:
+
+	/**
+	 * @brief ނƂ̃RC_[
+	 */
+	struct Slot
+	{
+		Sphere		sphere;
+		Plane		plane;
+		Triangle	triangle;
+		Box2D		box2D;
+		Segment		segment;
+		AABB		aabb;
+		Cylinder	cylinder;
+		Capsule		capsule;
+
+		const CollisionShape*	pShape;		///< `󃌃R[h
+		const ICollider*		pCollider;	///< RC_[
+
+		Slot();
+	};
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	Slot m_slots[SLOT_NUM];	///< 
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	ColliderScratch();
+
+	// fXgN^
+	~ColliderScratch();
+
+
+// 
+public:
+	// `󃌃R[h̋L^̔j
+	void Reset();
+
+	// `󃌃R[hRC_[𕜌
+	const ICollider* Restore(const CollisionShape& shape, int slotIndex);
+
+	// `󃌃R[hm̏Փ˔
+	bool DetectCollision(const CollisionShape& shapeA, const CollisionShape& shapeB);
+};
@@ -3,7 +3,7 @@
  * @brief  蔻VXeŎgp鋤ʂ̍\́ENX`
  * 
  * CXbhp̎̃f[^(CollisionData)ƁA
- * TuXbhp̃Rs[f[^(ThreadCollisionObjectProxy)𕪗Ē`܂B
+ * TuXbhp̃Rs[f[^(CollisionSnapshotNode)𕪗Ē`܂B
  * * @author 
  * @date   2025/03/22
  */
@@ -18,10 +18,48 @@
 // wb_t@C̓ǂݍ ===================================================
 #include "Game/GameObjects/Common/GameObject.h"
 #include "Game/Common/Utillities/Collision/ICollision.h"
+#include "Game/Common/Utillities/Collision/ICollider.h"
+#include "Library/MyLib/HandleTable/HandleTable.h"
 
 // O錾
 class GameObject;
 
+/**
+ * @brief Փ˃f[^̃nh
+ * 
+ *  o^ɔs܂B폜 RemoveAll ̃nh͐̈ႢŖƔ肳܂B
+ *  l͂̂܂܏Փ˃f[^IDƂĎg܂B
+ */
+using CollisionHandle = MyLib::Handle;
+
+/**
+ * @brief 󂯎Փ˒ʒm̎
+ * 
+ *  ON_COLLISION ͐ڐGĂԁAt[ OnCollision Ăт܂i]̒ʒmjB
+ *  ENTERESTAYEEXIT ͐ڐG̊JnEpEI̎ɑΉ֐Ăт܂B
+ */
+enum class CollisionEventFlag : uint32_t
+{
+    NONE            = 0,
+    ON_COLLISION    = 1 << 0,   ///< OnCollisionit[j
+    ENTER           = 1 << 1,   ///< OnCollisionEnteriڐG̊Jnj
+    STAY            = 1 << 2,   ///< OnCollisionStayiڐǦpj
+    EXIT            = 1 << 3,   ///< OnCollisionExitiڐG̏Ij
+
+    TRANSITION      = ENTER | EXIT,             ///< ڐG̊JnƏÎ
+};
+
+// rbgZqg₷邽߂̃I[o[[h
+inline CollisionEventFlag operator|(CollisionEventFlag a, CollisionEventFlag b)
+{
+    return static_cast<CollisionEventFlag>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+}
+// ANDZq (&) ̒` (莞Ɏg)
+inline CollisionEventFlag operator&(CollisionEventFlag a, CollisionEventFlag b)
+{
+    return static_cast<CollisionEventFlag>(static_cast<uint32_t>(a) & static_cast<uint32_t>(b));
+}
+
 /**
  * @brief Փ˒ʒmpCtH[V
  * 
@@ -43,19 +81,58 @@ public:
 };
 
 /**
- * @brief L攻iu[htF[Yjp̈ꎞf[^
+ * @brief L攻iu[htF[Yjp̋Ef[^
  * 
- *  ڍׂ͌قǎ\̋ԕ̍œKɎgp܂B
+ *  [gvLVƂɎZosE{bNXłB
+ *  ʂ̂悤ɋEȂ` isUnbounded 𗧂āASĂ̑ƌyAɂȂ܂B
  */
 struct BroadCollision
 {
-    ICollider* pCollider;       ///< Ώۂ̃RC_[
-    bool       isHit;           ///< Փ˃tO
+    DirectX::SimpleMath::Vector3 min;   ///< E{bNX̍ŏ_
+    DirectX::SimpleMath::Vector3 max;   ///< E{bNX̍ő_
+    uint32_t    proxyIndex;             ///< ΏۃvLṼCfbNX
+    bool        isUnbounded;            ///< EȂ`󂩂ǂ
+
+    BroadCollision()
+        : min{}
+        , max{}
+        , proxyIndex{ 0 }
+        , isUnbounded{ false }
+    {
+    }
+
+    /**
+     * @brief E{bNXmdȂĂ邩ǂiڐGdȂƂ݂Ȃj
+     */
+    bool Overlaps(const BroadCollision& other) const
+    {
+        if (isUnbounded || other.isUnbounded) return true;
+
+        return (min.x <= other.max.x && other.min.x <= max.x)
+            && (min.y <= other.max.y && other.min.y <= max.y)
+            && (min.z <= other.max.z && other.min.z <= max.z);
+    }
+};
+
+/**
+ * @brief L攻ʉ߂yA
+ * 
+ *  vLVz̃CfbNXێ܂B indexA < indexB ƂȂ悤Ɋi[܂B
+ */
+struct BroadPhasePair
+{
+    uint32_t indexA;    ///< vLVÃCfbNX
+    uint32_t indexB;    ///< vLVB̃CfbNX
+
+    BroadPhasePair(uint32_t a, uint32_t b)
+        : indexA{ (a < b) ? a : b }
+        , indexB{ (a < b) ? b : a }
+    {
+    }
 
-    BroadCollision(ICollider* pCollider)
-        : pCollider{ pCollider }
-        , isHit{ false }
+    bool operator<(const BroadPhasePair& other) const
     {
+        return (indexA != other.indexA) ? (indexA < other.indexA) : (indexB < other.indexB);
     }
 };
 
@@ -67,23 +144,32 @@ struct BroadCollision
  */
 struct CollisionData
 {
+    static constexpr uint32_t NOT_ROOT = 0xFFFFFFFFu;   ///< [gł͂Ȃ
+
     GameObject* pGameObject;    ///< Փ˒ʒm𑗂Ώۂ̃IuWFNg
     ICollider* pCollider;       ///< `f[^i{́j
 
-    int         id;             ///< IuWFNgŗL̃j[NIDivLVƂ̕RtɎgpj
+    int         id;             ///< IuWFNgŗL̃j[NIDinh̒lBvLVƂ̕RtɎgpj
     uint32_t    tagBitIndex;    ///< Փ˃}gbNXQƗp̃^OrbgʒuipLbVj
 
     std::vector<int> children;  ///< qIuWFNgiʂȂǁjCollisionData IDXg
+    int         parentId;       ///< eIDi[gȂ -1j
+    uint32_t    rootIndex;      ///< [gꗗł̈ʒuiqȂ NOT_ROOTj
 
     bool isStatic;              ///< ÓIIuWFNgtOitrueȂ瓮Ȃ̂ƂĔœKj
 
+    CollisionEventFlag eventFlags;  ///< 󂯎Փ˒ʒm̎
+
     CollisionData()
         : pGameObject{ nullptr }
         , pCollider{ nullptr }
         , tagBitIndex{ 0 }
         , children{}
         , id{ -1 }
+        , parentId{ -1 }
+        , rootIndex{ NOT_ROOT }
         , isStatic{ false }
+        , eventFlags{ CollisionEventFlag::ON_COLLISION }
     {
     }
 
@@ -92,11 +178,13 @@ struct CollisionData
      * @param pGameObject RtIuWFNg
      * @param pCollider   gpRC_[
      * @param isStatic    ړȂIuWFNgǂ
+     * @param eventFlags  󂯎Փ˒ʒm̎
      */
-    CollisionData(GameObject* pGameObject, ICollider* pCollider, bool isStatic)
+    CollisionData(GameObject* pGameObject, ICollider* pCollider, bool isStatic, CollisionEventFlag eventFlags = CollisionEventFlag::ON_COLLISION)
         : CollisionData{}
     {
         this->isStatic = isStatic;
+        this->eventFlags = eventFlags;
         this->pGameObject = pGameObject;
         this->pCollider = pCollider;
         if (pGameObject)
@@ -111,6 +199,26 @@ struct CollisionData
     }
 };
 
+/**
+ * @brief Փ˔̈˗Ŋmۂ̓v
+ * 
+ *  RequestCollisionDetection 1񕪂̒lłBmۗʂ̓XibvVbg̗eʂ̑łB
+ *  XibvVbg͎g񂷂߁AIuWFNgςȂʏ̃t[ł 0 ɂȂ܂B
+ */
+struct CollisionSubmitStats
+{
+    size_t dynamicAllocatedBytes;   ///< IȃXibvVbg̍쐬ŊmۂoCg
+    size_t staticAllocatedBytes;    ///< ÓIȃXibvVbg̍č\zŊmۂoCg
+    size_t allocationCount;         ///< mۉ
+
+    CollisionSubmitStats()
+        : dynamicAllocatedBytes{ 0 }
+        , staticAllocatedBytes{ 0 }
+        , allocationCount{ 0 }
+    {
+    }
+};
+
 /**
  * @brief Փˌmʃf[^
  * 
@@ -123,70 +231,58 @@ struct DetectedCollisonData
 };
 
 /**
- * @brief Փ˔pvLViTuXbhpRs[j
+ * @brief `󃌃R[hiTuXbhpRs[j
+ * 
+ *  RC_[̔ɕKvȐl^tp̂łBq[vmۂAzɂ̂܂ܕׂ܂B
+ *  Cylinder  Capsule ͓`icapsulejg܂B
+ */
+struct CollisionShape
+{
+    /// 
+    struct SphereShape      { DirectX::XMFLOAT3 center; float radius; };
+    /// 
+    struct PlaneShape       { DirectX::XMFLOAT4 plane; };
+    /// Op`
+    struct TriangleShape    { DirectX::XMFLOAT3 vertices[3]; };
+    /// `iOp` ABC  CDAj
+    struct Box2DShape       { DirectX::XMFLOAT3 vertices[4]; };
+    /// 
+    struct SegmentShape     { DirectX::XMFLOAT3 position; DirectX::XMFLOAT3 vector; };
+    /// AABB
+    struct AABBShape        { DirectX::XMFLOAT3 center; DirectX::XMFLOAT3 extend; };
+    /// EJvZ
+    struct CapsuleShape     { DirectX::XMFLOAT3 position; DirectX::XMFLOAT3 axis; float length; float radius; };
+
+    ColliderType type;      ///< RC_[̎ށip̂̂ǂꂪLj
+
+    union
+    {
+        SphereShape     sphere;
+        PlaneShape      plane;
+        TriangleShape   triangle;
+        Box2DShape      box2D;
+        SegmentShape    segment;
+        AABBShape       aabb;
+        CapsuleShape    capsule;
+    };
+};
+
+/**
+ * @brief Փ˔pXibvVbg̐ߓ_iTuXbhpRs[j
  * 
  * XbhZ[tɔs߁AɕKvȐlf[^݂̂uXibvVbgvƂĕ̂łB
+ * qvf̓|C^ł͂ȂAz̘Á͈ichildBegin  childCount jŕ\܂B
  * TuXbh͂̃f[^݂̂QƂAGameObjectɂ͒ڃANZX܂B
  */
-struct ThreadCollisionObjectProxy
+struct CollisionSnapshotNode
 {
     bool isActive;              ///< LtOiANeBuȂ画XLbvj
     GameObjectTag tag;          ///< IuWFNg̎ށi^Oj
     uint32_t    tagBitIndex;    ///< Փ˃}gbNXQƗp̃^Orbgʒu
 
-    int id;                                             ///< CollisionDataƕRt邽߂ID
-    std::unique_ptr<ICollider> collider;                ///< `f[^̃fB[vRs[
-    std::vector<ThreadCollisionObjectProxy> children;   ///< qvf̃vLVXg
-
-    ThreadCollisionObjectProxy()
-        : id{ -1 }
-        , tag{ GameObjectTag::DEFAULT }
-        , tagBitIndex{ 0 }
-        , isActive{ false }
-    {
-    }
-
-    /**
-     * @brief Rs[RXgN^ifB[vRs[j
-     * 
-     *  IColliderGetClone()gpāA`f[^Sɕ܂B
-     */
-    ThreadCollisionObjectProxy(const ThreadCollisionObjectProxy& origin)
-        : id{ origin.id }
-        , collider{ }
-        , children{ origin.children }
-        , tag{ origin.tag }
-        , tagBitIndex{ origin.tagBitIndex }
-        , isActive{ origin.isActive }
-    {
-        if (origin.collider)
-        {
-            collider = origin.collider->GetClone();
-        }
-    }
-
-    /**
-     * @brief ZqifB[vRs[j
-     */
-    ThreadCollisionObjectProxy& operator=(const ThreadCollisionObjectProxy& origin)
-    {
-        if (this != &origin) {
-            id = origin.id;
-            tag = origin.tag;
-            tagBitIndex = origin.tagBitIndex;
-            isActive = origin.isActive;
-            children = origin.children;
-            if (origin.collider) {
-                collider = origin.collider->GetClone();
-            }
-            else {
-                collider.reset();
-            }
-        }
-        return *this;
-    }
+    int id;                     ///< CollisionDataƕRt邽߂ID
+    CollisionShape shape;       ///< `f[^
 
-    // [uZ}eBNXLɂ邽߂̃ftHg`
-    ThreadCollisionObjectProxy(ThreadCollisionObjectProxy&&) noexcept = default;
-    ThreadCollisionObjectProxy& operator=(ThreadCollisionObjectProxy&&) noexcept = default;
-};
\ No newline at end of file
+    uint32_t childBegin;        ///< qvf̊Jnԍ
+    uint32_t childCount;        ///< qvf̐
+};
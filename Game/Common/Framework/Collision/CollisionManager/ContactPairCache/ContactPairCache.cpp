@@ -0,0 +1,229 @@
+/*****************************************************************//**
+ * @file    ContactPairCache.cpp
+ * @brief   ڐGĂg̋L^Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "ContactPairCache.h"
+
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+ContactPairCache::ContactPairCache()
+	: m_entries(MIN_CAPACITY, Entry{ 0, 0 })
+	, m_pairCount{ 0 }
+	, m_frame{ 0 }
+	, m_survivors{}
+{
+}
+
+/**
+ * @brief fXgN^
+ */
+ContactPairCache::~ContactPairCache()
+{
+}
+
+/**
+ * @brief t[̊Jn
+ */
+void ContactPairCache::BeginFrame()
+{
+	m_frame++;
+}
+
+/**
+ * @brief ڐGg̋L^
+ *
+ * @param[in] idA Փ˃f[^AID
+ * @param[in] idB Փ˃f[^BID
+ *
+ * @return ڐG̏
+ */
+ContactPairCache::ContactState ContactPairCache::Touch(int idA, int idB)
+{
+	// gp𒴂L
+	if ((m_pairCount + 1) * 2 > m_entries.size())
+	{
+		Rehash(m_entries.size() * 2, false);
+	}
+
+	const uint64_t key = MakeKey(idA, idB);
+	Entry& entry = m_entries[FindSlot(key)];
+
+	if (entry.key == 0)
+	{
+		entry.key	= key;
+		entry.frame = m_frame;
+		m_pairCount++;
+		return ContactState::ENTER;
+	}
+
+	if (entry.frame == m_frame)
+	{
+		return ContactState::DUPLICATE;
+	}
+
+	entry.frame = m_frame;
+	return ContactState::STAY;
+}
+
+/**
+ * @brief t[̏I
+ *
+ * ̃t[ŋL^ȂgoAL^O
+ *
+ * @param[out] pOutExitPairs ڐGIgiǋLj
+ */
+void ContactPairCache::EndFrame(std::vector<ContactPair>* pOutExitPairs)
+{
+	const size_t exitBegin = pOutExitPairs->size();
+
+	for (const Entry& entry : m_entries)
+	{
+		if (entry.key != 0 && entry.frame != m_frame)
+		{
+			pOutExitPairs->push_back({ static_cast<int>(entry.key >> 32), static_cast<int>(entry.key & 0xFFFFFFFFu) });
+		}
+	}
+
+	// JԒn@ł͗vfPɏȂ߁AIgclߒ
+	if (pOutExitPairs->size() != exitBegin)
+	{
+		Rehash(m_entries.size(), true);
+	}
+}
+
+/**
+ * @brief w肵Փ˃f[^܂ޑg̍폜
+ *
+ * Փ˃f[^폜鎞ɁAc鑊֐ڐG̏Iʒm邽߂Ɏg
+ *
+ * @param[in]  id				Փ˃f[^ID
+ * @param[out] pOutRemovedPairs	OgiǋLj
+ */
+void ContactPairCache::RemovePairs(int id, std::vector<ContactPair>* pOutRemovedPairs)
+{
+	const size_t removedBegin = pOutRemovedPairs->size();
+
+	for (Entry& entry : m_entries)
+	{
+		if (entry.key == 0) continue;
+
+		const ContactPair pair{ static_cast<int>(entry.key >> 32), static_cast<int>(entry.key & 0xFFFFFFFFu) };
+		if (pair.idA != id && pair.idB != id) continue;
+
+		pOutRemovedPairs->push_back(pair);
+		entry.key = 0;
+	}
+
+	// 󂫂ƒTrŎ~܂邽߁AOgclߒ
+	if (pOutRemovedPairs->size() != removedBegin)
+	{
+		Rehash(m_entries.size(), false);
+	}
+}
+
+/**
+ * @brief SĂ̋L^̍폜
+ */
+void ContactPairCache::Clear()
+{
+	std::fill(m_entries.begin(), m_entries.end(), Entry{ 0, 0 });
+	m_pairCount = 0;
+}
+
+/**
+ * @brief g̃L[̍쐬
+ *
+ * @param[in] idA Փ˃f[^AID
+ * @param[in] idB Փ˃f[^BID
+ *
+ * @return IDʁA傫IDʂɋl߂L[
+ */
+uint64_t ContactPairCache::MakeKey(int idA, int idB)
+{
+	const uint32_t low	= static_cast<uint32_t>((idA < idB) ? idA : idB);
+	const uint32_t high = static_cast<uint32_t>((idA < idB) ? idB : idA);
+
+	return (static_cast<uint64_t>(low) << 32) | high;
+}
+
+/**
+ * @brief L[vf󂫂̈ʒuT
+ *
+ * @param[in] key g̃L[
+ *
+ * @return vf̈ʒu
+ */
+size_t ContactPairCache::FindSlot(uint64_t key) const
+{
+	const size_t mask = m_entries.size() - 1;
+
+	size_t index = Hash(key) & mask;
+	while (m_entries[index].key != 0 && m_entries[index].key != key)
+	{
+		index = (index + 1) & mask;
+	}
+
+	return index;
+}
+
+/**
+ * @brief eʂςċlߒ
+ *
+ * @param[in] capacity		eʁi2ׂ̂j
+ * @param[in] isFrameEnd	t[̏I肩ǂiIȂ炱̃t[ŋL^ꂽgcj
+ */
+void ContactPairCache::Rehash(size_t capacity, bool isFrameEnd)
+{
+	m_survivors.clear();
+	for (const Entry& entry : m_entries)
+	{
+		if (entry.key != 0 && (!isFrameEnd || entry.frame == m_frame))
+		{
+			m_survivors.push_back(entry);
+		}
+	}
+
+	if (capacity != m_entries.size())
+	{
+		m_entries.assign(capacity, Entry{ 0, 0 });
+	}
+	else
+	{
+		std::fill(m_entries.begin(), m_entries.end(), Entry{ 0, 0 });
+	}
+
+	for (const Entry& entry : m_survivors)
+	{
+		m_entries[FindSlot(entry.key)] = entry;
+	}
+	m_pairCount = m_survivors.size();
+}
+
+/**
+ * @brief L[̃nbVl
+ *
+ * @param[in] key g̃L[
+ *
+ * @return nbVliʂƉʂ̃rbgj
+ */
+size_t ContactPairCache::Hash(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xFF51AFD7ED558CCDull;
+	key ^= key >> 33;
+	key *= 0xC4CEB9FE1A85EC53ull;
+	key ^= key >> 33;
+
+	return static_cast<size_t>(key);
+}
@@ -0,0 +1,133 @@
+/*****************************************************************//**
+ * @file    ContactPairCache.h
+ * @brief   ڐGĂg̋L^Ɋւwb_[t@C
+ *
+ * Ot[ɐڐGĂgoĂAڐG̊JnEpEI𔻕ʂ
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
+#include <vector>
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief ڐGĂg̋L^
+ *
+ * 2̏Փ˃f[^IDɕׂ 64 rbg̃L[ŁAJԒn@̃nbVWɋL^B
+ * evf͍ŌɐڐGt[At[̏IɍXVȂgڐG̏IƂB
+ * eʂ͌炳Ȃ߁AڐGςȂʏ̃t[ł̓mۂȂ
+ */
+class ContactPairCache
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr size_t MIN_CAPACITY = 64;	///< ŏ̗eʁi2ׂ̂j
+
+// 񋓌^̐錾 -----------------------------------------------------
+public:
+
+	/**
+	 * @brief ڐG̏
+	 */
+	enum class ContactState
+	{
+		ENTER,		///< ̃t[ŐڐGn߂
+		STAY,		///< Õt[ڐGĂ
+		DUPLICATE,	///< ̃t[ŊɋL^
+	};
+
+// \̂̐錾
+public:
+
+	/**
+	 * @brief ڐGĂg
+	 */
+	struct ContactPair
+	{
+		int idA;	///< Փ˃f[^AIDij
+		int idB;	///< Փ˃f[^BIDi傫j
+	};
+
+private:
+
+	/**
+	 * @brief nbVW̗vf
+	 */
+	struct Entry
+	{
+		uint64_t key;	///< g̃L[i0 ͋󂫁j
+		uint32_t frame;	///< ŌɐڐGt[
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	std::vector<Entry>	m_entries;		///< nbVWieʂ2ׂ̂j
+	size_t				m_pairCount;	///< L^Ăg̐
+	uint32_t			m_frame;		///< ݂̃t[
+
+	std::vector<Entry>	m_survivors;	///< lߒ̍Ɨ̈
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	ContactPairCache();
+
+	// fXgN^
+	~ContactPairCache();
+
+
+// 
+public:
+	// t[̊Jn
+	void BeginFrame();
+
+	// ڐGg̋L^
+	ContactState Touch(int idA, int idB);
+
+	// t[̏IiڐGIgoj
+	void EndFrame(std::vector<ContactPair>* pOutExitPairs);
+
+	// w肵Փ˃f[^܂ޑg̍폜iOgoj
+	void RemovePairs(int id, std::vector<ContactPair>* pOutRemovedPairs);
+
+	// SĂ̋L^̍폜
+	void Clear();
+
+
+// 擾/ݒ
+public:
+	// L^Ăg̐̎擾
+	size_t GetPairCount() const { return m_pairCount; }
+
+	// g̃L[̍쐬iɈ˂Ȃj
+	static uint64_t MakeKey(int idA, int idB);
+
+
+// 
+private:
+	// L[vf󂫂̈ʒuT
+	size_t FindSlot(uint64_t key) const;
+
+	// eʂςċlߒ
+	void Rehash(size_t capacity, bool isFrameEnd);
+
+	// L[̃nbVl
+	static size_t Hash(uint64_t key);
+};
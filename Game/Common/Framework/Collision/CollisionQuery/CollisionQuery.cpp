@@ -0,0 +1,1302 @@
+/*****************************************************************//**
+ * @file    CollisionQuery.cpp
+ * @brief   ԌiEdȂE|jɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionQuery.h"
+
+#include "Game/Common/Framework/Collision/CollisionDispatcher/CollisionDispatcher.h"
+#include "Game/GameObjects/Common/GameObject.h"
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr float BOUNDS_MARGIN		= 0.01f;	///< E{bNX̗]iڍהƂ̌vZ덷zj
+	constexpr float APPROACH_EPSILON	= 1e-6f;	///< ʂɋ߂ÂĂƂ݂Ȃ̉iڂ܂ܖʂɉē͓ĂȂj
+}
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * @param[in] Ȃ
+ */
+CollisionQuery::CollisionQuery()
+	: m_staticItems{}
+	, m_staticBVH{}
+	, m_dynamicItems{}
+	, m_candidates{}
+{
+
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+CollisionQuery::~CollisionQuery()
+{
+
+}
+
+/**
+ * @brief ÓIȌΏۂ̐ݒ
+ *
+ * E{[Kw蒼BÓIȃRC_[̓o^ςĂԂ
+ *
+ * @param[in] items Ώہie͎qOɕׂj
+ */
+void CollisionQuery::SetStaticItems(std::vector<Item> items)
+{
+	m_staticItems = std::move(items);
+
+	std::vector<BroadCollision> entries;
+	entries.reserve(m_staticItems.size());
+	for (uint32_t i = 0; i < m_staticItems.size(); i++)
+	{
+		BroadCollision entry;
+		CreateBounds(*m_staticItems[i].pCollider, i, &entry);
+		entries.push_back(entry);
+	}
+
+	m_staticBVH.Build(entries);
+}
+
+/**
+ * @brief IȌΏۂ̐ݒ
+ *
+ * @param[in] items Ώہie͎qOɕׂj
+ */
+void CollisionQuery::SetDynamicItems(std::vector<Item> items)
+{
+	m_dynamicItems = std::move(items);
+}
+
+/**
+ * @brief 폜
+ */
+void CollisionQuery::Clear()
+{
+	m_staticItems.clear();
+	m_staticBVH.Clear();
+	m_dynamicItems.clear();
+}
+
+/**
+ * @brief ƍŏɓRC_[߂
+ *
+ * @param[in]  origin		n_
+ * @param[in]  direction	iKȂĂ悢j
+ * @param[in]  maxDistance	ő勗
+ * @param[in]  filter		i荞ݏ
+ * @param[out] pOutHit		ł߂Փˁinullptr j
+ *
+ * @returns true  
+ * @returns false Ȃ
+ */
+bool CollisionQuery::Raycast(
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	const QueryFilter& filter,
+	QueryHit* pOutHit) const
+{
+	using namespace DirectX::SimpleMath;
+
+	Vector3 rayDirection = direction;
+	if (rayDirection.LengthSquared() <= 0.0f || maxDistance < 0.0f) return false;
+	rayDirection.Normalize();
+
+	QueryHit nearestHit;
+	bool isHit = false;
+
+	// xɍő勗k߁A艜ׂ͒Ȃ
+	auto testItem = [&](const std::vector<Item>& items, uint32_t index, float currentMaxDistance)
+		{
+			if (!IsQueryable(items, index, filter)) return currentMaxDistance;
+
+			float distance = 0.0f;
+			if (!IntersectRay(*items[index].pCollider, origin, rayDirection, currentMaxDistance, &distance)) return currentMaxDistance;
+
+			isHit = true;
+			nearestHit.pGameObject	= items[index].pGameObject;
+			nearestHit.pCollider	= items[index].pCollider;
+			nearestHit.distance		= distance;
+			nearestHit.position		= origin + rayDirection * distance;
+			return distance;
+		};
+
+	float currentMaxDistance = maxDistance;
+
+	m_staticBVH.Raycast(origin, rayDirection, currentMaxDistance, [&](uint32_t index, float distance)
+		{
+			currentMaxDistance = testItem(m_staticItems, index, distance);
+			return currentMaxDistance;
+		});
+
+	for (uint32_t i = 0; i < m_dynamicItems.size(); i++)
+	{
+		currentMaxDistance = testItem(m_dynamicItems, i, currentMaxDistance);
+	}
+
+	if (isHit && pOutHit)
+	{
+		*pOutHit = nearestHit;
+	}
+
+	return isHit;
+}
+
+/**
+ * @brief ƓSẴRC_[߂ɋ߂
+ *
+ * @param[in]  origin		n_
+ * @param[in]  direction	iKȂĂ悢j
+ * @param[in]  maxDistance	ő勗
+ * @param[in]  filter		i荞ݏ
+ * @param[out] pOutHits		ՓˁiǋLj
+ *
+ * @return ǉՓ˂̐
+ */
+size_t CollisionQuery::RaycastAll(
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	const QueryFilter& filter,
+	std::vector<QueryHit>* pOutHits) const
+{
+	using namespace DirectX::SimpleMath;
+
+	Vector3 rayDirection = direction;
+	if (!pOutHits || rayDirection.LengthSquared() <= 0.0f || maxDistance < 0.0f) return 0;
+	rayDirection.Normalize();
+
+	const size_t firstIndex = pOutHits->size();
+
+	auto testItem = [&](const std::vector<Item>& items, uint32_t index)
+		{
+			if (!IsQueryable(items, index, filter)) return;
+
+			float distance = 0.0f;
+			if (!IntersectRay(*items[index].pCollider, origin, rayDirection, maxDistance, &distance)) return;
+
+			QueryHit hit;
+			hit.pGameObject	= items[index].pGameObject;
+			hit.pCollider	= items[index].pCollider;
+			hit.distance	= distance;
+			hit.position	= origin + rayDirection * distance;
+			pOutHits->push_back(hit);
+		};
+
+	// SďW߂邽ߍő勗͏k߂Ȃ
+	m_staticBVH.Raycast(origin, rayDirection, maxDistance, [&](uint32_t index, float distance)
+		{
+			testItem(m_staticItems, index);
+			return distance;
+		});
+
+	for (uint32_t i = 0; i < m_dynamicItems.size(); i++)
+	{
+		testItem(m_dynamicItems, i);
+	}
+
+	std::stable_sort(pOutHits->begin() + firstIndex, pOutHits->end(), [](const QueryHit& a, const QueryHit& b)
+		{
+			return a.distance < b.distance;
+		});
+
+	return pOutHits->size() - firstIndex;
+}
+
+/**
+ * @brief Cӂ̌`ƏdȂRC_[߂
+ *
+ *  RetrieveCollisionData Ɠ (o^ꂽRC_[, ׂ`) ̏ CollisionDispatcher ɔCB
+ * ΉĂȂgݍ킹͏dȂȂ̂ƂĈ
+ *
+ * @param[in]  shape	ׂ`
+ * @param[in]  filter	i荞ݏ
+ * @param[out] pOutHits	ՓˁiǋLBnullptr Ȃ琔邾j
+ *
+ * @return dȂRC_[̐
+ */
+size_t CollisionQuery::Overlap(const ICollider& shape, const QueryFilter& filter, std::vector<QueryHit>* pOutHits) const
+{
+	BroadCollision bounds;
+	CreateBounds(shape, 0, &bounds);
+
+	size_t hitNum = 0;
+	ForEachCandidate(bounds, filter, [&](const Item& item)
+		{
+			if (!CollisionDispatcher::DetectCollision(item.pCollider, &shape)) return;
+
+			hitNum++;
+			if (pOutHits)
+			{
+				QueryHit hit;
+				hit.pGameObject = item.pGameObject;
+				hit.pCollider	= item.pCollider;
+				pOutHits->push_back(hit);
+			}
+		});
+
+	return hitNum;
+}
+
+/**
+ * @brief ƏdȂRC_[߂
+ *
+ * @param[in]  center	SW
+ * @param[in]  radius	a
+ * @param[in]  filter	i荞ݏ
+ * @param[out] pOutHits	ՓˁiǋLBnullptr Ȃ琔邾j
+ *
+ * @return dȂRC_[̐
+ */
+size_t CollisionQuery::OverlapSphere(const DirectX::SimpleMath::Vector3& center, float radius, const QueryFilter& filter, std::vector<QueryHit>* pOutHits) const
+{
+	return Overlap(Sphere(center, radius), filter, pOutHits);
+}
+
+/**
+ * @brief AABB ƏdȂRC_[߂
+ *
+ * @param[in]  center	SW
+ * @param[in]  extend	傫iAABB NXƓӂ̒j
+ * @param[in]  filter	i荞ݏ
+ * @param[out] pOutHits	ՓˁiǋLBnullptr Ȃ琔邾j
+ *
+ * @return dȂRC_[̐
+ */
+size_t CollisionQuery::OverlapAABB(const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& extend, const QueryFilter& filter, std::vector<QueryHit>* pOutHits) const
+{
+	return Overlap(AABB(center, extend), filter, pOutHits);
+}
+
+/**
+ * @brief 𓮂čŏɓRC_[߂
+ *
+ * |͈͂̋E{bNXŌiA₲Ƃɓ鋗͓Iɋ߂B
+ * n߂dȂĂ鑊ɂ́Aɓꍇċ 0 œ
+ *
+ * @param[in]  center		̒Sin_j
+ * @param[in]  radius		a
+ * @param[in]  direction	iKȂĂ悢j
+ * @param[in]  maxDistance	ő勗
+ * @param[in]  filter		i荞ݏ
+ * @param[out] pOutHit		ł߂Փˁinullptr j
+ *
+ * @returns true  
+ * @returns false Ȃ
+ */
+bool CollisionQuery::SweepSphere(
+	const DirectX::SimpleMath::Vector3& center,
+	float radius,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	const QueryFilter& filter,
+	QueryHit* pOutHit) const
+{
+	using namespace DirectX::SimpleMath;
+
+	Vector3 sweepDirection = direction;
+	if (sweepDirection.LengthSquared() <= 0.0f || maxDistance < 0.0f) return false;
+	sweepDirection.Normalize();
+
+	// n_ƏI_̋ދE{bNX
+	const Vector3 endCenter = center + sweepDirection * maxDistance;
+
+	BroadCollision sweptBounds;
+	sweptBounds.min = Vector3::Min(center, endCenter) - Vector3(radius + BOUNDS_MARGIN);
+	sweptBounds.max = Vector3::Max(center, endCenter) + Vector3(radius + BOUNDS_MARGIN);
+
+	QueryHit nearestHit;
+	bool isHit = false;
+	float currentMaxDistance = maxDistance;
+
+	ForEachCandidate(sweptBounds, filter, [&](const Item& item)
+		{
+			float distance = 0.0f;
+			Vector3 normal;
+			if (!SweepSphereAgainst(*item.pCollider, center, radius, sweepDirection, currentMaxDistance, &distance, &normal)) return;
+
+			isHit = true;
+			currentMaxDistance = distance;
+			nearestHit.pGameObject	= item.pGameObject;
+			nearestHit.pCollider	= item.pCollider;
+			nearestHit.distance		= distance;
+			nearestHit.position		= center + sweepDirection * distance;
+			nearestHit.normal		= normal;
+		});
+
+	if (isHit && pOutHit)
+	{
+		nearestHit.time = (maxDistance > 0.0f) ? nearestHit.distance / maxDistance : 0.0f;
+		*pOutHit = nearestHit;
+	}
+
+	return isHit;
+}
+
+/**
+ * @brief JvZ𓮂čŏɓRC_[߂
+ *
+ * |͈͂̋E{bNXŌiA₲ƂɌ`i߂ē鋗߂B
+ * n߂dȂĂ鑊ɂ́Aʂɉēꍇċ 0 œ
+ *
+ * @param[in]  capsule		JvZin_̈ʒuj
+ * @param[in]  direction	iKȂĂ悢j
+ * @param[in]  maxDistance	ő勗
+ * @param[in]  filter		i荞ݏ
+ * @param[out] pOutHit		ł߂Փˁinullptr j
+ *
+ * @returns true  
+ * @returns false Ȃ
+ */
+bool CollisionQuery::SweepCapsule(
+	const Capsule& capsule,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	const QueryFilter& filter,
+	QueryHit* pOutHit) const
+{
+	using namespace DirectX::SimpleMath;
+
+	Vector3 sweepDirection = direction;
+	if (sweepDirection.LengthSquared() <= 0.0f || maxDistance < 0.0f) return false;
+	sweepDirection.Normalize();
+
+	// n_ƏI_̃JvZދE{bNX
+	Capsule endCapsule = capsule;
+	endCapsule.SetPosition(capsule.GetPosition() + sweepDirection * maxDistance);
+
+	BroadCollision startBounds;
+	BroadCollision endBounds;
+	CreateBounds(capsule, 0, &startBounds);
+	CreateBounds(endCapsule, 0, &endBounds);
+
+	BroadCollision sweptBounds = startBounds;
+	sweptBounds.min = Vector3::Min(startBounds.min, endBounds.min);
+	sweptBounds.max = Vector3::Max(startBounds.max, endBounds.max);
+
+	QueryHit nearestHit;
+	bool isHit = false;
+	float currentMaxDistance = maxDistance;
+
+	ForEachCandidate(sweptBounds, filter, [&](const Item& item)
+		{
+			float distance = 0.0f;
+			if (!SweepCapsuleAgainst(*item.pCollider, capsule, sweepDirection, currentMaxDistance, &distance)) return;
+
+			isHit = true;
+			currentMaxDistance = distance;
+			nearestHit.pGameObject	= item.pGameObject;
+			nearestHit.pCollider	= item.pCollider;
+			nearestHit.distance		= distance;
+			nearestHit.position		= capsule.GetPosition() + sweepDirection * distance;
+		});
+
+	if (isHit && pOutHit)
+	{
+		Capsule hitCapsule = capsule;
+		hitCapsule.SetPosition(nearestHit.position);
+
+		nearestHit.normal	= CalcCapsuleContactNormal(*nearestHit.pCollider, hitCapsule, sweepDirection);
+		nearestHit.time		= (maxDistance > 0.0f) ? nearestHit.distance / maxDistance : 0.0f;
+		*pOutHit = nearestHit;
+	}
+
+	return isHit;
+}
+
+/**
+ * @brief E{bNXƏdȂɊ֐Kp
+ *
+ * ÓIȌ͊KwAIȌ݂͌̋E{bNX狁߂
+ *
+ * @param[in] bounds	ׂ鋫E{bNX
+ * @param[in] filter	i荞ݏ
+ * @param[in] func		₲ƂɌĂԊ֐
+ */
+template <typename Func>
+void CollisionQuery::ForEachCandidate(const BroadCollision& bounds, const QueryFilter& filter, Func func) const
+{
+	m_candidates.clear();
+	m_staticBVH.Query(bounds, &m_candidates);
+
+	for (uint32_t index : m_candidates)
+	{
+		if (IsQueryable(m_staticItems, index, filter))
+		{
+			func(m_staticItems[index]);
+		}
+	}
+
+	for (uint32_t i = 0; i < m_dynamicItems.size(); i++)
+	{
+		if (!IsQueryable(m_dynamicItems, i, filter)) continue;
+
+		BroadCollision itemBounds;
+		CreateBounds(*m_dynamicItems[i].pCollider, i, &itemBounds);
+		if (!itemBounds.Overlaps(bounds)) continue;
+
+		func(m_dynamicItems[i]);
+	}
+}
+
+/**
+ * @brief Ώۂɂł邩ǂ
+ *
+ * RetrieveCollisionData ƓlɁAȐe̎q͑ΏۂɂȂ
+ *
+ * @param[in] items		Ώ
+ * @param[in] index		ׂԍ
+ * @param[in] filter	i荞ݏ
+ *
+ * @returns true  Ώۂɂł
+ * @returns false ΏۊO
+ */
+bool CollisionQuery::IsQueryable(const std::vector<Item>& items, uint32_t index, const QueryFilter& filter)
+{
+	const Item& item = items[index];
+
+	if (item.pGameObject == filter.pIgnoreObject) return false;
+	if ((static_cast<uint32_t>(item.pGameObject->GetTag()) & filter.tagMask) == 0) return false;
+
+	for (uint32_t i = index; i != NO_PARENT; i = items[i].parentIndex)
+	{
+		if (!items[i].pGameObject->IsActive()) return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief RC_[̋Ef[^쐬
+ *
+ * @param[in]  collider		RC_[
+ * @param[in]  index		Ώۂ̔ԍ
+ * @param[out] pOutBounds	Ef[^
+ *
+ * @returns true  E
+ * @returns false EȂiɌƂj
+ */
+bool CollisionQuery::CreateBounds(const ICollider& collider, uint32_t index, BroadCollision* pOutBounds)
+{
+	using namespace DirectX::SimpleMath;
+
+	pOutBounds->proxyIndex = index;
+	pOutBounds->isUnbounded = !CalcBoundingBox(collider, &pOutBounds->min, &pOutBounds->max);
+
+	if (!pOutBounds->isUnbounded)
+	{
+		pOutBounds->min -= Vector3(BOUNDS_MARGIN);
+		pOutBounds->max += Vector3(BOUNDS_MARGIN);
+	}
+
+	return !pOutBounds->isUnbounded;
+}
+
+/**
+ * @brief ƃRC_[̌߂
+ *
+ * ̓JvZƂĈB͑ȂߓȂ
+ *
+ * @param[in]  collider		RC_[
+ * @param[in]  origin		n_
+ * @param[in]  direction	iKς݁j
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	n_̋in_Ȃ 0j
+ *
+ * @returns true  Ă
+ * @returns false ĂȂ
+ */
+bool CollisionQuery::IntersectRay(
+	const ICollider& collider,
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	float* pOutDistance)
+{
+	using namespace DirectX::SimpleMath;
+
+	const Segment ray(origin, direction * maxDistance);
+
+	// ʏ̌_̋
+	auto planeDistance = [&](const ::Plane& plane, float* pDistance)
+		{
+			Vector3 hitPosition;
+			if (!IsHit(plane, ray, &hitPosition)) return false;
+			*pDistance = (hitPosition - origin).Dot(direction);
+			return true;
+		};
+
+	switch (collider.GetColliderType())
+	{
+	case ColliderType::Sphere:
+	{
+		const Sphere& sphere = static_cast<const Sphere&>(collider);
+		return IntersectRaySphere(origin, direction, sphere.GetPosition(), sphere.GetRadius(), maxDistance, pOutDistance);
+	}
+	case ColliderType::AABB:
+	{
+		Vector3 hitPosition;
+		if (!GetIntersectionPoint(&hitPosition, static_cast<const AABB&>(collider), ray)) return false;
+		*pOutDistance = (hitPosition - origin).Dot(direction);
+		return true;
+	}
+	case ColliderType::Plane:
+		return planeDistance(static_cast<const ::Plane&>(collider), pOutDistance);
+	case ColliderType::Triangle:
+	{
+		const std::vector<Vector3>& vertices = static_cast<const Triangle&>(collider).GetPosition();
+		return IntersectRayTriangle(origin, direction, vertices[0], vertices[1], vertices[2], maxDistance, pOutDistance);
+	}
+	case ColliderType::BOX2D:
+	{
+		const Box2D& box = static_cast<const Box2D&>(collider);
+		float distance = FLT_MAX;
+		for (int i = 0; i < Box2D::TRIANGLE_NUM; i++)
+		{
+			const std::vector<Vector3>& vertices = box.GetTriangle(i).GetPosition();
+			float triangleDistance = 0.0f;
+			if (IntersectRayTriangle(origin, direction, vertices[0], vertices[1], vertices[2], maxDistance, &triangleDistance))
+			{
+				distance = std::min(distance, triangleDistance);
+			}
+		}
+		if (distance == FLT_MAX) return false;
+		*pOutDistance = distance;
+		return true;
+	}
+	case ColliderType::Capsule:
+	case ColliderType::Cylinder:
+	{
+		Vector3 center;
+		Vector3 axis;
+		float length = 0.0f;
+		float radius = 0.0f;
+		if (collider.GetColliderType() == ColliderType::Capsule)
+		{
+			const Capsule& capsule = static_cast<const Capsule&>(collider);
+			center = capsule.GetPosition(); axis = capsule.GetAxis(); length = capsule.GetLength(); radius = capsule.GetRadius();
+		}
+		else
+		{
+			const Cylinder& cylinder = static_cast<const Cylinder&>(collider);
+			center = cylinder.GetPosition(); axis = cylinder.GetAxis(); length = cylinder.GetLength(); radius = cylinder.GetRadius();
+		}
+
+		return IntersectRayCapsule(origin, direction, center - axis * (length * 0.5f), center + axis * (length * 0.5f), radius, maxDistance, pOutDistance);
+	}
+	default:
+		return false;
+	}
+}
+
+/**
+ * @brief Ƌ̌߂
+ *
+ * @param[in]  origin		n_
+ * @param[in]  direction	iKς݁j
+ * @param[in]  center		̒S
+ * @param[in]  radius		̔a
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	n_̋in_Ȃ 0j
+ *
+ * @returns true  Ă
+ * @returns false ĂȂ
+ */
+bool CollisionQuery::IntersectRaySphere(
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& direction,
+	const DirectX::SimpleMath::Vector3& center,
+	float radius,
+	float maxDistance,
+	float* pOutDistance)
+{
+	using namespace DirectX::SimpleMath;
+
+	const Vector3 toOrigin = origin - center;
+	const float c = toOrigin.LengthSquared() - radius * radius;
+	if (c <= 0.0f) { *pOutDistance = 0.0f; return true; }
+
+	const float b = toOrigin.Dot(direction);
+	const float discriminant = b * b - c;
+	if (b > 0.0f || discriminant < 0.0f) return false;
+
+	*pOutDistance = -b - std::sqrt(discriminant);
+	return *pOutDistance <= maxDistance;
+}
+
+/**
+ * @brief ƎOp`̌߂
+ *
+ * _̎璼ڋ߂邽߁Aő勗ĂOp`ɂ͓ʂɂȂB
+ * Triangle::CheckInner ͕ʂ̋Βlŋe邽߁A_牓ł͊ۂߌ덷ŊO
+ *
+ * @param[in]  origin		n_
+ * @param[in]  direction	iKς݁j
+ * @param[in]  vertexA		_A
+ * @param[in]  vertexB		_B
+ * @param[in]  vertexC		_C
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	n_̋
+ *
+ * @returns true  Ăij
+ * @returns false ĂȂ
+ */
+bool CollisionQuery::IntersectRayTriangle(
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& direction,
+	const DirectX::SimpleMath::Vector3& vertexA,
+	const DirectX::SimpleMath::Vector3& vertexB,
+	const DirectX::SimpleMath::Vector3& vertexC,
+	float maxDistance,
+	float* pOutDistance)
+{
+	using namespace DirectX::SimpleMath;
+
+	const Vector3 edgeAB = vertexB - vertexA;
+	const Vector3 edgeAC = vertexC - vertexA;
+
+	// Op`̖ʂƕsȂ瓖Ȃ
+	const Vector3 p = direction.Cross(edgeAC);
+	const float determinant = edgeAB.Dot(p);
+	if (std::abs(determinant) < 1.0e-8f) return false;
+
+	const float inverseDeterminant = 1.0f / determinant;
+
+	// dSWOp`̓
+	const Vector3 toOrigin = origin - vertexA;
+	const float u = toOrigin.Dot(p) * inverseDeterminant;
+	if (u < 0.0f || u > 1.0f) return false;
+
+	const Vector3 q = toOrigin.Cross(edgeAB);
+	const float v = direction.Dot(q) * inverseDeterminant;
+	if (v < 0.0f || u + v > 1.0f) return false;
+
+	const float distance = edgeAC.Dot(q) * inverseDeterminant;
+	if (distance < 0.0f || distance > maxDistance) return false;
+
+	*pOutDistance = distance;
+	return true;
+}
+
+/**
+ * @brief ƃJvŽ߂
+ *
+ * @param[in]  origin		n_
+ * @param[in]  direction	iKς݁j
+ * @param[in]  start		JvZ̎̎n_
+ * @param[in]  end			JvZ̎̏I_
+ * @param[in]  radius		JvZ̔a
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	n_̋in_Ȃ 0j
+ *
+ * @returns true  Ă
+ * @returns false ĂȂ
+ */
+bool CollisionQuery::IntersectRayCapsule(
+	const DirectX::SimpleMath::Vector3& origin,
+	const DirectX::SimpleMath::Vector3& direction,
+	const DirectX::SimpleMath::Vector3& start,
+	const DirectX::SimpleMath::Vector3& end,
+	float radius,
+	float maxDistance,
+	float* pOutDistance)
+{
+	using namespace DirectX::SimpleMath;
+
+	// n_
+	if ((CalcClosestPointOnSegment(start, end, origin) - origin).LengthSquared() <= radius * radius)
+	{
+		*pOutDistance = 0.0f;
+		return true;
+	}
+
+	// ʁi~Ƃ͈̌̔͂ɐj
+	const Vector3 ba = end - start;
+	const Vector3 oa = origin - start;
+	const float baba = ba.Dot(ba);
+	const float bard = ba.Dot(direction);
+	const float baoa = ba.Dot(oa);
+	const float a = baba - bard * bard;
+	if (a > 1e-6f)
+	{
+		const float b = baba * direction.Dot(oa) - baoa * bard;
+		const float c = baba * oa.Dot(oa) - baoa * baoa - radius * radius * baba;
+		const float discriminant = b * b - a * c;
+		if (discriminant < 0.0f) return false;
+
+		const float distance = (-b - std::sqrt(discriminant)) / a;
+		const float y = baoa + distance * bard;
+		if (y > 0.0f && y < baba)
+		{
+			if (distance < 0.0f || distance > maxDistance) return false;
+			*pOutDistance = distance;
+			return true;
+		}
+	}
+
+	// [̔
+	float startDistance = FLT_MAX;
+	float endDistance = FLT_MAX;
+	const bool isStartHit = IntersectRaySphere(origin, direction, start, radius, maxDistance, &startDistance);
+	const bool isEndHit = IntersectRaySphere(origin, direction, end, radius, maxDistance, &endDistance);
+	if (!isStartHit && !isEndHit) return false;
+
+	*pOutDistance = std::min(isStartHit ? startDistance : FLT_MAX, isEndHit ? endDistance : FLT_MAX);
+	return true;
+}
+
+/**
+ * @brief 𓮂ē鋗Ɩʂ̌߂
+ *
+ * ̔ac܂A̒SoƂ̌ƂĉB
+ * ̓JvZƂĈB͑ȂߓȂ
+ *
+ * @param[in]  collider		̃RC_[
+ * @param[in]  center		̒Sin_j
+ * @param[in]  radius		̔a
+ * @param[in]  direction	iKς݁j
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	in߂dȂĂ 0j
+ * @param[out] pOutNormal	ʂ̌iKς݁B肩痣j
+ *
+ * @returns true  
+ * @returns false Ȃin߂dȂĂĂAʂɉēꍇ܂ށj
+ */
+bool CollisionQuery::SweepSphereAgainst(
+	const ICollider& collider,
+	const DirectX::SimpleMath::Vector3& center,
+	float radius,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	float* pOutDistance,
+	DirectX::SimpleMath::Vector3* pOutNormal)
+{
+	using namespace DirectX::SimpleMath;
+
+	float distance = 0.0f;
+	Vector3 normal;
+	bool isHit = false;
+
+	switch (collider.GetColliderType())
+	{
+	case ColliderType::Sphere:
+	{
+		const Sphere& sphere = static_cast<const Sphere&>(collider);
+		isHit = IntersectRaySphere(center, direction, sphere.GetPosition(), sphere.GetRadius() + radius, maxDistance, &distance);
+		normal = center + direction * distance - sphere.GetPosition();
+		break;
+	}
+	case ColliderType::Capsule:
+	case ColliderType::Cylinder:
+	{
+		Vector3 position;
+		Vector3 axis;
+		float length = 0.0f;
+		float otherRadius = 0.0f;
+		if (collider.GetColliderType() == ColliderType::Capsule)
+		{
+			const Capsule& capsule = static_cast<const Capsule&>(collider);
+			position = capsule.GetPosition(); axis = capsule.GetAxis(); length = capsule.GetLength(); otherRadius = capsule.GetRadius();
+		}
+		else
+		{
+			const Cylinder& cylinder = static_cast<const Cylinder&>(collider);
+			position = cylinder.GetPosition(); axis = cylinder.GetAxis(); length = cylinder.GetLength(); otherRadius = cylinder.GetRadius();
+		}
+
+		const Vector3 start = position - axis * (length * 0.5f);
+		const Vector3 end	= position + axis * (length * 0.5f);
+
+		isHit = IntersectRayCapsule(center, direction, start, end, otherRadius + radius, maxDistance, &distance);
+
+		const Vector3 hitCenter = center + direction * distance;
+		normal = hitCenter - CalcClosestPointOnSegment(start, end, hitCenter);
+		break;
+	}
+	case ColliderType::AABB:
+		isHit = SweepSphereAgainstAABB(static_cast<const AABB&>(collider), center, radius, direction, maxDistance, &distance, &normal);
+		break;
+	case ColliderType::Plane:
+	{
+		const Vector4 plane = static_cast<const ::Plane&>(collider).GetVector4();
+		const Vector3 planeNormal(plane.x, plane.y, plane.z);
+
+		const float startDistance = planeNormal.Dot(center) + plane.w;
+		const float speed = planeNormal.Dot(direction);
+		const float side = (startDistance > 0.0f || (startDistance == 0.0f && speed < 0.0f)) ? 1.0f : -1.0f;
+
+		normal = planeNormal * side;
+		if (std::abs(startDistance) <= radius)
+		{
+			isHit = true;
+		}
+		else if (startDistance * speed < 0.0f)
+		{
+			distance = (side * radius - startDistance) / speed;
+			isHit = distance <= maxDistance;
+		}
+		break;
+	}
+	case ColliderType::Triangle:
+	{
+		const std::vector<Vector3>& vertices = static_cast<const Triangle&>(collider).GetPosition();
+		isHit = SweepSphereAgainstPolygon(vertices.data(), static_cast<int>(vertices.size()), center, radius, direction, maxDistance, &distance, &normal);
+		break;
+	}
+	case ColliderType::BOX2D:
+	{
+		// 2̎Op`iABC, CDAjΊp̖lp` ABCD ɖ߂
+		const Box2D& box = static_cast<const Box2D&>(collider);
+		const std::vector<Vector3>& triangleABC = box.GetTriangle(0).GetPosition();
+		const Vector3 vertices[] = { triangleABC[0], triangleABC[1], triangleABC[2], box.GetTriangle(1).GetPosition()[1] };
+		isHit = SweepSphereAgainstPolygon(vertices, 4, center, radius, direction, maxDistance, &distance, &normal);
+		break;
+	}
+	default:
+		return false;
+	}
+
+	if (!isHit) return false;
+
+	if (normal.LengthSquared() > 0.0f)	{ normal.Normalize(); }
+	else								{ normal = -direction; }
+
+	// n߂dȂĂ鎞́Aʂɋ߂ÂɓꍇĂ
+	if (distance <= 0.0f && normal.Dot(direction) > -APPROACH_EPSILON) return false;
+
+	*pOutDistance	= distance;
+	*pOutNormal		= normal;
+	return true;
+}
+
+/**
+ * @brief 𓮂 AABB ɓ鋗Ɩʂ̌߂
+ *
+ * ac܂ƌ̌߁A_ӂp̗̈ɂ
+ * ̕ӂƂJvZƂ̌ŋߒ
+ *
+ * @param[in]  box			 AABB
+ * @param[in]  center		̒Sin_j
+ * @param[in]  radius		̔a
+ * @param[in]  direction	iKς݁j
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	in߂dȂĂ 0j
+ * @param[out] pOutNormal	ʂ̌iKȂj
+ *
+ * @returns true  
+ * @returns false Ȃ
+ */
+bool CollisionQuery::SweepSphereAgainstAABB(
+	const AABB& box,
+	const DirectX::SimpleMath::Vector3& center,
+	float radius,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	float* pOutDistance,
+	DirectX::SimpleMath::Vector3* pOutNormal)
+{
+	using namespace DirectX::SimpleMath;
+
+	// AABB NXƓ傫͕ӂ̒
+	const Vector3 boxMin = box.GetCenter() - box.GetExtend() / 2.0f;
+	const Vector3 boxMax = box.GetCenter() + box.GetExtend() / 2.0f;
+
+	const float boxMinArray[3]	= { boxMin.x, boxMin.y, boxMin.z };
+	const float boxMaxArray[3]	= { boxMax.x, boxMax.y, boxMax.z };
+	const float centerArray[3]	= { center.x, center.y, center.z };
+	const float directionArray[3] = { direction.x, direction.y, direction.z };
+	const Vector3 axes[3] = { Vector3::UnitX, Vector3::UnitY, Vector3::UnitZ };
+
+	// n߂dȂĂ
+	const Vector3 closestPoint = Vector3::Min(Vector3::Max(center, boxMin), boxMax);
+	if ((center - closestPoint).LengthSquared() <= radius * radius)
+	{
+		*pOutDistance = 0.0f;
+		*pOutNormal = center - closestPoint;
+
+		// S̓ȂAł߂ʂ牟o
+		if (pOutNormal->LengthSquared() <= 0.0f)
+		{
+			float minDepth = FLT_MAX;
+			for (int i = 0; i < 3; i++)
+			{
+				const float toMin = centerArray[i] - boxMinArray[i];
+				const float toMax = boxMaxArray[i] - centerArray[i];
+				if (toMin < minDepth) { minDepth = toMin; *pOutNormal = -axes[i]; }
+				if (toMax < minDepth) { minDepth = toMax; *pOutNormal = axes[i]; }
+			}
+		}
+		return true;
+	}
+
+	// c܂Ƃ̌iXu@j
+	float enterDistance = -FLT_MAX;
+	float exitDistance = maxDistance;
+	int enterAxis = -1;
+	for (int i = 0; i < 3; i++)
+	{
+		const float expandedMin = boxMinArray[i] - radius;
+		const float expandedMax = boxMaxArray[i] + radius;
+
+		if (std::abs(directionArray[i]) < 1e-8f)
+		{
+			if (centerArray[i] < expandedMin || centerArray[i] > expandedMax) return false;
+			continue;
+		}
+
+		float nearDistance	= (expandedMin - centerArray[i]) / directionArray[i];
+		float farDistance	= (expandedMax - centerArray[i]) / directionArray[i];
+		if (nearDistance > farDistance) std::swap(nearDistance, farDistance);
+
+		if (nearDistance > enterDistance) { enterDistance = nearDistance; enterAxis = i; }
+		exitDistance = std::min(exitDistance, farDistance);
+		if (enterDistance > exitDistance) return false;
+	}
+
+	// Sc܂̊p̓ɂ鎞́An_ӂ𒲂ׂ
+	enterDistance = std::max(enterDistance, 0.0f);
+
+	const Vector3 enterPoint = center + direction * enterDistance;
+	const float enterArray[3] = { enterPoint.x, enterPoint.y, enterPoint.z };
+
+	// _̔̊Oɂ鎲
+	int outsideNum = 0;
+	float cornerArray[3];
+	for (int i = 0; i < 3; i++)
+	{
+		if		(enterArray[i] < boxMinArray[i]) { cornerArray[i] = boxMinArray[i]; outsideNum++; }
+		else if (enterArray[i] > boxMaxArray[i]) { cornerArray[i] = boxMaxArray[i]; outsideNum++; }
+		else									 { cornerArray[i] = enterArray[i]; }
+	}
+
+	// ʂ̗̈
+	if (outsideNum <= 1 && enterAxis >= 0)
+	{
+		*pOutDistance	= enterDistance;
+		*pOutNormal		= (directionArray[enterAxis] > 0.0f) ? -axes[enterAxis] : axes[enterAxis];
+		return true;
+	}
+
+	// ӁEp̗̈i_̊Oɂ鎲̊pLтӂJvZƂĒׂj
+	bool isHit = false;
+	float nearestDistance = maxDistance;
+	for (int i = 0; i < 3; i++)
+	{
+		const bool isInside = (enterArray[i] >= boxMinArray[i] && enterArray[i] <= boxMaxArray[i]);
+		if (outsideNum == 2 && !isInside) continue;
+
+		float edgeStart[3] = { cornerArray[0], cornerArray[1], cornerArray[2] };
+		float edgeEnd[3]   = { cornerArray[0], cornerArray[1], cornerArray[2] };
+		edgeStart[i]	= boxMinArray[i];
+		edgeEnd[i]		= boxMaxArray[i];
+
+		const Vector3 start(edgeStart[0], edgeStart[1], edgeStart[2]);
+		const Vector3 end(edgeEnd[0], edgeEnd[1], edgeEnd[2]);
+
+		float distance = 0.0f;
+		if (!IntersectRayCapsule(center, direction, start, end, radius, nearestDistance, &distance)) continue;
+
+		const Vector3 hitCenter = center + direction * distance;
+		isHit = true;
+		nearestDistance = distance;
+		*pOutNormal = hitCenter - CalcClosestPointOnSegment(start, end, hitCenter);
+	}
+
+	if (isHit)
+	{
+		*pOutDistance = nearestDistance;
+	}
+	return isHit;
+}
+
+/**
+ * @brief 𓮂ēʑp`ɓ鋗Ɩʂ̌߂
+ *
+ * ʂƂ̌ƁAeӂƂJvZƂ̌̋߂߂
+ *
+ * @param[in]  pVertices	_iꕽʏ̓ʑp`ɕׂj
+ * @param[in]  vertexNum	_̐
+ * @param[in]  center		̒Sin_j
+ * @param[in]  radius		̔a
+ * @param[in]  direction	iKς݁j
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	in߂dȂĂ 0j
+ * @param[out] pOutNormal	ʂ̌iKȂj
+ *
+ * @returns true  
+ * @returns false Ȃ
+ */
+bool CollisionQuery::SweepSphereAgainstPolygon(
+	const DirectX::SimpleMath::Vector3* pVertices,
+	int vertexNum,
+	const DirectX::SimpleMath::Vector3& center,
+	float radius,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	float* pOutDistance,
+	DirectX::SimpleMath::Vector3* pOutNormal)
+{
+	using namespace DirectX::SimpleMath;
+
+	Vector3 planeNormal = (pVertices[1] - pVertices[0]).Cross(pVertices[2] - pVertices[0]);
+	if (planeNormal.LengthSquared() <= 0.0f) return false;
+	planeNormal.Normalize();
+
+	// ʏ̓_p`̓ɂ邩ǂ
+	auto isInner = [&](const Vector3& point)
+		{
+			for (int i = 0; i < vertexNum; i++)
+			{
+				const Vector3& a = pVertices[i];
+				const Vector3& b = pVertices[(i + 1) % vertexNum];
+				if ((b - a).Cross(point - a).Dot(planeNormal) < 0.0f) return false;
+			}
+			return true;
+		};
+
+	const float startDistance = planeNormal.Dot(center - pVertices[0]);
+	const float speed = planeNormal.Dot(direction);
+	const float side = (startDistance > 0.0f || (startDistance == 0.0f && speed < 0.0f)) ? 1.0f : -1.0f;
+
+	// n߂dȂĂip`̍ŋߓ_Œׂj
+	Vector3 closestPoint = center - planeNormal * startDistance;
+	if (!isInner(closestPoint))
+	{
+		float closestDistanceSquared = FLT_MAX;
+		for (int i = 0; i < vertexNum; i++)
+		{
+			const Vector3 point = CalcClosestPointOnSegment(pVertices[i], pVertices[(i + 1) % vertexNum], center);
+			const float distanceSquared = (point - center).LengthSquared();
+			if (distanceSquared < closestDistanceSquared)
+			{
+				closestDistanceSquared = distanceSquared;
+				closestPoint = point;
+			}
+		}
+	}
+	if ((center - closestPoint).LengthSquared() <= radius * radius)
+	{
+		*pOutDistance	= 0.0f;
+		*pOutNormal		= center - closestPoint;
+		if (pOutNormal->LengthSquared() <= 0.0f) { *pOutNormal = planeNormal * side; }
+		return true;
+	}
+
+	bool isHit = false;
+	float nearestDistance = maxDistance;
+
+	// 
+	if (startDistance * speed < 0.0f)
+	{
+		const float distance = (side * radius - startDistance) / speed;
+		if (distance <= nearestDistance && isInner(center + direction * distance - planeNormal * (side * radius)))
+		{
+			isHit = true;
+			nearestDistance = distance;
+			*pOutNormal = planeNormal * side;
+		}
+	}
+
+	// 
+	for (int i = 0; i < vertexNum; i++)
+	{
+		const Vector3& start	= pVertices[i];
+		const Vector3& end		= pVertices[(i + 1) % vertexNum];
+
+		float distance = 0.0f;
+		if (!IntersectRayCapsule(center, direction, start, end, radius, nearestDistance, &distance)) continue;
+
+		const Vector3 hitCenter = center + direction * distance;
+		isHit = true;
+		nearestDistance = distance;
+		*pOutNormal = hitCenter - CalcClosestPointOnSegment(start, end, hitCenter);
+	}
+
+	if (isHit)
+	{
+		*pOutDistance = nearestDistance;
+	}
+	return isHit;
+}
+
+/**
+ * @brief JvZ𓮂ē鋗߂
+ *
+ * a̔i߂ďdȂ𒲂ׁAŏɏdȂԂ񕪒Tŋl߂B
+ * 1aZߒʂ蔲͋NȂiMAX_SWEEP_STEPS 𒴂钷|ł͕Lj
+ *
+ * @param[in]  collider		̃RC_[
+ * @param[in]  capsule		JvZ
+ * @param[in]  direction	iKς݁j
+ * @param[in]  maxDistance	ő勗
+ * @param[out] pOutDistance	in߂dȂĂ 0j
+ *
+ * @returns true  
+ * @returns false Ȃin߂dȂĂĂAʂɉēꍇ܂ށj
+ */
+bool CollisionQuery::SweepCapsuleAgainst(
+	const ICollider& collider,
+	const Capsule& capsule,
+	const DirectX::SimpleMath::Vector3& direction,
+	float maxDistance,
+	float* pOutDistance)
+{
+	Capsule moved = capsule;
+
+	auto overlapsAt = [&](float distance)
+		{
+			moved.SetPosition(capsule.GetPosition() + direction * distance);
+			return CollisionDispatcher::DetectCollision(&collider, &moved);
+		};
+
+	// n߂dȂĂ鎞́Aʂɋ߂ÂɓꍇĂiɏ܂ܓ͏𖳎j
+	if (overlapsAt(0.0f))
+	{
+		if (CalcCapsuleContactNormal(collider, capsule, direction).Dot(direction) > -APPROACH_EPSILON) return false;
+
+		*pOutDistance = 0.0f;
+		return true;
+	}
+
+	float step = std::max(capsule.GetRadius() * 0.5f, maxDistance / MAX_SWEEP_STEPS);
+	if (step <= 0.0f) return false;
+
+	float freeDistance = 0.0f;
+	while (freeDistance < maxDistance)
+	{
+		const float nextDistance = std::min(freeDistance + step, maxDistance);
+		if (!overlapsAt(nextDistance))
+		{
+			freeDistance = nextDistance;
+			continue;
+		}
+
+		// dȂn߂ʒul߂
+		float hitDistance = nextDistance;
+		for (int i = 0; i < SWEEP_REFINE_NUM; i++)
+		{
+			const float middle = (freeDistance + hitDistance) * 0.5f;
+			if (overlapsAt(middle)) { hitDistance = middle; }
+			else					{ freeDistance = middle; }
+		}
+
+		*pOutDistance = hitDistance;
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief ̃JvZƑ̖ʂ̌߂
+ *
+ * JvZ̎Ƒ̍ŋߓ_𐔉݂ɋ߁A̍ʂ̌ƂB
+ * ʏ͓̑Ƌt̖@g
+ *
+ * @param[in] collider	̃RC_[
+ * @param[in] capsule	̃JvZ
+ * @param[in] direction	iKς݁j
+ *
+ * @return ʂ̌iKς݁B肩痣j
+ */
+DirectX::SimpleMath::Vector3 CollisionQuery::CalcCapsuleContactNormal(
+	const ICollider& collider,
+	const Capsule& capsule,
+	const DirectX::SimpleMath::Vector3& direction)
+{
+	using namespace DirectX::SimpleMath;
+
+	constexpr int CLOSEST_POINT_ITERATION_NUM = 3;	///< ŋߓ_݂ɋ߂
+
+	const Vector3 start = capsule.GetPosition() - capsule.GetAxis() * (capsule.GetLength() * 0.5f);
+	const Vector3 end	= capsule.GetPosition() + capsule.GetAxis() * (capsule.GetLength() * 0.5f);
+
+	// ʂ̖@̂AƋt
+	auto facingNormal = [&](const ::Plane& plane)
+		{
+			const Vector4 vector = plane.GetVector4();
+			const Vector3 planeNormal(vector.x, vector.y, vector.z);
+			return (planeNormal.Dot(direction) > 0.0f) ? -planeNormal : planeNormal;
+		};
+
+	Vector3 normal;
+	switch (collider.GetColliderType())
+	{
+	case ColliderType::Sphere:
+	{
+		const Vector3 sphereCenter = static_cast<const Sphere&>(collider).GetPosition();
+		normal = CalcClosestPointOnSegment(start, end, sphereCenter) - sphereCenter;
+		break;
+	}
+	case ColliderType::AABB:
+	{
+		const AABB& box = static_cast<const AABB&>(collider);
+		Vector3 capsulePoint = CalcClosestPointOnSegment(start, end, box.GetCenter());
+		Vector3 boxPoint = CalcClosestPointOnAABB(box, capsulePoint);
+		for (int i = 0; i < CLOSEST_POINT_ITERATION_NUM; i++)
+		{
+			capsulePoint = CalcClosestPointOnSegment(start, end, boxPoint);
+			boxPoint = CalcClosestPointOnAABB(box, capsulePoint);
+		}
+		normal = capsulePoint - boxPoint;
+		break;
+	}
+	case ColliderType::Capsule:
+	case ColliderType::Cylinder:
+	{
+		Vector3 otherStart;
+		Vector3 otherEnd;
+		if (collider.GetColliderType() == ColliderType::Capsule)
+		{
+			const Capsule& other = static_cast<const Capsule&>(collider);
+			otherStart	= other.GetPosition() - other.GetAxis() * (other.GetLength() * 0.5f);
+			otherEnd	= other.GetPosition() + other.GetAxis() * (other.GetLength() * 0.5f);
+		}
+		else
+		{
+			const Cylinder& other = static_cast<const Cylinder&>(collider);
+			otherStart	= other.GetPosition() - other.GetAxis() * (other.GetLength() * 0.5f);
+			otherEnd	= other.GetPosition() + other.GetAxis() * (other.GetLength() * 0.5f);
+		}
+
+		Vector3 capsulePoint = CalcClosestPointOnSegment(start, end, (otherStart + otherEnd) * 0.5f);
+		Vector3 otherPoint = CalcClosestPointOnSegment(otherStart, otherEnd, capsulePoint);
+		for (int i = 0; i < CLOSEST_POINT_ITERATION_NUM; i++)
+		{
+			capsulePoint = CalcClosestPointOnSegment(start, end, otherPoint);
+			otherPoint = CalcClosestPointOnSegment(otherStart, otherEnd, capsulePoint);
+		}
+		normal = capsulePoint - otherPoint;
+		break;
+	}
+	case ColliderType::Plane:
+		normal = facingNormal(static_cast<const ::Plane&>(collider));
+		break;
+	case ColliderType::Triangle:
+		normal = facingNormal(static_cast<const Triangle&>(collider).GetPlane());
+		break;
+	case ColliderType::BOX2D:
+		normal = facingNormal(static_cast<const Box2D&>(collider).GetPlane());
+		break;
+	default:
+		break;
+	}
+
+	if (normal.LengthSquared() <= 0.0f) return -direction;
+
+	normal.Normalize();
+	return normal;
+}
@@ -0,0 +1,284 @@
+/*****************************************************************//**
+ * @file    CollisionQuery.h
+ * @brief   ԌiEdȂE|jɊւwb_[t@C
+ *
+ * o^ĂRC_[ɑ΂āu̓_̋߂ɉ邩v₢킹
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+
+#include "Game/Common/Framework/Collision/BroadPhase/StaticColliderBVH/StaticColliderBVH.h"
+#include "Game/Common/Utillities/Collision/Collision.h"
+
+
+// NX̑O錾 ===================================================
+class GameObject;	// Q[IuWFNg
+class ICollider;	// RC_[
+
+
+// \̂̒` ===============================================================
+/**
+ * @brief ̍i荞ݏ
+ */
+struct QueryFilter
+{
+	static constexpr uint32_t ALL_TAGS = 0xFFFFFFFFu;	///< SẴ^O
+
+	uint32_t			tagMask;		///< Ώۂɂ^OiGameObjectTag ̘_aj
+	const GameObject*	pIgnoreObject;	///< ΏۂOIuWFNgigȂǁj
+
+	QueryFilter()
+		: tagMask{ ALL_TAGS }
+		, pIgnoreObject{ nullptr }
+	{
+	}
+
+	QueryFilter(uint32_t tagMask, const GameObject* pIgnoreObject = nullptr)
+		: tagMask{ tagMask }
+		, pIgnoreObject{ pIgnoreObject }
+	{
+	}
+};
+
+/**
+ * @brief 
+ */
+struct QueryHit
+{
+	const GameObject*				pGameObject;	///< IuWFNg
+	const ICollider*				pCollider;		///< RC_[
+	DirectX::SimpleMath::Vector3	position;		///< Wi|ł͓̌`̒Sj
+	DirectX::SimpleMath::Vector3	normal;			///< ʂ̌i|̂݁B肩痣j
+	float							distance;		///< n_̋idȂł 0j
+	float							time;			///< i|̂݁Bő勗ɑ΂銄 0`1j
+
+	QueryHit()
+		: pGameObject{ nullptr }
+		, pCollider{ nullptr }
+		, position{}
+		, normal{}
+		, distance{ 0.0f }
+		, time{ 0.0f }
+	{
+	}
+};
+
+
+// NX̒` ===============================================================
+/**
+ * @brief Ԍ
+ *
+ * ÓIȃRC_[͋E{[KwɓAo^ς蒼B
+ * IȃRC_[͐Ȃt[߁A̓xɌ݂̋E{bNXōi荞ށB
+ * ̓CXbĥݍsƁiƗp̔zg񂷂߁j
+ */
+class CollisionQuery
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr uint32_t	NO_PARENT			= 0xFFFFFFFFu;	///< eȂ
+	static constexpr int		MAX_SWEEP_STEPS		= 256;			///< |Ō`i߂񐔂̏
+	static constexpr int		SWEEP_REFINE_NUM	= 8;			///< |œ񕪒Tŋl߂
+
+// \̂̐錾
+public:
+
+	/**
+	 * @brief Ώ
+	 */
+	struct Item
+	{
+		const GameObject*	pGameObject;	///< 
+		const ICollider*	pCollider;		///< RC_[
+		uint32_t			parentIndex;	///< e̔ԍieȂqΏۊOj
+	};
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	// ÓIȃRC_[
+	std::vector<Item>			m_staticItems;		///< ÓIȌΏ
+	StaticColliderBVH			m_staticBVH;		///< ÓIȌΏۂ̋E{[Kw
+
+	// IȃRC_[
+	std::vector<Item>			m_dynamicItems;		///< IȌΏ
+
+	// Ɨ̈
+	mutable std::vector<uint32_t>	m_candidates;	///< ÓIȊKw̌
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	CollisionQuery();
+
+	// fXgN^
+	~CollisionQuery();
+
+
+// 
+public:
+	// ÓIȌΏۂ̐ݒiKw蒼j
+	void SetStaticItems(std::vector<Item> items);
+	// IȌΏۂ̐ݒ
+	void SetDynamicItems(std::vector<Item> items);
+
+	// 폜
+	void Clear();
+
+	// ƍŏɓRC_[߂
+	bool Raycast(
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		const QueryFilter& filter,
+		QueryHit* pOutHit) const;
+
+	// ƓSẴRC_[߂ɋ߂
+	size_t RaycastAll(
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		const QueryFilter& filter,
+		std::vector<QueryHit>* pOutHits) const;
+
+	// Cӂ̌`ƏdȂRC_[߂
+	size_t Overlap(const ICollider& shape, const QueryFilter& filter, std::vector<QueryHit>* pOutHits) const;
+	// ƏdȂRC_[߂
+	size_t OverlapSphere(const DirectX::SimpleMath::Vector3& center, float radius, const QueryFilter& filter, std::vector<QueryHit>* pOutHits) const;
+	// AABB ƏdȂRC_[߂
+	size_t OverlapAABB(const DirectX::SimpleMath::Vector3& center, const DirectX::SimpleMath::Vector3& extend, const QueryFilter& filter, std::vector<QueryHit>* pOutHits) const;
+
+	// 𓮂čŏɓRC_[߂
+	bool SweepSphere(
+		const DirectX::SimpleMath::Vector3& center,
+		float radius,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		const QueryFilter& filter,
+		QueryHit* pOutHit) const;
+
+	// JvZ𓮂čŏɓRC_[߂
+	bool SweepCapsule(
+		const Capsule& capsule,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		const QueryFilter& filter,
+		QueryHit* pOutHit) const;
+
+
+// 擾/ݒ
+public:
+	// ÓIȌΏۂ̐̎擾
+	size_t GetStaticItemCount() const { return m_staticItems.size(); }
+	// IȌΏۂ̐̎擾
+	size_t GetDynamicItemCount() const { return m_dynamicItems.size(); }
+
+
+// 
+private:
+
+	// E{bNXƏdȂɊ֐Kp
+	template <typename Func>
+	void ForEachCandidate(const BroadCollision& bounds, const QueryFilter& filter, Func func) const;
+
+	// Ώۂɂł邩ǂ
+	static bool IsQueryable(const std::vector<Item>& items, uint32_t index, const QueryFilter& filter);
+
+	// RC_[̋Ef[^쐬
+	static bool CreateBounds(const ICollider& collider, uint32_t index, BroadCollision* pOutBounds);
+
+	// ƃRC_[̌߂
+	static bool IntersectRay(
+		const ICollider& collider,
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		float* pOutDistance);
+
+	// Ƌ̌߂
+	static bool IntersectRaySphere(
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& direction,
+		const DirectX::SimpleMath::Vector3& center,
+		float radius,
+		float maxDistance,
+		float* pOutDistance);
+
+	// ƎOp`̌߂
+	static bool IntersectRayTriangle(
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& direction,
+		const DirectX::SimpleMath::Vector3& vertexA,
+		const DirectX::SimpleMath::Vector3& vertexB,
+		const DirectX::SimpleMath::Vector3& vertexC,
+		float maxDistance,
+		float* pOutDistance);
+
+	// ƃJvŽ߂
+	static bool IntersectRayCapsule(
+		const DirectX::SimpleMath::Vector3& origin,
+		const DirectX::SimpleMath::Vector3& direction,
+		const DirectX::SimpleMath::Vector3& start,
+		const DirectX::SimpleMath::Vector3& end,
+		float radius,
+		float maxDistance,
+		float* pOutDistance);
+
+	// 𓮂ē鋗Ɩʂ̌߂
+	static bool SweepSphereAgainst(
+		const ICollider& collider,
+		const DirectX::SimpleMath::Vector3& center,
+		float radius,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		float* pOutDistance,
+		DirectX::SimpleMath::Vector3* pOutNormal);
+
+	// 𓮂 AABB ɓ鋗Ɩʂ̌߂
+	static bool SweepSphereAgainstAABB(
+		const AABB& box,
+		const DirectX::SimpleMath::Vector3& center,
+		float radius,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		float* pOutDistance,
+		DirectX::SimpleMath::Vector3* pOutNormal);
+
+	// 𓮂ēʑp`ɓ鋗Ɩʂ̌߂
+	static bool SweepSphereAgainstPolygon(
+		const DirectX::SimpleMath::Vector3* pVertices,
+		int vertexNum,
+		const DirectX::SimpleMath::Vector3& center,
+		float radius,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		float* pOutDistance,
+		DirectX::SimpleMath::Vector3* pOutNormal);
+
+	// JvZ𓮂ē鋗߂
+	static bool SweepCapsuleAgainst(
+		const ICollider& collider,
+		const Capsule& capsule,
+		const DirectX::SimpleMath::Vector3& direction,
+		float maxDistance,
+		float* pOutDistance);
+
+	// ̃JvZƑ̖ʂ̌߂
+	static DirectX::SimpleMath::Vector3 CalcCapsuleContactNormal(
+		const ICollider& collider,
+		const Capsule& capsule,
+		const DirectX::SimpleMath::Vector3& direction);
+};
@@ -0,0 +1,36 @@
+/*****************************************************************//**
+ * @file    ThreadEventData.h
+ * @brief   ̃Xbh瑗Cxg̃f[^Ɋւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
+
+/**
+ * @brief ̃Xbh瑗Cxg̎ʎq
+ */
+enum class ThreadEventID : uint32_t
+{
+	SCENE_LOADED,	// V[̓ǂݍ݊ivalue ɓǂݍ݂ɂԁi~bjj
+};
+
+/**
+ * @brief ̃Xbh瑗Cxg̃f[^
+ *
+ * XbhԂ̗ɒl̂܂ܐςނ߁AŒ蒷ŃRs[ł^
+ */
+struct ThreadEventData
+{
+	ThreadEventID	id;		///< ʎq
+	uint32_t		param;	///< ̈
+	float			value;	///< ̈
+};
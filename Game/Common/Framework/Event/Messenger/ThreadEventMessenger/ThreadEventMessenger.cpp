@@ -0,0 +1,63 @@
+/*****************************************************************//**
+ * @file    ThreadEventMessenger.cpp
+ * @brief   ̃Xbh烁CXbhփCxg𑗂NXɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "ThreadEventMessenger.h"
+
+// ÓIϐ̏
+std::unique_ptr<ThreadEventMessenger> ThreadEventMessenger::s_instance = nullptr;
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+ThreadEventMessenger::ThreadEventMessenger()
+	: m_queue{ QUEUE_CAPACITY }
+	, m_channel{}
+{
+	// 1Ɏo܂ł͓KpŃmۂȂ
+	m_channel.Reserve(QUEUE_CAPACITY, 8);
+}
+
+/**
+ * @brief Cxg𑗂
+ *
+ * @param[in] data Cxg̃f[^
+ *
+ * @retval true  
+ * @retval false 񂪈tŎ̂Ă
+ */
+bool ThreadEventMessenger::Post(const ThreadEventData& data)
+{
+	return m_queue.TryPush(data);
+}
+
+/**
+ * @brief ꂽCxgXi[ɓ͂
+ */
+void ThreadEventMessenger::Dispatch()
+{
+	m_queue.Drain([this](const ThreadEventData& data) { m_channel.Fire(data); });
+	m_channel.Apply();
+}
+
+/**
+ * @brief CX^X̎擾
+ *
+ * @return CX^X
+ */
+ThreadEventMessenger* ThreadEventMessenger::GetInstance()
+{
+	if (s_instance.get() == nullptr)
+	{
+		s_instance.reset(new ThreadEventMessenger());
+	}
+
+	return s_instance.get();
+}
@@ -0,0 +1,89 @@
+/*****************************************************************//**
+ * @file    ThreadEventMessenger.h
+ * @brief   ̃Xbh烁CXbhփCxg𑗂NXɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <memory>
+
+#include "Game/Common/Framework/EventSystem/EventChannel/EventChannel.h"
+#include "Game/Common/Framework/EventSystem/MPSCEventQueue/MPSCEventQueue.h"
+#include "Game/Common/Framework/Event/Messenger/ThreadEventMessenger/ThreadEventData.h"
+
+
+// NX̒` ===============================================================
+/**
+ * @brief ̃Xbh烁CXbhփCxg𑗂NX (VOg)
+ *
+ * ǂ̃Xbhł Post łAGame::Update ̍ŏ Dispatch ŃCXbh̃Xi[ɓ͂B
+ * 񂪈t͎̎̂ĂĈꂽ𐔂i鑤҂Ȃj
+ */
+class ThreadEventMessenger final
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+	static constexpr size_t QUEUE_CAPACITY = 1024;	///< 1t[ɑCxg̐
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	// CX^X
+	static std::unique_ptr<ThreadEventMessenger> s_instance;
+
+	MPSCEventQueue<ThreadEventData>	m_queue;	///< ̃Xbh瑗ꂽCxg
+	EventChannel<ThreadEventData>	m_channel;	///< CXbh̃Xi[
+
+
+// o֐̐錾 -------------------------------------------------
+private:
+	// RXgN^
+	ThreadEventMessenger();
+public :
+	// fXgN^
+	~ThreadEventMessenger() = default;
+
+
+// 
+public:
+
+	// Cxg𑗂iǂ̃Xbhł悢A񂪈tȂ falsej
+	bool Post(const ThreadEventData& data);
+
+	// ꂽCxgXi[ɓ͂iCXbĥ݁j
+	void Dispatch();
+
+	// Xi[̓o^iCXbĥ݁j
+	template <typename TContext>
+	void AddListener(TContext* context, std::type_identity_t<void (*)(TContext*, const ThreadEventData&)> function, int priority = 0)
+	{
+		m_channel.AddListener(context, function, priority);
+	}
+
+	// Xi[̍폜iCXbĥ݁j
+	void RemoveListener(const void* context) { m_channel.RemoveListener(context); }
+
+// 擾/ݒ
+public:
+
+	// CX^X̎擾iŏ̌Ăяo̓CXbhōsƁj
+	static ThreadEventMessenger* GetInstance();
+
+	// ꂽ̎擾i݌vj
+	uint64_t GetPostedNum() const { return m_queue.GetPushedNum(); }
+
+	// 񂪈tŎ̂Ă̎擾i݌vj
+	uint64_t GetOverflowNum() const { return m_queue.GetOverflowNum(); }
+
+	// 1t[ɂ܂̍ő̎擾
+	size_t GetMaxDepth() const { return m_queue.GetMaxDepth(); }
+};
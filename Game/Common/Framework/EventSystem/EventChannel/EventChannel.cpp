@@ -0,0 +1,11 @@
+/*****************************************************************//**
+ * @file    EventChannel.cpp
+ * @brief   Cxgf[^̌^Ƃ̃Cxg`lɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "EventChannel.h"
@@ -0,0 +1,387 @@
+/*****************************************************************//**
+ * @file    EventChannel.h
+ * @brief   Cxgf[^̌^Ƃ̃Cxg`lɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief Cxg`ľ^ɂȂ
+ *
+ * ̊mۉ񐔂𐔂
+ */
+class EventChannelBase
+{
+// f[^o̐錾 -----------------------------------------------
+protected:
+	size_t	m_allocationCount;	///< z̗̈mۂ񐔁i݌vj
+	bool	m_isDispatching;	///< Xi[ĂяoĂŒǂ
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	EventChannelBase()
+		: m_allocationCount{ 0 }
+		, m_isDispatching{ false }
+	{
+	}
+
+
+// 擾/ݒ
+public:
+	// z̗̈mۂ񐔂̎擾i݌vj
+	size_t GetAllocationCount() const { return m_allocationCount; }
+};
+
+
+
+/**
+ * @brief Cxgf[^̌^Ƃ̃Cxg`l
+ *
+ * Cxgf[^͒l̂܂ܔzɂ߂Ďg񂵁AXi[͊֐|C^ƌĂяȏgŎB
+ * ^̓`l̂̂Ō܂̂ŁAĂяǒ^̊mFiRTTIj͂ȂB
+ * Kpɔ΂Cxg͎̓Kpɉ񂷂߁Az2ւĎgB
+ * z̗̈悪Ăԁiԁj́A΂ƓKpŃmۂȂ
+ *
+ * @tparam TPayload Cxgf[^̌^
+ */
+template <typename TPayload>
+class EventChannel
+	: public EventChannelBase
+{
+// ^̐錾 ---------------------------------------------------------
+private:
+	struct Listener;
+
+	/**
+	 * @brief Xi[Ăяo֐̌^
+	 */
+	using Invoker = void (*)(const Listener& listener, const TPayload& payload);
+
+	/**
+	 * @brief Xi[
+	 *
+	 * Ăяǒ^Ƃɍ Invoker Afunction  context ̌^ɖ߂ČĂяo
+	 */
+	struct Listener
+	{
+		Invoker	invoker;	///< Xi[Ăяo֐i폜ς݂ nullptrj
+		void	(*function)();	///< o^ꂽ֐i^Ďj
+		void*	context;	///< Ăяo
+		int		priority;	///< ĂяoDxilقǐɌĂяoj
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+	std::vector<TPayload>	m_queue;				///< ΂Cxg
+	std::vector<TPayload>	m_dispatchingQueue;		///< Kp̃Cxgim_queue ƓւĎg񂷁j
+	std::vector<Listener>	m_listeners;			///< Xi[iĂяoDxj
+	std::vector<Listener>	m_pendingListeners;		///< Kpɓo^ꂽXi[
+	bool					m_hasRemovedListeners;	///< Kpɍ폜ꂽXi[邩ǂ
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	EventChannel()
+		: m_hasRemovedListeners{ false }
+	{
+	}
+
+
+// 
+public:
+	/**
+	 * @brief ̗̈\
+	 *
+	 * @param[in] eventNum    1̓Kp܂łɔ΂Cxg̐
+	 * @param[in] listenerNum Xi[̐
+	 */
+	void Reserve(size_t eventNum, size_t listenerNum)
+	{
+		const size_t capacity = m_queue.capacity() + m_dispatchingQueue.capacity() + m_listeners.capacity();
+		m_queue.reserve(eventNum);
+		m_dispatchingQueue.reserve(eventNum);
+		m_listeners.reserve(listenerNum);
+		CountAllocation(capacity, m_queue.capacity() + m_dispatchingQueue.capacity() + m_listeners.capacity());
+	}
+
+	/**
+	 * @brief Xi[̓o^
+	 *
+	 * Ăяo󂯎֐iLv`Ȃ_jo^
+	 *
+	 * @param[in] context  Ăяoi֐̑1ɓnj
+	 * @param[in] function CxgɌĂяo֐
+	 * @param[in] priority ĂяoDxilقǐɌĂяoj
+	 */
+	template <typename TContext>
+	void AddListener(TContext* context, std::type_identity_t<void (*)(TContext*, const TPayload&)> function, int priority = 0)
+	{
+		using Function = void (*)(TContext*, const TPayload&);
+
+		AddListener(Listener{
+			[](const Listener& listener, const TPayload& payload)
+			{
+				reinterpret_cast<Function>(listener.function)(static_cast<TContext*>(listener.context), payload);
+			},
+			reinterpret_cast<void (*)()>(function),
+			const_cast<void*>(static_cast<const void*>(context)),
+			priority });
+	}
+
+	/**
+	 * @brief Xi[̓o^io֐j
+	 *
+	 * @tparam Method Ăяoo֐
+	 *
+	 * @param[in] context  Ăяo
+	 * @param[in] priority ĂяoDxilقǐɌĂяoj
+	 */
+	template <auto Method, typename TContext>
+	void AddListener(TContext* context, int priority = 0)
+	{
+		AddListener(Listener{
+			[](const Listener& listener, const TPayload& payload)
+			{
+				(static_cast<TContext*>(listener.context)->*Method)(payload);
+			},
+			nullptr,
+			const_cast<void*>(static_cast<const void*>(context)),
+			priority });
+	}
+
+	/**
+	 * @brief Ăяo悪v郊Xi[̍폜
+	 *
+	 * Kp͌ĂяoȂ悤ɂĂAKp̌ŋl߂
+	 *
+	 * @param[in] context Ăяo
+	 */
+	void RemoveListener(const void* context)
+	{
+		auto isTarget = [context](const Listener& listener) { return listener.context == context; };
+
+		if (m_isDispatching)
+		{
+			for (Listener& listener : m_listeners)
+			{
+				if (isTarget(listener)) { listener.invoker = nullptr; m_hasRemovedListeners = true; }
+			}
+			m_pendingListeners.erase(std::remove_if(m_pendingListeners.begin(), m_pendingListeners.end(), isTarget), m_pendingListeners.end());
+			return;
+		}
+
+		m_listeners.erase(std::remove_if(m_listeners.begin(), m_listeners.end(), isTarget), m_listeners.end());
+	}
+
+	/**
+	 * @brief SẴXi[̍폜
+	 */
+	void RemoveAllListeners()
+	{
+		if (m_isDispatching)
+		{
+			for (Listener& listener : m_listeners) { listener.invoker = nullptr; }
+			m_hasRemovedListeners = !m_listeners.empty();
+			m_pendingListeners.clear();
+			return;
+		}
+
+		m_listeners.clear();
+	}
+
+	/**
+	 * @brief Cxg̔΁i̓KpŃXi[Ăяoj
+	 *
+	 * @param[in] payload Cxgf[^
+	 */
+	void Fire(const TPayload& payload)
+	{
+		const size_t capacity = m_queue.capacity();
+		m_queue.push_back(payload);
+		CountAllocation(capacity, m_queue.capacity());
+	}
+
+	/**
+	 * @brief Cxg̔΁iCxgf[^̏ōj
+	 *
+	 * @param[in] args Cxgf[^̃RXgN^̈
+	 */
+	template <typename... TArgs>
+	void Emplace(TArgs&&... args)
+	{
+		const size_t capacity = m_queue.capacity();
+		m_queue.emplace_back(std::forward<TArgs>(args)...);
+		CountAllocation(capacity, m_queue.capacity());
+	}
+
+	/**
+	 * @brief Cxg̓Kp
+	 *
+	 * ΂ɃCxgoAXi[ĂяoDxɌĂяoB
+	 * Kpɔ΂Cxg͎̓Kpɉ
+	 */
+	void Apply()
+	{
+		// Kp̍ēiXi[̓Kpj͎̓Kpɉ
+		if (m_queue.empty() || m_isDispatching) { return; }
+
+		std::swap(m_queue, m_dispatchingQueue);
+
+		m_isDispatching = true;
+		for (const TPayload& payload : m_dispatchingQueue)
+		{
+			for (const Listener& listener : m_listeners)
+			{
+				if (listener.invoker) { listener.invoker(listener, payload); }
+			}
+		}
+		m_isDispatching = false;
+
+		m_dispatchingQueue.clear();
+
+		// KpɕςXi[𔽉f
+		if (m_hasRemovedListeners)
+		{
+			m_listeners.erase(std::remove_if(m_listeners.begin(), m_listeners.end(), [](const Listener& listener) { return listener.invoker == nullptr; }), m_listeners.end());
+			m_hasRemovedListeners = false;
+		}
+		for (const Listener& listener : m_pendingListeners) { InsertListener(listener); }
+		m_pendingListeners.clear();
+	}
+
+	/**
+	 * @brief ΂CxgSč폜i͂Ȃj
+	 */
+	void ClearQueue()
+	{
+		m_queue.clear();
+	}
+
+
+// 擾/ݒ
+public:
+	// Kp҂ĂCxg̐̎擾
+	size_t GetQueuedNum() const { return m_queue.size(); }
+
+	// Xi[̐̎擾
+	size_t GetListenerNum() const { return m_listeners.size() + m_pendingListeners.size(); }
+
+
+// 
+private:
+	// Xi[̓o^iKp͓Kp̌ɉ񂷁j
+	void AddListener(const Listener& listener)
+	{
+		if (m_isDispatching)
+		{
+			const size_t capacity = m_pendingListeners.capacity();
+			m_pendingListeners.push_back(listener);
+			CountAllocation(capacity, m_pendingListeners.capacity());
+			return;
+		}
+
+		InsertListener(listener);
+	}
+
+	// ĂяoDxۂđ}iDx͓o^j
+	void InsertListener(const Listener& listener)
+	{
+		auto it = std::upper_bound(m_listeners.begin(), m_listeners.end(), listener.priority,
+			[](int priority, const Listener& other) { return priority < other.priority; });
+
+		const size_t capacity = m_listeners.capacity();
+		m_listeners.insert(it, listener);
+		CountAllocation(capacity, m_listeners.capacity());
+	}
+
+	// ̈悪Ămۂ񐔂𐔂
+	void CountAllocation(size_t oldCapacity, size_t newCapacity)
+	{
+		if (newCapacity != oldCapacity) { m_allocationCount++; }
+	}
+};
+
+
+
+/**
+ * @brief ̃Cxgf[^̌^̃Cxg`l܂Ƃ߂
+ *
+ * `l̓RpCɌ^őIԂ̂ŁACxgIĎ͂ȂB
+ * ܂Ƃ߂ēKpꍇ͌^ׂɓKp
+ *
+ * @tparam TPayloads Cxgf[^̌^idȂƁj
+ */
+template <typename... TPayloads>
+class EventChannelSet
+{
+// f[^o̐錾 -----------------------------------------------
+private:
+	std::tuple<EventChannel<TPayloads>...> m_channels;	///< Cxg`l
+
+
+// o֐̐錾 -------------------------------------------------
+// 
+public:
+	// Cxg`l̎擾
+	template <typename TPayload>
+	EventChannel<TPayload>& Get() { return std::get<EventChannel<TPayload>>(m_channels); }
+	template <typename TPayload>
+	const EventChannel<TPayload>& Get() const { return std::get<EventChannel<TPayload>>(m_channels); }
+
+	// SẴCxg̓Kpi^ׂj
+	void ApplyAll()
+	{
+		std::apply([](auto&... channels) { (channels.Apply(), ...); }, m_channels);
+	}
+
+	// SẴXi[̍폜
+	void RemoveAllListeners()
+	{
+		std::apply([](auto&... channels) { (channels.RemoveAllListeners(), ...); }, m_channels);
+	}
+
+	// Ăяo悪v郊Xi[SẴ`l폜
+	void RemoveListener(const void* context)
+	{
+		std::apply([context](auto&... channels) { (channels.RemoveListener(context), ...); }, m_channels);
+	}
+
+	// ΂CxgSč폜i͂Ȃj
+	void ClearQueues()
+	{
+		std::apply([](auto&... channels) { (channels.ClearQueue(), ...); }, m_channels);
+	}
+
+
+// 擾/ݒ
+public:
+	// z̗̈mۂ񐔂̎擾i݌vj
+	size_t GetAllocationCount() const
+	{
+		return std::apply([](const auto&... channels) { return (channels.GetAllocationCount() + ... + size_t{ 0 }); }, m_channels);
+	}
+};
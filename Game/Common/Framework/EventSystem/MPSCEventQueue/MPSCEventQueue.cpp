@@ -0,0 +1,11 @@
+/*****************************************************************//**
+ * @file    MPSCEventQueue.cpp
+ * @brief   ̃Xbhς݁A1̃XbhŎoCxg̗Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "MPSCEventQueue.h"
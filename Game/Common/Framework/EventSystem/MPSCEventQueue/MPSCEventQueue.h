@@ -0,0 +1,270 @@
+/*****************************************************************//**
+ * @file    MPSCEventQueue.h
+ * @brief   ̃Xbhς݁A1̃XbhŎoCxg̗Ɋւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief Cxǧ̗^ɂȂ
+ *
+ * ς񂾐EꂽȂǂ̓v
+ */
+class MPSCEventQueueBase
+{
+// f[^o̐錾 -----------------------------------------------
+protected:
+	std::atomic<uint64_t>	m_pushedNum;	///< ς񂾐i݌vj
+	std::atomic<uint64_t>	m_overflowNum;	///< 񂪈tŐς߂Ȃi݌vj
+	std::atomic<uint64_t>	m_waitNum;		///< 󂫂҂񐔁i݌vj
+	uint64_t				m_drainedNum;	///< oi݌vAoXbĥݏށj
+	size_t					m_maxDepth;		///< o_ł܂Ă̍őioXbĥݏށj
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	MPSCEventQueueBase()
+		: m_pushedNum{ 0 }
+		, m_overflowNum{ 0 }
+		, m_waitNum{ 0 }
+		, m_drainedNum{ 0 }
+		, m_maxDepth{ 0 }
+	{
+	}
+
+
+// 擾/ݒ
+public:
+	// ς񂾐̎擾i݌vj
+	uint64_t GetPushedNum() const { return m_pushedNum.load(std::memory_order_relaxed); }
+
+	// 񂪈tŐς߂Ȃ̎擾i݌vj
+	uint64_t GetOverflowNum() const { return m_overflowNum.load(std::memory_order_relaxed); }
+
+	// 󂫂҂񐔂̎擾i݌vj
+	uint64_t GetWaitNum() const { return m_waitNum.load(std::memory_order_relaxed); }
+
+	// o̎擾i݌vj
+	uint64_t GetDrainedNum() const { return m_drainedNum; }
+
+	// o_ł܂Ă̍ő̎擾
+	size_t GetMaxDepth() const { return m_maxDepth; }
+};
+
+
+
+/**
+ * @brief ̃Xbhς݁A1̃XbhŎoCxg̗ibNȂAeʌŒj
+ *
+ * vfƂɔԍ̔zŁAςޑ͏ވʒu CAS Ŏ荇A
+ * Ivf̔ԍi߂Ďoɒm点Bo1XbhɌB
+ * ͍̈쐬ɊmۂAςށEoŃmۂȂB
+ * t̎ TryPush  false Ԃiꂽ𐔂jAPush ͋󂭂܂ő҂
+ *
+ * @tparam TPayload Cxgf[^̌^iŒ蒷ŃRs[ł邱Ɓj
+ */
+template <typename TPayload>
+class MPSCEventQueue
+	: public MPSCEventQueueBase
+{
+	static_assert(std::is_trivially_copyable_v<TPayload>, "TPayload must be trivially copyable");
+
+// NX萔̐錾 -------------------------------------------------
+private:
+	static constexpr size_t CACHE_LINE_SIZE = 64;	///< LbVC̑傫iςޑƎöʒu𕪂j
+
+
+// ^̐錾 ---------------------------------------------------------
+private:
+	/**
+	 * @brief ̗vf
+	 *
+	 * sequence ʒuƓ΋󂫁Aʒu + 1 Ȃ珑ݍς
+	 */
+	struct Cell
+	{
+		std::atomic<size_t>	sequence;	///< vf̔ԍ
+		TPayload			payload;	///< Cxgf[^
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+	std::unique_ptr<Cell[]>	m_cells;	///< ̗vf
+	size_t					m_mask;		///< ʒuvf̔ԍւ̕ϊie - 1j
+
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t>	m_enqueuePosition;	///< ɐςވʒu
+	alignas(CACHE_LINE_SIZE) size_t					m_dequeuePosition;	///< ɎoʒuioXbĥ݁j
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	/**
+	 * @brief RXgN^
+	 *
+	 * @param[in] capacity eʁi2̗ݏɐ؂グj
+	 */
+	explicit MPSCEventQueue(size_t capacity = 1024)
+		: m_cells{}
+		, m_mask{ 0 }
+		, m_enqueuePosition{ 0 }
+		, m_dequeuePosition{ 0 }
+	{
+		size_t size = 2;
+		while (size < capacity) { size <<= 1; }
+
+		m_cells = std::make_unique<Cell[]>(size);
+		m_mask = size - 1;
+		for (size_t i = 0; i < size; i++) { m_cells[i].sequence.store(i, std::memory_order_relaxed); }
+	}
+
+	MPSCEventQueue(const MPSCEventQueue&) = delete;
+	MPSCEventQueue& operator=(const MPSCEventQueue&) = delete;
+
+
+// 
+public:
+	/**
+	 * @brief Cxgςށiǂ̃Xbhł悢j
+	 *
+	 * @param[in] payload Cxgf[^
+	 *
+	 * @retval true  ς
+	 * @retval false 񂪈tŐς߂Ȃ
+	 */
+	bool TryPush(const TPayload& payload)
+	{
+		if (PushIfSpace(payload)) { return true; }
+
+		m_overflowNum.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	/**
+	 * @brief Cxgςށi󂭂܂ő҂j
+	 *
+	 * oXbhĂԂƋ󂩂Ȃ̂ŁAoXbhȊOĂԂ
+	 *
+	 * @param[in] payload Cxgf[^
+	 */
+	void Push(const TPayload& payload)
+	{
+		while (!PushIfSpace(payload))
+		{
+			m_waitNum.fetch_add(1, std::memory_order_relaxed);
+			std::this_thread::yield();
+		}
+	}
+
+	/**
+	 * @brief ܂CxgoioXbĥ݁j
+	 *
+	 * oĂԂɐς܂ꂽCxgĎoA1Ɏô͗eʂ܂łɂ
+	 *
+	 * @param[in] function oCxgf[^󂯎֐
+	 *
+	 * @return o
+	 */
+	template <typename TFunction>
+	size_t Drain(TFunction&& function)
+	{
+		const size_t depth = m_enqueuePosition.load(std::memory_order_relaxed) - m_dequeuePosition;
+		if (depth > m_maxDepth) { m_maxDepth = depth; }
+
+		size_t drainedNum = 0;
+		TPayload payload;
+		while (drainedNum <= m_mask && TryPop(&payload))
+		{
+			function(payload);
+			drainedNum++;
+		}
+
+		m_drainedNum += drainedNum;
+		return drainedNum;
+	}
+
+	/**
+	 * @brief Cxg1oioXbĥ݁j
+	 *
+	 * @param[out] pOutPayload oCxgf[^
+	 *
+	 * @retval true  o
+	 * @retval false 񂪋
+	 */
+	bool TryPop(TPayload* pOutPayload)
+	{
+		Cell& cell = m_cells[m_dequeuePosition & m_mask];
+		if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) { return false; }
+
+		*pOutPayload = cell.payload;
+
+		// ̈ʒuŋ󂫂ɂ
+		cell.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+		m_dequeuePosition++;
+		return true;
+	}
+
+
+// 擾/ݒ
+public:
+	// eʂ̎擾
+	size_t GetCapacity() const { return m_mask + 1; }
+
+
+// 
+private:
+	// 󂫂ΐς
+	bool PushIfSpace(const TPayload& payload)
+	{
+		size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+		Cell* pCell = nullptr;
+		for (;;)
+		{
+			pCell = &m_cells[position & m_mask];
+			const size_t sequence = pCell->sequence.load(std::memory_order_acquire);
+			const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+			if (difference == 0)
+			{
+				// 󂢂Ă̂ňʒuis position XVj
+				if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+			}
+			else if (difference < 0)
+			{
+				// O̗vf܂oĂȂ
+				return false;
+			}
+			else
+			{
+				// ̃Xbhɐzꂽ
+				position = m_enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		pCell->payload = payload;
+		pCell->sequence.store(position + 1, std::memory_order_release);
+		m_pushedNum.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+};
@@ -8,19 +8,39 @@
 #include "pch.h"
 #include "TaskManager.h"
 
+#include <algorithm>
+#include <unordered_map>
 
-// q^XNXgw^XN폜֐
+#include "TaskScheduler/TaskScheduler.h"
+
+
+namespace
+{
+	// Wu[hł̃XbhXṼ^XN̔ԍ
+	thread_local uint32_t t_updatingNodeIndex = 0;
+}
+
+
+// q^XNXgɒǉ֐
+void TaskConnectInfo::AddChild(Task* task)
+{
+	m_children.push_back(task);
+
+	// OƂ̂߂ɈʒuoĂ
+	TaskConnectInfo& connect = task->GetTaskConnectInfo();
+	connect.m_siblingIterator = std::prev(m_children.end());
+	connect.m_isLinked = true;
+}
+
+// q^XNXgw^XN폜֐ioĂʒuŊÔŒTȂj
 bool TaskConnectInfo::DeleteChildList(Task* task)
 {
-	for (auto it = m_children.begin(); it != m_children.end(); it++)
-	{
-		if ((*it) == task)
-		{
-			m_children.erase(it);
-			return true;
-		}
-	}
-	return false;
+	TaskConnectInfo& connect = task->GetTaskConnectInfo();
+	if (!connect.m_isLinked) { return false; }
+
+	m_children.erase(connect.m_siblingIterator);
+	connect.m_isLinked = false;
+	return true;
 }
 
 // w肵^XN̎qɂύX֐
@@ -32,6 +52,9 @@ void Task::ChangeParent(Task* parent)
 	// eςȂꍇ͉Ȃ
 	if (currentParent == parent) return;
 
+	// Wu[hōXV̏ꍇ́AXVIĂeς
+	if (GetTaskManager() && GetTaskManager()->RequestChangeParent(this, parent)) return;
+
 	// ݂̐e^XN̎qXg^XN폜
 	currentParent->GetTaskConnectInfo().DeleteChildList(this);
 
@@ -40,6 +63,24 @@ void Task::ChangeParent(Task* parent)
 
 	// e^XN̎qXgɒǉ
 	parent->GetTaskConnectInfo().AddChild(this);
+
+	// ˑ֌W̃OtƍXV̔z蒼A`揇ג
+	if (GetTaskManager())
+	{
+		GetTaskManager()->MarkTreeDirty();
+		GetTaskManager()->MarkDrawOrderDirty(this, true);
+	}
+}
+
+// `揇ݒ֐
+void Task::SetOt(int ot)
+{
+	// ςȂꍇ͕גȂ
+	if (m_ot == ot) { return; }
+
+	m_ot = ot;
+
+	if (GetTaskManager()) { GetTaskManager()->MarkDrawOrderDirty(this); }
 }
 
 /**
@@ -51,6 +92,8 @@ void Task::EnableTask()
 	if (m_isEnabled) { return; }
 
 	m_isEnabled = true;
+
+	if (GetTaskManager()) { GetTaskManager()->UpdateEnabledCache(this); }
 }
 
 /**
@@ -62,6 +105,8 @@ void Task::DisableTask()
 	if (!m_isEnabled) { return; }
 
 	m_isEnabled = false;
+
+	if (GetTaskManager()) { GetTaskManager()->UpdateEnabledCache(this); }
 }
 
 /**
@@ -72,6 +117,13 @@ void Task::DisableTask()
  */
 bool Task::IsEnabled() const
 {
+	// ^XNǗoĂꍇ͐eǂȂ
+	bool isEnabled = false;
+	if (GetTaskManager() && GetTaskManager()->FindCachedEnabled(this, &isEnabled))
+	{
+		return isEnabled;
+	}
+
 	// e^XN̎擾
 	Task* parent = m_connect.GetParent();
 
@@ -84,16 +136,129 @@ bool Task::IsEnabled() const
 	return m_isEnabled;
 }
 
+/**
+ * @brief ǂދLf[^錾
+ *
+ * Wu[hł́Af[^^XNƑȌԂۂčXV
+ *
+ * @param[in] resource Lf[^iAhXʎqɂj
+ */
+void Task::AddReadResource(const void* resource)
+{
+	m_readResources.push_back(resource);
+	m_isAccessDeclared = true;
+
+	if (GetTaskManager()) { GetTaskManager()->MarkGraphDirty(); }
+}
+
+/**
+ * @brief Lf[^錾
+ *
+ * Wu[hł́Af[^ǂݏ^XNƑȌԂۂčXV
+ *
+ * @param[in] resource Lf[^iAhXʎqɂj
+ */
+void Task::AddWriteResource(const void* resource)
+{
+	m_writeResources.push_back(resource);
+	m_isAccessDeclared = true;
+
+	if (GetTaskManager()) { GetTaskManager()->MarkGraphDirty(); }
+}
+
+/**
+ * @brief ɍXVIׂ^XN錾
+ *
+ * Lf[^̐錾Ƃ͕ʂɏԂ߂B̍XVƓʂɂɂ́AOŐɂ^XNw肷
+ *
+ * @param[in] task ɍXVIׂ^XN
+ */
+void Task::AddPredecessor(Task* task)
+{
+	m_predecessors.push_back(task);
+
+	if (GetTaskManager()) { GetTaskManager()->MarkGraphDirty(); }
+}
+
+/**
+ * @brief Lf[^ɐGȂƂ錾
+ *
+ * e^XNƐɍXVIׂ^XŇł΁Ã^XNƓɍXVĂ悢Ƃ\
+ */
+void Task::DeclareIndependent()
+{
+	m_isAccessDeclared = true;
+
+	if (GetTaskManager()) { GetTaskManager()->MarkGraphDirty(); }
+}
+
+/**
+ * @brief ˑ֌W̐錾
+ */
+void Task::ClearDependencies()
+{
+	m_readResources.clear();
+	m_writeResources.clear();
+	m_predecessors.clear();
+	m_isAccessDeclared = false;
+
+	if (GetTaskManager()) { GetTaskManager()->MarkGraphDirty(); }
+}
+
+// RXgN^
+TaskManager::TaskManager()
+	: m_ot{}
+	, m_otInsertions{}
+	, m_otFirstHole{ UINT32_MAX }
+	, m_isDrawKeyDirty{ false }
+	, m_rootTask{}
+	, m_currentTask{}
+	, m_totalTaskCnt{}
+	, m_flatTasks{}
+	, m_flatEnds{}
+	, m_flatParents{}
+	, m_flatEnabled{}
+	, m_flatHoleNum{ 0 }
+	, m_isFlatDirty{ true }
+	, m_updateMode{ UpdateMode::SEQUENTIAL }
+	, m_scheduler{ std::make_unique<TaskScheduler>() }
+	, m_nodes{}
+	, m_isGraphDirty{ true }
+	, m_graphBuildCnt{ 0 }
+	, m_isRunningJobs{ false }
+	, m_isEnabledCacheStale{ false }
+	, m_pendingTasks{}
+{
+	// [g^XN̍쐬
+	m_rootTask = std::make_unique<Task>();
+	// ݂̃^XN̐ݒ
+	m_currentTask = m_rootTask.get();
+	// [g^XN̖Oݒ
+	m_rootTask->SetName("RootTask");
+}
+
+// fXgN^
+TaskManager::~TaskManager()
+{
+	//DeleteTask(m_rootTask);
+}
+
 // XV֐
 void TaskManager::Update(float deltaTime)
 {
-	// `揇Ǘe[uNA
-	m_ot.clear();
-	// [g^XNq^XNɌčċNIɍXVs
-	ChildTaskUpdate(m_rootTask.get(), deltaTime);
+	if (m_updateMode == UpdateMode::PARALLEL)
+	{
+		// Wu[h
+		ParallelUpdate(deltaTime);
+	}
+	else
+	{
+		// XV̔zɏ]ă[g^XN̎qOɍXV
+		FlatUpdate(deltaTime);
+	}
 
-	// s̃^XN[g^XNɐݒ
-	m_currentTask = m_rootTask.get();
+	// ǉE폜E`揇̕ύX^XN`揇Ǘe[uŕג
+	FlushOt();
 }
 
 // `֐
@@ -102,6 +267,9 @@ void TaskManager::Render(const Camera& camera)
 	// `揇Ǘe[uɏ]ă^XN̕`֐Ăяo
 	for (auto it = m_ot.begin(); it != m_ot.end(); it++)
 	{
+		// 폜^XN͕`悵Ȃi̍XVŋl߂j
+		if ((*it) == nullptr) { continue; }
+
 		// LłȂΕ`悵Ȃ
 		if (!(*it)->IsEnabled()) { continue; }
 
@@ -119,6 +287,25 @@ void TaskManager::Render(const Camera& camera)
 
 void TaskManager::AddTask(Task* task)
 {
+	// Wu[hōXV̏ꍇ́AXVIĂXṼ^XN̎qɂ
+	// iǉ҂Ԃɐeς悤A^XNǗIuWFNgɐݒ肷j
+	if (m_isRunningJobs)
+	{
+		task->GetTaskConnectInfo().SetTaskManager(this);
+
+		std::lock_guard<std::mutex> lock(m_pendingMutex);
+		m_pendingTasks.push_back(PendingTask{ PendingType::ADD_TASK, t_updatingNodeIndex, task, nullptr });
+		return;
+	}
+
+	// ˑ֌W̃OtƍXV̔z蒼
+	m_isGraphDirty = true;
+	m_isFlatDirty = true;
+
+	// `揇Ǘe[uɓo^
+	m_isDrawKeyDirty = true;
+	RequestOtInsertion(task);
+
 	// ^XN̐֐is̃^XN̎qɂȂj
 
 		// ^XNǗIuWFNgݒ
@@ -164,21 +351,76 @@ void TaskManager::DeleteTask(Task* task)
 {
 	assert(task != nullptr);
 
-	// q^XNċAō폜Ă
+	// Wu[hōXV̏ꍇ́AXVIĂ폜
+	if (m_isRunningJobs)
+	{
+		std::lock_guard<std::mutex> lock(m_pendingMutex);
+		m_pendingTasks.push_back(PendingTask{ PendingType::DELETE_TASK, t_updatingNodeIndex, task, nullptr });
+		return;
+	}
+
+	// ˑ֌W̃Ot蒼
+	m_isGraphDirty = true;
+
+	// `揇Ǘe[uO
+	RemoveFromOt(task);
+
+	// XV̔zł͕؂͈̔͂󂯂il߂̂͌ł܂Ƃ߂čsj
+	uint32_t flatIndex = 0;
+	if (FindFlatIndex(task, &flatIndex))
+	{
+		for (uint32_t i = flatIndex; i < m_flatEnds[flatIndex]; i++)
+		{
+			if (m_flatTasks[i] == nullptr) { continue; }
+
+			m_flatTasks[i] = nullptr;
+			m_flatHoleNum++;
+		}
+	}
+
+	// q^XNċAō폜Ăi폜q^XN͂̃XgOj
 	auto childList = task->GetTaskConnectInfo().GetChildList();
 	while (childList->empty() != true)
 	{
 		DeleteTask(childList->back());
-		childList->pop_back();
 	}
 
 	// Xg폜
-	auto parentChildList = task->GetParent()->GetTaskConnectInfo().GetChildList();
-	auto it = std::find(parentChildList->begin(), parentChildList->end(), task);
-	if (it != parentChildList->end())
+	task->GetParent()->GetTaskConnectInfo().DeleteChildList(task);
+}
+
+/**
+ * @brief Wu[hōXVȂe̕ύXXV̌ɉ
+ *
+ * ǉ҂Ă^XŃAǉ鎞̐eς
+ *
+ * @param[in] task		eς^XN
+ * @param[in] parent	Ve
+ *
+ * @returns true  XV̌ɉ񂵂
+ * @returns false XVłȂ̂ŁAĂяoŐeς
+ */
+bool TaskManager::RequestChangeParent(Task* task, Task* parent)
+{
+	if (!m_isRunningJobs) { return false; }
+
+	std::lock_guard<std::mutex> lock(m_pendingMutex);
+
+	// ê͒ǉ҂Ă^XN
+	if (task->GetParent() == nullptr)
 	{
-		parentChildList->erase(it);
+		for (auto it = m_pendingTasks.rbegin(); it != m_pendingTasks.rend(); it++)
+		{
+			if (it->type == PendingType::ADD_TASK && it->task == task)
+			{
+				it->parent = parent;
+				return true;
+			}
+		}
 	}
+
+	m_pendingTasks.push_back(PendingTask{ PendingType::CHANGE_PARENT, t_updatingNodeIndex, task, parent });
+	return true;
 }
 
 // q^XN̍XV֐ċNĂяoŎs֐
@@ -197,17 +439,581 @@ void TaskManager::ChildTaskUpdate(Task* task, float deltaTime)
 		// Update֐̖߂lfalsȅꍇ̓^XN폜
 		if (!(*it)->UpdateTask(deltaTime))
 		{
+			// ̃^XNɐi߂Ă폜iDeleteTask ̒Ŏq^XNXgOAit ɂȂ邽߁j
+			Task* deleteTask = *it;
+			it++;
 			// ^XN̍폜
-			DeleteTask(*it);
-			// q^XNXg폜
-			it = childList->erase(it);
+			DeleteTask(deleteTask);
 			continue;
 		}
-		// `揇Ǘe[uɓo^
-		m_ot.insert(*it);
 		// q̃^XN̍XVs
 		ChildTaskUpdate(*it, deltaTime);
 		it++;
 	}
 }
 
+/**
+ * @brief `揇Ǘe[uג
+ *
+ * O^XN̈ʒul߁Ao^^XNׂĂ납畹BύXȂΉȂB
+ * `揇^XN͑Oɕԁit[Oɓo^ĂƓԁjB
+ * 폜^XN͊ɉĂꍇ̂ŐGȂ
+ */
+void TaskManager::FlushOt()
+{
+	if (m_otFirstHole == UINT32_MAX && m_otInsertions.empty()) { return; }
+
+	// ǉEe̕ύXꍇ͑O̔ԍU蒼io^ς݂̃^XNm̏Ԃ͕ςȂj
+	if (m_isDrawKeyDirty)
+	{
+		uint32_t drawKey = 0;
+		AssignDrawKeys(m_rootTask.get(), &drawKey);
+		m_isDrawKeyDirty = false;
+	}
+
+	// O^XN̈ʒul߂iŏɊOʒuO͕ςȂj
+	size_t firstChangedIndex = m_ot.size();
+	if (m_otFirstHole != UINT32_MAX)
+	{
+		firstChangedIndex = m_otFirstHole;
+		m_ot.erase(std::remove(m_ot.begin() + m_otFirstHole, m_ot.end(), nullptr), m_ot.end());
+		m_otFirstHole = UINT32_MAX;
+	}
+
+	// o^^XNׂ
+	m_otInsertions.erase(std::remove(m_otInsertions.begin(), m_otInsertions.end(), nullptr), m_otInsertions.end());
+	std::sort(m_otInsertions.begin(), m_otInsertions.end(), greater_ot());
+
+	// 납畹
+	size_t listIndex = m_ot.size();
+	size_t insertionIndex = m_otInsertions.size();
+	m_ot.resize(m_ot.size() + m_otInsertions.size());
+	size_t writeIndex = m_ot.size();
+	while (insertionIndex > 0)
+	{
+		if (listIndex > 0 && greater_ot()(m_otInsertions[insertionIndex - 1], m_ot[listIndex - 1]))
+		{
+			m_ot[--writeIndex] = m_ot[--listIndex];
+		}
+		else
+		{
+			m_ot[--writeIndex] = m_otInsertions[--insertionIndex];
+		}
+	}
+	m_otInsertions.clear();
+	firstChangedIndex = std::min(firstChangedIndex, writeIndex);
+
+	// ^XN̈ʒuL^
+	for (uint32_t i = static_cast<uint32_t>(firstChangedIndex); i < static_cast<uint32_t>(m_ot.size()); i++)
+	{
+		TaskConnectInfo& connect = m_ot[i]->GetTaskConnectInfo();
+		connect.SetDrawState(TaskConnectInfo::DrawState::LISTED);
+		connect.SetOtIndex(i);
+	}
+}
+
+// `揇Ǘe[uւ̓o^\񂷂֐
+void TaskManager::RequestOtInsertion(Task* task)
+{
+	TaskConnectInfo& connect = task->GetTaskConnectInfo();
+
+	// ɗ\񂵂Ă
+	if (connect.GetDrawState() == TaskConnectInfo::DrawState::ADDING) { return; }
+
+	// o^ς݂̏ꍇ͊Oēo^
+	if (connect.GetDrawState() == TaskConnectInfo::DrawState::LISTED)
+	{
+		m_ot[connect.GetOtIndex()] = nullptr;
+		m_otFirstHole = std::min(m_otFirstHole, connect.GetOtIndex());
+	}
+
+	connect.SetDrawState(TaskConnectInfo::DrawState::ADDING);
+	connect.SetOtIndex(static_cast<uint32_t>(m_otInsertions.size()));
+	m_otInsertions.push_back(task);
+}
+
+// `揇Ǘe[uO֐
+void TaskManager::RemoveFromOt(Task* task)
+{
+	TaskConnectInfo& connect = task->GetTaskConnectInfo();
+	switch (connect.GetDrawState())
+	{
+	case TaskConnectInfo::DrawState::ADDING:
+		m_otInsertions[connect.GetOtIndex()] = nullptr;
+		break;
+	case TaskConnectInfo::DrawState::LISTED:
+		m_ot[connect.GetOtIndex()] = nullptr;
+		m_otFirstHole = std::min(m_otFirstHole, connect.GetOtIndex());
+		break;
+	default:
+		break;
+	}
+	connect.SetDrawState(TaskConnectInfo::DrawState::NONE);
+}
+
+// `揇Ǘe[üʒu̕ύXq^XN܂ŗ\񂷂֐
+void TaskManager::RequestOtInsertionTree(Task* task)
+{
+	RequestOtInsertion(task);
+	for (Task* child : *task->GetTaskConnectInfo().GetChildList())
+	{
+		RequestOtInsertionTree(child);
+	}
+}
+
+// O̔ԍU֐
+void TaskManager::AssignDrawKeys(Task* task, uint32_t* pDrawKey)
+{
+	for (Task* child : *task->GetTaskConnectInfo().GetChildList())
+	{
+		child->GetTaskConnectInfo().SetDrawKey((*pDrawKey)++);
+		AssignDrawKeys(child, pDrawKey);
+	}
+}
+
+/**
+ * @brief `揇ς^XN̍XVŕג
+ *
+ * Wu[h̍XVɌĂ΂ꂽꍇAXVIĂג
+ *
+ * @param[in] task				`揇ς^XN
+ * @param[in] isParentChanged	eςǂiOς̂Ŏq^XNגj
+ */
+void TaskManager::MarkDrawOrderDirty(Task* task, bool isParentChanged)
+{
+	std::unique_lock<std::mutex> lock(m_otMutex, std::defer_lock);
+	if (m_isRunningJobs) { lock.lock(); }
+
+	if (isParentChanged)
+	{
+		m_isDrawKeyDirty = true;
+		RequestOtInsertionTree(task);
+	}
+	else
+	{
+		RequestOtInsertion(task);
+	}
+}
+
+/**
+ * @brief XV̔zɏ]čXV
+ *
+ * ċAŎq^XNXgǂɁAO̔z擪XVB
+ * XV֐̖߂l false ̃^XNƁAȃ^XN̎q͕؂̏I܂Ŕ΂B
+ * XVɃ^XN̒ǉEe̕ύXꍇ͍蒼AXṼ^XN̈ʒu瑱̂ŁA
+ * ċAłǂĂƓԁEt[ōXV
+ *
+ * @param[in] deltaTime oߎ
+ */
+void TaskManager::FlatUpdate(float deltaTime)
+{
+	if (m_isFlatDirty)
+	{
+		RebuildFlat();
+	}
+
+	// [gLłȂ΍XVȂ
+	if (!m_rootTask->IsEnabled()) { return; }
+
+	uint32_t index = 0;
+	while (index < static_cast<uint32_t>(m_flatTasks.size()))
+	{
+		Task* task = m_flatTasks[index];
+
+		// 폜^XN͕؂Ɣ΂
+		if (task == nullptr)
+		{
+			index = m_flatEnds[index];
+			continue;
+		}
+
+		// s̃^XNݒ
+		m_currentTask = task;
+
+		const bool isAlive = task->UpdateTask(deltaTime);
+
+		// XVɃ^XN̒ǉEe̕ύXꍇ͍蒼
+		if (m_isFlatDirty)
+		{
+			RebuildFlat();
+			if (!FindFlatIndex(task, &index)) { continue; }
+		}
+
+		// XVɎg폜ꂽ
+		if (m_flatTasks[index] != task)
+		{
+			index = m_flatEnds[index];
+			continue;
+		}
+
+		// Update֐̖߂lfalsȅꍇ͕؂ƍ폜
+		if (!isAlive)
+		{
+			const uint32_t end = m_flatEnds[index];
+			DeleteTask(task);
+			index = end;
+			continue;
+		}
+
+		// ȏꍇ͎qXVȂ
+		index = m_flatEnabled[index] ? index + 1 : m_flatEnds[index];
+	}
+
+	// s̃^XN[g^XNɐݒ
+	m_currentTask = m_rootTask.get();
+
+	// 폜^XNŜ 1/4 𒴂l߂
+	if (m_flatHoleNum * 4 > m_flatTasks.size())
+	{
+		RebuildFlat();
+	}
+}
+
+// XV̔z蒼֐
+void TaskManager::RebuildFlat()
+{
+	m_flatTasks.clear();
+	m_flatEnds.clear();
+	m_flatParents.clear();
+	m_flatEnabled.clear();
+	m_flatHoleNum = 0;
+	m_isFlatDirty = false;
+
+	FlattenTree(m_rootTask.get(), NO_PARENT, m_rootTask->IsSelfEnabled());
+}
+
+// ^XNOɍXV̔zɕׂ֐
+void TaskManager::FlattenTree(Task* task, uint32_t parentIndex, bool isParentEnabled)
+{
+	for (Task* child : *task->GetTaskConnectInfo().GetChildList())
+	{
+		const uint32_t index = static_cast<uint32_t>(m_flatTasks.size());
+		const bool isEnabled = isParentEnabled && child->IsSelfEnabled();
+
+		m_flatTasks.push_back(child);
+		m_flatEnds.push_back(index + 1);
+		m_flatParents.push_back(parentIndex);
+		m_flatEnabled.push_back(isEnabled ? 1 : 0);
+		child->GetTaskConnectInfo().SetFlatIndex(index);
+
+		FlattenTree(child, index, isEnabled);
+		m_flatEnds[index] = static_cast<uint32_t>(m_flatTasks.size());
+	}
+}
+
+// XV̔zł̃^XN̈ʒuT֐i蒼OE폜ꍇ falsej
+bool TaskManager::FindFlatIndex(const Task* task, uint32_t* pIndex) const
+{
+	if (m_isFlatDirty) { return false; }
+
+	const uint32_t index = const_cast<Task*>(task)->GetTaskConnectInfo().GetFlatIndex();
+	if (index >= m_flatTasks.size() || m_flatTasks[index] != task) { return false; }
+
+	*pIndex = index;
+	return true;
+}
+
+/**
+ * @brief LE؂ւ^XN̕؂̗Lo
+ *
+ * ɂꍇ͕؂͈̔͂܂Ƃ߂ĖɂALɂꍇ͔͈͂O狁ߒB
+ * XV̔z蒼Oł΁A蒼Ƃɋ߂B
+ * Wu[hōXV͑̃Xbhǂł邽ߏAXVIĂ蒼
+ *
+ * @param[in] task LE؂ւ^XN
+ */
+void TaskManager::UpdateEnabledCache(Task* task)
+{
+	if (m_isRunningJobs)
+	{
+		m_isEnabledCacheStale.store(true, std::memory_order_relaxed);
+		return;
+	}
+
+	// [g̏ꍇ͑SĂς̂ō蒼
+	if (task == m_rootTask.get())
+	{
+		m_isFlatDirty = true;
+		return;
+	}
+
+	uint32_t index = 0;
+	if (!FindFlatIndex(task, &index)) { return; }
+
+	const uint32_t parentIndex = m_flatParents[index];
+	const bool isParentEnabled = (parentIndex == NO_PARENT) ? m_rootTask->IsSelfEnabled() : (m_flatEnabled[parentIndex] != 0);
+	const bool isEnabled = isParentEnabled && task->IsSelfEnabled();
+
+	// ςȂꍇ͎qςȂ
+	if ((m_flatEnabled[index] != 0) == isEnabled) { return; }
+
+	const uint32_t end = m_flatEnds[index];
+	if (!isEnabled)
+	{
+		std::fill(m_flatEnabled.begin() + index, m_flatEnabled.begin() + end, static_cast<uint8_t>(0));
+		return;
+	}
+
+	// q͂ꂼꎩgƐe̗L狁߂ie͑OŐɂj
+	m_flatEnabled[index] = 1;
+	for (uint32_t i = index + 1; i < end; i++)
+	{
+		if (m_flatTasks[i] == nullptr) { continue; }
+		m_flatEnabled[i] = (m_flatTasks[i]->IsSelfEnabled() && m_flatEnabled[m_flatParents[i]]) ? 1 : 0;
+	}
+}
+
+// oĂL擾֐
+bool TaskManager::FindCachedEnabled(const Task* task, bool* pIsEnabled) const
+{
+	// Wu[hōXV͊oĂLÂꍇ邽߁Aeǂ点
+	if (m_isRunningJobs) { return false; }
+
+	uint32_t index = 0;
+	if (!FindFlatIndex(task, &index)) { return false; }
+
+	*pIsEnabled = (m_flatEnabled[index] != 0);
+	return true;
+}
+
+// Wu[hŎgXbhݒ肷֐
+void TaskManager::SetThreadNum(uint32_t threadNum)
+{
+	m_scheduler->SetThreadNum(threadNum);
+}
+
+// Wu[hŎgXbh擾֐
+uint32_t TaskManager::GetThreadNum() const
+{
+	return m_scheduler->GetThreadNum();
+}
+
+/**
+ * @brief Wu[hōXV
+ *
+ * ^XN̒ǉE폜Ee̕ύXꍇˑ֌W̃Ot蒼A
+ * ˑXVI^XN畡̃XbhōXVB
+ * XṼ^XN̒ǉE폜Ee̕ύXƕ`揇Ǘe[uւ̓o^́ASĂ̍XVIĂ
+ * ύX^XN̑OEύXɍs߁AXV͖؂ςȂB
+ * 폜^XNeς^XNύX^XNOŐɂAɍXVIׂ^XNƂĐ錾Ă΁A
+ * ̍XVƓʂɂȂiXVɒǉ^XÑ͎t[XVA
+ * eςđOŌɈڂ^XN͂̃t[ɂx͍XVȂjB
+ * Ot񂵂Ăꍇ͒ɍXV
+ *
+ * @param[in] deltaTime oߎ
+ */
+void TaskManager::ParallelUpdate(float deltaTime)
+{
+	if (m_isGraphDirty)
+	{
+		BuildGraph();
+	}
+
+	// 񂵂Ăꍇ͒ɍXV
+	if (!m_scheduler->IsValid())
+	{
+		ChildTaskUpdate(m_rootTask.get(), deltaTime);
+		m_currentTask = m_rootTask.get();
+		return;
+	}
+
+	// [gLłȂ΍XVȂ
+	if (!m_rootTask->IsEnabled()) { return; }
+
+	for (auto& node : m_nodes)
+	{
+		node.isUpdated = false;
+		node.isAlive = true;
+		node.isChildrenUpdated = false;
+	}
+
+	// ˑ֌Wɏ]čXV
+	m_isRunningJobs = true;
+	m_scheduler->Run([this, deltaTime](uint32_t nodeIndex) { UpdateNode(nodeIndex, deltaTime); });
+	m_isRunningJobs = false;
+
+	// XVɗLE؂ւ^XN΁AXV̔z蒼Ċo
+	if (m_isEnabledCacheStale.exchange(false)) { m_isFlatDirty = true; }
+
+	// XVɍsꂽ؂̕ύXs
+	ApplyPendingTasks();
+
+	// XV֐̖߂l false ̃^XN폜iXVɍ폜ꂽ^XN͔΂j
+	for (const auto& node : m_nodes)
+	{
+		if (node.isUpdated && !node.isAlive && node.task->GetTaskConnectInfo().IsLinked())
+		{
+			DeleteTask(node.task);
+		}
+	}
+
+	// s̃^XN[g^XNɐݒ
+	m_currentTask = m_rootTask.get();
+}
+
+/**
+ * @brief XVɍsꂽ؂̕ύXAύX^XN̑OEύXɍs
+ *
+ * ɍ폜ꂽ^XN̍폜Ee̕ύXƁA폜ꂽ^XN̎qɂύX͔΂
+ */
+void TaskManager::ApplyPendingTasks()
+{
+	std::stable_sort(m_pendingTasks.begin(), m_pendingTasks.end(),
+		[](const PendingTask& a, const PendingTask& b) { return a.nodeIndex < b.nodeIndex; });
+
+	auto isInTree = [this](Task* task) { return task == m_rootTask.get() || task->GetTaskConnectInfo().IsLinked(); };
+
+	for (const auto& pending : m_pendingTasks)
+	{
+		switch (pending.type)
+		{
+		case PendingType::ADD_TASK:
+			// eςĂȂΒǉ^XN̎qɂ
+			m_currentTask = (pending.parent != nullptr) ? pending.parent : m_nodes[pending.nodeIndex].task;
+			if (isInTree(m_currentTask)) { AddTask(pending.task); }
+			break;
+
+		case PendingType::DELETE_TASK:
+			if (isInTree(pending.task)) { DeleteTask(pending.task); }
+			break;
+
+		case PendingType::CHANGE_PARENT:
+			if (isInTree(pending.task) && isInTree(pending.parent)) { pending.task->ChangeParent(pending.parent); }
+			break;
+		}
+	}
+	m_pendingTasks.clear();
+}
+
+/**
+ * @brief ˑ֌W̃Ot
+ *
+ * Oɕׂ^XNɎ̈ˑ֌WtB
+ * Ee^XŇɎq^XN
+ * ELf[^^XŇɁAǂށEOŌ̃^XN
+ * ELf[^ǂރ^XŇɁAOŌ̃^XN
+ * EɍXVIׂ^XŇ
+ * ELf[^錾ĂȂ^XŃAOőȎSẴ^XŇŁȂSẴ^XN̑O
+ */
+void TaskManager::BuildGraph()
+{
+	// Lf[^̒O̓ǂݏ
+	struct ResourceAccess
+	{
+		uint32_t lastWriter = NO_PARENT;
+		std::vector<uint32_t> readers;
+	};
+
+	m_isGraphDirty = false;
+	m_graphBuildCnt++;
+
+	m_nodes.clear();
+	CollectNodes(m_rootTask.get(), NO_PARENT);
+
+	const uint32_t nodeNum = static_cast<uint32_t>(m_nodes.size());
+	m_scheduler->BeginGraph(nodeNum);
+
+	std::unordered_map<const Task*, uint32_t> nodeIndices;
+	std::unordered_map<const void*, ResourceAccess> resources;
+	std::vector<uint32_t> sinceBarrier;
+	uint32_t lastBarrier = NO_PARENT;
+
+	for (uint32_t i = 0; i < nodeNum; i++)
+	{
+		const TaskNode& node = m_nodes[i];
+		const Task* task = node.task;
+
+		nodeIndices[task] = i;
+
+		if (node.parentIndex != NO_PARENT) { m_scheduler->AddDependency(node.parentIndex, i); }
+		if (lastBarrier != NO_PARENT) { m_scheduler->AddDependency(lastBarrier, i); }
+
+		// 錾ĂȂ^XN͑ȎSẴ^XNƏɍXV
+		if (!task->IsAccessDeclared())
+		{
+			for (const uint32_t before : sinceBarrier)
+			{
+				m_scheduler->AddDependency(before, i);
+			}
+			sinceBarrier.clear();
+			resources.clear();
+			lastBarrier = i;
+			continue;
+		}
+
+		sinceBarrier.push_back(i);
+
+		for (const void* resource : task->GetReadResources())
+		{
+			ResourceAccess& access = resources[resource];
+			if (access.lastWriter != NO_PARENT) { m_scheduler->AddDependency(access.lastWriter, i); }
+			access.readers.push_back(i);
+		}
+
+		for (const void* resource : task->GetWriteResources())
+		{
+			ResourceAccess& access = resources[resource];
+			if (access.readers.empty())
+			{
+				if (access.lastWriter != NO_PARENT) { m_scheduler->AddDependency(access.lastWriter, i); }
+			}
+			else
+			{
+				// ǂ񂾃^XN͒Oɏ^XŇȂ̂ŁAǂ񂾃^XŇł΂悢
+				for (const uint32_t reader : access.readers)
+				{
+					m_scheduler->AddDependency(reader, i);
+				}
+			}
+			access.readers.clear();
+			access.lastWriter = i;
+		}
+	}
+
+	// ɍXVIׂ^XNi폜ꂽ^XN͔΂j
+	for (uint32_t i = 0; i < nodeNum; i++)
+	{
+		for (const Task* predecessor : m_nodes[i].task->GetPredecessors())
+		{
+			const auto it = nodeIndices.find(predecessor);
+			if (it != nodeIndices.end()) { m_scheduler->AddDependency(it->second, i); }
+		}
+	}
+
+	if (!m_scheduler->EndGraph())
+	{
+		OutputDebugString(L"TaskManager : ˑ֌W񂵂Ă邽ߒɍXV܂\n");
+	}
+}
+
+// ^XNOɏW߂֐
+void TaskManager::CollectNodes(Task* task, uint32_t parentIndex)
+{
+	for (Task* child : *task->GetTaskConnectInfo().GetChildList())
+	{
+		const uint32_t index = static_cast<uint32_t>(m_nodes.size());
+		m_nodes.push_back(TaskNode{ child, parentIndex, false, true, false });
+		CollectNodes(child, index);
+	}
+}
+
+/**
+ * @brief Wu[h1̃^XNXV
+ *
+ * ̍XVƓAe^XNXVȂE폜Ȅꍇ͍XVȂ
+ *
+ * @param[in] nodeIndex	^XN̔ԍ
+ * @param[in] deltaTime	oߎ
+ */
+void TaskManager::UpdateNode(uint32_t nodeIndex, float deltaTime)
+{
+	TaskNode& node = m_nodes[nodeIndex];
+
+	if (node.parentIndex != NO_PARENT && !m_nodes[node.parentIndex].isChildrenUpdated) { return; }
+
+	t_updatingNodeIndex = nodeIndex;
+
+	node.isAlive = node.task->UpdateTask(deltaTime);
+	node.isUpdated = true;
+	node.isChildrenUpdated = node.isAlive && node.task->IsEnabled();
+}
@@ -7,21 +7,35 @@
  *********************************************************************/
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <set>
 #include <sstream>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 class Camera;
 
 class TaskManager;
 class Task;
+class TaskScheduler;
 
 /**
 	* @brief ^XNAǗNX
 	*/
 class TaskConnectInfo
 {
+public:
+	// `揇Ǘe[uł̏
+	enum class DrawState : uint8_t
+	{
+		NONE,		// o^ĂȂ
+		ADDING,		// ̕גœo^
+		LISTED,		// o^Ă
+	};
+
 private:
 	// ^XNǗIuWFNgւ̃|C^
 	TaskManager* m_taskManager;
@@ -32,15 +46,42 @@ private:
 	// q^XÑXg
 	std::list<Task*> m_children;
 
+	// e^XN̎qXgł̈ʒuiqXg萔ԂŊOj
+	std::list<Task*>::iterator m_siblingIterator;
+
+	// e^XN̎qXgɓĂ邩ǂ
+	bool m_isLinked;
+
+	// XV̔zł̈ʒu
+	uint32_t m_flatIndex;
+
+	// O̔ԍi`揇^XN͂̏ɕ`悷j
+	uint32_t m_drawKey;
+
+	// `揇Ǘe[uł̏
+	DrawState m_drawState;
+
+	// `揇Ǘe[uio^ꍇ͓o^̗\jł̈ʒu
+	uint32_t m_otIndex;
+
 public:
-	TaskConnectInfo() : m_taskManager{}, m_parent{} {}
+	TaskConnectInfo() : m_taskManager{}, m_parent{}, m_siblingIterator{}, m_isLinked{ false }, m_flatIndex{}, m_drawKey{}, m_drawState{ DrawState::NONE }, m_otIndex{} {}
 	TaskManager* GetTaskManager() const { return m_taskManager; }
 	Task* GetParent() const { return m_parent; }
 	std::list<Task*>* GetChildList() { return &m_children; }
+	bool IsLinked() const { return m_isLinked; }
 	void SetTaskManager(TaskManager* taskManager) { m_taskManager = taskManager; }
 	void SetParent(Task* task) { m_parent = task; }
-	void AddChild(Task* task) { m_children.push_back(task); }
+	void AddChild(Task* task);
 	bool DeleteChildList(Task* task);
+	uint32_t GetFlatIndex() const { return m_flatIndex; }
+	void SetFlatIndex(uint32_t flatIndex) { m_flatIndex = flatIndex; }
+	uint32_t GetDrawKey() const { return m_drawKey; }
+	void SetDrawKey(uint32_t drawKey) { m_drawKey = drawKey; }
+	DrawState GetDrawState() const { return m_drawState; }
+	void SetDrawState(DrawState drawState) { m_drawState = drawState; }
+	uint32_t GetOtIndex() const { return m_otIndex; }
+	void SetOtIndex(uint32_t otIndex) { m_otIndex = otIndex; }
 };
 
 /**
@@ -61,6 +102,18 @@ private:
 	// ^XNLǂ
 	bool m_isEnabled;
 
+	// Wu[hœǂދLf[^iAhXʎqɂj
+	std::vector<const void*> m_readResources;
+
+	// Wu[hŏLf[^iAhXʎqɂj
+	std::vector<const void*> m_writeResources;
+
+	// Wu[hŐɍXVIׂ^XN
+	std::vector<Task*> m_predecessors;
+
+	// Wu[hŐG鋤Lf[^錾ǂi錾ĂȂ^XN͑ȎSẴ^XNƏɍXVj
+	bool m_isAccessDeclared;
+
 public:
 
 
@@ -69,7 +122,7 @@ public:
 public:
 
 	// RXgN^
-	Task() : m_ot(0), m_isEnabled{ true } {}
+	Task() : m_ot(0), m_isEnabled{ true }, m_isAccessDeclared{ false } {}
 	Task(Task* parent) : Task() { ChangeParent(parent); }
 
 	// fXgN^
@@ -97,7 +150,7 @@ public:
 	Task* GetParent() const { return m_connect.GetParent(); }
 
 	// `揇ݒ֐iot̒l0ԎOj
-	void SetOt(int ot) { this->m_ot = ot; }
+	void SetOt(int ot);
 
 	// `揇̎擾֐
 	int GetOt() const { return m_ot; }
@@ -128,9 +181,42 @@ public:
 	// ^XN𖳌
 	void DisableTask();
 
-	// Lǂ
+	// Lǂie^XNȂ疳j
 	bool IsEnabled() const;
 
+	// gLǂie^XNȂj
+	bool IsSelfEnabled() const { return m_isEnabled; }
+
+// Wu[ḧˑ֌W
+public:
+
+	// ǂދLf[^錾
+	void AddReadResource(const void* resource);
+
+	// Lf[^錾
+	void AddWriteResource(const void* resource);
+
+	// ɍXVIׂ^XN錾
+	void AddPredecessor(Task* task);
+
+	// Lf[^ɐGȂƂ錾
+	void DeclareIndependent();
+
+	// ˑ֌W̐錾iȎSẴ^XNƏɍXVj
+	void ClearDependencies();
+
+	// Lf[^錾ǂ
+	bool IsAccessDeclared() const { return m_isAccessDeclared; }
+
+	// ǂދLf[^̎擾
+	const std::vector<const void*>& GetReadResources() const { return m_readResources; }
+
+	// Lf[^̎擾
+	const std::vector<const void*>& GetWriteResources() const { return m_writeResources; }
+
+	// ɍXVIׂ^XN̎擾
+	const std::vector<Task*>& GetPredecessors() const { return m_predecessors; }
+
 };
 
 /**
@@ -138,20 +224,41 @@ public:
 	*/
 class TaskManager
 {
+public:
+
+	// XV̎d
+	enum class UpdateMode
+	{
+		SEQUENTIAL,	///< eq֏ɍċAōXV
+		PARALLEL,	///< ˑ֌W̃Otɏ]ăXbhɐU蕪čXViWu[hj
+	};
 
 private:
 #pragma region
-	// `揇Ǘe[uւ̓o^pr֐iot̒l傫擪ցj
+	// `揇Ǘe[uւ̓o^pr֐iot̒l傫擪ցAꍇ͑Oj
 	struct greater_ot 
 	{
 		bool operator()(Task* a, Task* b) const
 		{
-			return a->GetOt() > b->GetOt();
+			if (a->GetOt() != b->GetOt()) { return a->GetOt() > b->GetOt(); }
+			return a->GetTaskConnectInfo().GetDrawKey() < b->GetTaskConnectInfo().GetDrawKey();
 		}
 	};
 
-	// `揇Ǘe[u
-	std::multiset<Task*, greater_ot> m_ot;
+	// `揇Ǘe[ui^XN̒ǉE폜E`揇̕ύXƂגBO^XN̈ʒu nullptrj
+	std::vector<Task*> m_ot;
+
+	// ̕גœo^^XNi\^XN̈ʒu nullptrj
+	std::vector<Task*> m_otInsertions;
+
+	// `揇Ǘe[uōŏɊO^XN̈ʒuiOĂȂΗvfȏj
+	uint32_t m_otFirstHole;
+
+	// O̔ԍU蒼ǂ
+	bool m_isDrawKeyDirty;
+
+	// Wu[hōXV̕`揇̕ύX̔r
+	std::mutex m_otMutex;
 
 	// [g^XN
 	std::unique_ptr<Task> m_rootTask;
@@ -164,29 +271,142 @@ private:
 	// q^XN̍XV֐s֐
 	void ChildTaskUpdate(Task* task, float deltaTime);
 
+	// `揇Ǘe[uג֐
+	void FlushOt();
+
+	// `揇Ǘe[uւ̓o^\񂷂֐io^ς݂̏ꍇ͊Oēo^j
+	void RequestOtInsertion(Task* task);
+
+	// `揇Ǘe[uO֐
+	void RemoveFromOt(Task* task);
+
+	// `揇Ǘe[üʒu̕ύXq^XN܂ŗ\񂷂֐
+	void RequestOtInsertionTree(Task* task);
+
+	// O̔ԍU֐
+	void AssignDrawKeys(Task* task, uint32_t* pDrawKey);
+
 	// ^XN
 	uint64_t m_totalTaskCnt;
 
 #pragma endregion
 
+#pragma region
+	// XV̔zi[gOB폜^XN̈ʒu nullptr ɂA蒼܂ŋl߂Ȃj
+	std::vector<Task*> m_flatTasks;
+
+	// ؂̏IïʒȗO܂łqj
+	std::vector<uint32_t> m_flatEnds;
+
+	// e^XN̈ʒuie[gȂ NO_PARENTj
+	std::vector<uint32_t> m_flatParents;
+
+	// e^XN܂Ŋ܂߂ėLǂiLE؂ւ^XN̕؂͈̔͂j
+	std::vector<uint8_t> m_flatEnabled;
+
+	// XV̔zō폜^XN̐
+	uint32_t m_flatHoleNum;
+
+	// XV̔z蒼ǂ
+	bool m_isFlatDirty;
+
+	// XV̔zɏ]čXV֐
+	void FlatUpdate(float deltaTime);
+
+	// XV̔z蒼֐
+	void RebuildFlat();
+
+	// ^XNOɍXV̔zɕׂ֐
+	void FlattenTree(Task* task, uint32_t parentIndex, bool isParentEnabled);
+
+	// XV̔zł̃^XN̈ʒuT֐
+	bool FindFlatIndex(const Task* task, uint32_t* pIndex) const;
+#pragma endregion
+
+#pragma region
+	// Wu[hōXV^XNi[gOɕׂj
+	struct TaskNode
+	{
+		Task* task;					// ^XN
+		uint32_t parentIndex;		// e^XN̔ԍie[gȂ NO_PARENTj
+		bool isUpdated;				// ̃t[ɍXVǂ
+		bool isAlive;				// XV֐̖߂l
+		bool isChildrenUpdated;		// q^XNXV邩ǂ
+	};
+
+	// XVɍsꂽ؂̕ύX̎
+	enum class PendingType : uint8_t
+	{
+		ADD_TASK,		// ^XN̒ǉ
+		DELETE_TASK,	// ^XN̍폜
+		CHANGE_PARENT,	// e̕ύX
+	};
+
+	// XVɍsꂽ؂̕ύXiXV̌ɍsj
+	struct PendingTask
+	{
+		PendingType type;			// ύX̎
+		uint32_t nodeIndex;			// ύX^XN̔ԍ
+		Task* task;					// ύXꂽ^XN
+		Task* parent;				// Veiǉ̏ꍇ nullptr ȂύX^XN̎qɂj
+	};
+
+	// e[gł邱Ƃ\ԍ
+	static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+	// XV̎d
+	UpdateMode m_updateMode;
+
+	// ˑ֌W̃OtƎsXbh
+	std::unique_ptr<TaskScheduler> m_scheduler;
+
+	// Wu[hōXV^XN
+	std::vector<TaskNode> m_nodes;
+
+	// Ot蒼ǂ
+	bool m_isGraphDirty;
+
+	// Ot蒼
+	uint64_t m_graphBuildCnt;
+
+	// Wu[hōXVǂ
+	bool m_isRunningJobs;
+
+	// Wu[hōXVɗLE؂ւ^XN邩ǂiXVIĂLoj
+	std::atomic<bool> m_isEnabledCacheStale;
+
+	// XVɍsꂽ؂̕ύX
+	std::vector<PendingTask> m_pendingTasks;
+
+	// XVɍsꂽ؂̕ύX̔r
+	std::mutex m_pendingMutex;
+
+	// Wu[hōXV֐
+	void ParallelUpdate(float deltaTime);
+
+	// XVɍsꂽ؂̕ύXOɍs֐
+	void ApplyPendingTasks();
+
+	// ˑ֌W̃Ot֐
+	void BuildGraph();
+
+	// ^XNOɏW߂֐
+	void CollectNodes(Task* task, uint32_t parentIndex);
+
+	// Wu[h1̃^XNXV֐
+	void UpdateNode(uint32_t nodeIndex, float deltaTime);
+#pragma endregion
+
+	// `ȂeXgiTools/HeadlessTests/TaskManagerjXV̈ꕔv
+	friend class TaskManagerTestAccess;
+
 public:
 
 	// RXgN^
-	TaskManager() : m_rootTask{}, m_currentTask{}, m_totalTaskCnt{}
-	{
-		// [g^XN̍쐬
-		m_rootTask = std::make_unique<Task>();
-		// ݂̃^XN̐ݒ
-		m_currentTask = m_rootTask.get();
-		// [g^XN̖Oݒ
-		m_rootTask->SetName("RootTask");
-	}
+	TaskManager();
 
 	// fXgN^
-	virtual ~TaskManager()
-	{
-		//DeleteTask(m_rootTask);
-	}
+	virtual ~TaskManager();
 
 	// XV֐
 	virtual void Update(float deltaTime);
@@ -199,9 +419,45 @@ public:
 	// ^XN̍폜֐
 	void DeleteTask(Task* task);
 
+	// Wu[hōXVȂe̕ύXXV̌ɉ񂷊֐i񂵂ꍇ true Ԃj
+	bool RequestChangeParent(Task* task, Task* parent);
+
 	// [g^XN擾֐
 	Task* GetRootTask() { return m_rootTask.get(); }
 
+	// XV̎dݒ肷֐
+	void SetUpdateMode(UpdateMode mode) { m_updateMode = mode; }
+
+	// XV̎d擾֐
+	UpdateMode GetUpdateMode() const { return m_updateMode; }
+
+	// Wu[hŎgXbhݒ肷֐iĂяõXbh܂ށj
+	void SetThreadNum(uint32_t threadNum);
+
+	// Wu[hŎgXbh擾֐
+	uint32_t GetThreadNum() const;
+
+	// ˑ֌W̃Ot̍XVō蒼֐
+	void MarkGraphDirty() { m_isGraphDirty = true; }
+
+	// eq֌Wς̂ňˑ֌W̃OtƍXV̔z蒼֐
+	void MarkTreeDirty() { m_isGraphDirty = true; m_isFlatDirty = true; }
+
+	// ˑ֌W̃Ot擾֐
+	const TaskScheduler* GetScheduler() const { return m_scheduler.get(); }
+
+	// Ot蒼񐔂擾֐
+	uint64_t GetGraphBuildCount() const { return m_graphBuildCnt; }
+
+	// `揇ς^XN̍XVŕג֐ieςꍇ͎q^XNגj
+	void MarkDrawOrderDirty(Task* task, bool isParentChanged = false);
+
+	// LE؂ւ^XN̕؂̗Lo֐
+	void UpdateEnabledCache(Task* task);
+
+	// oĂL擾֐ioĂȂꍇ false Ԃj
+	bool FindCachedEnabled(const Task* task, bool* pIsEnabled) const;
+
 };
 
 #pragma region
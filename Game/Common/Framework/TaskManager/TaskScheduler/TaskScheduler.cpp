@@ -0,0 +1,440 @@
+/*****************************************************************//**
+ * @file    TaskScheduler.cpp
+ * @brief   ˑ֌ŴdXbhɐU蕪ĎsNXɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "TaskScheduler.h"
+
+#include <algorithm>
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+TaskScheduler::TaskScheduler()
+	: m_jobNum{ 0 }
+	, m_dependencies{}
+	, m_successorBegins{ 0 }
+	, m_successors{}
+	, m_predecessorNums{}
+	, m_topologicalOrder{}
+	, m_remainingNums{}
+	, m_criticalPathLength{ 0 }
+	, m_isValid{ true }
+	, m_pJob{ nullptr }
+	, m_completedNum{ 0 }
+	, m_stealNum{ 0 }
+	, m_queues{}
+	, m_threadNum{ 1 }
+	, m_helperThreads{}
+	, m_poolGeneration{ 0 }
+	, m_pendingThreadNum{ 0 }
+	, m_stopHelpers{ false }
+{
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+TaskScheduler::~TaskScheduler()
+{
+	StopHelperThreads();
+}
+
+
+
+/**
+ * @brief Otn߂
+ *
+ * ܂ł̈ˑ֌ŴĂBAddDependency ňˑ֌WǉAEndGraph ōI
+ *
+ * @param[in] jobNum d̐
+ */
+void TaskScheduler::BeginGraph(uint32_t jobNum)
+{
+	m_jobNum = jobNum;
+	m_dependencies.clear();
+}
+
+
+
+/**
+ * @brief ˑ֌W̒ǉ
+ *
+ * ˑ֌WxǉĂ悢i㑱̐낤ߌʂ͕ςȂj
+ *
+ * @param[in] before	ɏIׂd
+ * @param[in] after		before IĂsd
+ */
+void TaskScheduler::AddDependency(uint32_t before, uint32_t after)
+{
+	if (before >= m_jobNum || after >= m_jobNum || before == after) { return; }
+
+	m_dependencies.emplace_back(before, after);
+}
+
+
+
+/**
+ * @brief OtI
+ *
+ * ˑ֌WdƂ̌㑱̔zɂ܂Ƃ߁Aˑ֌W𖞂Ԃƍłˑ̘AȂ߂B
+ * 񂵂Ăꍇ͎słȂ false ԂARun ͉Ȃ
+ *
+ * @return 񂵂ĂȂ true
+ */
+bool TaskScheduler::EndGraph()
+{
+	// **** dƂ̌㑱̔zɂ܂Ƃ߂ ****
+	m_successorBegins.assign(m_jobNum + 1, 0);
+	m_predecessorNums.assign(m_jobNum, 0);
+
+	for (const auto& [before, after] : m_dependencies)
+	{
+		m_successorBegins[before + 1]++;
+		m_predecessorNums[after]++;
+	}
+	for (uint32_t i = 0; i < m_jobNum; i++)
+	{
+		m_successorBegins[i + 1] += m_successorBegins[i];
+	}
+
+	m_successors.resize(m_dependencies.size());
+	std::vector<uint32_t> cursors(m_successorBegins.begin(), m_successorBegins.end() - 1);
+	for (const auto& [before, after] : m_dependencies)
+	{
+		m_successors[cursors[before]++] = after;
+	}
+
+	// **** ˑ֌W𖞂Ԃƍłˑ̘AȂ߂ ****
+	std::vector<uint32_t> remainingNums(m_predecessorNums);
+	std::vector<uint32_t> depths(m_jobNum, 1);
+
+	m_topologicalOrder.clear();
+	m_topologicalOrder.reserve(m_jobNum);
+	for (uint32_t i = 0; i < m_jobNum; i++)
+	{
+		if (remainingNums[i] == 0) { m_topologicalOrder.push_back(i); }
+	}
+
+	m_criticalPathLength = 0;
+	for (size_t i = 0; i < m_topologicalOrder.size(); i++)
+	{
+		const uint32_t job = m_topologicalOrder[i];
+		m_criticalPathLength = std::max(m_criticalPathLength, depths[job]);
+
+		for (uint32_t s = m_successorBegins[job]; s < m_successorBegins[job + 1]; s++)
+		{
+			const uint32_t successor = m_successors[s];
+			depths[successor] = std::max(depths[successor], depths[job] + 1);
+
+			if (--remainingNums[successor] == 0) { m_topologicalOrder.push_back(successor); }
+		}
+	}
+
+	m_isValid = (m_topologicalOrder.size() == m_jobNum);
+
+	// **** sp̗̈mۂ ****
+	m_remainingNums = std::make_unique<std::atomic<uint32_t>[]>(m_jobNum);
+
+	for (auto& pQueue : m_queues)
+	{
+		pQueue->jobs.resize(m_jobNum);
+	}
+
+	return m_isValid;
+}
+
+
+
+/**
+ * @brief SĂ̎ds
+ *
+ * ĂяõXbh0ԂƂĎsASĂ̎dI܂Ŗ߂ȂB
+ * Xbh 1 ̏ꍇ͈ˑ֌W𖞂ԂɌĂяõXbhŎs
+ *
+ * @param[in] job diقȂd͕ʂ̃XbhœɌĂ΂j
+ */
+void TaskScheduler::Run(const Job& job)
+{
+	if (!m_isValid || m_jobNum == 0) { return; }
+
+	if (m_threadNum <= 1)
+	{
+		for (const uint32_t jobIndex : m_topologicalOrder)
+		{
+			job(jobIndex);
+		}
+		return;
+	}
+
+	ResizeHelperThreads(m_threadNum - 1);
+
+	// **** ˑd̖deXbhɔz ****
+	for (auto& pQueue : m_queues)
+	{
+		pQueue->head = 0;
+		pQueue->tail = 0;
+	}
+
+	uint32_t queueIndex = 0;
+	for (uint32_t i = 0; i < m_jobNum; i++)
+	{
+		m_remainingNums[i].store(m_predecessorNums[i], std::memory_order_relaxed);
+
+		if (m_predecessorNums[i] != 0) { continue; }
+
+		WorkQueue& queue = *m_queues[queueIndex];
+		queue.jobs[queue.tail++] = i;
+		queueIndex = (queueIndex + 1) % m_threadNum;
+	}
+
+	m_pJob = &job;
+	m_completedNum.store(0, std::memory_order_relaxed);
+
+	// `Xbhɔzz
+	{
+		std::lock_guard<std::mutex> lock(m_poolMutex);
+		m_pendingThreadNum = static_cast<uint32_t>(m_helperThreads.size());
+		m_poolGeneration++;
+	}
+	m_poolCv.notify_all();
+
+	RunWorker(0);
+
+	// SẴXbh̊҂
+	std::unique_lock<std::mutex> lock(m_poolMutex);
+	m_poolDoneCv.wait(lock, [this] { return m_pendingThreadNum == 0; });
+
+	m_pJob = nullptr;
+}
+
+
+
+/**
+ * @brief gXbh̐ݒ
+ *
+ * @param[in] threadNum Xbhi1 ŕ񉻂ȂB1  MAX_THREAD_NUM Ɏ߂j
+ */
+void TaskScheduler::SetThreadNum(uint32_t threadNum)
+{
+	m_threadNum = std::clamp(threadNum, 1u, MAX_THREAD_NUM);
+}
+
+
+
+/**
+ * @brief Xbh̒S̎dȂȂ܂Ŏs
+ *
+ * ̗񂪋Ȃ瑼̃Xbh瓐݁AǂΑSĂ̎dI܂ŏȂ҂
+ *
+ * @param[in] threadIndex Xbh̔ԍ
+ */
+void TaskScheduler::RunWorker(uint32_t threadIndex)
+{
+	while (m_completedNum.load(std::memory_order_acquire) < m_jobNum)
+	{
+		uint32_t jobIndex = 0;
+		if (PopJob(threadIndex, &jobIndex) || StealJob(threadIndex, &jobIndex))
+		{
+			ExecuteJob(threadIndex, jobIndex);
+			continue;
+		}
+
+		std::this_thread::yield();
+	}
+}
+
+
+
+/**
+ * @brief dsAsł悤ɂȂ㑱̗ɐς
+ *
+ * @param[in] threadIndex	Xbh̔ԍ
+ * @param[in] jobIndex		d̔ԍ
+ */
+void TaskScheduler::ExecuteJob(uint32_t threadIndex, uint32_t jobIndex)
+{
+	(*m_pJob)(jobIndex);
+
+	for (uint32_t s = m_successorBegins[jobIndex]; s < m_successorBegins[jobIndex + 1]; s++)
+	{
+		const uint32_t successor = m_successors[s];
+
+		// ŌɏI̎d̃Xbhςށi̎ďʂ͂Ō悤ɂȂj
+		if (m_remainingNums[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			PushJob(threadIndex, successor);
+		}
+	}
+
+	m_completedNum.fetch_add(1, std::memory_order_release);
+}
+
+
+
+/**
+ * @brief ̗ɐς
+ *
+ * @param[in] threadIndex	Xbh̔ԍ
+ * @param[in] jobIndex		d̔ԍ
+ */
+void TaskScheduler::PushJob(uint32_t threadIndex, uint32_t jobIndex)
+{
+	WorkQueue& queue = *m_queues[threadIndex];
+
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	queue.jobs[queue.tail++] = jobIndex;
+}
+
+
+
+/**
+ * @brief ̗̌납
+ *
+ * Oɐς񂾌㑱ɎsA̎dGꂽf[^LbVɎcĂ邤Ɏg
+ *
+ * @param[in]  threadIndex	Xbh̔ԍ
+ * @param[out] pOutJobIndex	d̔ԍ
+ *
+ * @return ꂽꍇ true
+ */
+bool TaskScheduler::PopJob(uint32_t threadIndex, uint32_t* pOutJobIndex)
+{
+	WorkQueue& queue = *m_queues[threadIndex];
+
+	std::lock_guard<std::mutex> lock(queue.mutex);
+	if (queue.head == queue.tail) { return false; }
+
+	*pOutJobIndex = queue.jobs[--queue.tail];
+	return true;
+}
+
+
+
+/**
+ * @brief ̃Xbh̗̑O瓐
+ *
+ * ׂ̃Xbh珇ɒׂ
+ *
+ * @param[in]  threadIndex	Xbh̔ԍ
+ * @param[out] pOutJobIndex	񂾎d̔ԍ
+ *
+ * @return ߂ꍇ true
+ */
+bool TaskScheduler::StealJob(uint32_t threadIndex, uint32_t* pOutJobIndex)
+{
+	for (uint32_t offset = 1; offset < m_threadNum; offset++)
+	{
+		WorkQueue& queue = *m_queues[(threadIndex + offset) % m_threadNum];
+
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.head == queue.tail) { continue; }
+
+		*pOutJobIndex = queue.jobs[queue.head++];
+		m_stealNum.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	return false;
+}
+
+
+
+/**
+ * @brief `Xbh̐낦
+ *
+ * d̗Xbhɂ낦
+ *
+ * @param[in] helperNum `Xbh̐
+ */
+void TaskScheduler::ResizeHelperThreads(uint32_t helperNum)
+{
+	if (m_queues.size() != helperNum + 1)
+	{
+		m_queues.resize(helperNum + 1);
+		for (auto& pQueue : m_queues)
+		{
+			if (!pQueue) { pQueue = std::make_unique<WorkQueue>(); }
+			pQueue->jobs.resize(m_jobNum);
+			pQueue->head = 0;
+			pQueue->tail = 0;
+		}
+	}
+
+	if (m_helperThreads.size() == helperNum) return;
+
+	StopHelperThreads();
+
+	std::lock_guard<std::mutex> lock(m_poolMutex);
+	m_stopHelpers = false;
+	m_helperThreads.reserve(helperNum);
+	for (uint32_t i = 0; i < helperNum; i++)
+	{
+		// 0Ԃ͌ĂяõXbhŜ 1 Ԃ犄蓖Ă
+		m_helperThreads.emplace_back(&TaskScheduler::HelperThreadLoop, this, i + 1, m_poolGeneration);
+	}
+}
+
+
+
+/**
+ * @brief `Xbh̃[v
+ *
+ * @param[in] threadIndex		Xbh̔ԍ
+ * @param[in] startGeneration	쐬̎d̐
+ */
+void TaskScheduler::HelperThreadLoop(uint32_t threadIndex, uint64_t startGeneration)
+{
+	uint64_t generation = startGeneration;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_poolMutex);
+			// uVdvu~v܂ŃX[v
+			m_poolCv.wait(lock, [&] { return m_stopHelpers || m_poolGeneration != generation; });
+
+			if (m_stopHelpers) return;
+
+			generation = m_poolGeneration;
+		}
+
+		RunWorker(threadIndex);
+
+		{
+			std::lock_guard<std::mutex> lock(m_poolMutex);
+			m_pendingThreadNum--;
+		}
+		m_poolDoneCv.notify_one();
+	}
+}
+
+
+
+/**
+ * @brief `Xbh̒~
+ */
+void TaskScheduler::StopHelperThreads()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_poolMutex);
+		m_stopHelpers = true;
+	}
+	m_poolCv.notify_all();
+
+	for (auto& thread : m_helperThreads)
+	{
+		thread.join();
+	}
+	m_helperThreads.clear();
+}
@@ -0,0 +1,164 @@
+/*****************************************************************//**
+ * @file    TaskScheduler.h
+ * @brief   ˑ֌ŴdXbhɐU蕪ĎsNXɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief ˑ֌ŴdXbhɐU蕪ĎsNX
+ *
+ * diԍŕ\jƁuɏIׂdv̊֌WL񏄉OtA
+ * ˑdSďIdŒ萔̃XbhŎsB
+ * XbhƂɎd̗A̗͌납AɂȂ瑼̃Xbh̗̑O瓐ށB
+ * Ot͍蒼܂Ŏg񂵁AŝтɃmۂȂ
+ */
+class TaskScheduler
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+	static constexpr uint32_t MAX_THREAD_NUM = 16;	///< Xbh̏
+
+// ^̐錾 ---------------------------------------------------------
+public:
+	using Job = std::function<void(uint32_t jobIndex)>;	///< di͎d̔ԍj
+
+private:
+	/**
+	 * @brief XbhƂ̎d̗
+	 *
+	 * 1̎sŊed̂1xȂ̂ŁAd̗̐̈ĂΈȂ
+	 */
+	struct WorkQueue
+	{
+		std::mutex				mutex;	///< ̑̔r
+		std::vector<uint32_t>	jobs;	///< d̔ԍ
+		uint32_t				head;	///< ܂鑤̈ʒu
+		uint32_t				tail;	///< 傪oꂷʒu
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+	// Ot֘A
+	uint32_t								m_jobNum;				///< d̐
+	std::vector<std::pair<uint32_t, uint32_t>>	m_dependencies;		///< ˑ֌Wi̎dA̎dj
+	std::vector<uint32_t>					m_successorBegins;		///< dƂ̌㑱̐擪iɑj
+	std::vector<uint32_t>					m_successors;			///< 㑱̎d
+	std::vector<uint32_t>					m_predecessorNums;		///< dƂ̐ɏIׂd̐
+	std::vector<uint32_t>					m_topologicalOrder;		///< ˑ֌W𖞂ԁi1XbhŎsꍇɎgj
+	std::unique_ptr<std::atomic<uint32_t>[]>	m_remainingNums;	///< śAIĂȂ̎d̐
+	uint32_t								m_criticalPathLength;	///< łˑ̘AȂ̎d̐
+	bool									m_isValid;				///< Ot񂵂ĂȂǂ
+
+	// s֘A
+	const Job*								m_pJob;				///< s̎d
+	std::atomic<uint32_t>					m_completedNum;		///< Id̐
+	std::atomic<uint64_t>					m_stealNum;			///< ̃Xbh瓐񂾉񐔁i݌vj
+	std::vector<std::unique_ptr<WorkQueue>>	m_queues;			///< XbhƂ̎d̗
+
+	// Xbh֘A
+	uint32_t					m_threadNum;			///< gXbhiĂяõXbh܂ށj
+	std::vector<std::thread>	m_helperThreads;		///< `Xbh
+	std::mutex					m_poolMutex;			///< `XbhƂ̓p
+	std::condition_variable		m_poolCv;				///< d̔zzʒm
+	std::condition_variable		m_poolDoneCv;			///< d̊ʒm
+	uint64_t					m_poolGeneration;		///< zzd̐
+	uint32_t					m_pendingThreadNum;		///< dIĂȂ`Xbh̐
+	bool						m_stopHelpers;			///< `Xbh̒~
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	TaskScheduler();
+
+	// fXgN^
+	~TaskScheduler();
+
+
+// 
+public:
+	// Otn߂
+	void BeginGraph(uint32_t jobNum);
+
+	// ˑ֌W̒ǉibefore IĂ after sj
+	void AddDependency(uint32_t before, uint32_t after);
+
+	// OtIi񂵂Ăꍇ falsej
+	bool EndGraph();
+
+	// SĂ̎ds
+	void Run(const Job& job);
+
+
+// 擾/ݒ
+public:
+	// gXbh̐ݒi1 ŕ񉻂Ȃj
+	void SetThreadNum(uint32_t threadNum);
+	// gXbh̎擾
+	uint32_t GetThreadNum() const { return m_threadNum; }
+
+	// d̐̎擾
+	uint32_t GetJobNum() const { return m_jobNum; }
+
+	// ˑ֌W̐̎擾
+	size_t GetDependencyNum() const { return m_successors.size(); }
+
+	// łˑ̘AȂ̎d̐̎擾
+	uint32_t GetCriticalPathLength() const { return m_criticalPathLength; }
+
+	// ̃Xbh瓐񂾉񐔂̎擾i݌vj
+	uint64_t GetStealNum() const { return m_stealNum.load(std::memory_order_relaxed); }
+
+	// Ot񂵂ĂȂǂ
+	bool IsValid() const { return m_isValid; }
+
+
+// 
+private:
+	// Xbh̒S̎dȂȂ܂Ŏs
+	void RunWorker(uint32_t threadIndex);
+
+	// dsAsł悤ɂȂ㑱̗ɐς
+	void ExecuteJob(uint32_t threadIndex, uint32_t jobIndex);
+
+	// ̗ɐς
+	void PushJob(uint32_t threadIndex, uint32_t jobIndex);
+
+	// ̗̌납
+	bool PopJob(uint32_t threadIndex, uint32_t* pOutJobIndex);
+
+	// ̃Xbh̗̑O瓐
+	bool StealJob(uint32_t threadIndex, uint32_t* pOutJobIndex);
+
+	// `Xbh̐낦
+	void ResizeHelperThreads(uint32_t helperNum);
+
+	// `Xbh̃[v
+	void HelperThreadLoop(uint32_t threadIndex, uint64_t startGeneration);
+
+	// `Xbh̒~
+	void StopHelperThreads();
+};
@@ -0,0 +1,236 @@
+/*****************************************************************//**
+ * @file    ParticleStore.cpp
+ * @brief   \̔ziSoAjŎp[eBNQɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "ParticleStore.h"
+
+using namespace DirectX;
+
+
+// ֐̒` =============================================================
+namespace
+{
+	// \̔z̓ǂݍ
+	inline XMVECTOR Load(const float* pValues)
+	{
+		return XMLoadFloat4A(reinterpret_cast<const XMFLOAT4A*>(pValues));
+	}
+
+	// \̔zւ̏
+	inline void Store(float* pValues, FXMVECTOR value)
+	{
+		XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(pValues), value);
+	}
+
+	// X ̔z̎ނ YEZ ̔z̎ނ߂
+	inline ParticleStore::ArrayID OffsetArrayID(ParticleStore::ArrayID xID, uint32_t axis)
+	{
+		return static_cast<ParticleStore::ArrayID>(static_cast<uint32_t>(xID) + axis);
+	}
+}
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+ParticleStore::ParticleStore()
+	: m_arrays{}
+{
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+ParticleStore::~ParticleStore()
+{
+}
+
+
+
+/**
+ * @brief ͈͂̊m
+ *
+ *  4 ̔{ɐ؂グ̗̈ǉASĂ̒l 0 ɂ
+ *
+ * @param[in] particleNum p[eBN̐
+ *
+ * @return 擪̃p[eBN̈ʒui4 ̔{j
+ */
+uint32_t ParticleStore::Allocate(uint32_t particleNum)
+{
+	const uint32_t begin = GetSize();
+	const size_t packNum = (particleNum + LANE_NUM - 1) / LANE_NUM;
+
+	for (auto& array : m_arrays)
+	{
+		array.resize(array.size() + packNum, FloatPack{});
+	}
+
+	return begin;
+}
+
+
+
+/**
+ * @brief ͈͂̍폜
+ *
+ * @param[in] begin			擪̃p[eBN̈ʒuiAllocate Ԃlj
+ * @param[in] particleNum	p[eBN̐iAllocate ɓnlj
+ */
+void ParticleStore::Erase(uint32_t begin, uint32_t particleNum)
+{
+	const size_t packBegin = begin / LANE_NUM;
+	const size_t packNum = (particleNum + LANE_NUM - 1) / LANE_NUM;
+
+	for (auto& array : m_arrays)
+	{
+		array.erase(array.begin() + packBegin, array.begin() + packBegin + packNum);
+	}
+}
+
+
+
+/**
+ * @brief Sč폜
+ */
+void ParticleStore::Clear()
+{
+	for (auto& array : m_arrays)
+	{
+		array.clear();
+	}
+}
+
+
+
+/**
+ * @brief eʂ̗\
+ *
+ * @param[in] particleNum p[eBN̐
+ */
+void ParticleStore::Reserve(uint32_t particleNum)
+{
+	for (auto& array : m_arrays)
+	{
+		array.reserve((particleNum + LANE_NUM - 1) / LANE_NUM);
+	}
+}
+
+
+
+/**
+ * @brief SẴp[eBN̗\WixijɊÂČvZ
+ *
+ * XPBDSimulator::PredictNextPositions Ɠ xi = x + t vBO͂͂ł͉Ȃ
+ *
+ * @param[in] deltaTime oߎԁitj
+ */
+void ParticleStore::PredictNextPositions(float deltaTime)
+{
+	const XMVECTOR dt = XMVectorReplicate(deltaTime);
+	const uint32_t size = GetSize();
+
+	for (uint32_t axis = 0; axis < 3; axis++)
+	{
+		const float* pX = GetArray(OffsetArrayID(ArrayID::POSITION_X, axis));
+		const float* pV = GetArray(OffsetArrayID(ArrayID::VELOCITY_X, axis));
+		float* pXi		= GetArray(OffsetArrayID(ArrayID::PREDICTED_X, axis));
+
+		for (uint32_t i = 0; i < size; i += LANE_NUM)
+		{
+			Store(pXi + i, XMVectorAdd(Load(pX + i), XMVectorMultiply(Load(pV + i), dt)));
+		}
+	}
+}
+
+
+
+/**
+ * @brief ͈͂̃p[eBN̑xƍWm肳
+ *
+ * XPBDSimulator::FinalizeVelocitiesAndPositions ƓŁAŒ_Ɩߑ͂̂܂܂ɂ
+ *
+ * @param[in] begin			擪̃p[eBN̈ʒui4 ̔{j
+ * @param[in] particleNum	p[eBN̐
+ * @param[in] gravity		d
+ * @param[in] deltaTime		oߎԁitj
+ */
+void ParticleStore::FinalizeVelocitiesAndPositions(uint32_t begin, uint32_t particleNum, const DirectX::SimpleMath::Vector3& gravity, float deltaTime)
+{
+	const XMVECTOR invDeltaTime = XMVectorReplicate(1.0f / deltaTime);
+	const SimpleMath::Vector3 gravityVelocity = gravity * deltaTime;
+	const XMVECTOR gravityVelocities[3] =
+	{
+		XMVectorReplicate(gravityVelocity.x),
+		XMVectorReplicate(gravityVelocity.y),
+		XMVectorReplicate(gravityVelocity.z),
+	};
+
+	const float* pMovable = GetArray(ArrayID::MOVABLE);
+	const uint32_t end = begin + particleNum;
+
+	for (uint32_t axis = 0; axis < 3; axis++)
+	{
+		float* pX			= GetArray(OffsetArrayID(ArrayID::POSITION_X, axis));
+		const float* pXi	= GetArray(OffsetArrayID(ArrayID::PREDICTED_X, axis));
+		float* pV			= GetArray(OffsetArrayID(ArrayID::VELOCITY_X, axis));
+
+		for (uint32_t i = begin; i < end; i += LANE_NUM)
+		{
+			const XMVECTOR isMovable = XMVectorGreater(Load(pMovable + i), XMVectorZero());
+			const XMVECTOR x	= Load(pX + i);
+			const XMVECTOR xi	= Load(pXi + i);
+
+			// v = (xi - x) / t + g t + g t
+			XMVECTOR v = XMVectorMultiply(XMVectorSubtract(xi, x), invDeltaTime);
+			v = XMVectorAdd(XMVectorAdd(v, gravityVelocities[axis]), gravityVelocities[axis]);
+
+			Store(pV + i, XMVectorSelect(Load(pV + i), v, isMovable));
+			Store(pX + i, XMVectorSelect(x, xi, isMovable));
+		}
+	}
+}
+
+
+
+/**
+ * @brief X ̔z̎ނ3܂Ƃ߂Ď擾
+ *
+ * @param[in] xID	X ̔z̎
+ * @param[in] index	p[eBN̈ʒu
+ *
+ * @return l
+ */
+DirectX::SimpleMath::Vector3 ParticleStore::GetVector(ArrayID xID, uint32_t index) const
+{
+	return DirectX::SimpleMath::Vector3(
+		GetArray(xID)[index],
+		GetArray(OffsetArrayID(xID, 1))[index],
+		GetArray(OffsetArrayID(xID, 2))[index]);
+}
+
+
+
+/**
+ * @brief X ̔z̎ނ3܂Ƃ߂Đݒ肷
+ *
+ * @param[in] xID	X ̔z̎
+ * @param[in] index	p[eBN̈ʒu
+ * @param[in] value	l
+ */
+void ParticleStore::SetVector(ArrayID xID, uint32_t index, const DirectX::SimpleMath::Vector3& value)
+{
+	GetArray(xID)[index]					= value.x;
+	GetArray(OffsetArrayID(xID, 1))[index]	= value.y;
+	GetArray(OffsetArrayID(xID, 2))[index]	= value.z;
+}
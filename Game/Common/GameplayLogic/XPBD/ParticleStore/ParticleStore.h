@@ -0,0 +1,152 @@
+/*****************************************************************//**
+ * @file    ParticleStore.h
+ * @brief   \̔ziSoAjŎp[eBNQɊւwb_[t@C
+ *
+ * WE\WExEtʂ𐬕Ƃ̘AzɕĎA
+ * \Ɗm 4  SIMD ł܂Ƃ߂čs
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
+#include <vector>
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief \̔ziSoAjŎp[eBNQ
+ *
+ * z 4 ̉i16 oCgEjŊmۂA͈͂̐擪͏ɉ̐擪ɑB
+ * ͈͂̒[͓Ȃߑit 0jŖ߂B
+ * vZ XPBDSimulator Ɠōs
+ */
+class ParticleStore
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr uint32_t LANE_NUM = 4;	///< 1xɌvZp[eBN̐
+
+// 񋓌^̐錾 -----------------------------------------------------
+public:
+
+	/**
+	 * @brief z̎
+	 */
+	enum class ArrayID : uint32_t
+	{
+		POSITION_X,		///< ݂̍W X
+		POSITION_Y,		///< ݂̍W Y
+		POSITION_Z,		///< ݂̍W Z
+		PREDICTED_X,	///< \W X
+		PREDICTED_Y,	///< \W Y
+		PREDICTED_Z,	///< \W Z
+		VELOCITY_X,		///< x X
+		VELOCITY_Y,		///< x Y
+		VELOCITY_Z,		///< x Z
+		INV_MASS,		///< t
+		MOVABLE,		///< 邩ǂi1 Ȃ瓮BŒ_Ɩߑ 0j
+
+		NUM
+	};
+
+// \̂̐錾
+private:
+
+	/**
+	 * @brief 4 ̒l
+	 */
+	struct alignas(16) FloatPack
+	{
+		float value[LANE_NUM];
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	std::vector<FloatPack> m_arrays[static_cast<uint32_t>(ArrayID::NUM)];	///< Ƃ̔z
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	ParticleStore();
+
+	// fXgN^
+	~ParticleStore();
+
+
+// 
+public:
+	// ͈͂̊mہiɒǉA擪̈ʒuԂj
+	uint32_t Allocate(uint32_t particleNum);
+
+	// ͈͂̍폜i͈̔͂Oɋl߂j
+	void Erase(uint32_t begin, uint32_t particleNum);
+
+	// Sč폜
+	void Clear();
+
+	// eʂ̗\
+	void Reserve(uint32_t particleNum);
+
+	// SẴp[eBN̗\WixijɊÂČvZ
+	void PredictNextPositions(float deltaTime);
+
+	// ͈͂̃p[eBN̑xƍWm肳
+	void FinalizeVelocitiesAndPositions(uint32_t begin, uint32_t particleNum, const DirectX::SimpleMath::Vector3& gravity, float deltaTime);
+
+
+// 擾/ݒ
+public:
+	// p[eBNiߑ܂ށj̐̎擾
+	uint32_t GetSize() const { return static_cast<uint32_t>(m_arrays[0].size()) * LANE_NUM; }
+
+	// z̎擾
+	float* GetArray(ArrayID id) { return reinterpret_cast<float*>(m_arrays[static_cast<uint32_t>(id)].data()); }
+	const float* GetArray(ArrayID id) const { return reinterpret_cast<const float*>(m_arrays[static_cast<uint32_t>(id)].data()); }
+
+	// ݂̍W
+	DirectX::SimpleMath::Vector3 GetX(uint32_t index) const { return GetVector(ArrayID::POSITION_X, index); }
+	void SetX(uint32_t index, const DirectX::SimpleMath::Vector3& x) { SetVector(ArrayID::POSITION_X, index, x); }
+
+	// \W
+	DirectX::SimpleMath::Vector3 GetXi(uint32_t index) const { return GetVector(ArrayID::PREDICTED_X, index); }
+	void SetXi(uint32_t index, const DirectX::SimpleMath::Vector3& xi) { SetVector(ArrayID::PREDICTED_X, index, xi); }
+
+	// x
+	DirectX::SimpleMath::Vector3 GetV(uint32_t index) const { return GetVector(ArrayID::VELOCITY_X, index); }
+	void SetV(uint32_t index, const DirectX::SimpleMath::Vector3& v) { SetVector(ArrayID::VELOCITY_X, index, v); }
+
+	// t
+	float GetInvMass(uint32_t index) const { return GetArray(ArrayID::INV_MASS)[index]; }
+	void SetInvMass(uint32_t index, float w) { GetArray(ArrayID::INV_MASS)[index] = w; }
+
+	// ʂ̐ݒiSimParticle::SetMass Ɠ 0 Ȃtʂ 0 ɂj
+	void SetMass(uint32_t index, float mass) { SetInvMass(index, (mass != 0.0f) ? 1.0f / mass : 0.0f); }
+
+	// Œ_ǂ
+	bool IsFixed(uint32_t index) const { return GetArray(ArrayID::MOVABLE)[index] == 0.0f; }
+	void SetFixed(uint32_t index, bool isFixed) { GetArray(ArrayID::MOVABLE)[index] = isFixed ? 0.0f : 1.0f; }
+
+
+// 
+private:
+	// X ̔z̎ނ3܂Ƃ߂Ď擾
+	DirectX::SimpleMath::Vector3 GetVector(ArrayID xID, uint32_t index) const;
+
+	// X ̔z̎ނ3܂Ƃ߂Đݒ肷
+	void SetVector(ArrayID xID, uint32_t index, const DirectX::SimpleMath::Vector3& value);
+};
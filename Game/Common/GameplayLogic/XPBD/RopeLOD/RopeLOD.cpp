@@ -0,0 +1,292 @@
+/*****************************************************************//**
+ * @file    RopeLOD.cpp
+ * @brief   [v̏ڍדxip[eBN̐j̐؂ւɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "RopeLOD.h"
+
+#include <algorithm>
+
+#include "../ParticleObject/ParticleObject.h"
+
+using namespace DirectX;
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+RopeLOD::RopeLOD()
+	: RopeLOD{ Setting() }
+{
+}
+
+
+
+/**
+ * @brief RXgN^
+ *
+ * @param[in] setting ݒ
+ */
+RopeLOD::RopeLOD(const Setting& setting)
+	: m_setting{ setting }
+	, m_level{ Level::HIGH }
+	, m_restLength{ 0.0f }
+	, m_framesSinceChange{ 0 }
+	, m_samples{}
+{
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+RopeLOD::~RopeLOD()
+{
+}
+
+
+
+/**
+ * @brief 
+ *
+ * @param[in] restLength	[vŜ̎Ri_ CalculateLength Ȃǁj
+ * @param[in] level			[v_̏ڍדx
+ */
+void RopeLOD::Initialize(float restLength, Level level)
+{
+	m_restLength		= restLength;
+	m_level				= level;
+	m_framesSinceChange	= 0;
+}
+
+
+
+/**
+ * @brief XV
+ *
+ * V~[V̌ɖt[ĂԁBڍדxςꍇ̓[v蒼B
+ * ꍇ͂ɖ߂AȊO͍蒼Ă minChangeInterval t[҂B
+ * ڍדxႢ܂ܖĂ郍[v͒炸ɏI
+ *
+ * @param[in]     viewDistance		J̋
+ * @param[in,out] pSimulator		[ṽV~[^[
+ * @param[in,out] pParticleObjects	[ṽp[eBN̎
+ * @param[in,out] pRopeParticles	V~[^[ɓnĂp[eBNiRopeObject::GetParticles Ȃǁj
+ *
+ * @return 蒼ꍇ true
+ */
+bool RopeLOD::Update(
+	float viewDistance,
+	XPBDSimulator* pSimulator,
+	std::vector<std::unique_ptr<ParticleObject>>* pParticleObjects,
+	std::vector<ParticleObject*>* pRopeParticles)
+{
+	m_framesSinceChange++;
+
+	if (m_level == Level::LOW && pSimulator->IsSleeping()) { return false; }
+
+	const float stretch = (m_restLength > 0.0f) ? CalculateLength(*pRopeParticles) / m_restLength - 1.0f : 0.0f;
+
+	const Level level = SelectLevel(viewDistance, pSimulator->IsSleeping(), stretch);
+	if (level == m_level) { return false; }
+
+	const bool isTense = (stretch >= m_setting.tensionStretch);
+	if (!isTense && m_framesSinceChange < m_setting.minChangeInterval) { return false; }
+
+	if (!Rebuild(GetParticleNum(level), pSimulator, pParticleObjects, pRopeParticles)) { return false; }
+
+	m_level = level;
+
+	return true;
+}
+
+
+
+/**
+ * @brief ڍדxI
+ *
+ * Ă΍AĂ邩 lowDistance 艓ΒႭB
+ * highDistance  lowDistance ̊Ԃł͍̏ڍדx̂܂܂ɂ
+ *
+ * @param[in] viewDistance	J̋
+ * @param[in] isSleeping	Ă邩ǂ
+ * @param[in] stretch		[vŜ̐LсiRƂ̔j
+ *
+ * @return ڍדx
+ */
+RopeLOD::Level RopeLOD::SelectLevel(float viewDistance, bool isSleeping, float stretch) const
+{
+	if (stretch >= m_setting.tensionStretch) { return Level::HIGH; }
+
+	if (isSleeping || viewDistance >= m_setting.lowDistance) { return Level::LOW; }
+
+	if (viewDistance <= m_setting.highDistance) { return Level::HIGH; }
+
+	return m_level;
+}
+
+
+
+/**
+ * @brief p[eBN̐ςă[v蒼
+ *
+ * ̃[v̌`ʒœp[eBNɒuA̎R
+ * Ŝ̎R / Ԃ̐ɂăV~[^[B
+ * p𗎂Ƃ`͎RZȂ邽߁A蒼̐͐Lтł͂Ȃɂ݂ɂȂB
+ * Ă[v͖܂܂ɂ
+ *
+ * @param[in]     particleNum		p[eBN̐i3 ȏj
+ * @param[in,out] pSimulator		[ṽV~[^[
+ * @param[in,out] pParticleObjects	[ṽp[eBN̎́i킹j
+ * @param[in,out] pRopeParticles	V~[^[ɓnĂp[eBNi蒼j
+ *
+ * @return 蒼ꍇ true
+ */
+bool RopeLOD::Rebuild(
+	int particleNum,
+	XPBDSimulator* pSimulator,
+	std::vector<std::unique_ptr<ParticleObject>>* pParticleObjects,
+	std::vector<ParticleObject*>* pRopeParticles)
+{
+	if (m_restLength <= 0.0f) { return false; }
+
+	if (!Resample(*pRopeParticles, particleNum, &m_samples)) { return false; }
+
+	// p[eBN̎̂̐킹ĩp[eBN͊ m_samples ɎʂĂj
+	pParticleObjects->resize(m_samples.size());
+	pRopeParticles->clear();
+
+	for (size_t i = 0; i < m_samples.size(); i++)
+	{
+		auto& pParticleObject = (*pParticleObjects)[i];
+		if (!pParticleObject) { pParticleObject = std::make_unique<ParticleObject>(); }
+
+		pParticleObject->SetPosition(m_samples[i].position);
+		pParticleObject->SetVelocity(m_samples[i].velocity);
+		pParticleObject->SetMass(m_samples[i].mass);
+
+		pRopeParticles->push_back(pParticleObject.get());
+	}
+
+	// Ŝ̎Rۂ
+	XPBDSimulator::Parameter parameter = pSimulator->GetParameter();
+	parameter.segmentLength = m_restLength / static_cast<float>(particleNum - 1);
+
+	const bool isSleeping = pSimulator->IsSleeping();
+
+	pSimulator->Initialize(parameter, *pRopeParticles);
+
+	if (isSleeping) { pSimulator->Sleep(); }
+
+	m_framesSinceChange = 0;
+
+	return true;
+}
+
+
+
+/**
+ * @brief [v̌`ʒœp[eBN߂
+ *
+ * [͌̃p[eBN̂܂܎ʂAԂ͌̐܂̏ɓԊuɒuđxƎʂ`ԂB
+ * Ԃ̃p[eBN̎ʂ͍v̒Ԃ̃p[eBN̍vƓȂ悤ɑ
+ *
+ * @param[in]  ropeParticles	̃p[eBNi2 ȏj
+ * @param[in]  particleNum		߂p[eBN̐i3 ȏj
+ * @param[out] pOutSamples		߂p[eBN
+ *
+ * @return ߂ꂽꍇ true
+ */
+bool RopeLOD::Resample(const std::vector<ParticleObject*>& ropeParticles, int particleNum, std::vector<Sample>* pOutSamples)
+{
+	const size_t sourceNum = ropeParticles.size();
+	if (sourceNum < 2 || particleNum < 3) { return false; }
+
+	auto toSample = [](const ParticleObject* pParticle)
+		{
+			return Sample{ pParticle->GetPosition(), pParticle->GetVelocity(), pParticle->GetMass() };
+		};
+
+	float sourceInteriorMass = 0.0f;
+	for (size_t i = 1; i + 1 < sourceNum; i++)
+	{
+		sourceInteriorMass += ropeParticles[i]->GetMass();
+	}
+
+	const float totalLength = CalculateLength(ropeParticles);
+
+	pOutSamples->resize(particleNum);
+	(*pOutSamples)[0]				= toSample(ropeParticles.front());
+	(*pOutSamples)[particleNum - 1]	= toSample(ropeParticles.back());
+
+	// ̐܂ǂȂ瓙Ԋuɒu
+	size_t segment = 0;
+	float segmentStart = 0.0f;
+	float segmentLength = SimpleMath::Vector3::Distance(ropeParticles[0]->GetPosition(), ropeParticles[1]->GetPosition());
+	float interiorMass = 0.0f;
+
+	for (int k = 1; k < particleNum - 1; k++)
+	{
+		const float target = totalLength * static_cast<float>(k) / static_cast<float>(particleNum - 1);
+
+		while (segment + 2 < sourceNum && segmentStart + segmentLength < target)
+		{
+			segmentStart += segmentLength;
+			segment++;
+			segmentLength = SimpleMath::Vector3::Distance(ropeParticles[segment]->GetPosition(), ropeParticles[segment + 1]->GetPosition());
+		}
+
+		const float t = (segmentLength > 0.0f) ? std::clamp((target - segmentStart) / segmentLength, 0.0f, 1.0f) : 0.0f;
+
+		const ParticleObject* pP1 = ropeParticles[segment];
+		const ParticleObject* pP2 = ropeParticles[segment + 1];
+
+		Sample& sample = (*pOutSamples)[k];
+		sample.position	= SimpleMath::Vector3::Lerp(pP1->GetPosition(), pP2->GetPosition(), t);
+		sample.velocity	= SimpleMath::Vector3::Lerp(pP1->GetVelocity(), pP2->GetVelocity(), t);
+		sample.mass		= pP1->GetMass() + (pP2->GetMass() - pP1->GetMass()) * t;
+
+		interiorMass += sample.mass;
+	}
+
+	// Ԃ̎ʂ̍vۂiɒԂ̃p[eBNꍇ͕Ԃʂ̂܂܂ɂj
+	if (sourceInteriorMass <= 0.0f)
+	{
+		sourceInteriorMass = interiorMass;
+	}
+
+	const float massScale = (interiorMass > 0.0f) ? sourceInteriorMass / interiorMass : 1.0f;
+	for (int k = 1; k < particleNum - 1; k++)
+	{
+		(*pOutSamples)[k].mass *= massScale;
+	}
+
+	return true;
+}
+
+
+
+/**
+ * @brief [v̒iׂ荇p[eBN̋̍vj߂
+ *
+ * @param[in] ropeParticles p[eBN
+ *
+ * @return [v̒
+ */
+float RopeLOD::CalculateLength(const std::vector<ParticleObject*>& ropeParticles)
+{
+	float length = 0.0f;
+
+	for (size_t i = 0; i + 1 < ropeParticles.size(); i++)
+	{
+		length += SimpleMath::Vector3::Distance(ropeParticles[i]->GetPosition(), ropeParticles[i + 1]->GetPosition());
+	}
+
+	return length;
+}
@@ -0,0 +1,137 @@
+/*****************************************************************//**
+ * @file    RopeLOD.h
+ * @brief   [v̏ڍדxip[eBN̐j̐؂ւɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+#include <memory>
+
+#include "../XPBDSimulator/XPBDSimulator.h"
+
+
+// NX̑O錾 ===================================================
+class ParticleObject;
+
+
+// NX̒` ===============================================================
+/**
+ * @brief [v̏ڍדx
+ *
+ * ɂE~܂Ă郍[v͏Ȃp[eBNō蒼AƂߕtƂɖ߂B
+ * 蒼͍̃[v̌`ʒœčsA[̈ʒuƑŜ̎RisegmentLength ~ Ԃ̐jۂB
+ * 1{̃[viXPBDSimulator ƃp[eBNjƂɎ
+ */
+class RopeLOD
+{
+// 񋓌^̐錾
+public:
+	/**
+	 * @brief ڍדx
+	 */
+	enum class Level
+	{
+		HIGH,	///< ߂EĂ
+		LOW,	///< E~܂Ă
+	};
+
+// \̂̐錾
+public:
+	/**
+	 * @brief ݒ
+	 */
+	struct Setting
+	{
+		int highParticleNum		= 50;		///< ڍדxƂ̃p[eBN̐
+		int lowParticleNum		= 10;		///< ڍדxႢƂ̃p[eBN̐
+		float lowDistance		= 60.0f;	///< p[eBN炷J̋
+		float highDistance		= 45.0f;	///< p[eBN߂J̋isȂ悤 lowDistance Zj
+		float tensionStretch	= 0.005f;	///< ĂƂ݂ȂLсiRƂ̔j
+		int minChangeInterval	= 30;		///< 蒼Ă玟ɍ蒼܂ł̃t[
+	};
+
+	/**
+	 * @brief 蒼p[eBN
+	 */
+	struct Sample
+	{
+		DirectX::SimpleMath::Vector3 position;	///< W
+		DirectX::SimpleMath::Vector3 velocity;	///< x
+		float mass;								///< 
+	};
+
+// f[^o̐錾 -----------------------------------------------
+private:
+	Setting m_setting;	///< ݒ
+
+	Level	m_level;				///< ̏ڍדx
+	float	m_restLength;			///< [vŜ̎R
+	int		m_framesSinceChange;	///< 蒼Ẵt[
+
+	std::vector<Sample> m_samples;	///< 蒼p[eBNiƗpBg񂷁j
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	RopeLOD();
+
+	// RXgN^
+	explicit RopeLOD(const Setting& setting);
+
+	// fXgN^
+	~RopeLOD();
+
+
+// 
+public:
+	// 
+	void Initialize(float restLength, Level level = Level::HIGH);
+
+	// XViڍדxςꍇ̓[v蒼j
+	bool Update(
+		float viewDistance,
+		XPBDSimulator* pSimulator,
+		std::vector<std::unique_ptr<ParticleObject>>* pParticleObjects,
+		std::vector<ParticleObject*>* pRopeParticles);
+
+	// ڍדxI
+	Level SelectLevel(float viewDistance, bool isSleeping, float stretch) const;
+
+	// p[eBN̐ςă[v蒼
+	bool Rebuild(
+		int particleNum,
+		XPBDSimulator* pSimulator,
+		std::vector<std::unique_ptr<ParticleObject>>* pParticleObjects,
+		std::vector<ParticleObject*>* pRopeParticles);
+
+	// [v̌`ʒœp[eBN߂
+	static bool Resample(const std::vector<ParticleObject*>& ropeParticles, int particleNum, std::vector<Sample>* pOutSamples);
+
+	// [v̒iׂ荇p[eBN̋̍vj߂
+	static float CalculateLength(const std::vector<ParticleObject*>& ropeParticles);
+
+// 擾/ݒ
+public:
+	// ݒ̎擾
+	const Setting& GetSetting() const { return m_setting; }
+
+	// ̏ڍדx̎擾
+	Level GetLevel() const { return m_level; }
+
+	// [vŜ̎R̎擾
+	float GetRestLength() const { return m_restLength; }
+
+	// ڍדxƂ̃p[eBN̐̎擾
+	int GetParticleNum(Level level) const { return (level == Level::HIGH) ? m_setting.highParticleNum : m_setting.lowParticleNum; }
+
+};
@@ -269,12 +269,3 @@ void RopeObject::AddParticle(ParticleObject* pParticle)
 	m_particles.push_back(pParticle);
 }
 
-/**
- * @brief p[eBNf[^̎擾
- * 
- * @return p[eBNf[^
- */
-std::vector<ParticleObject*>* RopeObject::GetParticles() 
-{
-	return &m_particles;
-}
@@ -77,8 +77,8 @@ public:
 	// p[eBN̒ǉ
 	void AddParticle(ParticleObject* pParticle);
 
-	// p[eBNf[^̎擾
-	std::vector< ParticleObject*>* GetParticles() ;
+	// p[eBNf[^̎擾iXPBDSimulator `Ȃłg悤Ƀwb_[Œ`j
+	std::vector< ParticleObject*>* GetParticles() { return &m_particles; }
 
 
 // 擾/ݒ
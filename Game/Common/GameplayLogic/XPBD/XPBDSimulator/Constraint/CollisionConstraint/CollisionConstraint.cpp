@@ -39,6 +39,21 @@ CollisionConstraint::~CollisionConstraint()
 
 }
 
+/**
+ * @brief 
+ *
+ * v[Ŏg񂷎ɁAƓԂɖ߂
+ *
+ * @param[in] pParticle p[eBN
+ */
+void CollisionConstraint::Initialize(SimParticle* pParticle)
+{
+	m_pParticle = pParticle;
+	m_constraintParam = ConstraintParam();
+	m_collisionNormal = DirectX::SimpleMath::Vector3::Zero;
+	m_planeDistance = 0.0f;
+}
+
 /**
  * @brief p[^Zbg
  *
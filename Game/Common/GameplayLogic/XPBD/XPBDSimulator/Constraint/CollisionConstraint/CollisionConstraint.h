@@ -61,6 +61,9 @@ public:
 
 // 
 public:
+	// iv[Ŏg񂷎ɌĂԁj
+	void Initialize(SimParticle* pParticle);
+
 	// p[^Zbg
 	void ResetConstraintParam(float flexibility) override;
 
@@ -16,10 +16,14 @@
 // t[[N֘A
 #include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
 
+// Q[IuWFNg֘A
+#include "Game/GameObjects/Common/GameObject.h"
+
 
 // [eBeB֘A
 #include "../..//Constraint/CollisionConstraint/CollisionConstraint.h"
 #include "../..//SimParticle/SimParticle.h"
+
 using namespace DirectX;
 
 
@@ -27,11 +31,16 @@ using namespace DirectX;
 /**
  * @brief RXgN^
  *
- * @param[in] pParticle p[eBN
+ * @param[in] pCollisionManager	ՓˊǗ
+ * @param[in] mode				Փ˂𒲂ׂp[eBN
+ * @param[in] particleRadius	p[eBN̔a
  */
-CollisionConstraintFactory::CollisionConstraintFactory(CollisionManager* pCollisionManager)
+CollisionConstraintFactory::CollisionConstraintFactory(CollisionManager* pCollisionManager, Mode mode, float particleRadius)
 	: ConstraintFactoryBase		{ true }
 	,m_pCollisionManager	{ pCollisionManager }
+	,m_mode					{ mode }
+	,m_particleRadius		{ particleRadius }
+	,m_ropeTagMask			{ static_cast<uint32_t>(GameObjectTag::BUILDING | GameObjectTag::FLOOR | GameObjectTag::WALL) }
 {
 }
 
@@ -48,37 +57,62 @@ CollisionConstraintFactory::~CollisionConstraintFactory()
 /**
  * @brief Փː̍쐬
  * 
- * @param[in] pParticle->p[eBN
- * 
- * @return 쐬Փː
+ * @param[in]  pParticles			p[eBN
+ * @param[in]  paramater			p[^
+ * @param[out] pOutConstraints	쐬ՓːiǋLj
  */
-std::vector<std::unique_ptr<IConstraint>> CollisionConstraintFactory::CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater)
+void CollisionConstraintFactory::CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints)
 {
-	std::vector<std::unique_ptr<IConstraint>> creationConstraints;
+	// Ot[̐g
+	m_constraintPool.Release();
+
+	if (pParticles->empty()) return;
+
+	switch (m_mode)
+	{
+	case Mode::TIP_ONLY:
+		CreateTipConstraint(pParticles, paramater.flexibility, pOutConstraints);
+		break;
+	case Mode::WHOLE_ROPE:
+		CreateRopeConstraints(pParticles, paramater.flexibility, pOutConstraints);
+		break;
+	}
+}
+
 
+
+/**
+ * @brief [̃p[eBN̏Փː̍쐬
+ *
+ * @param[in]  pParticles		p[eBN
+ * @param[in]  flexibility		_
+ * @param[out] pOutConstraints	쐬ՓːiǋLj
+ */
+void CollisionConstraintFactory::CreateTipConstraint(std::vector<XPBDSimulator::Particle>* pParticles, float flexibility, std::vector<IConstraint*>* pOutConstraints)
+{
 	//for (auto& particle : *pParticles)
 	//{
 		SimParticle* simParticle = &(*pParticles).back().simP;
 
 		// Œ肳Ăp[eBN͏ՓˏȂ
-		if (simParticle->IsFixed()) return creationConstraints;
+		if (simParticle->IsFixed()) return;
 
 
 
-		Sphere sphere(simParticle->GetXi(), 0.3f);
-		std::vector<const ICollider*> hitColliders;
+		Sphere sphere(simParticle->GetXi(), m_particleRadius);
 
-		if (m_pCollisionManager->RetrieveCollisionData(&sphere, nullptr, &hitColliders) == false) return creationConstraints;
-
-		if (hitColliders.size() <= 0) return creationConstraints;
+		// 茋ʂ̔zg
+		m_hits.clear();
+		if (m_pCollisionManager->OverlapSphere(sphere.GetPosition(), sphere.GetRadius(), &m_hits) == 0) return;
 
 		// **** vǒvZ ****
 		SimpleMath::Vector3 overlap = SimpleMath::Vector3::Zero;
 		SimpleMath::Vector4 planeNormal = SimpleMath::Vector4::Zero;
 
 		// Փ˂RC_[Ƃɏ
-		for (auto& collider : hitColliders)
+		for (const auto& hit : m_hits)
 		{
+			const ICollider* collider = hit.pCollider;
 
 			// `RC_[ƏՓ
 			if (collider->GetColliderType() == ColliderType::BOX2D)
@@ -135,7 +169,7 @@ std::vector<std::unique_ptr<IConstraint>> CollisionConstraintFactory::CreateCons
 
 
 		}
-		if (MyLib::ApproxEqual(planeNormal.LengthSquared(), 0.0f)) return creationConstraints;
+		if (MyLib::ApproxEqual(planeNormal.LengthSquared(), 0.0f)) return;
 		//planeNormal = -planeNormal;
 		// p[eBN̗\ʒunʂ艺ɂ邩`FbN
 		// nʂ Y=0 ̕ʂŁA@ (0, 1, 0) Ɖ
@@ -158,20 +192,193 @@ std::vector<std::unique_ptr<IConstraint>> CollisionConstraintFactory::CreateCons
 			// ComputeLambdaCorrection  C 𐳂̒lɂKv邩mFKv
 			// PBD/XPBD̎ł C > 0 (Sᔽ) ̏ꍇɐKp
 			// ł́Ap[eBNʂ""ɂ邱ƂᔽƂ邽߁AEvaluateConstraint() ɂȂ邱Ƃ
-			auto collisionConstraint = std::make_unique<CollisionConstraint>(simParticle);
-			collisionConstraint->ResetConstraintParam(paramater.flexibility);
+			CollisionConstraint* collisionConstraint = m_constraintPool.Acquire(simParticle);
+			collisionConstraint->ResetConstraintParam(flexibility);
 			collisionConstraint->m_planeDistance = planeNormal.w;
 			collisionConstraint->m_collisionNormal = SimpleMath::Vector3(planeNormal.x, planeNormal.y, planeNormal.z);
 
-			creationConstraints.emplace_back(std::move(collisionConstraint));
+			pOutConstraints->push_back(collisionConstraint);
 			
 
 		}
 	
-	return creationConstraints;
 	
 }
 
+
+
+/**
+ * @brief SẴp[eBN̏Փː̍쐬
+ *
+ * ̓t[1񂾂sAp[eBNƂ̔͏W߂ AABB ɑ΂ĂsB
+ * oʂ͔a̕Oɂ炵Ap[eBN̒Sʂ甼a悤ɂ
+ *
+ * @param[in]  pParticles		p[eBN
+ * @param[in]  flexibility		_
+ * @param[out] pOutConstraints	쐬ՓːiǋLj
+ */
+void CollisionConstraintFactory::CreateRopeConstraints(std::vector<XPBDSimulator::Particle>* pParticles, float flexibility, std::vector<IConstraint*>* pOutConstraints)
+{
+	using namespace SimpleMath;
+
+	CollectNearbyBoxes(*pParticles);
+	if (m_nearbyBoxes.empty()) return;
+
+	for (auto& particle : *pParticles)
+	{
+		SimParticle* simParticle = &particle.simP;
+
+		// Œ肳Ăp[eBN͏ՓˏȂ
+		if (simParticle->IsFixed()) continue;
+
+		Vector4 plane;
+		if (!FindContactPlane(simParticle->GetXi(), m_particleRadius, m_nearbyBoxes, &plane)) continue;
+
+		CollisionConstraint* collisionConstraint = m_constraintPool.Acquire(simParticle);
+		collisionConstraint->ResetConstraintParam(flexibility);
+		collisionConstraint->m_planeDistance = plane.w;
+		collisionConstraint->m_collisionNormal = Vector3(plane.x, plane.y, plane.z);
+
+		pOutConstraints->push_back(collisionConstraint);
+	}
+}
+
+
+
+/**
+ * @brief [vޔ͈͂ɂ AABB W߂
+ *
+ * Œ肳ĂȂp[eBN̗\ʒuދE{bNX𔼌a̕LAԌ1񂾂ׂ
+ *
+ * @param[in] particles p[eBN
+ */
+void CollisionConstraintFactory::CollectNearbyBoxes(const std::vector<XPBDSimulator::Particle>& particles)
+{
+	using namespace SimpleMath;
+
+	m_nearbyBoxes.clear();
+
+	// **** [vޔ͈ ****
+	bool hasMovableParticle = false;
+	Vector3 ropeMin;
+	Vector3 ropeMax;
+	for (const auto& particle : particles)
+	{
+		if (particle.simP.IsFixed()) continue;
+
+		const Vector3 position = particle.simP.GetXi();
+		ropeMin = hasMovableParticle ? Vector3::Min(ropeMin, position) : position;
+		ropeMax = hasMovableParticle ? Vector3::Max(ropeMax, position) : position;
+		hasMovableParticle = true;
+	}
+	if (!hasMovableParticle) return;
+
+	ropeMin -= Vector3(m_particleRadius);
+	ropeMax += Vector3(m_particleRadius);
+
+	// **** ͈͂ƏdȂ AABB W߂ ****
+	m_hits.clear();
+	if (m_pCollisionManager->OverlapAABB((ropeMin + ropeMax) * 0.5f, ropeMax - ropeMin, &m_hits, QueryFilter(m_ropeTagMask)) == 0) return;
+
+	for (const auto& hit : m_hits)
+	{
+		if (hit.pCollider->GetColliderType() != ColliderType::AABB) continue;
+
+		if (const AABB* box = dynamic_cast<const AABB*>(hit.pCollider))
+		{
+			const Vector3 halfExtend = box->GetExtend() * 0.5f;
+			m_nearbyBoxes.push_back({ box->GetCenter() - halfExtend, box->GetCenter() + halfExtend });
+		}
+	}
+}
+
+
+
+/**
+ * @brief oʂ߂
+ *
+ * dȂ AABB ̒ōł[߂荞񂾂̂IԁB
+ * SOɂ΍ł߂_璆Sւ̌Aɂ΍ł߂ʂ̌։o
+ *
+ * @param[in]  center		̒S
+ * @param[in]  radius		a
+ * @param[in]  boxes		AABB
+ * @param[out] pOutPlane	oʁi@ƁAa̕炵_̋j
+ *
+ * @returns true  dȂ
+ * @returns false dȂĂȂ
+ */
+bool CollisionConstraintFactory::FindContactPlane(
+	const DirectX::SimpleMath::Vector3& center,
+	float radius,
+	const std::vector<NearbyBox>& boxes,
+	DirectX::SimpleMath::Vector4* pOutPlane)
+{
+	using namespace SimpleMath;
+
+	const float radiusSquared = radius * radius;
+
+	float maxDepth = 0.0f;
+	bool isHit = false;
+
+	for (const NearbyBox& box : boxes)
+	{
+		// ̒Sł߂ AABB ̓_
+		const Vector3 closestPoint = Vector3::Min(Vector3::Max(center, box.min), box.max);
+		const Vector3 toCenter = center - closestPoint;
+		const float distanceSquared = toCenter.LengthSquared();
+		if (distanceSquared >= radiusSquared) continue;
+
+		Vector3 normal;
+		float depth = 0.0f;
+
+		if (distanceSquared > 0.0f)
+		{
+			// SOɂ
+			const float distance = std::sqrt(distanceSquared);
+			normal = toCenter / distance;
+			depth = radius - distance;
+		}
+		else
+		{
+			// Sɂ̂ŁAł߂ʂo
+			const float faceDistances[6] =
+			{
+				center.x - box.min.x, box.max.x - center.x,
+				center.y - box.min.y, box.max.y - center.y,
+				center.z - box.min.z, box.max.z - center.z,
+			};
+			const Vector3 faceNormals[6] =
+			{
+				-Vector3::UnitX, Vector3::UnitX,
+				-Vector3::UnitY, Vector3::UnitY,
+				-Vector3::UnitZ, Vector3::UnitZ,
+			};
+
+			int nearestFace = 0;
+			for (int i = 1; i < 6; i++)
+			{
+				if (faceDistances[i] < faceDistances[nearestFace]) nearestFace = i;
+			}
+			normal = faceNormals[nearestFace];
+			depth = radius + faceDistances[nearestFace];
+		}
+
+		if (isHit && depth <= maxDepth) continue;
+
+		// ł߂_ʂʂ𔼌a̕Oɂ炷iɂꍇ͖ʏ֏o_ʂj
+		const Vector3 surfacePoint = center + normal * (depth - radius);
+		*pOutPlane = Vector4(normal.x, normal.y, normal.z, -normal.Dot(surfacePoint) - radius);
+
+		maxDepth = depth;
+		isHit = true;
+	}
+
+	return isHit;
+}
+
+
+
 //
 ///**
 // * @brief Փː̍쐬
@@ -298,4 +505,4 @@ std::vector<std::unique_ptr<IConstraint>> CollisionConstraintFactory::CreateCons
 //	}
 //	return creationConstraints;
 //
-//}
\ No newline at end of file
+//}
@@ -13,9 +13,13 @@
 
 
 // wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include "../../../XPBDSimulator/Constraint/ConstraintFactory.h"
+#include "../../../XPBDSimulator/Constraint/ConstraintPool.h"
+#include "CollisionConstraint.h"
+#include "Game/Common/Framework/Collision/CollisionQuery/CollisionQuery.h"
 
 #include "../../../XPBDSimulator/XPBDSimulator.h"
 
@@ -36,18 +40,47 @@ class CollisionConstraintFactory
 // NX萔̐錾 -------------------------------------------------
 public:
 
+	static constexpr float DEFAULT_PARTICLE_RADIUS = 0.3f;	///< p[eBN̔ål
 
+	/**
+	 * @brief Փ˂𒲂ׂp[eBN
+	 */
+	enum class Mode
+	{
+		TIP_ONLY,	///< [it[ŌAʂړőIԁj
+		WHOLE_ROPE,	///< Sāi[vޔ͈͂ AABB t[̎n߂ɏW߁A̒Tj
+	};
+
+// \̂̐錾
+private:
+
+	/**
+	 * @brief [v̋߂ɂ AABB
+	 */
+	struct NearbyBox
+	{
+		DirectX::SimpleMath::Vector3 min;	///< ŏ̍W
+		DirectX::SimpleMath::Vector3 max;	///< ő̍W
+	};
 
 // f[^o̐錾 -----------------------------------------------
 private:
 	CollisionManager* m_pCollisionManager; ///< ՓˊǗ
 
+	Mode		m_mode;				///< Փ˂𒲂ׂp[eBN
+	float		m_particleRadius;	///< p[eBN̔a
+	uint32_t	m_ropeTagMask;		///< SẴp[eBNŒׂꍇɑΏۂɂ^O
+
+	ConstraintPool<CollisionConstraint> m_constraintPool;	///< Փː̃v[
+	std::vector<QueryHit> m_hits;							///< dȂRC_[iƗ̈j
+	std::vector<NearbyBox> m_nearbyBoxes;					///< [v̋߂ɂ AABBit[ƂɏWߒj
+
 
 // o֐̐錾 -------------------------------------------------
 // RXgN^/fXgN^
 public:
 	// RXgN^
-	CollisionConstraintFactory(CollisionManager* pCollisionManager);
+	CollisionConstraintFactory(CollisionManager* pCollisionManager, Mode mode = Mode::TIP_ONLY, float particleRadius = DEFAULT_PARTICLE_RADIUS);
 
 	// fXgN^
 	~CollisionConstraintFactory();
@@ -57,13 +90,44 @@ public:
 public:
 	
 	// ̍쐬
-	std::vector<std::unique_ptr<IConstraint>> CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater) override;
+	void CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints) override;
 
 // 擾/ݒ
 public:
+	// ̂߂Ƀmۂ񐔂̎擾
+	size_t GetAllocationCount() const override { return m_constraintPool.GetAllocationCount(); }
+
+	// Փ˂𒲂ׂp[eBN̐ݒ
+	void SetMode(Mode mode) { m_mode = mode; }
+	// Փ˂𒲂ׂp[eBN̎擾
+	Mode GetMode() const { return m_mode; }
+
+	// p[eBN̔a̐ݒ
+	void SetParticleRadius(float radius) { m_particleRadius = radius; }
+	// p[eBN̔a̎擾
+	float GetParticleRadius() const { return m_particleRadius; }
+
+	// SẴp[eBNŒׂꍇɑΏۂɂ^O̐ݒiGameObjectTag ̘_aj
+	void SetRopeTagMask(uint32_t tagMask) { m_ropeTagMask = tagMask; }
+
+	// Õt[ŏW߂ AABB ̐̎擾
+	size_t GetNearbyBoxCount() const { return m_nearbyBoxes.size(); }
 
 // 
 private:
+	// [̃p[eBN̏Փː̍쐬
+	void CreateTipConstraint(std::vector<XPBDSimulator::Particle>* pParticles, float flexibility, std::vector<IConstraint*>* pOutConstraints);
+
+	// SẴp[eBN̏Փː̍쐬
+	void CreateRopeConstraints(std::vector<XPBDSimulator::Particle>* pParticles, float flexibility, std::vector<IConstraint*>* pOutConstraints);
 
+	// [vޔ͈͂ɂ AABB W߂
+	void CollectNearbyBoxes(const std::vector<XPBDSimulator::Particle>& particles);
 
+	// oʂ߂
+	static bool FindContactPlane(
+		const DirectX::SimpleMath::Vector3& center,
+		float radius,
+		const std::vector<NearbyBox>& boxes,
+		DirectX::SimpleMath::Vector4* pOutPlane);
 };
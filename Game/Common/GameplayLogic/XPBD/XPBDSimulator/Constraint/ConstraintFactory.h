@@ -47,12 +47,15 @@ public:
 	// fXgN^
 	virtual ~ConstraintFactoryBase() = default;
 
-	// ̍쐬
-	virtual std::vector<std::unique_ptr<IConstraint>> CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater)  = 0;
+	// ̍쐬i킪 pOutConstraints ɒǋLBO쐬͏㏑j
+	virtual void CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints) = 0;
 
 	// Zbg
 	virtual void Reset() {};
 
+	// ̂߂Ƀmۂ񐔂̎擾
+	virtual size_t GetAllocationCount() const { return 0; }
+
 
 // 擾/ݒ
 public:
@@ -0,0 +1,102 @@
+/*****************************************************************//**
+ * @file    ConstraintPool.h
+ * @brief   g񂷂߂̃v[Ɋւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <memory>
+#include <utility>
+#include <vector>
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief g񂷂߂̃v[
+ *
+ * mۂ̓t[܂ŎARelease ̌ Acquire Ő擪珇ɏĕԂB
+ * gÕt[ȉł΃mۂȂB
+ * ͌ʂɊmۂ邽߁AvfĂԂ|C^͖ɂȂȂ
+ *
+ * @tparam T iRXgN^Ɠ Initialize Ɓj
+ */
+template <typename T>
+class ConstraintPool
+{
+// f[^o̐錾 -----------------------------------------------
+private:
+	std::vector<std::unique_ptr<T>> m_constraints;	///< mۂ
+	size_t m_usedNum;								///< gĂ鐔
+	size_t m_allocationCount;						///< mۂ
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	ConstraintPool()
+		: m_constraints{}
+		, m_usedNum{ 0 }
+		, m_allocationCount{ 0 }
+	{
+	}
+
+
+// 
+public:
+	/**
+	 * @brief SĖgpɖ߂
+	 *
+	 * ܂łɕԂ͎ Acquire ŏ㏑
+	 */
+	void Release()
+	{
+		m_usedNum = 0;
+	}
+
+	/**
+	 * @brief o
+	 *
+	 * gp̐񂪂ΏĕԂAΐVmۂ
+	 *
+	 * @param[in] args ̈
+	 *
+	 * @return 
+	 */
+	template <typename... Args>
+	T* Acquire(Args&&... args)
+	{
+		if (m_usedNum < m_constraints.size())
+		{
+			T* pConstraint = m_constraints[m_usedNum++].get();
+			pConstraint->Initialize(std::forward<Args>(args)...);
+			return pConstraint;
+		}
+
+		const size_t capacity = m_constraints.capacity();
+		m_constraints.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+		m_allocationCount += (m_constraints.capacity() != capacity) ? 2 : 1;
+		m_usedNum++;
+
+		return m_constraints.back().get();
+	}
+
+
+// 擾/ݒ
+public:
+	// gĂ鐔̎擾
+	size_t GetUsedNum() const { return m_usedNum; }
+
+	// mۂ񐔂̎擾
+	size_t GetAllocationCount() const { return m_allocationCount; }
+};
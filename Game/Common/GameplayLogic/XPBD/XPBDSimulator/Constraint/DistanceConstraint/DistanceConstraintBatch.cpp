@@ -0,0 +1,328 @@
+/*****************************************************************//**
+ * @file    DistanceConstraintBatch.cpp
+ * @brief   ܂Ƃ߂ĉzɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "DistanceConstraintBatch.h"
+
+using namespace DirectX;
+
+
+// ֐̒` =============================================================
+namespace
+{
+	// 4 ̒l̓ǂݍ
+	inline XMVECTOR Load(const float* pValues)
+	{
+		return XMLoadFloat4A(reinterpret_cast<const XMFLOAT4A*>(pValues));
+	}
+
+	// 4 ̒l̏
+	inline void Store(float* pValues, FXMVECTOR value)
+	{
+		XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(pValues), value);
+	}
+}
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+DistanceConstraintBatch::DistanceConstraintBatch()
+	: m_particleIndices1{}
+	, m_particleIndices2{}
+	, m_restLengths{}
+	, m_compliances{}
+	, m_lambdas{}
+{
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+DistanceConstraintBatch::~DistanceConstraintBatch()
+{
+}
+
+
+
+/**
+ * @brief ̒ǉ
+ *
+ * @param[in] particleIndex1	qp[eBN1̈ʒu
+ * @param[in] particleIndex2	qp[eBN2̈ʒu
+ * @param[in] restLength		R
+ *
+ * @return ǉʒu
+ */
+uint32_t DistanceConstraintBatch::Add(uint32_t particleIndex1, uint32_t particleIndex2, float restLength)
+{
+	const uint32_t index = GetSize();
+
+	m_particleIndices1.push_back(particleIndex1);
+	m_particleIndices2.push_back(particleIndex2);
+	m_restLengths.push_back(restLength);
+	m_compliances.push_back(0.0f);
+	m_lambdas.push_back(0.0f);
+
+	return index;
+}
+
+
+
+/**
+ * @brief ͈͂̍폜
+ *
+ * @param[in] begin			擪̐̈ʒu
+ * @param[in] constraintNum	̐
+ */
+void DistanceConstraintBatch::Erase(uint32_t begin, uint32_t constraintNum)
+{
+	auto erase = [&](auto& array) { array.erase(array.begin() + begin, array.begin() + begin + constraintNum); };
+
+	erase(m_particleIndices1);
+	erase(m_particleIndices2);
+	erase(m_restLengths);
+	erase(m_compliances);
+	erase(m_lambdas);
+}
+
+
+
+/**
+ * @brief 폜Đ낦
+ *
+ * @param[in] constraintNum c̐
+ */
+void DistanceConstraintBatch::Shrink(uint32_t constraintNum)
+{
+	m_particleIndices1.resize(constraintNum);
+	m_particleIndices2.resize(constraintNum);
+	m_restLengths.resize(constraintNum);
+	m_compliances.resize(constraintNum);
+	m_lambdas.resize(constraintNum);
+}
+
+
+
+/**
+ * @brief Sč폜
+ */
+void DistanceConstraintBatch::Clear()
+{
+	Shrink(0);
+}
+
+
+
+/**
+ * @brief eʂ̗\
+ *
+ * @param[in] constraintNum ̐
+ */
+void DistanceConstraintBatch::Reserve(uint32_t constraintNum)
+{
+	m_particleIndices1.reserve(constraintNum);
+	m_particleIndices2.reserve(constraintNum);
+	m_restLengths.reserve(constraintNum);
+	m_compliances.reserve(constraintNum);
+	m_lambdas.reserve(constraintNum);
+}
+
+
+
+/**
+ * @brief ͈͂̐񂪌qp[eBN̈ʒu炷
+ *
+ * @param[in] begin				擪̐̈ʒui܂ł炷j
+ * @param[in] particleOffset	
+ */
+void DistanceConstraintBatch::ShiftParticleIndices(uint32_t begin, uint32_t particleOffset)
+{
+	for (uint32_t i = begin; i < GetSize(); i++)
+	{
+		m_particleIndices1[i] -= particleOffset;
+		m_particleIndices2[i] -= particleOffset;
+	}
+}
+
+
+
+/**
+ * @brief ͈͂̐   0 ɖ߂A_ݒ肷
+ *
+ * @param[in] begin			擪̐̈ʒu
+ * @param[in] constraintNum	̐
+ * @param[in] compliance	_ij
+ */
+void DistanceConstraintBatch::ResetParameters(uint32_t begin, uint32_t constraintNum, float compliance)
+{
+	std::fill(m_lambdas.begin() + begin, m_lambdas.begin() + begin + constraintNum, 0.0f);
+	std::fill(m_compliances.begin() + begin, m_compliances.begin() + begin + constraintNum, compliance);
+}
+
+
+
+/**
+ * @brief ͈͂̐1񂸂
+ *
+ * DistanceConstraint ƓEŉ߁AXPBDSimulator ŋꍇƌʂvB
+ * LтĂȂ͔΂
+ *
+ * @param[in] begin		擪̐̈ʒu
+ * @param[in] end		̐̈ʒui܂܂Ȃj
+ * @param[in] particles	p[eBN̔z
+ * @param[in] deltaTime	oߎԁitj
+ */
+void DistanceConstraintBatch::SolveSequential(uint32_t begin, uint32_t end, const ParticleArrays& particles, float deltaTime)
+{
+	using namespace SimpleMath;
+
+	float* pXiX = particles.pXiX;
+	float* pXiY = particles.pXiY;
+	float* pXiZ = particles.pXiZ;
+	const float* pInvMass = particles.pInvMass;
+
+	for (uint32_t i = begin; i < end; i++)
+	{
+		const uint32_t i1 = m_particleIndices1[i];
+		const uint32_t i2 = m_particleIndices2[i];
+		const Vector3 xi1(pXiX[i1], pXiY[i1], pXiZ[i1]);
+		const Vector3 xi2(pXiX[i2], pXiY[i2], pXiZ[i2]);
+		const float w1 = pInvMass[i1];
+		const float w2 = pInvMass[i2];
+
+		// ᔽ̕]iLтĂȂ΃XLbvj
+		const Vector3 vector = xi2 - xi1;
+		const float distance = vector.Length();
+		const float C = distance - m_restLengths[i];
+		if (C <= 0.0f || distance < 1e-6f) { continue; }
+
+		// ɂ̌vZ
+		const float Tilda = m_compliances[i] / (deltaTime * deltaTime);
+		const Vector3 deltaC = vector / distance;
+		const float invM = w1 + w2;
+		const float  = (C - Tilda * m_lambdas[i]) / (deltaC.Dot(invM * deltaC) + Tilda);
+
+		// OW搔̒~
+		m_lambdas[i] += ;
+
+		// ʒu̕␳
+		Vector3 direction = vector;
+		direction.Normalize();
+		const Vector3 deltaX = direction * ;
+		const Vector3 newXi1 = xi1 + w1 * deltaX;
+		const Vector3 newXi2 = xi2 - w2 * deltaX;
+		pXiX[i1] = newXi1.x; pXiY[i1] = newXi1.y; pXiZ[i1] = newXi1.z;
+		pXiX[i2] = newXi2.x; pXiY[i2] = newXi2.y; pXiZ[i2] = newXi2.z;
+	}
+}
+
+
+
+/**
+ * @brief p[eBNLȂ 4 ܂Ƃ߂ĉ
+ *
+ * w肵񓯎mp[eBNLȂƁiFł邱ƁjOB
+ * [vZŉ߁Aěʂ͂܂ƂߕɈ˂ȂB
+ *  SolveSequential ƓAvZ̏قȂ邽ߌʂ͊ۂߌ덷͈̔͂ňقȂ
+ *
+ * @param[in] pConstraintIndices	̈ʒu
+ * @param[in] constraintNum			̐
+ * @param[in] particles				p[eBN̔z
+ * @param[in] deltaTime				oߎԁitj
+ */
+void DistanceConstraintBatch::SolveIndependent(const uint32_t* pConstraintIndices, size_t constraintNum, const ParticleArrays& particles, float deltaTime)
+{
+	const XMVECTOR deltaTimeSquared	= XMVectorReplicate(deltaTime * deltaTime);
+	const XMVECTOR minDistance		= XMVectorReplicate(1e-6f);
+	const XMVECTOR zero				= XMVectorZero();
+
+	for (size_t group = 0; group < constraintNum; group += LANE_NUM)
+	{
+		const uint32_t laneNum = static_cast<uint32_t>(std::min<size_t>(LANE_NUM, constraintNum - group));
+
+		// **** 4 W߂iȂ͐擪̐Ŗ߁A␳ 0 ɂj ****
+		uint32_t c[LANE_NUM], i1[LANE_NUM], i2[LANE_NUM];
+		for (uint32_t lane = 0; lane < LANE_NUM; lane++)
+		{
+			c[lane]		= pConstraintIndices[group + ((lane < laneNum) ? lane : 0)];
+			i1[lane]	= m_particleIndices1[c[lane]];
+			i2[lane]	= m_particleIndices2[c[lane]];
+		}
+
+		// W߂ʒu̒lǂݍ
+		auto gather = [](const float* pValues, const uint32_t* pIndices)
+			{
+				return XMVectorSet(pValues[pIndices[0]], pValues[pIndices[1]], pValues[pIndices[2]], pValues[pIndices[3]]);
+			};
+
+		const XMVECTOR x1 = gather(particles.pXiX, i1), y1 = gather(particles.pXiY, i1), z1 = gather(particles.pXiZ, i1);
+		const XMVECTOR x2 = gather(particles.pXiX, i2), y2 = gather(particles.pXiY, i2), z2 = gather(particles.pXiZ, i2);
+		const XMVECTOR invMass1 = gather(particles.pInvMass, i1);
+		const XMVECTOR invMass2 = gather(particles.pInvMass, i2);
+		const XMVECTOR isValid = XMVectorLess(XMVectorSet(0.0f, 1.0f, 2.0f, 3.0f), XMVectorReplicate(static_cast<float>(laneNum)));
+
+		const XMVECTOR vx = XMVectorSubtract(x2, x1);
+		const XMVECTOR vy = XMVectorSubtract(y2, y1);
+		const XMVECTOR vz = XMVectorSubtract(z2, z1);
+
+		// ᔽ̕]iLтĂȂƖߑ͕␳ 0 ɂj
+		const XMVECTOR distance = XMVectorSqrt(XMVectorAdd(XMVectorAdd(XMVectorMultiply(vx, vx), XMVectorMultiply(vy, vy)), XMVectorMultiply(vz, vz)));
+		const XMVECTOR C = XMVectorSubtract(distance, gather(m_restLengths.data(), c));
+		const XMVECTOR isActive = XMVectorAndInt(
+			XMVectorAndInt(XMVectorGreater(C, zero), XMVectorGreaterOrEqual(distance, minDistance)),
+			isValid);
+
+		// 4 ƂLтĂȂΉȂiɉꍇ̑ continue ɑj
+		if (XMVector4EqualInt(isActive, XMVectorFalseInt())) { continue; }
+
+		// ɂ̌vZ
+		const XMVECTOR Tilda = XMVectorDivide(gather(m_compliances.data(), c), deltaTimeSquared);
+		const XMVECTOR invDistance = XMVectorReciprocal(distance);
+		const XMVECTOR dcx = XMVectorMultiply(vx, invDistance);
+		const XMVECTOR dcy = XMVectorMultiply(vy, invDistance);
+		const XMVECTOR dcz = XMVectorMultiply(vz, invDistance);
+		const XMVECTOR invM = XMVectorAdd(invMass1, invMass2);
+		const XMVECTOR effectiveMass = XMVectorAdd(XMVectorAdd(
+			XMVectorMultiply(dcx, XMVectorMultiply(invM, dcx)),
+			XMVectorMultiply(dcy, XMVectorMultiply(invM, dcy))),
+			XMVectorMultiply(dcz, XMVectorMultiply(invM, dcz)));
+		const XMVECTOR  = gather(m_lambdas.data(), c);
+		XMVECTOR  = XMVectorDivide(XMVectorSubtract(C, XMVectorMultiply(Tilda, )), XMVectorAdd(effectiveMass, Tilda));
+		 = XMVectorSelect(zero, , isActive);
+
+		// ʒu̕␳
+		const XMVECTOR deltaX = XMVectorSelect(zero, XMVectorMultiply(XMVectorDivide(vx, distance), ), isActive);
+		const XMVECTOR deltaY = XMVectorSelect(zero, XMVectorMultiply(XMVectorDivide(vy, distance), ), isActive);
+		const XMVECTOR deltaZ = XMVectorSelect(zero, XMVectorMultiply(XMVectorDivide(vz, distance), ), isActive);
+
+		alignas(16) float lambda[LANE_NUM];
+		alignas(16) float newX1[LANE_NUM], newY1[LANE_NUM], newZ1[LANE_NUM];
+		alignas(16) float newX2[LANE_NUM], newY2[LANE_NUM], newZ2[LANE_NUM];
+		Store(lambda, XMVectorAdd(, ));
+		Store(newX1, XMVectorAdd(x1, XMVectorMultiply(invMass1, deltaX)));
+		Store(newY1, XMVectorAdd(y1, XMVectorMultiply(invMass1, deltaY)));
+		Store(newZ1, XMVectorAdd(z1, XMVectorMultiply(invMass1, deltaZ)));
+		Store(newX2, XMVectorSubtract(x2, XMVectorMultiply(invMass2, deltaX)));
+		Store(newY2, XMVectorSubtract(y2, XMVectorMultiply(invMass2, deltaY)));
+		Store(newZ2, XMVectorSubtract(z2, XMVectorMultiply(invMass2, deltaZ)));
+
+		// **** ߂iߑ͏߂Ȃj ****
+		for (uint32_t lane = 0; lane < laneNum; lane++)
+		{
+			particles.pXiX[i1[lane]] = newX1[lane]; particles.pXiY[i1[lane]] = newY1[lane]; particles.pXiZ[i1[lane]] = newZ1[lane];
+			particles.pXiX[i2[lane]] = newX2[lane]; particles.pXiY[i2[lane]] = newY2[lane]; particles.pXiZ[i2[lane]] = newZ2[lane];
+			m_lambdas[c[lane]] = lambda[lane];
+		}
+	}
+}
@@ -0,0 +1,119 @@
+/*****************************************************************//**
+ * @file    DistanceConstraintBatch.h
+ * @brief   ܂Ƃ߂ĉzɊւwb_[t@C
+ *
+ * 񂾂z֐ʂɉB
+ * ނ͍̍܂Œʂ IConstraint ŉ
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
+#include <vector>
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief ܂Ƃ߂ĉz
+ *
+ * qp[eBN̈ʒuERE_E 𐬕Ƃ̔zŎB
+ * p[eBN͍\̔ziParticleStorej̗\WƋtʂʒuŎwB
+ * vZ DistanceConstraint Ɠōs
+ */
+class DistanceConstraintBatch
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr uint32_t LANE_NUM = 4;	///< 1xɌvZ鐧̐
+
+// \̂̐錾
+public:
+
+	/**
+	 * @brief Ώۂ̃p[eBN̔z
+	 */
+	struct ParticleArrays
+	{
+		float*			pXiX;		///< \W X
+		float*			pXiY;		///< \W Y
+		float*			pXiZ;		///< \W Z
+		const float*	pInvMass;	///< t
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	std::vector<uint32_t>	m_particleIndices1;	///< qp[eBN1̈ʒu
+	std::vector<uint32_t>	m_particleIndices2;	///< qp[eBN2̈ʒu
+	std::vector<float>		m_restLengths;		///< R
+	std::vector<float>		m_compliances;		///< _ij
+	std::vector<float>		m_lambdas;			///< OW搔iɁj
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	DistanceConstraintBatch();
+
+	// fXgN^
+	~DistanceConstraintBatch();
+
+
+// 
+public:
+	// ̒ǉiǉʒuԂj
+	uint32_t Add(uint32_t particleIndex1, uint32_t particleIndex2, float restLength);
+
+	// ͈͂̍폜i̐Oɋl߂j
+	void Erase(uint32_t begin, uint32_t constraintNum);
+
+	// 폜Đ낦
+	void Shrink(uint32_t constraintNum);
+
+	// Sč폜
+	void Clear();
+
+	// eʂ̗\
+	void Reserve(uint32_t constraintNum);
+
+	// ͈͂̐񂪌qp[eBN̈ʒu炷ip[eBN̍폜ŋl߂j
+	void ShiftParticleIndices(uint32_t begin, uint32_t particleOffset);
+
+	// ͈͂̐   0 ɖ߂A_ݒ肷
+	void ResetParameters(uint32_t begin, uint32_t constraintNum, float compliance);
+
+	// ͈͂̐1񂸂iDistanceConstraint ɉꍇƈvj
+	void SolveSequential(uint32_t begin, uint32_t end, const ParticleArrays& particles, float deltaTime);
+
+	// p[eBNLȂ 4 ܂Ƃ߂ĉ
+	void SolveIndependent(const uint32_t* pConstraintIndices, size_t constraintNum, const ParticleArrays& particles, float deltaTime);
+
+
+// 擾/ݒ
+public:
+	// ̐̎擾
+	uint32_t GetSize() const { return static_cast<uint32_t>(m_restLengths.size()); }
+
+	// qp[eBN̈ʒu̎擾
+	uint32_t GetParticleIndex1(uint32_t index) const { return m_particleIndices1[index]; }
+	uint32_t GetParticleIndex2(uint32_t index) const { return m_particleIndices2[index]; }
+
+	// R̎擾
+	float GetRestLength(uint32_t index) const { return m_restLengths[index]; }
+
+	// OW搔̎擾
+	float GetLambda(uint32_t index) const { return m_lambdas[index]; }
+};
@@ -17,11 +17,7 @@
 // Cu֘A
 #include "Library/MyLib/MathUtils/MathUtils.h"
 
-// t[[N֘A
-#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
-
 // [eBeB֘A
-#include "../../Constraint/CollisionConstraint/CollisionConstraint.h"
 #include "../../SimParticle/SimParticle.h"
 
 using namespace DirectX;
@@ -51,17 +47,20 @@ DistanceConstraintFactory::~DistanceConstraintFactory()
 /**
  * @brief Փː̍쐬
  * 
- * @param[in] pParticle->p[eBN
+ * R̓p[^ segmentLength  0 傫΂̒lAłȂ΍쐬_̋Ƃ
  * 
- * @return 쐬Փː
+ * @param[in]  pParticles			p[eBN
+ * @param[in]  paramater			p[^
+ * @param[out] pOutConstraints	쐬iǋLj
  */
-std::vector<std::unique_ptr<IConstraint>> DistanceConstraintFactory::CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater)
+void DistanceConstraintFactory::CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints)
 {
-	UNREFERENCED_PARAMETER(paramater);
+
+	// O쐬g
+	m_constraintPool.Release();
+
 	int particleNum = static_cast<int>(pParticles->size() - 1);
-	if (particleNum <= 0) {
-		return std::vector<std::unique_ptr<IConstraint>>();}
-	std::vector<std::unique_ptr<IConstraint>> creationConstraints(particleNum);
+	if (particleNum <= 0) return;
 
 	for (size_t i = 0; i < pParticles->size(); i++)
 	{
@@ -71,8 +70,14 @@ std::vector<std::unique_ptr<IConstraint>> DistanceConstraintFactory::CreateConst
 		SimParticle* pSimParticle = &(*pParticles)[i].simP;
 
 		// 
-		creationConstraints[i] = std::make_unique<DistanceConstraint>(pSimParticle, &(*pParticles)[i + 1].simP);
+		DistanceConstraint* pConstraint = m_constraintPool.Acquire(pSimParticle, &(*pParticles)[i + 1].simP);
+
+		// R̎w
+		if (paramater.segmentLength > 0.0f)
+		{
+			pConstraint->m_constraint.startDistance = paramater.segmentLength;
+		}
+
+		pOutConstraints->push_back(pConstraint);
 	}
-	return creationConstraints;
-	
 }
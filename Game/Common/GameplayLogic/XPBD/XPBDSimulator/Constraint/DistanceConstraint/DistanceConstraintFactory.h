@@ -16,6 +16,8 @@
 #include <memory>
 #include <vector>
 #include "../../../XPBDSimulator/Constraint/ConstraintFactory.h"
+#include "../../../XPBDSimulator/Constraint/ConstraintPool.h"
+#include "DistanceConstraint.h"
 
 #include "../../../XPBDSimulator/XPBDSimulator.h"
 
@@ -41,6 +43,7 @@ public:
 // f[^o̐錾 -----------------------------------------------
 private:
 
+	ConstraintPool<DistanceConstraint> m_constraintPool;	///< ̃v[
 
 // o֐̐錾 -------------------------------------------------
 // RXgN^/fXgN^
@@ -56,10 +59,12 @@ public:
 public:
 	
 	// ̍쐬
-	std::vector<std::unique_ptr<IConstraint>> CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater) override;
+	void CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints) override;
 
 // 擾/ݒ
 public:
+	// ̂߂Ƀmۂ񐔂̎擾
+	size_t GetAllocationCount() const override { return m_constraintPool.GetAllocationCount(); }
 
 // 
 private:
@@ -11,15 +11,10 @@
 #include "SteeringConstraint.h"
 
 // Cu֘A
-#include "Library\MyLib\MathUtils\MathUtils.h"
+#include "Library/MyLib/MathUtils/MathUtils.h"
 
 // [eBeB֘A
-#include "Game/Common/Utillities/Collision/Collision.h"
 #include "../../SimParticle/SimParticle.h"
-
-// OtBbN֘A
-#include "Game/Common/Graphics/Camera/MainCamera/MainCamera.h"
-#include "Game/Common/Graphics/Camera/Camera.h"
 using namespace DirectX;
 
 
@@ -48,6 +43,23 @@ SteeringConstraint::~SteeringConstraint()
 
 }
 
+/**
+ * @brief 
+ *
+ * v[Ŏg񂷎ɁAƓԂɖ߂BXeAOs͍蒼Ɏg
+ *
+ * @param[in] pCommonResources	ʃ\[X
+ * @param[in] pParticle			p[eBN
+ * @param[in] targetPosition	ڕW̍W
+ */
+void SteeringConstraint::Initialize(const CommonResources* pCommonResources, SimParticle* pParticle, const DirectX::SimpleMath::Vector3& targetPosition)
+{
+	m_pCommonResources	= pCommonResources;
+	m_pParticle			= pParticle;
+	m_constraintParam	= ConstraintParam();
+	m_targetPosition	= targetPosition;
+}
+
 /**
  * @brief p[^Zbg
  *
@@ -68,6 +68,9 @@ public:
 
 // 
 public:
+	// iv[Ŏg񂷎ɌĂԁj
+	void Initialize(const CommonResources* pCommonResources, SimParticle* pParticle, const DirectX::SimpleMath::Vector3& targetPosition);
+
 	// p[^Zbg
 	void ResetConstraintParam(float flexibility) override;
 
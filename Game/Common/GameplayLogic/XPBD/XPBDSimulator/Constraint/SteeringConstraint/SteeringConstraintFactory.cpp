@@ -28,7 +28,7 @@
 #include "Game/Common/Graphics/Camera/Camera.h"
 
 // [eBeB֘A
-#include "../../Constraint/SteeringConstraint/SteeringConstraint.h"
+#include "../../Constraint/SteeringConstraint/SteeringConstraintGenerator.h"
 
 
 
@@ -44,7 +44,8 @@ using namespace DirectX;
 SteeringConstraintFactory::SteeringConstraintFactory(const CommonResources* pCommonResources)
     : ConstraintFactoryBase{ true }
     , m_pCommonResources{ pCommonResources }
-    , m_elapsedTimeCounter{}
+    , m_rawInput{}
+    , m_generator{ pCommonResources }
 {
     // ͂Ƃ̕RÂ̓o^
     RegisterBindCallbackToInput();
@@ -67,135 +68,37 @@ SteeringConstraintFactory::~SteeringConstraintFactory()
  */
 void SteeringConstraintFactory::Reset()
 {
-    m_elapsedTimeCounter.Reset();
+    m_generator.Reset();
 }
 
 /**
  * @brief Փː̍쐬
  * 
- * @param[in] pParticle->p[eBN
- * 
- * @return 쐬Փː
+ * @param[in]  pParticles			p[eBN
+ * @param[out] pOutConstraints	쐬ǐiǋLj
  */
-std::vector<std::unique_ptr<IConstraint>> SteeringConstraintFactory::CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater)
+void SteeringConstraintFactory::CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints)
 {
 	UNREFERENCED_PARAMETER(paramater);
     using namespace SimpleMath;
 
     m_rawInput.Normalize();
 
-    // 쐬
-    std::vector<std::unique_ptr<IConstraint>> creationConstraints;
-
     // Ot[̎Ԃ擾
     float deltaTime = static_cast<float>(m_pCommonResources->GetStepTimer()->GetElapsedSeconds());
-    m_elapsedTimeCounter.UpperTime(deltaTime);
-    
-    // C[̊̌̎Zo
-    float inertiaDamping = 1.f - std::min(DUMPING_DURATION, m_elapsedTimeCounter.GetElapsedTime()) / DUMPING_DURATION;
 
-    // J̌ړƂȂuʁEEvxNgZo
+    // J̌ړƂȂuʁvxNgZo
     auto camera = MainCamera::GetInstance()->GetCamera();
     Vector3 cameraForward = camera->GetTarget() - camera->GetEye();
     cameraForward.y = 0.0f;
     cameraForward.Normalize();
 
-    // pϐ
-    const int totalParticleNum = static_cast<int>(pParticles->size());
-    const Vector3 rootPosition = pParticles->front().simP.GetXi(); // C[̍ʒu
-
-    //  *** ͂ɂ鑀Ǘ͂Zo ****
-    auto inputSteeringForce = ComputeInputSteeringForce(cameraForward);
-
-    for (int i = 0; i < totalParticleNum; ++i)
-    {
-        auto& particle = (*pParticles)[i].simP;
-
-        // **** œKp鑀Ǘ͂Zo ****
-        Vector3 autoSteeringForce = ComputeCameraDirectedSteeringForce(cameraForward, rootPosition, particle, inertiaDamping);
-
-        // ****ŏIIȃXeAOʂ̎Zo ****
-        // ␳ { vC[̓
-        Vector3 totalSteeringOffset = autoSteeringForce + inputSteeringForce;
-
-        // XeAOĂ΍쐬
-        if (!MyLib::ApproxEqual(totalSteeringOffset.LengthSquared(), 0.0f))
-        {
-            // --- [قǋ悤ɒ ---
-            //  (0.0) [ (1.0) Ɍĉexグ
-            float influenceWeight = static_cast<float>(i) / static_cast<float>(totalParticleNum);
-
-            // \ʒuɁAz̈ʒu(Target)肷
-            Vector3 finalTargetPos = particle.GetXi() + (totalSteeringOffset * influenceWeight);
-            // --- ̐ ---
-            creationConstraints.emplace_back(std::move(
-                std::make_unique<SteeringConstraint>(m_pCommonResources, &particle, finalTargetPos)
-            ));
-        }
-
+    // Ot[̐g񂵂č쐬
+    m_generator.Generate(pParticles, deltaTime, cameraForward, m_rawInput, pOutConstraints);
 
-    }
     m_rawInput = SimpleMath::Vector3::Zero;
-
-    return creationConstraints;
-
-}
-
-
-/**
- * @brief ͂ɑ΂XeAO͂vZ
- * 
- * @param[in] cameraForward J̐ʃxNg
- * 
- * @return ͂ɑ΂XeAO
- */
-DirectX::SimpleMath::Vector3 SteeringConstraintFactory::ComputeInputSteeringForce(const DirectX::SimpleMath::Vector3& cameraForward) const
-{
-    using namespace SimpleMath;
-
-
-    Vector3 cameraRight = cameraForward.Cross(Vector3::Up);
-    cameraRight.Normalize();
-
-    // ͂JԂ̈ړɕϊ
-    Vector3 moveDirection = (m_rawInput.z * cameraForward) + (-m_rawInput.x * cameraRight);
-    if (moveDirection.LengthSquared() > 0.001f) 
-    {
-        moveDirection.Normalize();
-    }
-
-    return (moveDirection * INPUT_INERTIA_STRENGTH);
 }
 
-/**
- * @brief J֓XeAO͂vZ
- * 
- * @param[in] cameraForward         J̐ʃxNg
- * @param[in] particleRootPosition  p[eBN̍{W
- * @param[in] particle              XeAOKpp[eBN
- * @param[in] inertiaDamping        ̌
- * 
- * @return J֓XeAO
- */
-DirectX::SimpleMath::Vector3 SteeringConstraintFactory::ComputeCameraDirectedSteeringForce(
-    const DirectX::SimpleMath::Vector3& cameraForward,
-    const DirectX::SimpleMath::Vector3& particleRootPosition,
-    const SimParticle& particle,
-    const float& inertiaDamping) const
-{
-    using namespace SimpleMath;
-
-     // p[eBN  ̐xNg 
-    Vector3 particleToRootDir = particleRootPosition - particle.GetXi();
-    particleToRootDir.y = 0.0f;
-    particleToRootDir.Normalize();
-
-    // JƂ̍ɂ銵XeAO 
-    Vector3 steeringForce = (particleToRootDir - cameraForward) * AUTO_INERTIA_STRENGTH * inertiaDamping;
-
-    // I[gItZbgFC[is̋tɒxĂĂ悤ȗ
-    return steeringForce;
-}
 
 void SteeringConstraintFactory::RegisterBindCallbackToInput()
 {
@@ -17,16 +17,12 @@
 #include <vector>
 
 #include "../../../XPBDSimulator/Constraint/ConstraintFactory.h"
+#include "SteeringConstraintGenerator.h"
 #include "../../../XPBDSimulator/XPBDSimulator.h"
 
 // t@Ng[֘A
 #include "Game/Common/Factory/InputBindingFactory/InputBindingFactory.h"
 
-// t[[N֘A
-
-// [eBeB֘A
-#include "Game/Common/Utillities/ElapsedTimeCounter/ElapsedTimeCounter.h"
-
 // NX̑O錾 ===================================================
 class SimParticle; // V~[Ṽp[eBN
 
@@ -37,26 +33,21 @@ class CommonResources;
 // NX̒` ===============================================================
 /**
  * @brief ǐ̐
+ *
+ * J̌ƈړ͂擾A쐬 SteeringConstraintGenerator ɔC
  */
 class SteeringConstraintFactory
 	: public ConstraintFactoryBase
 {
-// NX萔̐錾 -------------------------------------------------
-public:
-
-	static constexpr float DUMPING_DURATION = 1.0f; // C[̊鎞
-	static constexpr float AUTO_INERTIA_STRENGTH = 50.0f; // ł銵̋
-	static constexpr float INPUT_INERTIA_STRENGTH = 130.0f; // ͂ɂł銵̋
-
 // f[^o̐錾 -----------------------------------------------
 private:
 
 	const CommonResources* m_pCommonResources;
 
-	ElapsedTimeCounter m_elapsedTimeCounter;	///< oߎԃJE^[
-
 	DirectX::SimpleMath::Vector3 m_rawInput;
 
+	SteeringConstraintGenerator m_generator;	///< ǐ̍쐬
+
 // o֐̐錾 -------------------------------------------------
 // RXgN^/fXgN^
 public:
@@ -72,24 +63,16 @@ public:
 	// Zbg
 	void Reset() override;
 	// ̍쐬
-	std::vector<std::unique_ptr<IConstraint>> CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater) override;
+	void CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints) override;
 
 // 擾/ݒ
 public:
+	// ̂߂Ƀmۂ񐔂̎擾
+	size_t GetAllocationCount() const override { return m_generator.GetAllocationCount(); }
 
 // 
 private:
 
-	// ͂ɑ΂XeAO͂vZ
-	DirectX::SimpleMath::Vector3 ComputeInputSteeringForce(const DirectX::SimpleMath::Vector3& cameraForward) const;
-
-	// J֓XeAO͂vZ
-	DirectX::SimpleMath::Vector3 ComputeCameraDirectedSteeringForce(
-		const DirectX::SimpleMath::Vector3& cameraForward,
-		const DirectX::SimpleMath::Vector3& particleRootPosition,
-		const SimParticle& particle,
-		const float& inertiaDamping) const;
-
 	// ͂̃R[obN̓o^
 	void RegisterBindCallbackToInput();
 	// RẨ
@@ -0,0 +1,178 @@
+/*****************************************************************//**
+ * @file    SteeringConstraintGenerator.cpp
+ * @brief   ǐ̍쐬Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "SteeringConstraintGenerator.h"
+
+// Cu֘A
+#include "Library/MyLib/MathUtils/MathUtils.h"
+
+// [eBeB֘A
+#include "../../SimParticle/SimParticle.h"
+
+
+
+using namespace DirectX;
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * @param[in] pCommonResources ʃ\[Xi쐬ɓnB nullptrj
+ */
+SteeringConstraintGenerator::SteeringConstraintGenerator(const CommonResources* pCommonResources)
+	: m_pCommonResources{ pCommonResources }
+	, m_elapsedTimeCounter{}
+{
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+SteeringConstraintGenerator::~SteeringConstraintGenerator()
+{
+}
+
+
+
+/**
+ * @brief Zbg
+ *
+ * C[̊̌oߎԂ 0 ɖ߂
+ */
+void SteeringConstraintGenerator::Reset()
+{
+	m_elapsedTimeCounter.Reset();
+}
+
+
+
+/**
+ * @brief ̍쐬
+ *
+ * O쐬̓v[ɖ߂Ďg
+ *
+ * @param[in]  pParticles		p[eBN
+ * @param[in]  deltaTime		Ot[̌oߎ
+ * @param[in]  cameraForward	J̐ʃxNgiEKς݁j
+ * @param[in]  input			ړ́iKς݁B 0j
+ * @param[out] pOutConstraints	쐬ǐiǋLj
+ */
+void SteeringConstraintGenerator::Generate(
+	std::vector<XPBDSimulator::Particle>* pParticles,
+	float deltaTime,
+	const DirectX::SimpleMath::Vector3& cameraForward,
+	const DirectX::SimpleMath::Vector3& input,
+	std::vector<IConstraint*>* pOutConstraints)
+{
+	using namespace SimpleMath;
+
+	// Ot[̐g
+	m_constraintPool.Release();
+
+	m_elapsedTimeCounter.UpperTime(deltaTime);
+
+	// C[̊̌̎Zo
+	float inertiaDamping = 1.f - std::min(DUMPING_DURATION, m_elapsedTimeCounter.GetElapsedTime()) / DUMPING_DURATION;
+
+	// pϐ
+	const int totalParticleNum = static_cast<int>(pParticles->size());
+	const Vector3 rootPosition = pParticles->front().simP.GetXi(); // C[̍ʒu
+
+	//  *** ͂ɂ鑀Ǘ͂Zo ****
+	auto inputSteeringForce = ComputeInputSteeringForce(cameraForward, input);
+
+	for (int i = 0; i < totalParticleNum; ++i)
+	{
+		auto& particle = (*pParticles)[i].simP;
+
+		// **** œKp鑀Ǘ͂Zo ****
+		Vector3 autoSteeringForce = ComputeCameraDirectedSteeringForce(cameraForward, rootPosition, particle, inertiaDamping);
+
+		// ****ŏIIȃXeAOʂ̎Zo ****
+		// ␳ { vC[̓
+		Vector3 totalSteeringOffset = autoSteeringForce + inputSteeringForce;
+
+		// XeAOĂ΍쐬
+		if (!MyLib::ApproxEqual(totalSteeringOffset.LengthSquared(), 0.0f))
+		{
+			// --- [قǋ悤ɒ ---
+			//  (0.0) [ (1.0) Ɍĉexグ
+			float influenceWeight = static_cast<float>(i) / static_cast<float>(totalParticleNum);
+
+			// \ʒuɁAz̈ʒu(Target)肷
+			Vector3 finalTargetPos = particle.GetXi() + (totalSteeringOffset * influenceWeight);
+			// --- ̐ ---
+			pOutConstraints->push_back(m_constraintPool.Acquire(m_pCommonResources, &particle, finalTargetPos));
+		}
+	}
+}
+
+
+
+/**
+ * @brief ͂ɑ΂XeAO͂vZ
+ *
+ * @param[in] cameraForward J̐ʃxNg
+ * @param[in] input			ړ
+ *
+ * @return ͂ɑ΂XeAO
+ */
+DirectX::SimpleMath::Vector3 SteeringConstraintGenerator::ComputeInputSteeringForce(const DirectX::SimpleMath::Vector3& cameraForward, const DirectX::SimpleMath::Vector3& input) const
+{
+	using namespace SimpleMath;
+
+
+	Vector3 cameraRight = cameraForward.Cross(Vector3::Up);
+	cameraRight.Normalize();
+
+	// ͂JԂ̈ړɕϊ
+	Vector3 moveDirection = (input.z * cameraForward) + (-input.x * cameraRight);
+	if (moveDirection.LengthSquared() > 0.001f)
+	{
+		moveDirection.Normalize();
+	}
+
+	return (moveDirection * INPUT_INERTIA_STRENGTH);
+}
+
+
+
+/**
+ * @brief J֓XeAO͂vZ
+ *
+ * @param[in] cameraForward         J̐ʃxNg
+ * @param[in] particleRootPosition  p[eBN̍{W
+ * @param[in] particle              XeAOKpp[eBN
+ * @param[in] inertiaDamping        ̌
+ *
+ * @return J֓XeAO
+ */
+DirectX::SimpleMath::Vector3 SteeringConstraintGenerator::ComputeCameraDirectedSteeringForce(
+	const DirectX::SimpleMath::Vector3& cameraForward,
+	const DirectX::SimpleMath::Vector3& particleRootPosition,
+	const SimParticle& particle,
+	const float& inertiaDamping) const
+{
+	using namespace SimpleMath;
+
+	 // p[eBN  ̐xNg
+	Vector3 particleToRootDir = particleRootPosition - particle.GetXi();
+	particleToRootDir.y = 0.0f;
+	particleToRootDir.Normalize();
+
+	// JƂ̍ɂ銵XeAO
+	Vector3 steeringForce = (particleToRootDir - cameraForward) * AUTO_INERTIA_STRENGTH * inertiaDamping;
+
+	// I[gItZbgFC[is̋tɒxĂĂ悤ȗ
+	return steeringForce;
+}
@@ -0,0 +1,95 @@
+/*****************************************************************//**
+ * @file    SteeringConstraintGenerator.h
+ * @brief   ǐ̍쐬Ɋւwb_[t@C
+ *
+ * JƓ͂̎擾͎Anꂽl瑀ǐ쐬B
+ * Q[ł SteeringConstraintFactory Aؗp̊ł͑{ʂ̒ln킪g
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+
+#include "../../../XPBDSimulator/XPBDSimulator.h"
+#include "../../../XPBDSimulator/Constraint/ConstraintPool.h"
+#include "SteeringConstraint.h"
+
+// [eBeB֘A
+#include "Game/Common/Utillities/ElapsedTimeCounter/ElapsedTimeCounter.h"
+
+// NX̑O錾 ===================================================
+class SimParticle; // V~[Ṽp[eBN
+class IConstraint;
+class CommonResources;
+
+// NX̒` ===============================================================
+/**
+ * @brief ǐ̍쐬
+ */
+class SteeringConstraintGenerator
+{
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr float DUMPING_DURATION = 1.0f; // C[̊鎞
+	static constexpr float AUTO_INERTIA_STRENGTH = 50.0f; // ł銵̋
+	static constexpr float INPUT_INERTIA_STRENGTH = 130.0f; // ͂ɂł銵̋
+
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	const CommonResources* m_pCommonResources;	///< ʃ\[Xi쐬ɓnj
+
+	ElapsedTimeCounter m_elapsedTimeCounter;	///< oߎԃJE^[
+
+	ConstraintPool<SteeringConstraint> m_constraintPool;	///< ǐ̃v[
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	SteeringConstraintGenerator(const CommonResources* pCommonResources);
+
+	// fXgN^
+	~SteeringConstraintGenerator();
+
+
+// 
+public:
+	// Zbg
+	void Reset();
+
+	// ̍쐬
+	void Generate(
+		std::vector<XPBDSimulator::Particle>* pParticles,
+		float deltaTime,
+		const DirectX::SimpleMath::Vector3& cameraForward,
+		const DirectX::SimpleMath::Vector3& input,
+		std::vector<IConstraint*>* pOutConstraints);
+
+// 擾/ݒ
+public:
+	// ̂߂Ƀmۂ񐔂̎擾
+	size_t GetAllocationCount() const { return m_constraintPool.GetAllocationCount(); }
+
+// 
+private:
+
+	// ͂ɑ΂XeAO͂vZ
+	DirectX::SimpleMath::Vector3 ComputeInputSteeringForce(const DirectX::SimpleMath::Vector3& cameraForward, const DirectX::SimpleMath::Vector3& input) const;
+
+	// J֓XeAO͂vZ
+	DirectX::SimpleMath::Vector3 ComputeCameraDirectedSteeringForce(
+		const DirectX::SimpleMath::Vector3& cameraForward,
+		const DirectX::SimpleMath::Vector3& particleRootPosition,
+		const SimParticle& particle,
+		const float& inertiaDamping) const;
+};
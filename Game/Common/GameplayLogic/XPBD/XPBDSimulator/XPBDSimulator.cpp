@@ -11,13 +11,7 @@
 #include "XPBDSimulator.h"
 
 // Cu֘A
-#include "Library/MyLib\MathUtils/MathUtils.h"
-
-// t[[N֘A
-#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
-
-// [eBeB֘A
-#include "Game/Common/Utillities/Collision/Collision.h"
+#include "Library/MyLib/MathUtils/MathUtils.h"
 
 // XPBD֘A
 #include "Constraint/ConstraintFactory.h"
@@ -27,6 +21,10 @@
 #include "../RopeObject/RopeObject.h"
 #include "Constraint/DistanceConstraint/DistanceConstraint.h"
 
+#ifdef XPBDSIMULATOR_PROFILE
+#include <chrono>
+#endif
+
 using namespace DirectX;
 
 // o֐̒` ===========================================================
@@ -36,7 +34,12 @@ using namespace DirectX;
  * @param[in] Ȃ
  */
 XPBDSimulator::XPBDSimulator()
-	: m_pCollisionManager{ nullptr }
+	: m_allocationCount{ 0 }
+	, m_lastSolveResult{}
+	, m_isSleeping{ false }
+	, m_calmFrameCount{ 0 }
+	, m_kineticEnergy{ 0.0f }
+	, m_pCollisionManager{ nullptr }
 {
 
 }
@@ -60,6 +63,21 @@ XPBDSimulator::~XPBDSimulator()
  * @param[in] pRopeObject	[vIuWFNg
  */
 void XPBDSimulator::Initialize(Parameter parameter, RopeObject* pRopeObject)
+{
+	Initialize(parameter, *pRopeObject->GetParticles());
+}
+
+
+
+/**
+ * @brief 
+ *
+ * [vIuWFNgɃp[eBN𒼐ړni`Ȃؗp̃[vȂǁj
+ *
+ * @param[in] parameter			p[^
+ * @param[in] ropeParticles		p[eBNi擪Œ肷j
+ */
+void XPBDSimulator::Initialize(Parameter parameter, const std::vector<ParticleObject*>& ropeParticles)
 {
 	// 
 	Reset();
@@ -68,14 +86,16 @@ void XPBDSimulator::Initialize(Parameter parameter, RopeObject* pRopeObject)
 
 
 	// **** p[eBNz̏ ****
-	const auto pRopeParticles = pRopeObject->GetParticles();	// pϐ
+	const auto pRopeParticles = &ropeParticles;	// pϐ
 
 	size_t particleNum = pRopeParticles->size();
 
 	if (particleNum <= 0) particleNum = 2;
 
 	// p[eBN̔z̗̈mۂ
+	const size_t particleCapacity = m_particles.capacity();
 	m_particles.resize(particleNum);
+	if (m_particles.capacity() != particleCapacity) m_allocationCount++;
 
 
 	//// [vm̊Ǘz̗̈mۂ
@@ -109,6 +129,7 @@ void XPBDSimulator::Initialize(Parameter parameter, RopeObject* pRopeObject)
 	}
 	
 	// ÓIȐ
+	const size_t staticCapacity = m_staticConstraints.capacity();
 	m_staticConstraints.clear();
 
 	for (auto& factory : m_constraintFactories)
@@ -116,19 +137,11 @@ void XPBDSimulator::Initialize(Parameter parameter, RopeObject* pRopeObject)
 		// Iȏꍇ܂쐬Ȃ
 		if (factory->IsDynamic()) continue; 
 
-		// ̊i[z
-		std::vector<std::unique_ptr<IConstraint>> creationConstraints;
-
-		// 
-		creationConstraints = factory->CreateConstraint(&m_particles, m_parameter);
-
 		// o^
-		for (int i = 0; i < creationConstraints.size(); i++)
-		{
-			m_staticConstraints.push_back(std::move(creationConstraints[i]));
-		}
-
+		factory->CreateConstraint(&m_particles, m_parameter, &m_staticConstraints);
 	}
+
+	if (m_staticConstraints.capacity() != staticCapacity) m_allocationCount++;
 	
 }
 
@@ -137,22 +150,44 @@ void XPBDSimulator::Initialize(Parameter parameter, RopeObject* pRopeObject)
 /**
  * @brief XV
  *
+ * Ăꍇ́AŒ_ wakeDistance 蓮ƂNăV~[V
+ *
  * @param[in] deltaTime oߎ
  *
  * @return Ȃ
  */
 void XPBDSimulator::Update(float deltaTime)
 {
-	// **** Œ_ȊÖʒuf[^ɔf ****
+	if (m_isSleeping)
+	{
+		// ĂԂ͌Œ_𔽉fȂ߁AƂ̈ʒüړʂŒׂiĂNj
+		const float wakeDistanceSquared = m_parameter.wakeDistance * m_parameter.wakeDistance;
+		bool isAnchorMoved = false;
+		for (const auto& particle : m_particles)
+		{
+			if (!particle.simP.IsFixed()) { continue; }
+
+			if (SimpleMath::Vector3::DistanceSquared(particle.pP->GetPosition(), particle.simP.GetX()) > wakeDistanceSquared) { isAnchorMoved = true; }
+		}
+
+		if (!isAnchorMoved) { return; }
+
+		WakeUp();
+	}
+
+	// **** Œ_̈ʒuf[^ɔf ****
 	for (auto& particle : m_particles)
 	{
 		if (!particle.simP.IsFixed())  continue; 
+
 		// f
 		particle.simP.SetX(particle.pP->GetPosition());
 	}
 
 	Simulate(deltaTime);
 
+	UpdateSleepState(deltaTime);
+
 	// **** V~[Vʂ̈ʒuf[^ɔf ****
 	for (auto& particle : m_particles)
 	{
@@ -195,25 +230,62 @@ void XPBDSimulator::Finalize()
 /**
  * @brief V~[V
  * 
+ * TuXebv 1 傫ꍇ͌oߎԂ𓙕ČJԂB
+ * IȐ͑̓͂1t[1񂾂󂯎邽߁Aŏ̃TuXebvŐĎg񂷁B
+ * s񐔂ƍŌ̎c GetLastSolveResult Ŏ擾ł
+ * 
  * @param[in] deltaTime@oߎ
  */
 void XPBDSimulator::Simulate(float deltaTime)
 {
-	if (m_particles.size() <= 1) { return; }
-	// \ʒu̎Zo
-	PredictNextPositions(deltaTime);
+	m_lastSolveResult = SolveResult();
 
-	// ̐
-	GenerateConstraints();
+#ifdef XPBDSIMULATOR_PROFILE
+	m_lastPhaseTimes = PhaseTimes();
 
-	// ̏
-	ResetConstraintParameters();
+	// Ő؂肩̎ԂHɉ
+	auto phaseStart = std::chrono::steady_clock::now();
+	auto addPhaseTime = [&phaseStart](double* pPhaseTime)
+		{
+			const auto now = std::chrono::steady_clock::now();
+			*pPhaseTime += std::chrono::duration<double, std::micro>(now - phaseStart).count();
+			phaseStart = now;
+		};
+#define XPBDSIMULATOR_PHASE_END(phase) addPhaseTime(&m_lastPhaseTimes.phase)
+#else
+#define XPBDSIMULATOR_PHASE_END(phase)
+#endif
+
+	if (m_particles.size() <= 1) { return; }
+
+	const int substeps = std::max(1, m_parameter.substeps);
+	const float substepDeltaTime = deltaTime / static_cast<float>(substeps);
 
-	// eɑ΂XPBD̔vZsAp[eBN̗\ʒuixij𒲐
-	IterateConstraints(deltaTime);
+	for (int substep = 0; substep < substeps; substep++)
+	{
+		// \ʒu̎Zo
+		PredictNextPositions(substepDeltaTime);
+		XPBDSIMULATOR_PHASE_END(predict);
+
+		// ̐
+		if (substep == 0) { GenerateConstraints(); }
+
+		// ̏iTuXebvƂ   0 ɖ߂j
+		ResetConstraintParameters();
+		XPBDSIMULATOR_PHASE_END(generate);
+
+		// eɑ΂XPBD̔vZsAp[eBN̗\ʒuixij𒲐
+		const SolveResult solveResult = IterateConstraints(substepDeltaTime);
+		m_lastSolveResult.iterations	+= solveResult.iterations;
+		m_lastSolveResult.residual		= solveResult.residual;
+		XPBDSIMULATOR_PHASE_END(iterate);
+
+		// \ʒuƌ݈ʒu瑬xXV
+		FinalizeVelocitiesAndPositions(substepDeltaTime);
+		XPBDSIMULATOR_PHASE_END(finalize);
+	}
 
-	// \ʒuƌ݈ʒu瑬xXV
-	FinalizeVelocitiesAndPositions(deltaTime);
+#undef XPBDSIMULATOR_PHASE_END
 }
 
 /**
@@ -224,6 +296,10 @@ void XPBDSimulator::Reset()
 {
 	m_particles.clear();
 
+	m_isSleeping		= false;
+	m_calmFrameCount	= 0;
+	m_kineticEnergy		= 0.0f;
+
 	for (auto& factory : m_constraintFactories)
 	{
 		factory->Reset();
@@ -236,6 +312,59 @@ void XPBDSimulator::AddConstraint(std::unique_ptr<ConstraintFactoryBase> constra
 }
 
 
+
+/**
+ * @brief Ă郍[vN
+ *
+ * ĂԂ͐ڐG𒲂ׂȂ߁A[vɉƂ͎傪Ă
+ */
+void XPBDSimulator::WakeUp()
+{
+	m_isSleeping		= false;
+	m_calmFrameCount	= 0;
+}
+
+
+
+/**
+ * @brief [v𖰂点
+ *
+ * x 0 ɂAN܂ŃV~[VsȂB
+ * p[eBN̐ςč蒼[v𖰂܂܂ɂꍇȂǂɎg
+ */
+void XPBDSimulator::Sleep()
+{
+	m_isSleeping = true;
+
+	for (auto& particle : m_particles)
+	{
+		particle.simP.SetV(SimpleMath::Vector3::Zero);
+		particle.pP->SetVelocity(SimpleMath::Vector3::Zero);
+	}
+}
+
+
+
+/**
+ * @brief mۂ񐔂̎擾
+ *
+ * p[eBNE̔zƁAe񐶐̃v[Ŋmۂ񐔂̍v
+ *
+ * @return mۂ
+ */
+size_t XPBDSimulator::GetAllocationCount() const
+{
+	size_t allocationCount = m_allocationCount;
+
+	for (const auto& factory : m_constraintFactories)
+	{
+		allocationCount += factory->GetAllocationCount();
+	}
+
+	return allocationCount;
+}
+
+
 /**
  * @brief ep[eBN̗\ʒuixijɊÂČvZ
  *
@@ -272,12 +401,7 @@ void XPBDSimulator::PredictNextPositions(float deltaTime)
 void XPBDSimulator::ResetConstraintParameters()
 {
 	// ̏
-	for (auto& constraint : m_staticConstraints)
-	{
-		constraint->ResetConstraintParam(m_parameter.flexibility);
-	}
-	// ̏
-	for (auto& constraint : m_dynamicConstraints)
+	for (auto& constraint : m_constraints)
 	{
 		constraint->ResetConstraintParam(m_parameter.flexibility);
 	}
@@ -291,30 +415,28 @@ void XPBDSimulator::ResetConstraintParameters()
  */
 void XPBDSimulator::GenerateConstraints()
 {
-	// ĨNA
+	const size_t dynamicCapacity	= m_dynamicConstraints.capacity();
+	const size_t constraintCapacity = m_constraints.capacity();
+
+	// ĨNAï͎cj
 	m_dynamicConstraints.clear();
 
 	
-	// IȐ̍쐬
+	// IȐ̍쐬ie񐶐Õt[̐ĒǋLj
 	for (auto& constraintFactory : m_constraintFactories)
 	{
 		if (!constraintFactory->IsDynamic()) { continue; }
 
-		// I̍쐬
-		auto creationConstraints = constraintFactory->CreateConstraint(&m_particles, m_parameter);
-		if (creationConstraints.empty()) { continue; }
-
-		// 炩ߗ̈̊m
-		m_dynamicConstraints.reserve(m_dynamicConstraints.size() + creationConstraints.size());
-
-		// I̓o^
-		m_dynamicConstraints.insert(
-			m_dynamicConstraints.end(),
-			std::make_move_iterator(creationConstraints.begin()),
-			std::make_move_iterator(creationConstraints.end())
-		);
+		constraintFactory->CreateConstraint(&m_particles, m_parameter, &m_dynamicConstraints);
 	}
 
+	// ŉW񂷂iIAÓȈj
+	m_constraints.clear();
+	m_constraints.insert(m_constraints.end(), m_dynamicConstraints.begin(), m_dynamicConstraints.end());
+	m_constraints.insert(m_constraints.end(), m_staticConstraints.begin(), m_staticConstraints.end());
+
+	if (m_dynamicConstraints.capacity() != dynamicCapacity) m_allocationCount++;
+	if (m_constraints.capacity() != constraintCapacity) m_allocationCount++;
 }
 
 /**
@@ -325,24 +447,20 @@ void XPBDSimulator::GenerateConstraints()
  * p[eBN̗\ʒuɔfĂ܂B
  * w肳ꂽCe[V񐔂āA肵ɋ߂Â܂B
  *
+ * c͊eŕ␳Oɕ]ᔽi̕j̍ől܂͓敽ϕƂB
+ * cőł؂ꍇ́Aŏ񐔂IɎcelȉɂȂŏI
+ *
  * @param[in] deltaTime oߎԁitj
+ *
+ * @return s񐔂ƍŌ̔̎c
  */
-void XPBDSimulator::IterateConstraints(float deltaTime)
+XPBDSimulator::SolveResult XPBDSimulator::IterateConstraints(float deltaTime)
 {
 	using namespace SimpleMath;
 
-	// W񂷂
-	std::vector<IConstraint*> constraints;
+	const int minIterations = m_parameter.isAdaptiveIterations ? std::clamp(m_parameter.minIterations, 1, std::max(1, m_parameter.iterations)) : m_parameter.iterations;
 
-
-	for (auto& con : m_dynamicConstraints)
-	{
-		constraints.push_back(con.get());
-	}
-	for (auto& con : m_staticConstraints)
-	{
-		constraints.push_back(con.get());
-	}
+	SolveResult result;
 
 	// Ce[V܂킷
 	   // iterations ̔ŐAxi ǂǂ񒲐B
@@ -350,7 +468,10 @@ void XPBDSimulator::IterateConstraints(float deltaTime)
 	int i = 0;
 	while (i < m_parameter.iterations)
 	{
-		for (auto& constraint : constraints) 
+		float maxViolation = 0.0f;
+		float violationSquaredSum = 0.0f;
+
+		for (auto& constraint : m_constraints) 
 		{
 			// ̎擾
 			ConstraintParam cParam = constraint->GetConstraintParam();
@@ -362,6 +483,10 @@ void XPBDSimulator::IterateConstraints(float deltaTime)
 			// 0ȉłΐᔽȂƂ݂ȂiђʂĂȂj
 			if (C <= 0.0f) { continue; }
 
+			// c̏Wv
+			maxViolation = std::max(maxViolation, C);
+			violationSquaredSum += C * C;
+
 			// ɂ̌vZ
 			float  = constraint->ComputeLambdaCorrection(deltaTime, C);
 
@@ -374,9 +499,17 @@ void XPBDSimulator::IterateConstraints(float deltaTime)
 			constraint->ApplyPositionCorrection(); 
 		}
 		i = i + 1;
+
+		result.iterations = i;
+		result.residual = (m_parameter.residualNorm == ResidualNorm::RMS && !m_constraints.empty())
+			? std::sqrt(violationSquaredSum / static_cast<float>(m_constraints.size()))
+			: maxViolation;
+
+		// celȉɂȂΑł؂
+		if (m_parameter.isAdaptiveIterations && i >= minIterations && result.residual <= m_parameter.residualTolerance) { break; }
 	}
 
-	constraints.clear();
+	return result;
 }
 
 /**
@@ -407,3 +540,38 @@ void XPBDSimulator::FinalizeVelocitiesAndPositions(float deltaTime)
 		simP->SetX(simP->GetXi());
 	}
 }
+
+
+
+/**
+ * @brief ^GlM[߂Ė邩ǂ߂
+ *
+ * m肵xɂ͏d͂Ă݂邵Ď~܂ĂĂ 0 ɂȂȂ߁A
+ * ^GlM[͑Õt[̈ʒuiParticleObject ɂ܂fĂȂj̈ړʂŋ߂B
+ * 臒l葱t[ sleepFrameNum ɒB疰
+ *
+ * @param[in] deltaTime oߎԁitj
+ */
+void XPBDSimulator::UpdateSleepState(float deltaTime)
+{
+	if (!m_parameter.isSleepEnabled || deltaTime <= 0.0f) { return; }
+
+	float energy = 0.0f;
+	float massSum = 0.0f;
+	for (const auto& particle : m_particles)
+	{
+		if (particle.simP.IsFixed()) { continue; }
+
+		const SimpleMath::Vector3 velocity = (particle.simP.GetX() - particle.pP->GetPosition()) / deltaTime;
+		energy	+= 0.5f * particle.simP.GetMass() * velocity.LengthSquared();
+		massSum	+= particle.simP.GetMass();
+	}
+
+	m_kineticEnergy = (massSum > 0.0f) ? energy / massSum : 0.0f;
+
+	m_calmFrameCount = (m_kineticEnergy < m_parameter.sleepEnergyThreshold) ? m_calmFrameCount + 1 : 0;
+
+	if (m_calmFrameCount < m_parameter.sleepFrameNum) { return; }
+
+	Sleep();
+}
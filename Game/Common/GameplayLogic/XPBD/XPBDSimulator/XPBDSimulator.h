@@ -34,14 +34,86 @@ class CollisionManager; // 
  */
 class XPBDSimulator
 {
+// 񋓌^̐錾
+public:
+	/**
+	 * @brief ciᔽj̋ߕ
+	 */
+	enum class ResidualNorm
+	{
+		MAX,	///< ől
+		RMS,	///< 敽ϕ
+	};
+
 // \̂̐錾
 public:
 	struct Parameter
 	{
 		float flexibility = 0.001f;
-		int iterations = 10;
+		int iterations = 10;	///< 񐔁iTuXebvƁBcőł؂ꍇ͍őlj
 		DirectX::SimpleMath::Vector3 gravity = DirectX::SimpleMath::Vector3(0.0f, 9.80f, 0.0f);
+
+		/**
+		 * @brief TuXebv
+		 *
+		 * 1 傫ꍇ t 𓙕ATuXebvƂɗ\E ̏EEmsB
+		 * iterations  1 ɂƁȂɍׂԍ݂ōdouSmall Stepsv̉ɂȂ
+		 */
+		int substeps = 1;
+
+		/**
+		 * @brief cŔł؂邩ǂ
+		 *
+		 * true ̏ꍇAƂɐᔽicj߁AresidualTolerance ȉɂȂ_Ŕ߂B
+		 * 񐔂 minIterations ȏ iterations ȉɂȂ
+		 */
+		bool isAdaptiveIterations = false;
+		int minIterations = 1;							///< 񐔂̍ŏlicőł؂ꍇj
+		float residualTolerance = 0.001f;				///< ł؂c
+		ResidualNorm residualNorm = ResidualNorm::MAX;	///< c̋ߕ
+
+		/**
+		 * @brief ̎R
+		 *
+		 * 0 ̏ꍇ͏_ׂ̗荇p[eBN̋gB
+		 * p[eBN̐ς[viRopeLODjőŜ̒ۂ߂Ɏg
+		 */
+		float segmentLength = 0.0f;
+
+		/**
+		 * @brief ~܂[v̌vZȂǂ
+		 *
+		 * true ̏ꍇA1kg ̉^GlM[ sleepEnergyThreshold  sleepFrameNum t[ĉƖA
+		 * Œ_Ƃ̈ʒu wakeDistance 蓮 WakeUp Ă΂܂ŃV~[VsȂ
+		 */
+		bool isSleepEnabled = false;
+		float sleepEnergyThreshold = 0.0001f;	///< ^GlM[i1kg B 0.014m/s xj
+		int sleepFrameNum = 30;					///< ܂łɉ^GlM[臒l葱t[
+		float wakeDistance = 0.001f;			///< Ă郍[vNŒ_̈ړʁiƂ̈ʒuj
+	};
+
+	/**
+	 * @brief 1Xebv̔̌
+	 */
+	struct SolveResult
+	{
+		int		iterations = 0;		///< s񐔁iSẴTuXebv̍vj
+		float	residual = 0.0f;	///< Ō̔ŕ]ciŌ̃TuXebvj
+	};
+
+	// HƂ̎Ԃ Tools/RopeSimulationHarness rh XPBDSIMULATOR_PROFILE `Čv
+#ifdef XPBDSIMULATOR_PROFILE
+	/**
+	 * @brief 1Xebv̍HƂ̎ԁi}CNbBSẴTuXebv̍vj
+	 */
+	struct PhaseTimes
+	{
+		double predict	= 0.0;	///< \ʒu̎Zo
+		double generate	= 0.0;	///< ̐Ə
+		double iterate	= 0.0;	///< vZ
+		double finalize	= 0.0;	///< xƈʒům
 	};
+#endif
 
 
 
@@ -73,9 +145,22 @@ private:
 
 	Parameter m_parameter;	///< p[^
 
-	//  xSۂ̂ߕĂ
-	std::vector<std::unique_ptr<IConstraint>> m_staticConstraints;  ///< ÓIQ 
-	std::vector<std::unique_ptr<IConstraint>> m_dynamicConstraints; ///< IQ@it[XVj
+	//  xSۂ̂ߕĂî͊e񐶐j
+	std::vector<IConstraint*> m_staticConstraints;  ///< ÓIQ 
+	std::vector<IConstraint*> m_dynamicConstraints; ///< IQ@it[XVj
+	std::vector<IConstraint*> m_constraints;		///< ŉQiIQAÓIQ̏Bt[܂Ŏg񂷁j
+
+	size_t m_allocationCount; ///< z񂪃mۂ
+
+	SolveResult m_lastSolveResult;	///< ÕXebv̔̌
+
+	bool	m_isSleeping;		///< Ă邩ǂiV~[VȂj
+	int		m_calmFrameCount;	///< ^GlM[臒l葱Ăt[
+	float	m_kineticEnergy;	///< Õt[ 1kg ̉^GlM[
+
+#ifdef XPBDSIMULATOR_PROFILE
+	PhaseTimes m_lastPhaseTimes;	///< ÕXebv̍HƂ̎
+#endif
 
 	std::vector<std::unique_ptr<ConstraintFactoryBase>> m_constraintFactories; ///< 񐶐Q
 
@@ -99,6 +184,9 @@ public:
 	// 
 	void Initialize(Parameter parameter, RopeObject* pRopeObject);
 
+	// ip[eBN𒼐ړnj
+	void Initialize(Parameter parameter, const std::vector<ParticleObject*>& ropeParticles);
+
 	// XV
 	void Update(float deltaTime);
 
@@ -117,11 +205,46 @@ public:
 	// ̒ǉ
 	void AddConstraint(std::unique_ptr<ConstraintFactoryBase> constraintFactory);
 
+	// Ă郍[vNiڐGƂȂǁj
+	void WakeUp();
+
+	// [v𖰂点
+	void Sleep();
+
 // 擾/ݒ
 public:
 
 	void SetCollisionManager(CollisionManager* pCollisionManager) { m_pCollisionManager = pCollisionManager; }
 
+	// mۂ񐔂̎擾ie񐶐̕܂ށj
+	size_t GetAllocationCount() const;
+
+	// ÕXebv̔̌ʂ̎擾
+	const SolveResult& GetLastSolveResult() const { return m_lastSolveResult; }
+
+	// p[^̎擾
+	const Parameter& GetParameter() const { return m_parameter; }
+
+	// p[eBN̐̎擾
+	size_t GetParticleNum() const { return m_particles.size(); }
+
+	// V~[Ṽp[eBN̈ʒu̎擾iUpdate ŔfO̒lj
+	DirectX::SimpleMath::Vector3 GetParticlePosition(size_t index) const { return m_particles[index].simP.GetX(); }
+
+	// ÕXebvŉ̐̎擾
+	size_t GetConstraintNum() const { return m_constraints.size(); }
+
+	// Ă邩ǂ
+	bool IsSleeping() const { return m_isSleeping; }
+
+	// Õt[ 1kg ̉^GlM[̎擾
+	float GetKineticEnergy() const { return m_kineticEnergy; }
+
+#ifdef XPBDSIMULATOR_PROFILE
+	// ÕXebv̍HƂ̎Ԃ̎擾
+	const PhaseTimes& GetLastPhaseTimes() const { return m_lastPhaseTimes; }
+#endif
+
 
 
 // 
@@ -137,11 +260,14 @@ private:
 	void GenerateConstraints();
 
 	// eɑ΂XPBD̔vZsAp[eBN̗\ʒuixij𒲐
-	void IterateConstraints(float deltaTime);
+	SolveResult IterateConstraints(float deltaTime);
 
 	// \ʒuƌ݈ʒu瑬xXVAp[eBN̏Ԃm肳
 	void FinalizeVelocitiesAndPositions(float deltaTime);
 
+	// ^GlM[߂Ė邩ǂ߂
+	void UpdateSleepState(float deltaTime);
+
 
 
 };
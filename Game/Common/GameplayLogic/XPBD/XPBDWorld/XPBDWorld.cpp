@@ -0,0 +1,745 @@
+/*****************************************************************//**
+ * @file    XPBDWorld.cpp
+ * @brief   ̃[v܂Ƃ߂ĉXPBD̃[hɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDWorld.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+// Q[IuWFNg֘A
+#include "../RopeObject/RopeObject.h"
+#include "../ParticleObject/ParticleObject.h"
+
+using namespace DirectX;
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+XPBDWorld::XPBDWorld()
+	: m_ropes{}
+	, m_particleStore{}
+	, m_particleObjects{}
+	, m_constraints{}
+	, m_maxIterations{ 0 }
+	, m_coloredConstraints{}
+	, m_coloredIterations{}
+	, m_colorBegins{}
+	, m_isColorDirty{ true }
+	, m_threadNum{ 1 }
+	, m_solveDeltaTime{ 0.0f }
+	, m_helperThreads{}
+	, m_poolGeneration{ 0 }
+	, m_pendingThreadNum{ 0 }
+	, m_stopHelpers{ false }
+	, m_barrierCount{ 0 }
+	, m_barrierGeneration{ 0 }
+{
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+XPBDWorld::~XPBDWorld()
+{
+	StopHelperThreads();
+}
+
+
+
+/**
+ * @brief XV
+ *
+ * Œ_[vIuWFNg̈ʒuɍ킹Ăi߁Aʂ[vIuWFNg֔fB
+ * [vIuWFNgȂ[v͔fȂ
+ *
+ * @param[in] deltaTime oߎ
+ */
+void XPBDWorld::Update(float deltaTime)
+{
+	// **** Œ_̈ʒuf[^ɔf ****
+	for (const Rope& rope : m_ropes)
+	{
+		if (rope.pRopeObject == nullptr) continue;
+
+		for (uint32_t i = rope.particleBegin; i < rope.particleBegin + rope.particleNum; i++)
+		{
+			if (!m_particleStore.IsFixed(i)) continue;
+			m_particleStore.SetX(i, m_particleObjects[i]->GetPosition());
+		}
+	}
+
+	Simulate(deltaTime);
+
+	// **** V~[Vʂ̈ʒuf[^ɔf ****
+	for (const Rope& rope : m_ropes)
+	{
+		if (rope.pRopeObject == nullptr) continue;
+
+		for (uint32_t i = rope.particleBegin; i < rope.particleBegin + rope.particleNum; i++)
+		{
+			m_particleObjects[i]->SetPosition(m_particleStore.GetX(i));
+			m_particleObjects[i]->SetVelocity(m_particleStore.GetV(i));
+		}
+	}
+}
+
+
+
+/**
+ * @brief V~[V
+ *
+ * SẴ[v̗\E̔Emꂼ1̏ōs
+ *
+ * @param[in] deltaTime oߎ
+ */
+void XPBDWorld::Simulate(float deltaTime)
+{
+	if (m_ropes.IsEmpty()) return;
+
+	// \ʒu̎Zo
+	PredictNextPositions(deltaTime);
+
+	// ̏
+	ResetConstraintParameters();
+
+	// eɑ΂XPBD̔vZsAp[eBN̗\ʒuixij𒲐
+	IterateConstraints(deltaTime);
+
+	// \ʒuƌ݈ʒu瑬xXV
+	FinalizeVelocitiesAndPositions(deltaTime);
+}
+
+
+
+/**
+ * @brief [v̒ǉ
+ *
+ * [vIuWFNg̃p[eBN擪珇ɌqB擪̃p[eBNŒ肷
+ *
+ * @param[in] parameter		p[^
+ * @param[in] pRopeObject	[vIuWFNg
+ *
+ * @return [ṽnhip[eBN2Ȃ疳ȃnhj
+ */
+XPBDWorld::RopeHandle XPBDWorld::AddRope(const XPBDSimulator::Parameter& parameter, RopeObject* pRopeObject)
+{
+	const auto pRopeParticles = pRopeObject->GetParticles();
+	if (pRopeParticles->size() < 2) return RopeHandle();
+
+	const uint32_t particleNum = static_cast<uint32_t>(pRopeParticles->size());
+	const uint32_t particleBegin = m_particleStore.Allocate(particleNum);
+	m_particleObjects.resize(m_particleStore.GetSize(), nullptr);
+
+	for (uint32_t i = 0; i < particleNum; i++)
+	{
+		const uint32_t index = particleBegin + i;
+		ParticleObject* pParticleObject = (*pRopeParticles)[i];
+		m_particleObjects[index] = pParticleObject;
+
+		/**** V~[Vp[eBN̐ݒ ***/
+		m_particleStore.SetFixed(index, i == 0);
+		m_particleStore.SetX(index, pParticleObject->GetPosition());
+		m_particleStore.SetMass(index, pParticleObject->GetMass());
+		m_particleStore.SetV(index, pParticleObject->GetVelocity());
+	}
+
+	return RegisterRope(parameter, pRopeObject, particleBegin, particleNum);
+}
+
+
+
+/**
+ * @brief ʒuw肵[v̒ǉ
+ *
+ * [vIuWFNgȂpB擪̃p[eBNŒ肷
+ *
+ * @param[in] parameter		p[^
+ * @param[in] positions		p[eBN̏W
+ * @param[in] particleMass	p[eBN1̎
+ *
+ * @return [ṽnhip[eBN2Ȃ疳ȃnhj
+ */
+XPBDWorld::RopeHandle XPBDWorld::AddRope(const XPBDSimulator::Parameter& parameter, const std::vector<DirectX::SimpleMath::Vector3>& positions, float particleMass)
+{
+	if (positions.size() < 2) return RopeHandle();
+
+	const uint32_t particleNum = static_cast<uint32_t>(positions.size());
+	const uint32_t particleBegin = m_particleStore.Allocate(particleNum);
+	m_particleObjects.resize(m_particleStore.GetSize(), nullptr);
+
+	for (uint32_t i = 0; i < particleNum; i++)
+	{
+		const uint32_t index = particleBegin + i;
+		m_particleStore.SetFixed(index, i == 0);
+		m_particleStore.SetX(index, positions[i]);
+		m_particleStore.SetMass(index, particleMass);
+		m_particleStore.SetV(index, SimpleMath::Vector3::Zero);
+	}
+
+	return RegisterRope(parameter, nullptr, particleBegin, particleNum);
+}
+
+
+
+/**
+ * @brief [v̍폜
+ *
+ * L̔z񂩂烍[v͈̔͂菜Ã[v̈ʒul߂
+ *
+ * @param[in] handle [ṽnh
+ *
+ * @returns true  폜
+ * @returns false ȃnh
+ */
+bool XPBDWorld::RemoveRope(RopeHandle handle)
+{
+	const Rope* pRope = m_ropes.Get(handle);
+	if (pRope == nullptr) return false;
+
+	const Rope removed = *pRope;
+	m_ropes.Remove(handle);
+
+	// ߑ܂߂Ď菜
+	const uint32_t storeParticleNum = (removed.particleNum + ParticleStore::LANE_NUM - 1) / ParticleStore::LANE_NUM * ParticleStore::LANE_NUM;
+	m_particleStore.Erase(removed.particleBegin, removed.particleNum);
+	m_particleObjects.erase(
+		m_particleObjects.begin() + removed.particleBegin,
+		m_particleObjects.begin() + removed.particleBegin + storeParticleNum);
+	m_constraints.Erase(removed.constraintBegin, removed.constraintNum);
+
+	// ɂ[v̈ʒul߂
+	for (Rope& rope : m_ropes)
+	{
+		if (rope.particleBegin > removed.particleBegin) rope.particleBegin -= storeParticleNum;
+		if (rope.constraintBegin > removed.constraintBegin) rope.constraintBegin -= removed.constraintNum;
+	}
+	m_constraints.ShiftParticleIndices(removed.constraintBegin, storeParticleNum);
+
+	UpdateMaxIterations();
+	m_isColorDirty = true;
+
+	return true;
+}
+
+
+
+/**
+ * @brief Sč폜
+ */
+void XPBDWorld::Clear()
+{
+	m_ropes.Clear();
+	m_particleStore.Clear();
+	m_particleObjects.clear();
+	m_constraints.Clear();
+	m_maxIterations = 0;
+	m_isColorDirty = true;
+}
+
+
+
+/**
+ * @brief [ṽp[^̎擾
+ *
+ * @param[in] handle [ṽnh
+ *
+ * @return p[^iȃnhȂ nullptrj
+ */
+const XPBDSimulator::Parameter* XPBDWorld::GetParameter(RopeHandle handle) const
+{
+	const Rope* pRope = m_ropes.Get(handle);
+	return (pRope != nullptr) ? &pRope->parameter : nullptr;
+}
+
+
+
+/**
+ * @brief [ṽp[^̐ݒ
+ *
+ * @param[in] handle	[ṽnh
+ * @param[in] parameter	p[^
+ *
+ * @returns true  ݒ肵
+ * @returns false ȃnh
+ */
+bool XPBDWorld::SetParameter(RopeHandle handle, const XPBDSimulator::Parameter& parameter)
+{
+	Rope* pRope = m_ropes.Get(handle);
+	if (pRope == nullptr) return false;
+
+	if (pRope->parameter.iterations != parameter.iterations)
+	{
+		// F̒̕т͔񐔂Ō܂
+		m_isColorDirty = true;
+	}
+	pRope->parameter = parameter;
+	UpdateMaxIterations();
+
+	return true;
+}
+
+
+
+/**
+ * @brief [ṽp[eBN͈̔͂̎擾
+ *
+ * ͈͂̓[v̍폜őOɋl߂
+ *
+ * @param[in]  handle			[ṽnh
+ * @param[out] pOutBegin		擪̃p[eBN̈ʒuip[eBNQ̒ł̈ʒuj
+ * @param[out] pOutParticleNum	p[eBN̐
+ *
+ * @returns true  擾
+ * @returns false ȃnh
+ */
+bool XPBDWorld::GetParticleRange(RopeHandle handle, uint32_t* pOutBegin, uint32_t* pOutParticleNum) const
+{
+	const Rope* pRope = m_ropes.Get(handle);
+	if (pRope == nullptr) return false;
+
+	*pOutBegin			= pRope->particleBegin;
+	*pOutParticleNum	= pRope->particleNum;
+	return true;
+}
+
+
+
+/**
+ * @brief mۂp[eBNq[v̓o^
+ *
+ * ͈͂̃p[eBNדm̋Ōq
+ *
+ * @param[in] parameter		p[^
+ * @param[in] pRopeObject	[vIuWFNg
+ * @param[in] particleBegin	擪̃p[eBN̈ʒu
+ * @param[in] particleNum	p[eBN̐
+ *
+ * @return [ṽnh
+ */
+XPBDWorld::RopeHandle XPBDWorld::RegisterRope(const XPBDSimulator::Parameter& parameter, RopeObject* pRopeObject, uint32_t particleBegin, uint32_t particleNum)
+{
+	Rope rope;
+	rope.parameter			= parameter;
+	rope.pRopeObject		= pRopeObject;
+	rope.particleBegin		= particleBegin;
+	rope.particleNum		= particleNum;
+	rope.constraintBegin	= m_constraints.GetSize();
+	rope.constraintNum		= rope.particleNum - 1;
+
+	m_constraints.Reserve(m_constraints.GetSize() + rope.constraintNum);
+	for (uint32_t i = 0; i < rope.constraintNum; i++)
+	{
+		const uint32_t particleIndex1 = particleBegin + i;
+		const uint32_t particleIndex2 = particleBegin + i + 1;
+
+		// RƂ
+		const SimpleMath::Vector3 dirVec = m_particleStore.GetX(particleIndex1) - m_particleStore.GetX(particleIndex2);
+		m_constraints.Add(particleIndex1, particleIndex2, dirVec.Length());
+	}
+
+	const RopeHandle handle = m_ropes.Add(rope);
+	if (handle.IsNull())
+	{
+		// o^łȂ͎菜
+		m_particleStore.Erase(particleBegin, particleNum);
+		m_particleObjects.resize(m_particleStore.GetSize());
+		m_constraints.Shrink(rope.constraintBegin);
+		return handle;
+	}
+
+	m_maxIterations = std::max(m_maxIterations, parameter.iterations);
+	m_isColorDirty = true;
+
+	return handle;
+}
+
+
+
+/**
+ * @brief 񐔂̍őlߒ
+ */
+void XPBDWorld::UpdateMaxIterations()
+{
+	m_maxIterations = 0;
+	for (const Rope& rope : m_ropes)
+	{
+		m_maxIterations = std::max(m_maxIterations, rope.parameter.iterations);
+	}
+}
+
+
+
+/**
+ * @brief ep[eBN̗\ʒuixijɊÂČvZ
+ *
+ * O͂̓[vƂɈقȂ邽߁Ał͉Ȃ
+ *
+ * @param[in] deltaTime oߎԁitj
+ */
+void XPBDWorld::PredictNextPositions(float deltaTime)
+{
+	m_particleStore.PredictNextPositions(deltaTime);
+}
+
+
+
+/**
+ * @brief e[v̐p[^iɁEj
+ */
+void XPBDWorld::ResetConstraintParameters()
+{
+	for (const Rope& rope : m_ropes)
+	{
+		m_constraints.ResetParameters(rope.constraintBegin, rope.constraintNum, rope.parameter.flexibility);
+	}
+}
+
+
+
+/**
+ * @brief ̌vZɎgXbh̐ݒ
+ *
+ * @param[in] threadNum Xbhi1 ŕ񉻂ȂB1  MAX_THREAD_NUM Ɏ߂j
+ */
+void XPBDWorld::SetThreadNum(uint32_t threadNum)
+{
+	m_threadNum = std::clamp(threadNum, 1u, MAX_THREAD_NUM);
+}
+
+
+
+/**
+ * @brief F̐̎擾
+ *
+ * @return F̐iדmq̃[vȂ 2j
+ */
+uint32_t XPBDWorld::GetColorNum()
+{
+	UpdateConstraintColors();
+	return m_colorBegins.empty() ? 0 : static_cast<uint32_t>(m_colorBegins.size() - 1);
+}
+
+
+
+/**
+ * @brief e[v̋𔽕񐔕Ap[eBN̗\ʒuixij𒲐
+ *
+ * ̉񂲂ƂɑSẴ[vɉA񐔂ɒB[v͔΂B
+ * [vm̓p[eBNLȂ߁Ae[v̌ʂ1{ꍇƕςȂB
+ * Xbh 2 ȏŋ񂪏\ɑꍇ͐FƂɕɉ
+ *
+ * @param[in] deltaTime oߎԁitj
+ */
+void XPBDWorld::IterateConstraints(float deltaTime)
+{
+	if (m_threadNum > 1 && m_constraints.GetSize() >= MIN_PARALLEL_CONSTRAINT_NUM)
+	{
+		IterateColoredConstraints(deltaTime);
+		return;
+	}
+
+	const DistanceConstraintBatch::ParticleArrays particles = GetParticleArrays();
+
+	for (int iteration = 0; iteration < m_maxIterations; iteration++)
+	{
+		for (const Rope& rope : m_ropes)
+		{
+			if (iteration >= rope.parameter.iterations) continue;
+
+			m_constraints.SolveSequential(rope.constraintBegin, rope.constraintBegin + rope.constraintNum, particles, deltaTime);
+		}
+	}
+}
+
+
+
+/**
+ * @brief FƂɋɉ
+ *
+ * ĂяõXbh0ԂƂĉASẴXbhI܂ő҂
+ *
+ * @param[in] deltaTime oߎԁitj
+ */
+void XPBDWorld::IterateColoredConstraints(float deltaTime)
+{
+	UpdateConstraintColors();
+	ResizeHelperThreads(m_threadNum - 1);
+
+	m_solveDeltaTime = deltaTime;
+	m_barrierCount = 0;
+
+	// `Xbhɔzz
+	{
+		std::lock_guard<std::mutex> lock(m_poolMutex);
+		m_pendingThreadNum = static_cast<uint32_t>(m_helperThreads.size());
+		m_poolGeneration++;
+	}
+	m_poolCv.notify_all();
+
+	SolveColoredConstraints(0);
+
+	// SẴXbh̊҂
+	std::unique_lock<std::mutex> lock(m_poolMutex);
+	m_poolDoneCv.wait(lock, [this] { return m_pendingThreadNum == 0; });
+}
+
+
+
+/**
+ * @brief Xbh̒S̋FƂɉ
+ *
+ * F̋̓p[eBNLȂ߁Aǂ̂悤ɕĂʂ͕ςȂB
+ * F͔̒񐔂̑ɕł̂ŁA񐔂ɒBĂȂ擪͈̔͂𕪂
+ *
+ * @param[in] threadIndex Xbh̔ԍi0 ͌ĂяõXbhj
+ */
+void XPBDWorld::SolveColoredConstraints(uint32_t threadIndex)
+{
+	const DistanceConstraintBatch::ParticleArrays particles = GetParticleArrays();
+
+	const uint32_t threadNum	= m_threadNum;
+	const size_t colorNum		= m_colorBegins.size() - 1;
+	const float deltaTime		= m_solveDeltaTime;
+
+	for (int iteration = 0; iteration < m_maxIterations; iteration++)
+	{
+		for (size_t color = 0; color < colorNum; color++)
+		{
+			// 񐔂ɒBĂȂ͈͂𓙕ĒS
+			const size_t colorBegin = m_colorBegins[color];
+			const size_t colorSize	= std::partition_point(
+				m_coloredIterations.begin() + colorBegin,
+				m_coloredIterations.begin() + m_colorBegins[color + 1],
+				[iteration](int iterations) { return iteration < iterations; }) - (m_coloredIterations.begin() + colorBegin);
+			const size_t begin	= colorBegin + colorSize * threadIndex / threadNum;
+			const size_t end	= colorBegin + colorSize * (threadIndex + 1) / threadNum;
+
+			m_constraints.SolveIndependent(m_coloredConstraints.data() + begin, end - begin, particles, deltaTime);
+
+			// ̐F͍̐F̌ʂĝőSẴXbh҂
+			WaitColorBarrier();
+		}
+	}
+}
+
+
+
+/**
+ * @brief p[eBN̔z̎擾
+ *
+ * p[eBN̒ǉŔz񂪈ړ邽߁AOɎ擾
+ *
+ * @return \WƋtʂ̔z
+ */
+DistanceConstraintBatch::ParticleArrays XPBDWorld::GetParticleArrays()
+{
+	DistanceConstraintBatch::ParticleArrays particles;
+	particles.pXiX		= m_particleStore.GetArray(ParticleStore::ArrayID::PREDICTED_X);
+	particles.pXiY		= m_particleStore.GetArray(ParticleStore::ArrayID::PREDICTED_Y);
+	particles.pXiZ		= m_particleStore.GetArray(ParticleStore::ArrayID::PREDICTED_Z);
+	particles.pInvMass	= m_particleStore.GetArray(ParticleStore::ArrayID::INV_MASS);
+	return particles;
+}
+
+
+
+/**
+ * @brief FKvȂ蒼
+ *
+ * o^ɌāA[̃p[eBN܂gĂȂŏ̐F蓖Ăi×~@jB
+ * F̒ł͔񐔂̑ɕׁA񐔂Ȃo^ۂ
+ */
+void XPBDWorld::UpdateConstraintColors()
+{
+	if (!m_isColorDirty) return;
+	m_isColorDirty = false;
+
+	// p[eBNƂɎgFrbgŎ
+	std::vector<uint64_t> particleColorMasks(m_particleStore.GetSize(), 0);
+	std::vector<uint32_t> constraintColors(m_constraints.GetSize());
+	uint32_t colorNum = 0;
+
+	for (uint32_t i = 0; i < m_constraints.GetSize(); i++)
+	{
+		const uint32_t particleIndex1 = m_constraints.GetParticleIndex1(i);
+		const uint32_t particleIndex2 = m_constraints.GetParticleIndex2(i);
+		const uint64_t usedMask = particleColorMasks[particleIndex1] | particleColorMasks[particleIndex2];
+		const uint32_t color = static_cast<uint32_t>(std::countr_one(usedMask));
+		assert(color < MAX_COLOR_NUM);
+
+		particleColorMasks[particleIndex1] |= (1ull << color);
+		particleColorMasks[particleIndex2] |= (1ull << color);
+		constraintColors[i] = color;
+		colorNum = std::max(colorNum, color + 1);
+	}
+
+	// 񂲂Ƃ̔
+	std::vector<int> constraintIterations(m_constraints.GetSize());
+	for (const Rope& rope : m_ropes)
+	{
+		std::fill_n(constraintIterations.begin() + rope.constraintBegin, rope.constraintNum, rope.parameter.iterations);
+	}
+
+	// F̏ɕׂ
+	m_colorBegins.assign(colorNum + 1, 0);
+	for (const uint32_t color : constraintColors)
+	{
+		m_colorBegins[color + 1]++;
+	}
+	for (uint32_t color = 0; color < colorNum; color++)
+	{
+		m_colorBegins[color + 1] += m_colorBegins[color];
+	}
+
+	std::vector<uint32_t> writePositions(m_colorBegins.begin(), m_colorBegins.end() - 1);
+	m_coloredConstraints.resize(m_constraints.GetSize());
+	for (size_t i = 0; i < constraintColors.size(); i++)
+	{
+		m_coloredConstraints[writePositions[constraintColors[i]]++] = static_cast<uint32_t>(i);
+	}
+
+	// F̒𔽕񐔂̑ɕׂ
+	for (uint32_t color = 0; color < colorNum; color++)
+	{
+		std::stable_sort(
+			m_coloredConstraints.begin() + m_colorBegins[color],
+			m_coloredConstraints.begin() + m_colorBegins[color + 1],
+			[&](uint32_t lhs, uint32_t rhs) { return constraintIterations[lhs] > constraintIterations[rhs]; });
+	}
+
+	m_coloredIterations.resize(m_coloredConstraints.size());
+	for (size_t i = 0; i < m_coloredConstraints.size(); i++)
+	{
+		m_coloredIterations[i] = constraintIterations[m_coloredConstraints[i]];
+	}
+}
+
+
+
+/**
+ * @brief SẴXbhF̋؂ɒ܂ő҂
+ *
+ * 1̔ŐF̐҂̂ŁAX[vɉđ҂
+ */
+void XPBDWorld::WaitColorBarrier()
+{
+	const uint32_t generation = m_barrierGeneration.load(std::memory_order_acquire);
+
+	// ŌɒXbh̐ɐi߂
+	if (m_barrierCount.fetch_add(1, std::memory_order_acq_rel) + 1 == m_threadNum)
+	{
+		m_barrierCount.store(0, std::memory_order_relaxed);
+		m_barrierGeneration.fetch_add(1, std::memory_order_release);
+		return;
+	}
+
+	while (m_barrierGeneration.load(std::memory_order_acquire) == generation)
+	{
+		std::this_thread::yield();
+	}
+}
+
+
+
+/**
+ * @brief `Xbh̐낦
+ *
+ * @param[in] helperNum `Xbh̐
+ */
+void XPBDWorld::ResizeHelperThreads(uint32_t helperNum)
+{
+	if (m_helperThreads.size() == helperNum) return;
+
+	StopHelperThreads();
+
+	std::lock_guard<std::mutex> lock(m_poolMutex);
+	m_stopHelpers = false;
+	m_helperThreads.reserve(helperNum);
+	for (uint32_t i = 0; i < helperNum; i++)
+	{
+		// 0Ԃ͌ĂяõXbhŜ 1 Ԃ犄蓖Ă
+		m_helperThreads.emplace_back(&XPBDWorld::HelperThreadLoop, this, i + 1, m_poolGeneration);
+	}
+}
+
+
+
+/**
+ * @brief `Xbh̃[v
+ *
+ * @param[in] threadIndex		Xbh̔ԍ
+ * @param[in] startGeneration	쐬̎d̐
+ */
+void XPBDWorld::HelperThreadLoop(uint32_t threadIndex, uint64_t startGeneration)
+{
+	uint64_t generation = startGeneration;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_poolMutex);
+			// uVdvu~v܂ŃX[v
+			m_poolCv.wait(lock, [&] { return m_stopHelpers || m_poolGeneration != generation; });
+
+			if (m_stopHelpers) return;
+
+			generation = m_poolGeneration;
+		}
+
+		SolveColoredConstraints(threadIndex);
+
+		{
+			std::lock_guard<std::mutex> lock(m_poolMutex);
+			m_pendingThreadNum--;
+		}
+		m_poolDoneCv.notify_one();
+	}
+}
+
+
+
+/**
+ * @brief `Xbh̒~
+ */
+void XPBDWorld::StopHelperThreads()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_poolMutex);
+		m_stopHelpers = true;
+	}
+	m_poolCv.notify_all();
+
+	for (auto& thread : m_helperThreads)
+	{
+		thread.join();
+	}
+	m_helperThreads.clear();
+}
+
+
+
+/**
+ * @brief \ʒuƌ݈ʒu瑬xXVAp[eBN̏Ԃm肳
+ *
+ * d͂̓[vƂ̃p[^gB[v͈͉̔͂̐擪ɑĂ邽߁A[vƂɂ܂Ƃ߂ČvZł
+ *
+ * @param[in] deltaTime oߎԁitj
+ */
+void XPBDWorld::FinalizeVelocitiesAndPositions(float deltaTime)
+{
+	for (const Rope& rope : m_ropes)
+	{
+		m_particleStore.FinalizeVelocitiesAndPositions(rope.particleBegin, rope.particleNum, rope.parameter.gravity, deltaTime);
+	}
+}
@@ -0,0 +1,214 @@
+/*****************************************************************//**
+ * @file    XPBDWorld.h
+ * @brief   ̃[v܂Ƃ߂ĉXPBD̃[hɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/XPBDSimulator.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintBatch.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleStore/ParticleStore.h"
+#include "Library/MyLib/HandleTable/HandleTable.h"
+
+
+// NX̑O錾 ===================================================
+class RopeObject;
+class ParticleObject;
+
+
+// NX̒` ===============================================================
+/**
+ * @brief ̃[v܂Ƃ߂ĉXPBD̃[h
+ *
+ * SẴ[ṽp[eBNƋL̔zɋl߁A1t[1̏őSẴ[vi߂B
+ * p[eBN͍\̔ziParticleStorejŎA[vIuWFNgւ̔f͎Ă郍[vsB
+ * _E񐔁Ed͂̓[vƂɎB
+ * e[v̌vZ XPBDSimulator ɋ񂾂o^ꍇƓɂȂiTuXebv͎g킸A 1 ƂjB
+ *
+ * Xbh 2 ȏɂƁA𓯂p[eBNLȂgiFjɕA
+ * FƂɕ̃XbhŕɉiF̊ԂőSẴXbh̊҂jB
+ * Ԃς邽ߌʂ͏ɉꍇƈvȂAXbhɂ͈˂ȂB
+ *  DistanceConstraintBatch ɂ܂Ƃ߁Aɉꍇ1{AFƂɉꍇ 4 ܂Ƃ߂ĉ
+ */
+class XPBDWorld
+{
+// ^̐錾
+public:
+	using RopeHandle = MyLib::Handle;
+
+// NX萔̐錾 -------------------------------------------------
+public:
+
+	static constexpr uint32_t	MAX_THREAD_NUM				= 8;	///< ̌vZɎgXbh̍ő吔
+	static constexpr size_t		MIN_PARALLEL_CONSTRAINT_NUM	= 1024;	///< ɉ̍ŏiȂƓׂ̂̕ŏɉj
+	static constexpr uint32_t	MAX_COLOR_NUM				= 64;	///< F̍ő吔
+
+// \̂̐錾
+private:
+
+	/**
+	 * @brief [v
+	 */
+	struct Rope
+	{
+		XPBDSimulator::Parameter parameter;		///< p[^
+		RopeObject*	pRopeObject;				///< [vIuWFNgiʒuōꍇ nullptrj
+		uint32_t	particleBegin;				///< 擪̃p[eBN̈ʒui4 ̔{j
+		uint32_t	particleNum;				///< p[eBN̐
+		uint32_t	constraintBegin;			///< 擪̋̈ʒu
+		uint32_t	constraintNum;				///< ̐
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+	MyLib::HandleTable<Rope>				m_ropes;			///< [vQ
+	ParticleStore							m_particleStore;	///< SẴ[ṽp[eBN
+	std::vector<ParticleObject*>			m_particleObjects;	///< p[eBNƂ̔fi nullptrj
+	DistanceConstraintBatch					m_constraints;		///< SẴ[v̋
+
+	int m_maxIterations;	///< [v̔񐔂̍ől
+
+	// F֘A
+	std::vector<uint32_t>	m_coloredConstraints;	///< F̏ɕׂ̈ʒuiF̒ł͔񐔂̑j
+	std::vector<int>		m_coloredIterations;	///< F̏ɕׂ񂪑郍[v̔
+	std::vector<uint32_t>	m_colorBegins;			///< FƂ̐擪iɑj
+	bool					m_isColorDirty;			///< F蒼ǂ
+
+	// vZ֘A
+	uint32_t					m_threadNum;			///< ̌vZɎgXbhiĂяõXbh܂ށj
+	float						m_solveDeltaTime;		///< ɉԂ̌oߎ
+	std::vector<std::thread>	m_helperThreads;		///< ̌vZ`Xbh
+	std::mutex					m_poolMutex;			///< `XbhƂ̓p
+	std::condition_variable		m_poolCv;				///< d̔zzʒm
+	std::condition_variable		m_poolDoneCv;			///< d̊ʒm
+	uint64_t					m_poolGeneration;		///< zzd̐
+	uint32_t					m_pendingThreadNum;		///< dIĂȂ`Xbh̐
+	bool						m_stopHelpers;			///< `Xbh̒~
+	std::atomic<uint32_t>		m_barrierCount;			///< F̋؂ɓXbh̐
+	std::atomic<uint32_t>		m_barrierGeneration;	///< F̋؂̐
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	XPBDWorld();
+
+	// fXgN^
+	~XPBDWorld();
+
+
+// 
+public:
+	// XV
+	void Update(float deltaTime);
+
+	// V~[V
+	void Simulate(float deltaTime);
+
+	// [v̒ǉi擪̃p[eBNŒ肷j
+	RopeHandle AddRope(const XPBDSimulator::Parameter& parameter, RopeObject* pRopeObject);
+
+	// ʒuw肵[v̒ǉi[vIuWFNgȂpj
+	RopeHandle AddRope(const XPBDSimulator::Parameter& parameter, const std::vector<DirectX::SimpleMath::Vector3>& positions, float particleMass);
+
+	// [v̍폜
+	bool RemoveRope(RopeHandle handle);
+
+	// Sč폜
+	void Clear();
+
+
+// 擾/ݒ
+public:
+	// [ṽp[^̎擾iȃnhȂ nullptrj
+	const XPBDSimulator::Parameter* GetParameter(RopeHandle handle) const;
+
+	// [ṽp[^̐ݒ
+	bool SetParameter(RopeHandle handle, const XPBDSimulator::Parameter& parameter);
+
+	// [ṽp[eBN͈̔͂̎擾
+	bool GetParticleRange(RopeHandle handle, uint32_t* pOutBegin, uint32_t* pOutParticleNum) const;
+
+	// p[eBNQ̎擾
+	ParticleStore* GetParticleStore() { return &m_particleStore; }
+	const ParticleStore* GetParticleStore() const { return &m_particleStore; }
+
+	// [v̐̎擾
+	size_t GetRopeNum() const { return m_ropes.GetSize(); }
+
+	// p[eBNiߑ܂ށj̐̎擾
+	size_t GetParticleNum() const { return m_particleStore.GetSize(); }
+
+	// ̐̎擾
+	size_t GetConstraintNum() const { return m_constraints.GetSize(); }
+
+	// ̌vZɎgXbh̐ݒi1 ŕ񉻂Ȃj
+	void SetThreadNum(uint32_t threadNum);
+	// ̌vZɎgXbh̎擾
+	uint32_t GetThreadNum() const { return m_threadNum; }
+
+	// F̐̎擾iF蒼j
+	uint32_t GetColorNum();
+
+
+// 
+private:
+	// mۂp[eBNq[v̓o^
+	RopeHandle RegisterRope(const XPBDSimulator::Parameter& parameter, RopeObject* pRopeObject, uint32_t particleBegin, uint32_t particleNum);
+
+	// 񐔂̍őlߒ
+	void UpdateMaxIterations();
+
+	// ep[eBN̗\ʒuixijɊÂČvZ
+	void PredictNextPositions(float deltaTime);
+
+	// e[v̐p[^iɁEj
+	void ResetConstraintParameters();
+
+	// e[v̋𔽕񐔕Ap[eBN̗\ʒuixij𒲐
+	void IterateConstraints(float deltaTime);
+
+	// FƂɋɉ
+	void IterateColoredConstraints(float deltaTime);
+
+	// Xbh̒S̋FƂɉ
+	void SolveColoredConstraints(uint32_t threadIndex);
+
+	// p[eBN̔z̎擾
+	DistanceConstraintBatch::ParticleArrays GetParticleArrays();
+
+	// FKvȂ蒼
+	void UpdateConstraintColors();
+
+	// SẴXbhF̋؂ɒ܂ő҂
+	void WaitColorBarrier();
+
+	// `Xbh̐낦
+	void ResizeHelperThreads(uint32_t helperNum);
+
+	// `Xbh̃[v
+	void HelperThreadLoop(uint32_t threadIndex, uint64_t startGeneration);
+
+	// `Xbh̒~
+	void StopHelperThreads();
+
+	// \ʒuƌ݈ʒu瑬xXVAp[eBN̏Ԃm肳
+	void FinalizeVelocitiesAndPositions(float deltaTime);
+};
@@ -0,0 +1,345 @@
+/*****************************************************************//**
+ * @file    BatchCollision.cpp
+ * @brief   ̌`܂Ƃ߂Ĕ肷Փ˔Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "BatchCollision.h"
+
+using namespace DirectX;
+
+
+// ֐̒` =============================================================
+namespace
+{
+	/**
+	 * @brief rʂvfƂ̃rbgɕϊ
+	 *
+	 * @param[in] control rʁivfƂɑSrbg 1  0j
+	 *
+	 * @return vfƂ̃rbg
+	 */
+	inline uint32_t ToMask(FXMVECTOR control)
+	{
+#if defined(_XM_SSE_INTRINSICS_)
+		return static_cast<uint32_t>(_mm_movemask_ps(control));
+#else
+		XMUINT4 bits;
+		XMStoreUInt4(&bits, control);
+		return (bits.x >> 31) | ((bits.y >> 31) << 1) | ((bits.z >> 31) << 2) | ((bits.w >> 31) << 3);
+#endif
+	}
+
+	// \̔z̓ǂݍ
+	inline XMVECTOR Load(const float* pValues)
+	{
+		return XMLoadFloat4A(reinterpret_cast<const XMFLOAT4A*>(pValues));
+	}
+
+	// \̔zւ̏
+	inline void Store(float* pValues, FXMVECTOR value)
+	{
+		XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(pValues), value);
+	}
+
+	/**
+	 * @brief 4  AABB ̍ŋߓ_߂
+	 *
+	 * CalcClosestPointOnAABB ƓƂɍŏ_Eő_͈̔͂֎߂
+	 */
+	inline void CalcClosestPoints(const AABBPack& boxes, FXMVECTOR pointX, FXMVECTOR pointY, FXMVECTOR pointZ,
+		XMVECTOR* pOutX, XMVECTOR* pOutY, XMVECTOR* pOutZ)
+	{
+		*pOutX = XMVectorMax(Load(boxes.minX), XMVectorMin(pointX, Load(boxes.maxX)));
+		*pOutY = XMVectorMax(Load(boxes.minY), XMVectorMin(pointY, Load(boxes.maxY)));
+		*pOutZ = XMVectorMax(Load(boxes.minZ), XMVectorMin(pointZ, Load(boxes.maxZ)));
+	}
+}
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+AABBPack::AABBPack()
+	: minX{}
+	, minY{}
+	, minZ{}
+	, maxX{}
+	, maxY{}
+	, maxZ{}
+	, count{ 0 }
+{
+}
+
+/**
+ * @brief vf̐ݒ
+ *
+ * @param[in] lane vf̔ԍ
+ * @param[in] aabb ݒ肷 AABB
+ */
+void AABBPack::Set(int lane, const AABB& aabb)
+{
+	const SimpleMath::Vector3 center = aabb.GetCenter();
+	const SimpleMath::Vector3 extend = aabb.GetExtend();
+
+	// P̂̔ƓvZōŏ_ƍő_߂
+	const SimpleMath::Vector3 min = center - extend / 2.0f;
+	const SimpleMath::Vector3 max = center + extend / 2.0f;
+
+	minX[lane] = min.x;
+	minY[lane] = min.y;
+	minZ[lane] = min.z;
+	maxX[lane] = max.x;
+	maxY[lane] = max.y;
+	maxZ[lane] = max.z;
+
+	count = std::max(count, lane + 1);
+}
+
+/**
+ * @brief RXgN^
+ */
+SpherePack::SpherePack()
+	: centerX{}
+	, centerY{}
+	, centerZ{}
+	, radius{}
+	, count{ 0 }
+{
+}
+
+/**
+ * @brief vf̐ݒ
+ *
+ * @param[in] lane		vf̔ԍ
+ * @param[in] sphere	ݒ肷鋅
+ */
+void SpherePack::Set(int lane, const Sphere& sphere)
+{
+	const SimpleMath::Vector3 position = sphere.GetPosition();
+
+	centerX[lane]	= position.x;
+	centerY[lane]	= position.y;
+	centerZ[lane]	= position.z;
+	radius[lane]	= sphere.GetRadius();
+
+	count = std::max(count, lane + 1);
+}
+
+
+
+// ֐̒` =================================================================
+/**
+ * @brief  4  AABB ̏Փ˔
+ *
+ * @param[in]  sphere			
+ * @param[in]  boxes			AABB
+ * @param[out] pOutPenetration	ђʂ̐[ AABB ̍ŋߓ_isvȂ nullptrj
+ *
+ * @return  AABB ̃rbg
+ */
+uint32_t BatchCollision::IsHit(const Sphere& sphere, const AABBPack& boxes, BatchPenetration* pOutPenetration)
+{
+	const SimpleMath::Vector3 position = sphere.GetPosition();
+	const float radius = sphere.GetRadius();
+
+	const XMVECTOR pointX = XMVectorReplicate(position.x);
+	const XMVECTOR pointY = XMVectorReplicate(position.y);
+	const XMVECTOR pointZ = XMVectorReplicate(position.z);
+
+	XMVECTOR closestX, closestY, closestZ;
+	CalcClosestPoints(boxes, pointX, pointY, pointZ, &closestX, &closestY, &closestZ);
+
+	// ̒Sƍŋߓ_̋̓
+	const XMVECTOR dx = XMVectorSubtract(pointX, closestX);
+	const XMVECTOR dy = XMVectorSubtract(pointY, closestY);
+	const XMVECTOR dz = XMVectorSubtract(pointZ, closestZ);
+	const XMVECTOR distanceSq = XMVectorAdd(XMVectorAdd(XMVectorMultiply(dx, dx), XMVectorMultiply(dy, dy)), XMVectorMultiply(dz, dz));
+
+	const uint32_t hitMask = ToMask(XMVectorLess(distanceSq, XMVectorReplicate(radius * radius))) & boxes.GetValidMask();
+
+	if (pOutPenetration && hitMask)
+	{
+		Store(pOutPenetration->depth, XMVectorSubtract(XMVectorReplicate(radius), XMVectorSqrt(distanceSq)));
+		Store(pOutPenetration->pointX, closestX);
+		Store(pOutPenetration->pointY, closestY);
+		Store(pOutPenetration->pointZ, closestZ);
+	}
+
+	return hitMask;
+}
+
+/**
+ * @brief AABB  4  AABB ̏Փ˔
+ *
+ * @param[in]  box				AABB
+ * @param[in]  boxes			葊 AABB
+ * @param[out] pOutPenetration	ł󂢎̏dȂ̐[isvȂ nullptrj
+ *
+ * @return  AABB ̃rbg
+ */
+uint32_t BatchCollision::IsHit(const AABB& box, const AABBPack& boxes, BatchPenetration* pOutPenetration)
+{
+	const SimpleMath::Vector3 center = box.GetCenter();
+	const SimpleMath::Vector3 extend = box.GetExtend();
+	const SimpleMath::Vector3 min = center - extend / 2.0f;
+	const SimpleMath::Vector3 max = center + extend / 2.0f;
+
+	const XMVECTOR minX = XMVectorReplicate(min.x), maxX = XMVectorReplicate(max.x);
+	const XMVECTOR minY = XMVectorReplicate(min.y), maxY = XMVectorReplicate(max.y);
+	const XMVECTOR minZ = XMVectorReplicate(min.z), maxZ = XMVectorReplicate(max.z);
+
+	const XMVECTOR boxesMinX = Load(boxes.minX), boxesMaxX = Load(boxes.maxX);
+	const XMVECTOR boxesMinY = Load(boxes.minY), boxesMaxY = Load(boxes.maxY);
+	const XMVECTOR boxesMinZ = Load(boxes.minZ), boxesMaxZ = Load(boxes.maxZ);
+
+	// ǂꂩ̎ŗĂΓĂȂ
+	XMVECTOR separated = XMVectorOrInt(XMVectorLess(maxX, boxesMinX), XMVectorGreater(minX, boxesMaxX));
+	separated = XMVectorOrInt(separated, XMVectorOrInt(XMVectorLess(maxY, boxesMinY), XMVectorGreater(minY, boxesMaxY)));
+	separated = XMVectorOrInt(separated, XMVectorOrInt(XMVectorLess(maxZ, boxesMinZ), XMVectorGreater(minZ, boxesMaxZ)));
+
+	const uint32_t hitMask = ~ToMask(separated) & boxes.GetValidMask();
+
+	if (pOutPenetration && hitMask)
+	{
+		const XMVECTOR overlapX = XMVectorMin(XMVectorSubtract(maxX, boxesMinX), XMVectorSubtract(boxesMaxX, minX));
+		const XMVECTOR overlapY = XMVectorMin(XMVectorSubtract(maxY, boxesMinY), XMVectorSubtract(boxesMaxY, minY));
+		const XMVECTOR overlapZ = XMVectorMin(XMVectorSubtract(maxZ, boxesMinZ), XMVectorSubtract(boxesMaxZ, minZ));
+		Store(pOutPenetration->depth, XMVectorMin(overlapX, XMVectorMin(overlapY, overlapZ)));
+	}
+
+	return hitMask;
+}
+
+/**
+ * @brief JvZ 4  AABB ̏Փ˔
+ *
+ * P̂̔ƓAaL AABB Ǝ̐Xu@Ŕ肷B
+ * ̌͑SĂ̗vfŋʂȂ̂ŁAɕsǂ͗̕vfƂɕȂ
+ *
+ * @param[in] capsule	JvZ
+ * @param[in] boxes		AABB
+ *
+ * @return  AABB ̃rbg
+ */
+uint32_t BatchCollision::IsHit(const Capsule& capsule, const AABBPack& boxes)
+{
+	using namespace SimpleMath;
+
+	const Vector3 p0 = capsule.GetPosition() - capsule.GetAxis() * (capsule.GetLength() * 0.5f);
+	const Vector3 p1 = capsule.GetPosition() + capsule.GetAxis() * (capsule.GetLength() * 0.5f);
+	Vector3 direction = p1 - p0;
+	const float length = direction.Length();
+
+	// ق0̏ꍇ͏Փ˂Ȃ
+	if (length < 1e-6f)
+		return 0;
+
+	direction /= length;
+
+	const XMVECTOR radius = XMVectorReplicate(capsule.GetRadius());
+
+	const float*	pBoxesMin[3]	= { boxes.minX, boxes.minY, boxes.minZ };
+	const float*	pBoxesMax[3]	= { boxes.maxX, boxes.maxY, boxes.maxZ };
+	const float		start[3]		= { p0.x, p0.y, p0.z };
+	const float		delta[3]		= { direction.x, direction.y, direction.z };
+
+	XMVECTOR tmin = XMVectorZero();
+	XMVECTOR tmax = XMVectorReplicate(length);
+	XMVECTOR rejected = XMVectorFalseInt();
+
+	for (int i = 0; i < 3; i++)
+	{
+		const XMVECTOR minValue = XMVectorSubtract(Load(pBoxesMin[i]), radius);
+		const XMVECTOR maxValue = XMVectorAdd(Load(pBoxesMax[i]), radius);
+		const XMVECTOR p0i = XMVectorReplicate(start[i]);
+
+		if (fabs(delta[i]) < 1e-6f)
+		{
+			// ɕs  n_XůOɂvf͓Ȃ
+			rejected = XMVectorOrInt(rejected, XMVectorOrInt(XMVectorLess(p0i, minValue), XMVectorGreater(p0i, maxValue)));
+		}
+		else
+		{
+			const XMVECTOR ood = XMVectorReplicate(1.0f / delta[i]);
+			const XMVECTOR t1 = XMVectorMultiply(XMVectorSubtract(minValue, p0i), ood);
+			const XMVECTOR t2 = XMVectorMultiply(XMVectorSubtract(maxValue, p0i), ood);
+			tmin = XMVectorMax(tmin, XMVectorMin(t1, t2));
+			tmax = XMVectorMin(tmax, XMVectorMax(t1, t2));
+		}
+	}
+
+	// ͈͂A܂͐ɖvf͓Ȃ
+	rejected = XMVectorOrInt(rejected, XMVectorGreater(tmin, tmax));
+	rejected = XMVectorOrInt(rejected, XMVectorLess(tmin, XMVectorZero()));
+	rejected = XMVectorOrInt(rejected, XMVectorGreater(tmin, XMVectorReplicate(length)));
+
+	return ~ToMask(rejected) & boxes.GetValidMask();
+}
+
+/**
+ * @brief AABB  4 ̋̏Փ˔
+ *
+ * @param[in]  box				AABB
+ * @param[in]  spheres			
+ * @param[out] pOutPenetration	ђʂ̐[ AABB ̍ŋߓ_isvȂ nullptrj
+ *
+ * @return ̃rbg
+ */
+uint32_t BatchCollision::IsHit(const AABB& box, const SpherePack& spheres, BatchPenetration* pOutPenetration)
+{
+	const SimpleMath::Vector3 center = box.GetCenter();
+	const SimpleMath::Vector3 extend = box.GetExtend();
+	const SimpleMath::Vector3 min = center - extend / 2.0f;
+	const SimpleMath::Vector3 max = center + extend / 2.0f;
+
+	const XMVECTOR centerX = Load(spheres.centerX);
+	const XMVECTOR centerY = Load(spheres.centerY);
+	const XMVECTOR centerZ = Load(spheres.centerZ);
+	const XMVECTOR radius  = Load(spheres.radius);
+
+	// e̒Sɍł߂ AABB ̓_
+	const XMVECTOR closestX = XMVectorMax(XMVectorReplicate(min.x), XMVectorMin(centerX, XMVectorReplicate(max.x)));
+	const XMVECTOR closestY = XMVectorMax(XMVectorReplicate(min.y), XMVectorMin(centerY, XMVectorReplicate(max.y)));
+	const XMVECTOR closestZ = XMVectorMax(XMVectorReplicate(min.z), XMVectorMin(centerZ, XMVectorReplicate(max.z)));
+
+	const XMVECTOR dx = XMVectorSubtract(centerX, closestX);
+	const XMVECTOR dy = XMVectorSubtract(centerY, closestY);
+	const XMVECTOR dz = XMVectorSubtract(centerZ, closestZ);
+	const XMVECTOR distanceSq = XMVectorAdd(XMVectorAdd(XMVectorMultiply(dx, dx), XMVectorMultiply(dy, dy)), XMVectorMultiply(dz, dz));
+
+	const uint32_t hitMask = ToMask(XMVectorLess(distanceSq, XMVectorMultiply(radius, radius))) & spheres.GetValidMask();
+
+	if (pOutPenetration && hitMask)
+	{
+		Store(pOutPenetration->depth, XMVectorSubtract(radius, XMVectorSqrt(distanceSq)));
+		Store(pOutPenetration->pointX, closestX);
+		Store(pOutPenetration->pointY, closestY);
+		Store(pOutPenetration->pointZ, closestZ);
+	}
+
+	return hitMask;
+}
+
+/**
+ * @brief _ 4  AABB ̍ŋߓ_߂
+ *
+ * @param[in]  boxes				AABB
+ * @param[in]  point				_
+ * @param[out] pOutClosestPoints	ŋߓ_i[͐ݒ肵Ȃj
+ */
+void BatchCollision::CalcClosestPointOnAABB(const AABBPack& boxes, const DirectX::SimpleMath::Vector3& point, BatchPenetration* pOutClosestPoints)
+{
+	XMVECTOR closestX, closestY, closestZ;
+	CalcClosestPoints(boxes, XMVectorReplicate(point.x), XMVectorReplicate(point.y), XMVectorReplicate(point.z), &closestX, &closestY, &closestZ);
+
+	Store(pOutClosestPoints->pointX, closestX);
+	Store(pOutClosestPoints->pointY, closestY);
+	Store(pOutClosestPoints->pointZ, closestZ);
+}
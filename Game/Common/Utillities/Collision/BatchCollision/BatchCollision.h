@@ -0,0 +1,105 @@
+/*****************************************************************//**
+ * @file    BatchCollision.h
+ * @brief   ̌`܂Ƃ߂Ĕ肷Փ˔Ɋւwb_[t@C
+ *
+ * 1̌`ƁA\̔ziSoAjɋl߂ 4 ̌` SIMD œɔ肷
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
+
+#include "Game/Common/Utillities/Collision/Collision.h"
+
+
+// 萔̒` =================================================================
+namespace BatchCollision
+{
+	static constexpr int		LANE_NUM	= 4;							///< 1xɔ肷`̐
+	static constexpr uint32_t	ALL_LANES	= (1u << LANE_NUM) - 1u;		///< SĂ̌`̃rbg
+}
+
+
+// \̂̒` ===============================================================
+/**
+ * @brief 4  AABBi\̔zj
+ *
+ * ŏ_ƍő_ƂɕׂBgȂvf count ŏO
+ */
+struct alignas(16) AABBPack
+{
+	float minX[BatchCollision::LANE_NUM];	///< ŏ_ X
+	float minY[BatchCollision::LANE_NUM];	///< ŏ_ Y
+	float minZ[BatchCollision::LANE_NUM];	///< ŏ_ Z
+	float maxX[BatchCollision::LANE_NUM];	///< ő_ X
+	float maxY[BatchCollision::LANE_NUM];	///< ő_ Y
+	float maxZ[BatchCollision::LANE_NUM];	///< ő_ Z
+	int count;								///< Lȗvf̐
+
+	AABBPack();
+
+	// vf̐ݒiAABB NXƓvZōŏ_Eő_߂j
+	void Set(int lane, const AABB& aabb);
+
+	// Lȗvf̃rbg
+	uint32_t GetValidMask() const { return (1u << count) - 1u; }
+};
+
+/**
+ * @brief 4 ̋i\̔zj
+ */
+struct alignas(16) SpherePack
+{
+	float centerX[BatchCollision::LANE_NUM];	///< S X
+	float centerY[BatchCollision::LANE_NUM];	///< S Y
+	float centerZ[BatchCollision::LANE_NUM];	///< S Z
+	float radius[BatchCollision::LANE_NUM];		///< a
+	int count;									///< Lȗvf̐
+
+	SpherePack();
+
+	// vf̐ݒ
+	void Set(int lane, const Sphere& sphere);
+
+	// Lȗvf̃rbg
+	uint32_t GetValidMask() const { return (1u << count) - 1u; }
+};
+
+/**
+ * @brief ꊇ̊ђʏ
+ *
+ * Ȃvf̒l͕s
+ */
+struct alignas(16) BatchPenetration
+{
+	float depth[BatchCollision::LANE_NUM];		///< ђʂ̐[
+	float pointX[BatchCollision::LANE_NUM];		///< ŋߓ_ Xi AABB ̂݁j
+	float pointY[BatchCollision::LANE_NUM];		///< ŋߓ_ Yi AABB ̂݁j
+	float pointZ[BatchCollision::LANE_NUM];		///< ŋߓ_ Zi AABB ̂݁j
+};
+
+
+// ֐̐錾 =================================================================
+namespace BatchCollision
+{
+	//  4  AABB ̏Փ˔iIsHit(AABB, Sphere) Ɠʁj
+	uint32_t IsHit(const Sphere& sphere, const AABBPack& boxes, BatchPenetration* pOutPenetration = nullptr);
+
+	// AABB  4  AABB ̏Փ˔iIsHit(AABB, AABB) Ɠʁj
+	uint32_t IsHit(const AABB& box, const AABBPack& boxes, BatchPenetration* pOutPenetration = nullptr);
+
+	// JvZ 4  AABB ̏Փ˔iIsHit(Capsule, AABB) Ɠʁj
+	uint32_t IsHit(const Capsule& capsule, const AABBPack& boxes);
+
+	// AABB  4 ̋̏Փ˔iIsHit(AABB, Sphere) Ɠʁj
+	uint32_t IsHit(const AABB& box, const SpherePack& spheres, BatchPenetration* pOutPenetration = nullptr);
+
+	// _ 4  AABB ̍ŋߓ_߂iCalcClosestPointOnAABB Ɠʁj
+	void CalcClosestPointOnAABB(const AABBPack& boxes, const DirectX::SimpleMath::Vector3& point, BatchPenetration* pOutClosestPoints);
+}
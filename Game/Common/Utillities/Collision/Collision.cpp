@@ -1053,8 +1053,8 @@ bool IsHit(const Triangle& triangle, const Segment& segment)
 bool IsHit(const Box2D& box, const Sphere& sphere)
 {
 	return (
-		box.GetTriangle()[0].CheckHit(sphere) || 
-		box.GetTriangle()[1].CheckHit(sphere));
+		box.GetTriangle(0).CheckHit(sphere) || 
+		box.GetTriangle(1).CheckHit(sphere));
 }
 
 /**
@@ -1067,8 +1067,8 @@ bool IsHit(const Box2D& box, const Sphere& sphere)
 bool IsHit(const Box2D& box, const Segment& segment)
 {
 	return (
-		box.GetTriangle()[0].CheckHit(segment) ||
-		box.GetTriangle()[1].CheckHit(segment));
+		box.GetTriangle(0).CheckHit(segment) ||
+		box.GetTriangle(1).CheckHit(segment));
 }
 
 /**
@@ -1944,7 +1944,7 @@ DirectX::SimpleMath::Vector3 CalcOverlap(const Triangle& triangle, const Sphere&
 DirectX::SimpleMath::Vector3 CalcOverlap(const Box2D& box2D, const Sphere& sphere)
 {
 	// Փ˂Op`擾
-	const Triangle* pHitTri = (box2D.GetTriangle()[0].CheckHit(sphere)) ? &box2D.GetTriangle()[0] : &box2D.GetTriangle()[1];
+	const Triangle* pHitTri = (box2D.GetTriangle(0).CheckHit(sphere)) ? &box2D.GetTriangle(0) : &box2D.GetTriangle(1);
 
 	// Op`̐̎擾
 	const auto& triPos = pHitTri->GetPosition();
@@ -2387,6 +2387,109 @@ DirectX::SimpleMath::Vector3 CalcClosestPointOnAABBSurface(const AABB& aabb, con
 	
 }
 
+/**
+ * @brief RC_[ގsE{bNX߂
+ * 
+ * e`̏Փ˔ŎgpĂ͈͂ƓŎZo
+ * 
+ * @param[in]  collider	RC_[
+ * @param[out] pOutMin	ŏ_
+ * @param[out] pOutMax	ő_
+ * 
+ * @returns true  E{bNX߂ꂽ
+ * @returns false EȂ`iʂȂǁj
+ */
+bool CalcBoundingBox(const ICollider& collider, DirectX::SimpleMath::Vector3* pOutMin, DirectX::SimpleMath::Vector3* pOutMax)
+{
+	using namespace SimpleMath;
+
+	if (!pOutMin || !pOutMax) return false;
+
+	// ̓_ރ{bNX߂
+	auto encapsulate = [&](const Vector3* pPoints, size_t count)
+		{
+			*pOutMin = pPoints[0];
+			*pOutMax = pPoints[0];
+			for (size_t i = 1; i < count; i++)
+			{
+				*pOutMin = Vector3::Min(*pOutMin, pPoints[i]);
+				*pOutMax = Vector3::Max(*pOutMax, pPoints[i]);
+			}
+		};
+
+	switch (collider.GetColliderType())
+	{
+	case ColliderType::Sphere:
+	{
+		const Sphere& sphere = static_cast<const Sphere&>(collider);
+		*pOutMin = sphere.GetPosition() - Vector3(sphere.GetRadius());
+		*pOutMax = sphere.GetPosition() + Vector3(sphere.GetRadius());
+		return true;
+	}
+	case ColliderType::AABB:
+	{
+		const AABB& aabb = static_cast<const AABB&>(collider);
+		*pOutMin = aabb.GetCenter() - aabb.GetExtend() / 2.0f;
+		*pOutMax = aabb.GetCenter() + aabb.GetExtend() / 2.0f;
+		return true;
+	}
+	case ColliderType::Segment:
+	{
+		const Segment& segment = static_cast<const Segment&>(collider);
+		const Vector3 points[] = { segment.GetPosition(), segment.GetPosition() + segment.GetVector() };
+		encapsulate(points, 2);
+		return true;
+	}
+	case ColliderType::Capsule:
+	{
+		const Capsule& capsule = static_cast<const Capsule&>(collider);
+		const Vector3 halfAxis = capsule.GetAxis() * (capsule.GetLength() * 0.5f);
+		const Vector3 points[] = { capsule.GetPosition() - halfAxis, capsule.GetPosition() + halfAxis };
+		encapsulate(points, 2);
+		*pOutMin -= Vector3(capsule.GetRadius());
+		*pOutMax += Vector3(capsule.GetRadius());
+		return true;
+	}
+	case ColliderType::Cylinder:
+	{
+		const Cylinder& cylinder = static_cast<const Cylinder&>(collider);
+		const Vector3 halfAxis = cylinder.GetAxis() * (cylinder.GetLength() * 0.5f);
+		const Vector3 points[] = { cylinder.GetPosition() - halfAxis, cylinder.GetPosition() + halfAxis };
+		encapsulate(points, 2);
+		*pOutMin -= Vector3(cylinder.GetRadius());
+		*pOutMax += Vector3(cylinder.GetRadius());
+		return true;
+	}
+	case ColliderType::Triangle:
+	{
+		const Triangle& triangle = static_cast<const Triangle&>(collider);
+		const auto& positions = triangle.GetPosition();
+		if (positions.empty()) return false;
+		encapsulate(positions.data(), positions.size());
+		return true;
+	}
+	case ColliderType::BOX2D:
+	{
+		const Box2D& box = static_cast<const Box2D&>(collider);
+		Vector3 points[Box2D::TRIANGLE_NUM * 3];
+		size_t count = 0;
+		for (int i = 0; i < Box2D::TRIANGLE_NUM; i++)
+		{
+			for (const auto& position : box.GetTriangle(i).GetPosition())
+			{
+				if (count < std::size(points)) points[count++] = position;
+			}
+		}
+		if (count == 0) return false;
+		encapsulate(points, count);
+		return true;
+	}
+	default:
+		// ʂȂǂ̋EȂ`
+		return false;
+	}
+}
+
 /**
  * @brief RXgN^@_w
  * 
@@ -2494,6 +2597,18 @@ const std::array<Triangle, Box2D::TRIANGLE_NUM> Box2D::GetTriangle() const
 	return { m_triangles[0], m_triangles[1] };
 }
 
+/**
+ * @brief Op`̎QƂ̎擾
+ * 
+ * @param[in] index Op`̔ԍi0 : ABC, 1 : CDAj
+ * 
+ * @return Op`
+ */
+const Triangle& Box2D::GetTriangle(int index) const
+{
+	return m_triangles[index];
+}
+
 /**
  * @brief ʏ̎擾
  * 
@@ -323,6 +323,8 @@ public:
 
 	// Op`̎擾
 	const std::array<Triangle, TRIANGLE_NUM> GetTriangle() const;
+	// Op`̎QƂ̎擾iȂj
+	const Triangle& GetTriangle(int index) const;
 
 	// ʏ̎擾
 	const Plane& GetPlane() const;
@@ -663,5 +665,10 @@ DirectX::SimpleMath::Vector3 CalcClosestPointOnSegment(const DirectX::SimpleMath
 DirectX::SimpleMath::Vector3 CalcClosestPointOnAABB(const AABB& aabb, const DirectX::SimpleMath::Vector3& point);
 DirectX::SimpleMath::Vector3 CalcClosestPointOnAABBSurface(const AABB& aabb, const DirectX::SimpleMath::Vector3& point);
 
+// **** E{bNX *****
+
+// RC_[ގsE{bNX߂
+bool CalcBoundingBox(const ICollider& collider, DirectX::SimpleMath::Vector3* pOutMin, DirectX::SimpleMath::Vector3* pOutMax);
+
 
 
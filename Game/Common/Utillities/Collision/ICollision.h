@@ -40,6 +40,13 @@ public:
 	// Փˏ
 	virtual  void OnCollision(const CollisionInfo& info)  = 0;
 
+	// ڐG̊Jn
+	virtual void OnCollisionEnter(const CollisionInfo& info) = 0;
+	// ڐǦp
+	virtual void OnCollisionStay(const CollisionInfo& info) = 0;
+	// ڐG̏I
+	virtual void OnCollisionExit(const CollisionInfo& info) = 0;
+
 	// Փ˔钼Oɍs
 	virtual void PreCollision() = 0;
 
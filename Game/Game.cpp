@@ -23,6 +23,7 @@
 
 // t[[N֘A
 #include "Game/Common/Framework/SoundManager/SoundManager.h"
+#include "Game/Common/Framework/Event/Messenger/ThreadEventMessenger/ThreadEventMessenger.h"
 
 // OtBbN֘A
 #include "Game/Common/Graphics/GameEffect/GameEffectController.h"
@@ -134,6 +135,17 @@ void Game::Initialize(HWND window, int width, int height)
    // ****  ****
     m_collisionManager = std::make_unique<CollisionManager>();
 
+   // ̃Xbh̃Cxg̑̐i[hpXbhɃCXbhōj
+   ThreadEventMessenger::GetInstance()->AddListener(this,
+       [](Game* self, const ThreadEventData& data)
+       {
+           UNREFERENCED_PARAMETER(self);
+           if (data.id == ThreadEventID::SCENE_LOADED)
+           {
+               OutputDebugString(L"Scene loaded : %.1f ms\n", data.value);
+           }
+       });
+
    // V[̐
    m_sceneManager = std::make_unique<MyLib::SceneManager<CommonResources>>();
 
@@ -230,6 +242,9 @@ void Game::Update(DX::StepTimer const& timer)
 {
     float deltaTime = float(timer.GetElapsedSeconds());
 
+    // ̃Xbh͂Cxg̓Kpit[̍ŏɂ܂Ƃ߂ē͂j
+    ThreadEventMessenger::GetInstance()->Dispatch();
+
     // ՓˊǗ̍XV
     m_collisionManager->UpdateTask(deltaTime);
 
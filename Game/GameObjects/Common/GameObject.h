@@ -17,7 +17,6 @@
 #include <unordered_map>
 
 // t[[N֘A
-#include "Game/Common/Framework/EventSystem/EventSystem.h"
 #include "Game/Common/Framework/TaskManager/TaskManager.h"
 
 // [eBeB֘A
@@ -93,7 +92,7 @@ public:
 private:
 
 	const CommonResources*				m_pCommonResources;			///< ʃ\[X
-	EventSystem<GameObjectEventType>	m_gameObjectEventSystem;	///< CxgVXe
+	GameObjectEventChannels				m_gameObjectEvents;			///< Cxg`l
 
 	std::unordered_map<std::type_index, void*>  m_childs;
 
@@ -136,6 +135,13 @@ public:
 	// Փˏ
 	void OnCollision(const CollisionInfo& info) override { UNREFERENCED_PARAMETER(info); }
 
+	// ڐG̊Jn
+	void OnCollisionEnter(const CollisionInfo& info) override { UNREFERENCED_PARAMETER(info); }
+	// ڐǦp
+	void OnCollisionStay(const CollisionInfo& info) override { UNREFERENCED_PARAMETER(info); }
+	// ڐG̏I
+	void OnCollisionExit(const CollisionInfo& info) override { UNREFERENCED_PARAMETER(info); }
+
 
 // 擾/ݒ
 public:
@@ -163,53 +169,53 @@ private:
 public:
 
 
-	// CxgID̃ftHgDxݒ肷
-	void SetEventDefaultPriority(GameObjectEventType id, int priority)
-	{
-		m_gameObjectEventSystem.SetEventDefaultPriority(id, priority);
-	}
-	// Xi[o^: CxgIDƁAΉEventData^AR[obN󂯎
-	template<typename TEventData, typename Func>
-	void AddEventListener(GameObjectEventType id, Func callback, int listenerPriority = 0) // Xi[Dx
+	// Xi[o^: 󂯎Cxgf[^̌^ƂɁAĂяoƌĂяo֐iLv`Ȃ_j󂯎
+	template<typename TEventData, typename TContext>
+	void AddEventListener(TContext* context, std::type_identity_t<void (*)(TContext*, const TEventData&)> function, int listenerPriority = 0) // Xi[Dx
 	{
-		m_gameObjectEventSystem.AddListener < TEventData, Func>(id, callback, listenerPriority);
+		m_gameObjectEvents.Get<TEventData>().AddListener(context, function, listenerPriority);
 	}
-	// ̃CxgIDɓo^ꂽSẴXi[폜
-	void RemoveEventListener(GameObjectEventType id)
+	// ̃Cxgf[^̌^ɓo^ꂽSẴXi[폜
+	template<typename TEventData>
+	void RemoveEventListener()
 	{
-		m_gameObjectEventSystem.RemoveListener(id);
+		m_gameObjectEvents.Get<TEventData>().RemoveAllListeners();
 	}
-	// SẴCxgIDɓo^ꂽXi[Sč폜
+	// SẴCxgf[^̌^ɓo^ꂽXi[Sč폜
 	void RemoveAllEventListener()
 	{
-		m_gameObjectEventSystem.RemoveAllListeners();
+		m_gameObjectEvents.RemoveAllListeners();
 	}
 
-	// CxgL[w肳ꂽCxgID̃CxgSč폜i͂Ȃj
-	void RemoveQueuedEvents(GameObjectEventType id)
+	// w肳ꂽCxgf[^̌^̔΍ς݂̃CxgSč폜i͂Ȃj
+	template<typename TEventData>
+	void RemoveQueuedEvents()
 	{
-		m_gameObjectEventSystem.RemoveQueuedEvents(id);
+		m_gameObjectEvents.Get<TEventData>().ClearQueue();
 	}
-	// CxgL[̃CxgSč폜i͂Ȃj
+	// ΍ς݂̃CxgSč폜i͂Ȃj
 	void RemoveAllQueuedEvents()
 	{
-		m_gameObjectEventSystem.RemoveAllQueueEvents();
+		m_gameObjectEvents.ClearQueues();
 	}
 
-	void FireEvent(GameObjectEventType id, std::unique_ptr<EventData> data)
+	// Cxg̔΁iCxgf[^̌^Ń`l܂j
+	template<typename TEventData>
+	void FireEvent(const TEventData& data)
 	{
-		m_gameObjectEventSystem.FireEvent(id, std::move(data));
+		m_gameObjectEvents.Get<TEventData>().Fire(data);
 	}
 
 	// Cxg܂Ƃ߂Ďs
 	void ApplyEvents()
 	{
-		m_gameObjectEventSystem.ApplyEvents();
+		m_gameObjectEvents.ApplyAll();
 	}
 	// Cxg̕s
-	void ApplyEvent(GameObjectEventType id)
+	template<typename TEventData>
+	void ApplyEvent()
 	{
-		m_gameObjectEventSystem.ApplyEvent(id);
+		m_gameObjectEvents.Get<TEventData>().Apply();
 	}
 
 
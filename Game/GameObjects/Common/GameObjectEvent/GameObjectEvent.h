@@ -13,21 +13,17 @@
 
 
 // wb_t@C̓ǂݍ ===================================================
-#include "Game/Common/Framework/EventSystem/EventData/EventData.h"
+#include "Game/Common/Framework/EventSystem/EventChannel/EventChannel.h"
 
 // NX̑O錾 ===================================================
 class GameObject;
 class ICollider;
 
-// 񋓌^̒` ===============================================================
-enum class GameObjectEventType 
-{
-	THROW_HIT, // ďՓ˂
-	CAUGHT	,  // ߂܂
-};
-
+// \̂̒` ===============================================================
+/**
+ * @brief Փ˂Ƃ̃Cxgf[^
+ */
 struct CollisionEventData 
-	: public EventData
 {
 	GameObject* pHitGameObject;
 	ICollider* pHitCollider;
@@ -39,10 +35,13 @@ struct CollisionEventData
 	}
 };	
 
+// ďՓ˂
 using ThrowHitEventData = CollisionEventData;
 
+/**
+ * @brief ߂܂Ƃ̃Cxgf[^
+ */
 struct CaughtEventData
-	: public EventData
 {
 	GameObject* captorObject;
 
@@ -50,4 +49,17 @@ struct CaughtEventData
 		: captorObject {captorObject}
 	{
 	}
-};
\ No newline at end of file
+};
+
+
+
+// ^̒` ===================================================================
+/**
+ * @brief Q[IuWFNg̃Cxg`l
+ *
+ * Cxgf[^̌^Cxg̎ނ\B܂Ƃ߂ēKpꍇׂ͕ɓKp
+ */
+using GameObjectEventChannels = EventChannelSet<
+	ThrowHitEventData,	// ďՓ˂
+	CaughtEventData		// ߂܂
+>;
@@ -101,10 +101,11 @@ void Enemy::Initialize(const CommonResources* pCommonResources, CollisionManager
 	m_deltaTime = 0.0f;
 
 	// Cxg̒ǉ
-	AddEventListener<ThrowHitEventData>(GameObjectEventType::THROW_HIT,
-		[this](const ThrowHitEventData data)
+	AddEventListener<ThrowHitEventData>(this,
+		[](Enemy* self, const ThrowHitEventData& data)
 		{
-			m_isActive = false;
+			UNREFERENCED_PARAMETER(data);
+			self->m_isActive = false;
 			ResultData::GetInstance()->UpperDestroyedNum();
 		}
 	);
@@ -160,8 +161,23 @@ void Enemy::Update(float deltaTime)
 
 	SetVelocity(velocity);
 
-	SimpleMath::Vector3 position = MovementHelper::CalcPositionForVelocity(deltaTime, GetTransform()->GetPosition(), GetVelocity());
-	GetTransform()->SetPosition(position );
+	if (m_isThrow)
+	{
+		// ĂԂ͑߁AǁAʂ蔲Ȃ悤ɓ
+		// iǂ͏Փˌm\ɖ߁A|Ŏ~߂j
+		m_collider->Transform(GetTransform()->GetPosition() + SimpleMath::Vector3(0.0f, 0.5f, 0.0f));
+
+		const QueryFilter filter(static_cast<uint32_t>(GameObjectTag::BUILDING | GameObjectTag::WALL | GameObjectTag::FLOOR), this);
+		SimpleMath::Vector3 position = GetTransform()->GetPosition() + GetCommonResources()->GetCollisionManager()->CalcContinuousMove(*m_collider, GetVelocity() * deltaTime, filter, &velocity);
+
+		SetVelocity(velocity);
+		GetTransform()->SetPosition(position);
+	}
+	else
+	{
+		SimpleMath::Vector3 position = MovementHelper::CalcPositionForVelocity(deltaTime, GetTransform()->GetPosition(), GetVelocity());
+		GetTransform()->SetPosition(position );
+	}
 	m_collider->Transform(GetTransform()->GetPosition() + SimpleMath::Vector3(0.0f, 0.5f, 0.0f));
 
 	GetTransform()->SetRotation(MovementHelper::RotateForMoveDirection(deltaTime, GetTransform()->GetRotation(), GetTransform()->GetForward(), GetVelocity(), 0.1f));
@@ -226,12 +242,12 @@ void Enemy::OnCollision(const CollisionInfo& info)
 
 	if (m_isThrow && info.pOtherObject->GetTag() == GameObjectTag::ENEMY)
 	{
-		info.pOtherObject->FireEvent(GameObjectEventType::THROW_HIT, std::make_unique<ThrowHitEventData>(this, m_collider.get()));
+		info.pOtherObject->FireEvent(ThrowHitEventData(this, m_collider.get()));
 	}
 
 	if (!m_isThrow && !m_isHold && info.pOtherObject->GetTag() == GameObjectTag::PLAYER)
 	{
-		info.pOtherObject->FireEvent(GameObjectEventType::CAUGHT, std::make_unique<CaughtEventData>(this));
+		info.pOtherObject->FireEvent(CaughtEventData(this));
 	}
 
 	if (info.pOtherObject->GetTag() == GameObjectTag::BUILDING || info.pOtherObject->GetTag() == GameObjectTag::FLOOR)
@@ -173,12 +173,13 @@ void Player::Initialize(const CommonResources* pCommonResources, CollisionManage
 	m_isActive = true;
 
 	// ߂炦̃Cxg̒ǉ
-	AddEventListener<CaughtEventData>(GameObjectEventType::CAUGHT,
-		[this](const CaughtEventData data)
+	AddEventListener<CaughtEventData>(this,
+		[](Player* self, const CaughtEventData& data)
 		{
-			if (IsActive())
+			UNREFERENCED_PARAMETER(data);
+			if (self->IsActive())
 			{
-				m_isActive = false;
+				self->m_isActive = false;
 				GameFlowMessenger::GetInstance()->Notify(GameFlowEventID::PLAYER_DIE);
 
 			}
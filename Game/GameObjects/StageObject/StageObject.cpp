@@ -226,6 +226,33 @@ void StageObject::Move(const float& deltaTime)
 	m_collider->Transform(position);
 }
 
+/**
+ * @brief AIȏՓ˔gړ̓Kp
+ *
+ * ړÖʒu珰EǁEɌċ|AʒuŎ~߂ĖʂɉĊ点B
+ * o▀C͒ʏǂ OnCollision ōsi͏Փˌm\ɖ߁A|Ŏ~߂j
+ *
+ * @param[in] deltaTime@oߎ
+ */
+void StageObject::MoveContinuous(const float& deltaTime)
+{
+	// ͂܂ĂԂ͍W߁AړÕRC_킹Ă
+	SimpleMath::Vector3 position = GetTransform()->GetPosition();
+	m_collider->Transform(position);
+
+	// **** W̍XV ****
+	const QueryFilter filter(static_cast<uint32_t>(GameObjectTag::FLOOR | GameObjectTag::WALL | GameObjectTag::BUILDING), this);
+
+	SimpleMath::Vector3 velocity = GetVelocity();
+	position += GetCommonResources()->GetCollisionManager()->CalcContinuousMove(*m_collider, velocity * deltaTime, filter, &velocity);
+
+	SetVelocity(velocity);
+	GetTransform()->SetPosition(position);
+
+	// RC_̍XV
+	m_collider->Transform(position);
+}
+
 /**
  * @brief ͂ޒʒm󂯂Ƃ̏
  *
@@ -321,7 +348,7 @@ void StageObject::OnCollision(const CollisionInfo& info)
 	if (info.pOtherObject->GetTag() == GameObjectTag::STAGE_OBJECT)
 	{
 	
-			info.pOtherObject->FireEvent(GameObjectEventType::THROW_HIT, std::make_unique<ThrowHitEventData>(this, m_collider.get()));
+			info.pOtherObject->FireEvent(ThrowHitEventData(this, m_collider.get()));
 		
 	}
 }
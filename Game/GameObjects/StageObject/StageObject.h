@@ -90,6 +90,8 @@ public:
 	void ApplyGravity(const float& deltaTime);
 	// ړ̓Kp
 	void Move(const float& deltaTime);
+	// AIȏՓ˔gړ̓Kpiđɕǂ⏰ʂ蔲Ȃ悤ɂj
+	void MoveContinuous(const float& deltaTime);
 
 
 	//  C[ɒ͂܂ꂽƂ̋
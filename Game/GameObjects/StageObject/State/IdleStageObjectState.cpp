@@ -41,10 +41,11 @@ void IdleStageObjectState::OnStartState()
 {
 
 	// Cxg̒ǉ
-	GetOwner()->AddEventListener<ThrowHitEventData>(GameObjectEventType::THROW_HIT, 
-		[this](const ThrowHitEventData data) 
-								{
-			GetOwner()->SetActive(false); 
+	GetOwner()->AddEventListener<ThrowHitEventData>(this, 
+		[](IdleStageObjectState* self, const ThrowHitEventData& data) 
+		{
+			UNREFERENCED_PARAMETER(data);
+			self->GetOwner()->SetActive(false); 
 		}
 	);
 }
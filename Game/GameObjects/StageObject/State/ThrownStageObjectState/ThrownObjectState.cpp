@@ -51,7 +51,9 @@ ThrownStageObjectState::~ThrownStageObjectState()
 void ThrownStageObjectState::OnUpdate(float deltaTime)
 {
 	GetOwner()->ApplyPhysic(deltaTime);
-	GetOwner()->Move(deltaTime);
+
+	// ĂԂ͑߁Aǂʂ蔲Ȃ悤ɓ
+	GetOwner()->MoveContinuous(deltaTime);
 
 	SimpleMath::Vector3 velocity = GetOwner()->GetVelocity();
 
@@ -55,6 +55,7 @@ Wire::Wire()
 	, m_length {}
 	, m_wireSpeed{ 0.f }
 	, m_isExtending{ false }
+	, m_colliderHandle{}
 {
 
 }
@@ -118,8 +119,8 @@ void Wire::Initialize(
 	m_simulator->AddConstraint(std::make_unique<SteeringConstraintFactory>(GetCommonResources()));
 	// 
 	m_simulator->AddConstraint(std::make_unique<DistanceConstraintFactory>());
-	// Փː
-	m_simulator->AddConstraint(std::make_unique<CollisionConstraintFactory>(m_pCollisionManager));
+	// Փːi蔲Ȃ悤ɑSẴp[eBNŒׂj
+	m_simulator->AddConstraint(std::make_unique<CollisionConstraintFactory>(m_pCollisionManager, CollisionConstraintFactory::Mode::WHOLE_ROPE));
 
 
 	// ̐ݒ
@@ -298,7 +299,9 @@ void Wire::ShootWire(const DirectX::SimpleMath::Vector3& origin, const DirectX::
 
 	m_collider->Set(origin, origin, true);
 
-	m_pCollisionManager->AddCollisionData(CollisionData(this, m_collider.get(), false));
+	// ˂̓xɓo^iO̓o^͊Oj
+	m_pCollisionManager->RemoveCollisionData(m_colliderHandle);
+	m_colliderHandle = m_pCollisionManager->AddCollisionData(CollisionData(this, m_collider.get(), false));
 
 	m_particleObjects.emplace_back(std::make_unique<ParticleObject>());
 	m_particleObjects.back()->SetPosition(origin);
@@ -332,7 +335,9 @@ void Wire::ShootWireToTarget(const DirectX::SimpleMath::Vector3& origin, const D
 
 	m_collider->Set(origin, origin, true);
 
-	m_pCollisionManager->AddCollisionData(CollisionData(this, m_collider.get(), false));
+	// ˂̓xɓo^iO̓o^͊Oj
+	m_pCollisionManager->RemoveCollisionData(m_colliderHandle);
+	m_colliderHandle = m_pCollisionManager->AddCollisionData(CollisionData(this, m_collider.get(), false));
 
 	m_particleObjects.emplace_back(std::make_unique<ParticleObject>());
 	m_particleObjects.back()->SetPosition(origin);
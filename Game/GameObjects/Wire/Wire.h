@@ -23,6 +23,7 @@
 
 // c[
 #include "Library/MyLib/Ray/Ray.h"	// C
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionTypes/CollisionTypes.h"	// Փ˃f[^̃nh
 
 // NX̑O錾 ===================================================
 class WireSystemSubject;	// C[IuU[o[̊ώ@Ώ
@@ -72,6 +73,7 @@ private:
 	
 	// i
 	std::unique_ptr<Segment>	m_collider;		///< RC_
+	CollisionHandle			m_colliderHandle;	///< RC_̓o^nh
 	MyLib::Ray			m_extentionRay;			///< Lт
 	float				m_length;				///< 
 	XPBDSimulator::Parameter m_simulationParam;
@@ -14,6 +14,7 @@
 #include "Keyboard.h"
 #endif
 
+#include <chrono>
 #include <mutex>
 #include <thread>
 
@@ -22,6 +23,8 @@
 #include <sstream>
 #include <typeinfo>
 
+#include "Game/Common/Framework/Event/Messenger/ThreadEventMessenger/ThreadEventMessenger.h"
+
 
 namespace MyLib
 {
@@ -367,6 +370,8 @@ namespace MyLib
 
 
 
+				const auto loadStart = std::chrono::high_resolution_clock::now();
+
 				DeleteScene();
 				m_nextScene = sceneFactory();
 
@@ -377,6 +382,10 @@ namespace MyLib
 				m_nextScene->Initialize();
 				newStateName = "complete";
 				OutputDebugString(L"%ls\n", std::wstring(newStateName.begin(), newStateName.end()).c_str());
+
+				// ǂݍ݂ɂԂCXbhɑ
+				const float loadMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - loadStart).count();
+				ThreadEventMessenger::GetInstance()->Post(ThreadEventData{ ThreadEventID::SCENE_LOADED, 0, loadMilliseconds });
 				m_loadingMutex.lock();
 				m_isLoading = false;
 				m_loadingMutex.unlock();
@@ -0,0 +1,245 @@
+/*****************************************************************//**
+ * @file    HandleTable.h
+ * @brief   tnh\̃wb_[t@Ci색Cuj
+ *
+ * vf͌Ԃ̖zɋl߁A폜͖̗vfƂ̓ւōsB
+ * ǉE폜EQƂׂ͂Ē萔ԂŁA폜ς݂̗vfwnh͐̈ႢŌoł
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace MyLib
+{
+	/**
+	 * @brief tnh
+	 *
+	 * ʃrbgɔԍAʃrbgɐl߂B
+	 * t̎ʔԍƂĂ悤 31 rbgɎ߂
+	 */
+	struct Handle
+	{
+		static constexpr uint32_t INDEX_BITS		= 20;								///< ԍ̃rbg
+		static constexpr uint32_t INDEX_MASK		= (1u << INDEX_BITS) - 1u;			///< ԍ̃}XN
+		static constexpr uint32_t MAX_INDEX			= INDEX_MASK;						///< ԍ̍ől
+		static constexpr uint32_t MAX_GENERATION	= (1u << (31 - INDEX_BITS)) - 1u;	///< ̍ől
+
+		uint32_t value;	///< ԍƐl߂li0 ͖j
+
+		Handle()
+			: value{ 0 }
+		{
+		}
+
+		explicit Handle(uint32_t value)
+			: value{ value }
+		{
+		}
+
+		Handle(uint32_t index, uint32_t generation)
+			: value{ (generation << INDEX_BITS) | index }
+		{
+		}
+
+		// ԍ̎擾
+		uint32_t GetIndex() const { return value & INDEX_MASK; }
+		// ̎擾
+		uint32_t GetGeneration() const { return value >> INDEX_BITS; }
+
+		// ȃnhǂ
+		bool IsNull() const { return value == 0; }
+
+		bool operator==(const Handle& other) const { return value == other.value; }
+		bool operator!=(const Handle& other) const { return value != other.value; }
+	};
+
+	/**
+	 * @brief tnh\
+	 *
+	 * vf̕т͍폜̓xɕς邽߁AяɈӖȂƁB
+	 * vfւ̎QƁE|C^͒ǉƍ폜ŖɂȂ
+	 */
+	template <typename T>
+	class HandleTable
+	{
+	private:
+
+		/**
+		 * @brief nh̔ԍwg
+		 */
+		struct Slot
+		{
+			uint32_t denseIndex;	///< vf̈ʒu
+			uint32_t generation;	///< ݂̐i폜̓xɐi߂j
+			bool	 isUsed;		///< gpǂ
+		};
+
+	private:
+		std::vector<T>			m_values;		///< vfiԖׂj
+		std::vector<uint32_t>	m_valueSlots;	///< vfƂ̘g̔ԍ
+		std::vector<Slot>		m_slots;		///< g
+		std::vector<uint32_t>	m_freeSlots;	///< ėpłg̔ԍ
+
+	public:
+		HandleTable()
+		{
+		}
+
+	public:
+		/**
+		 * @brief ǉ
+		 *
+		 * @param[in] value ǉvf
+		 *
+		 * @return vf̃nhigg؂͖ȃnhj
+		 */
+		Handle Add(T value)
+		{
+			uint32_t slotIndex;
+			if (!m_freeSlots.empty())
+			{
+				slotIndex = m_freeSlots.back();
+				m_freeSlots.pop_back();
+			}
+			else
+			{
+				// l 0iȃnhjɂȂȂ悤A 1 n߂
+				if (m_slots.size() > Handle::MAX_INDEX) return Handle();
+
+				slotIndex = static_cast<uint32_t>(m_slots.size());
+				m_slots.push_back({ 0, 1, false });
+			}
+
+			Slot& slot = m_slots[slotIndex];
+			slot.denseIndex = static_cast<uint32_t>(m_values.size());
+			slot.isUsed		= true;
+
+			m_values.push_back(std::move(value));
+			m_valueSlots.push_back(slotIndex);
+
+			return Handle(slotIndex, slot.generation);
+		}
+
+		/**
+		 * @brief 폜
+		 *
+		 * ̗vf󂢂ʒuֈڂ
+		 *
+		 * @param[in] handle 폜vf̃nh
+		 *
+		 * @returns true  폜
+		 * @returns false ȃnhi폜ς݂܂ށj
+		 */
+		bool Remove(Handle handle)
+		{
+			if (!IsValid(handle)) return false;
+
+			const uint32_t slotIndex = handle.GetIndex();
+			const uint32_t denseIndex = m_slots[slotIndex].denseIndex;
+			const uint32_t lastIndex = static_cast<uint32_t>(m_values.size() - 1);
+
+			if (denseIndex != lastIndex)
+			{
+				m_values[denseIndex] = std::move(m_values[lastIndex]);
+				m_valueSlots[denseIndex] = m_valueSlots[lastIndex];
+				m_slots[m_valueSlots[denseIndex]].denseIndex = denseIndex;
+			}
+			m_values.pop_back();
+			m_valueSlots.pop_back();
+
+			ReleaseSlot(slotIndex);
+
+			return true;
+		}
+
+		/**
+		 * @brief Sč폜
+		 *
+		 * sς݂̃nh͑SĖɂȂ
+		 */
+		void Clear()
+		{
+			for (uint32_t slotIndex : m_valueSlots)
+			{
+				ReleaseSlot(slotIndex);
+			}
+			m_values.clear();
+			m_valueSlots.clear();
+		}
+
+		/**
+		 * @brief eʂ̗\
+		 *
+		 * @param[in] capacity vf
+		 */
+		void Reserve(size_t capacity)
+		{
+			m_values.reserve(capacity);
+			m_valueSlots.reserve(capacity);
+			m_slots.reserve(capacity);
+		}
+
+		/**
+		 * @brief nhLȗvfwĂ邩ǂ
+		 */
+		bool IsValid(Handle handle) const
+		{
+			const uint32_t slotIndex = handle.GetIndex();
+			if (slotIndex >= m_slots.size()) return false;
+
+			const Slot& slot = m_slots[slotIndex];
+			return slot.isUsed && slot.generation == handle.GetGeneration();
+		}
+
+		// vf̎擾iȃnhȂ nullptrj
+		T* Get(Handle handle) { return IsValid(handle) ? &m_values[m_slots[handle.GetIndex()].denseIndex] : nullptr; }
+		const T* Get(Handle handle) const { return IsValid(handle) ? &m_values[m_slots[handle.GetIndex()].denseIndex] : nullptr; }
+
+		// vf̎擾
+		size_t GetSize() const { return m_values.size(); }
+		// 󂩂ǂ
+		bool IsEmpty() const { return m_values.empty(); }
+
+		// ʒuw肵vf̎擾
+		T& GetAt(size_t denseIndex) { return m_values[denseIndex]; }
+		const T& GetAt(size_t denseIndex) const { return m_values[denseIndex]; }
+		// ʒuw肵vf̃nh̎擾
+		Handle GetHandleAt(size_t denseIndex) const
+		{
+			const uint32_t slotIndex = m_valueSlots[denseIndex];
+			return Handle(slotIndex, m_slots[slotIndex].generation);
+		}
+
+		// ͈ for p
+		typename std::vector<T>::iterator begin() { return m_values.begin(); }
+		typename std::vector<T>::iterator end() { return m_values.end(); }
+		typename std::vector<T>::const_iterator begin() const { return m_values.begin(); }
+		typename std::vector<T>::const_iterator end() const { return m_values.end(); }
+
+	private:
+		/**
+		 * @brief g󂯂
+		 *
+		 * i߂ČÂnh𖳌ɂBg؂g͍ėpȂ
+		 *
+		 * @param[in] slotIndex g̔ԍ
+		 */
+		void ReleaseSlot(uint32_t slotIndex)
+		{
+			Slot& slot = m_slots[slotIndex];
+			slot.isUsed = false;
+
+			if (slot.generation < Handle::MAX_GENERATION)
+			{
+				slot.generation++;
+				m_freeSlots.push_back(slotIndex);
+			}
+		}
+	};
+}
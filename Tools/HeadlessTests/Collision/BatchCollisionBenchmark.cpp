@@ -0,0 +1,144 @@
+/*****************************************************************//**
+ * @file    BatchCollisionBenchmark.cpp
+ * @brief   ꊇՓ˔̌vɊւ\[Xt@C
+ *
+ * _ AABB  4 l߁AEAABBEJvZƂ̔P̂̔ƈꊇōsA
+ * ʂv邱Ƃm߂1b̔萔v
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Utillities/Collision/BatchCollision/BatchCollision.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	TEST_NUM	= 4000000;	///< `󂲂Ƃ̔̉
+	constexpr int		BOX_NUM		= 1024;		///< 葊 AABB ̐
+	constexpr uint32_t	SEED		= 0;		///< ̎
+}
+
+
+
+/**
+ * @brief ꊇP̂̔ƔׁAʂv邱Ƃm߂ĎԂv
+ *
+ * @returns true  SĂ̔Ōʂv
+ * @returns false ʂHႤ肪
+ */
+bool RunBatchCollisionBenchmark()
+{
+	using namespace DirectX::SimpleMath;
+	using namespace BatchCollision;
+
+	std::mt19937 random(SEED);
+	auto randomValue = [&](float min, float max) { return std::uniform_real_distribution<float>(min, max)(random); };
+	auto randomPoint = [&]() { return Vector3(randomValue(-10.0f, 10.0f), randomValue(-10.0f, 10.0f), randomValue(-10.0f, 10.0f)); };
+
+	// 葊 AABB
+	std::vector<AABB> boxes;
+	boxes.reserve(BOX_NUM);
+	for (int i = 0; i < BOX_NUM; i++)
+	{
+		boxes.emplace_back(randomPoint(), Vector3(randomValue(0.5f, 4.0f), randomValue(0.5f, 4.0f), randomValue(0.5f, 4.0f)));
+	}
+
+	std::vector<AABBPack> packs(BOX_NUM / LANE_NUM);
+	for (int i = 0; i < BOX_NUM; i++)
+	{
+		packs[i / LANE_NUM].Set(i % LANE_NUM, boxes[i]);
+	}
+
+	// 肷`iSĂ AABB Ɣ肷̂ŁA`͔̐񐔂 AABB ̐Ŋ́j
+	const uint32_t queryNum = std::max(1u, TEST_NUM / BOX_NUM);
+	std::vector<Sphere>		spheres;
+	std::vector<AABB>		queryBoxes;
+	std::vector<Capsule>	capsules;
+	for (uint32_t i = 0; i < queryNum; i++)
+	{
+		spheres.emplace_back(randomPoint(), randomValue(0.5f, 3.0f));
+		queryBoxes.emplace_back(randomPoint(), Vector3(randomValue(0.5f, 4.0f), randomValue(0.5f, 4.0f), randomValue(0.5f, 4.0f)));
+
+		// ͎ɕsȌŁAsȏꍇ̕m߂
+		Vector3 axis = (i % 2 == 0) ? Vector3::Up : randomPoint();
+		axis.Normalize();
+		capsules.emplace_back(axis, randomValue(0.5f, 4.0f), randomPoint(), randomValue(0.2f, 1.5f));
+	}
+
+	auto measure = [&](const char* name, auto scalarTest, auto batchTest)
+		{
+			const uint64_t totalTestNum = static_cast<uint64_t>(queryNum) * BOX_NUM;
+
+			// P̂̔
+			std::vector<uint32_t> scalarMasks(queryNum * packs.size());
+			const double scalarMs = MeasureMilliseconds([&]()
+				{
+					for (uint32_t q = 0; q < queryNum; q++)
+					{
+						for (size_t p = 0; p < packs.size(); p++)
+						{
+							uint32_t mask = 0;
+							for (int lane = 0; lane < LANE_NUM; lane++)
+							{
+								mask |= static_cast<uint32_t>(scalarTest(q, boxes[p * LANE_NUM + lane])) << lane;
+							}
+							scalarMasks[q * packs.size() + p] = mask;
+						}
+					}
+				});
+
+			// ꊇ
+			std::vector<uint32_t> batchMasks(queryNum * packs.size());
+			const double batchMs = MeasureMilliseconds([&]()
+				{
+					for (uint32_t q = 0; q < queryNum; q++)
+					{
+						for (size_t p = 0; p < packs.size(); p++)
+						{
+							batchMasks[q * packs.size() + p] = batchTest(q, packs[p]);
+						}
+					}
+				});
+
+			size_t mismatchNum = 0;
+			size_t hitNum = 0;
+			for (size_t i = 0; i < batchMasks.size(); i++)
+			{
+				const uint32_t difference = scalarMasks[i] ^ batchMasks[i];
+				for (int lane = 0; lane < LANE_NUM; lane++)
+				{
+					mismatchNum += (difference >> lane) & 1u;
+					hitNum		+= (scalarMasks[i] >> lane) & 1u;
+				}
+			}
+
+			auto testsPerSecond = [&](double ms) { return static_cast<double>(totalTestNum) * 1000.0 / std::max(ms, 0.001); };
+
+			std::printf("%s : %llu tests, %7zu hits, scalar %11.0f tests/s, batch %11.0f tests/s (x%.2f)\n",
+				name, static_cast<unsigned long long>(totalTestNum), hitNum, testsPerSecond(scalarMs), testsPerSecond(batchMs), scalarMs / batchMs);
+			return Check(mismatchNum == 0, "%s : batch equals scalar in %llu / %llu tests",
+				name, static_cast<unsigned long long>(totalTestNum - mismatchNum), static_cast<unsigned long long>(totalTestNum));
+		};
+
+	bool isPassed = true;
+	isPassed &= measure("Sphere  vs AABB",
+		[&](uint32_t q, const AABB& box) { return ::IsHit(box, spheres[q]); },
+		[&](uint32_t q, const AABBPack& pack) { return IsHit(spheres[q], pack); });
+	isPassed &= measure("AABB    vs AABB",
+		[&](uint32_t q, const AABB& box) { return ::IsHit(queryBoxes[q], box); },
+		[&](uint32_t q, const AABBPack& pack) { return IsHit(queryBoxes[q], pack); });
+	isPassed &= measure("Capsule vs AABB",
+		[&](uint32_t q, const AABB& box) { return ::IsHit(capsules[q], box); },
+		[&](uint32_t q, const AABBPack& pack) { return IsHit(capsules[q], pack); });
+
+	return isPassed;
+}
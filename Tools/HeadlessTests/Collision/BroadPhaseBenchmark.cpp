@@ -0,0 +1,200 @@
+/*****************************************************************//**
+ * @file    BroadPhaseBenchmark.cpp
+ * @brief   L攻̌vɊւ\[Xt@C
+ *
+ * ŒuE{bNX 500 / 2000 / 10000 pӂA
+ * SweepAndPrune  SpatialHash ̌yA𑍓iO(n^2)ǰʂƔׂĎԂv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/BroadPhase/SweepAndPruneBroadPhase/SweepAndPruneBroadPhase.h"
+#include "Game/Common/Framework/Collision/BroadPhase/SpatialHashBroadPhase/SpatialHashBroadPhase.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	PROXY_NUMS[]		= { 500, 2000, 10000 };	///< E{bNX̐
+	constexpr uint32_t	SEED				= 20261017;				///< ̎
+	constexpr float		PROXIES_PER_AREA	= 1.0f / 100.0f;		///< 1[g̐iɂ炸x𑵂j
+	constexpr float		LARGE_RATIO			= 0.02f;				///< ̂悤ȑ傫ȋE{bNX̊
+	constexpr uint32_t	UNBOUNDED_NUM		= 2;					///< EȂvfiʁj̐
+	constexpr double	MIN_MEASURE_MS		= 200.0;				///< 1̕JԂvŒZ̎
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief E{bNX̍쐬
+	 *
+	 * nʂɉ`͈̔͂ɁAlȇ傫̔ƌ̑傫̔u
+	 *
+	 * @param[in] proxyNum	
+	 * @param[in] seed		̎
+	 *
+	 * @return E{bNX
+	 */
+	std::vector<BroadCollision> CreateEntries(uint32_t proxyNum, uint32_t seed)
+	{
+		std::mt19937 random(seed);
+		const float halfSize = std::sqrt(proxyNum / PROXIES_PER_AREA) * 0.5f;
+		std::uniform_real_distribution<float> horizontal(-halfSize, halfSize);
+		std::uniform_real_distribution<float> vertical(0.0f, 20.0f);
+		std::uniform_real_distribution<float> smallExtent(0.25f, 2.0f);
+		std::uniform_real_distribution<float> largeExtent(5.0f, 15.0f);
+		std::uniform_real_distribution<float> ratio(0.0f, 1.0f);
+
+		std::vector<BroadCollision> entries(proxyNum);
+		for (uint32_t i = 0; i < proxyNum; i++)
+		{
+			BroadCollision& entry = entries[i];
+			entry.proxyIndex = i;
+
+			if (i < UNBOUNDED_NUM)
+			{
+				entry.isUnbounded = true;
+				continue;
+			}
+
+			const Vector3 center(horizontal(random), vertical(random), horizontal(random));
+			const bool isLarge = ratio(random) < LARGE_RATIO;
+			const Vector3 extent = isLarge
+				? Vector3(largeExtent(random), largeExtent(random), largeExtent(random))
+				: Vector3(smallExtent(random), smallExtent(random), smallExtent(random));
+
+			entry.min = center - extent;
+			entry.max = center + extent;
+		}
+
+		return entries;
+	}
+
+
+
+	/**
+	 * @brief ŌyA߂
+	 *
+	 * @param[in]  entries	E{bNX
+	 * @param[out] pOutPairs	yA
+	 */
+	void ComputeBruteForcePairs(const std::vector<BroadCollision>& entries, std::vector<BroadPhasePair>* pOutPairs)
+	{
+		pOutPairs->clear();
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			for (size_t j = i + 1; j < entries.size(); j++)
+			{
+				if (entries[i].Overlaps(entries[j]))
+				{
+					pOutPairs->emplace_back(entries[i].proxyIndex, entries[j].proxyIndex);
+				}
+			}
+		}
+	}
+
+
+
+	/**
+	 * @brief yAWǂ
+	 *
+	 * @param[in] expected	̌yAiבւς݁j
+	 * @param[in] pairs		ׂyAiבւj
+	 *
+	 * @returns true  
+	 * @returns false قȂ
+	 */
+	bool IsSamePairSet(const std::vector<BroadPhasePair>& expected, std::vector<BroadPhasePair> pairs)
+	{
+		std::sort(pairs.begin(), pairs.end());
+		if (pairs.size() != expected.size()) return false;
+
+		for (size_t i = 0; i < pairs.size(); i++)
+		{
+			if (pairs[i].indexA != expected[i].indexA || pairs[i].indexB != expected[i].indexB) return false;
+		}
+		return true;
+	}
+
+
+
+	/**
+	 * @brief yA̎ZoJԂ1񂠂̎Ԃv
+	 *
+	 * ŏ1͌vȂiƗ̈̊mۂ܂߂Ȃ߁j
+	 *
+	 * @param[in]  compute	yA̎Zo
+	 * @param[out] pOutPairs	yA
+	 *
+	 * @return 1񂠂̎ԁi~bj
+	 */
+	template <typename TCompute>
+	double MeasurePairs(TCompute&& compute, std::vector<BroadPhasePair>* pOutPairs)
+	{
+		compute(pOutPairs);
+
+		int count = 0;
+		double total = 0.0;
+		while (total < MIN_MEASURE_MS)
+		{
+			total += MeasureMilliseconds([&]() { compute(pOutPairs); });
+			count++;
+		}
+		return total / count;
+	}
+}
+
+
+
+/**
+ * @brief L攻𑍓ƔׁAyAv邱Ƃm߂ĎԂv
+ *
+ * @returns true  SĂ̐ŗ̌yAƈv
+ * @returns false vȂ
+ */
+bool RunBroadPhaseBenchmark()
+{
+	bool isPassed = true;
+
+	for (const uint32_t proxyNum : PROXY_NUMS)
+	{
+		const std::vector<BroadCollision> entries = CreateEntries(proxyNum, SEED + proxyNum);
+
+		std::vector<BroadPhasePair> bruteForcePairs;
+		const double bruteForceMs = MeasurePairs([&](std::vector<BroadPhasePair>* pPairs) { ComputeBruteForcePairs(entries, pPairs); }, &bruteForcePairs);
+		std::sort(bruteForcePairs.begin(), bruteForcePairs.end());
+
+		SweepAndPruneBroadPhase sweepAndPrune;
+		std::vector<BroadPhasePair> sweepAndPrunePairs;
+		const double sweepAndPruneMs = MeasurePairs([&](std::vector<BroadPhasePair>* pPairs) { pPairs->clear(); sweepAndPrune.ComputePairs(entries, pPairs); }, &sweepAndPrunePairs);
+
+		SpatialHashBroadPhase spatialHash;
+		std::vector<BroadPhasePair> spatialHashPairs;
+		const double spatialHashMs = MeasurePairs([&](std::vector<BroadPhasePair>* pPairs) { pPairs->clear(); spatialHash.ComputePairs(entries, pPairs); }, &spatialHashPairs);
+
+		std::printf("%5u proxies, %6zu pairs : brute force %8.3f ms / sweep and prune %7.3f ms (x%6.1f) / spatial hash %7.3f ms (x%6.1f)\n",
+			proxyNum, bruteForcePairs.size(),
+			bruteForceMs, sweepAndPruneMs, bruteForceMs / sweepAndPruneMs, spatialHashMs, bruteForceMs / spatialHashMs);
+
+		isPassed &= Check(IsSamePairSet(bruteForcePairs, sweepAndPrunePairs),
+			"%5u proxies : sweep and prune pairs %6zu equal brute force", proxyNum, sweepAndPrunePairs.size());
+		isPassed &= Check(IsSamePairSet(bruteForcePairs, spatialHashPairs),
+			"%5u proxies : spatial hash pairs    %6zu equal brute force", proxyNum, spatialHashPairs.size());
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,91 @@
+/*****************************************************************//**
+ * @file    ChurnBenchmark.cpp
+ * @brief   Փ˃f[^̓o^ƍ폜̌vɊւ\[Xt@C
+ *
+ * t[ʂ̃RC_[Փ˔ǗɒǉAǉƖ֌WȏőSč폜B
+ * o^ɎsȂƂƁA폜̃nhSĖɂȂ邱Ƃm߂ĎԂv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	COLLIDER_NUM	= 10000;	///< 1t[ŒǉE폜RC_[̐
+	constexpr uint32_t	FRAME_NUM		= 1000;		///< t[
+	constexpr uint32_t	SEED			= 0;		///< ̎
+}
+
+
+
+/**
+ * @brief Փ˃f[^̓o^ƍ폜JԂAnhɂȂ邱Ƃm߂ĎԂv
+ *
+ * 4  1 ͒ÕRC_[̎qƂĒǉ
+ *
+ * @returns true  SĂ̓o^A폜nhSĖɂȂ
+ * @returns false o^̎sA폜Lȃnh
+ */
+bool RunChurnBenchmark()
+{
+	CollisionManager manager;
+	std::mt19937 random(SEED);
+
+	// o^̌vȂ̂Ō`͔肵ȂBRC_[𖈃t[o^
+	std::vector<Sphere> colliders(COLLIDER_NUM);
+	std::vector<CollisionHandle> handles(COLLIDER_NUM);
+
+	double addMs = 0.0;
+	double removeMs = 0.0;
+	size_t failedNum = 0;
+	size_t staleNum = 0;
+
+	for (uint32_t frame = 0; frame < FRAME_NUM; frame++)
+	{
+		addMs += MeasureMilliseconds([&]()
+			{
+				for (uint32_t i = 0; i < COLLIDER_NUM; i++)
+				{
+					const CollisionData data(nullptr, &colliders[i], false);
+					handles[i] = (i % 4 == 3) ? manager.AddCollisionData(data, handles[i - 1]) : manager.AddCollisionData(data);
+					failedNum += handles[i].IsNull();
+				}
+			});
+
+		std::shuffle(handles.begin(), handles.end(), random);
+
+		removeMs += MeasureMilliseconds([&]()
+			{
+				for (const auto& handle : handles)
+				{
+					// eƈꏏɍ폜ꂽq͎s邪AvɊ܂߂
+					manager.RemoveCollisionData(handle);
+				}
+			});
+
+		// 폜nh͑SĖɂȂĂȂ΂ȂȂ
+		for (const auto& handle : handles)
+		{
+			staleNum += manager.IsRegistered(handle) || manager.RemoveCollisionData(handle);
+		}
+	}
+
+	std::printf("%u colliders x %u frames : add %.3f ms/frame, remove %.3f ms/frame\n",
+		COLLIDER_NUM, FRAME_NUM, addMs / FRAME_NUM, removeMs / FRAME_NUM);
+
+	bool isPassed = true;
+	isPassed &= Check(failedNum == 0, "add failed %zu times", failedNum);
+	isPassed &= Check(staleNum == 0, "stale handles alive %zu", staleNum);
+	return isPassed;
+}
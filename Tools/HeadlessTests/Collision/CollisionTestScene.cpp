@@ -0,0 +1,355 @@
+/*****************************************************************//**
+ * @file    CollisionTestScene.cpp
+ * @brief   蔻̃eXgp̏ʂɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTestScene.h"
+
+#include "Game/Common/Framework/Collision/CollisionDispatcher/CollisionDispatcher.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr float		AREA_PER_OBJECT		= 12.0f;	///< vf1̒nʂ̍Li[gj
+	constexpr float		AREA_PER_BUILDING	= 240.0f;	///< 1̒nʂ̍Li[gj
+	constexpr uint32_t	OBJECTS_PER_BUILDING = 20;		///< ̐ȗ́A1̓vf̐
+}
+
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * nʁi`jEiAABBjEǁi`jEiOp`jÓIɒuA
+ * GiJvZ2̋̎qjEeijEC[ijEvC[ij𓮓Iɒu
+ *
+ * nʂ̍L͓vfƌ̂ALꏊgɍ킹
+ *
+ * @param[in] dynamicNum	vfi[gj̐
+ * @param[in] seed			̎
+ * @param[in] buildingNum	̖̐ڈi0 Ȃ瓮vf̐猈߂Bǂƍ͂̔j
+ */
+CollisionTestScene::CollisionTestScene(uint32_t dynamicNum, uint32_t seed, uint32_t buildingNum)
+{
+	if (buildingNum == 0) { buildingNum = dynamicNum / OBJECTS_PER_BUILDING; }
+
+	std::mt19937 random(seed);
+	const float halfSize = std::sqrt(std::max(dynamicNum * AREA_PER_OBJECT, buildingNum * AREA_PER_BUILDING)) * 0.5f;
+	auto range = [&](float minValue, float maxValue) { return std::uniform_real_distribution<float>(minValue, maxValue)(random); };
+	auto groundPoint = [&](float y) { return Vector3(range(-halfSize, halfSize), y, range(-halfSize, halfSize)); };
+
+	// ՓˑΉ\
+	m_matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::ENEMY);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::BUILDING);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::WALL);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::FLOOR);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::BALL);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::WIRE);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::BALL, GameObjectTag::BUILDING);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::BALL, GameObjectTag::WALL);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::BALL, GameObjectTag::FLOOR);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::BALL, GameObjectTag::PLAYER);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::WIRE, GameObjectTag::BUILDING);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::WIRE, GameObjectTag::WALL);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::PLAYER, GameObjectTag::BUILDING);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::PLAYER, GameObjectTag::WALL);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::PLAYER, GameObjectTag::FLOOR);
+	m_matrix.RegisterDetectionTarget(GameObjectTag::PLAYER, GameObjectTag::ENEMY);
+
+	// n
+	AddElement(GameObjectTag::FLOOR, std::make_unique<Box2D>(
+		Vector3(-halfSize, 0.0f, -halfSize), Vector3(halfSize, 0.0f, -halfSize),
+		Vector3(halfSize, 0.0f, halfSize), Vector3(-halfSize, 0.0f, halfSize)), true);
+
+	// 
+	for (uint32_t i = 0; i < buildingNum + 1; i++)
+	{
+		const Vector3 extend(range(2.0f, 8.0f), range(3.0f, 15.0f), range(2.0f, 8.0f));
+		AddElement(GameObjectTag::BUILDING, std::make_unique<AABB>(groundPoint(extend.y), extend), true);
+	}
+
+	// 
+	const uint32_t wallNum = buildingNum / 2 + 1;
+	for (uint32_t i = 0; i < wallNum; i++)
+	{
+		const Vector3 start = groundPoint(0.0f);
+		const float angle = range(0.0f, DirectX::XM_2PI);
+		const Vector3 end = start + Vector3(std::cos(angle), 0.0f, std::sin(angle)) * range(4.0f, 12.0f);
+		const float height = range(2.0f, 5.0f);
+		AddElement(GameObjectTag::WALL, std::make_unique<Box2D>(
+			start, end, end + Vector3(0.0f, height, 0.0f), start + Vector3(0.0f, height, 0.0f)), true);
+	}
+
+	// 
+	const uint32_t rampNum = buildingNum / 2 + 1;
+	for (uint32_t i = 0; i < rampNum; i++)
+	{
+		const Vector3 base = groundPoint(0.0f);
+		AddElement(GameObjectTag::FLOOR, std::make_unique<Triangle>(
+			base, base + Vector3(4.0f, 0.0f, 0.0f), base + Vector3(0.0f, 2.0f, 4.0f)), true);
+	}
+
+	// vf
+	for (uint32_t i = 0; i < dynamicNum; i++)
+	{
+		const float kind = range(0.0f, 1.0f);
+
+		if (kind < 0.5f)
+		{
+			// GîƁAƎ̎qj
+			const Vector3 position = groundPoint(range(0.5f, 1.5f));
+			const int body = AddElement(GameObjectTag::ENEMY, std::make_unique<Capsule>(Vector3::Up, 1.2f, position, 0.4f), false);
+			AddElement(GameObjectTag::ENEMY, std::make_unique<Sphere>(position + Vector3(0.0f, 0.9f, 0.0f), 0.25f), false, body);
+			AddElement(GameObjectTag::ENEMY, std::make_unique<Sphere>(position + Vector3(range(-0.6f, 0.6f), 0.2f, range(-0.6f, 0.6f)), 0.2f), false, body);
+		}
+		else if (kind < 0.8f)
+		{
+			// e
+			AddElement(GameObjectTag::BALL, std::make_unique<Sphere>(groundPoint(range(0.1f, 4.0f)), range(0.2f, 0.6f)), false);
+		}
+		else if (kind < 0.9f)
+		{
+			// C[
+			const Vector3 direction(range(-1.0f, 1.0f), range(0.2f, 1.0f), range(-1.0f, 1.0f));
+			AddElement(GameObjectTag::WIRE, std::make_unique<Segment>(groundPoint(range(0.5f, 3.0f)), direction * range(2.0f, 8.0f)), false);
+		}
+		else
+		{
+			// vC[
+			Vector3 axis(range(-0.3f, 0.3f), 1.0f, range(-0.3f, 0.3f));
+			axis.Normalize();
+			AddElement(GameObjectTag::PLAYER, std::make_unique<Cylinder>(axis, 1.6f, groundPoint(range(0.6f, 1.2f)), 0.35f), false);
+		}
+	}
+}
+
+
+
+/**
+ * @brief Փ˔Ǘւ̓o^
+ *
+ * @param[in] pManager Փ˔Ǘ
+ */
+void CollisionTestScene::Register(CollisionManager* pManager) const
+{
+	pManager->SetCollisionMatrix(&m_matrix);
+
+	std::vector<CollisionHandle> handles(m_elements.size());
+	for (size_t i = 0; i < m_elements.size(); i++)
+	{
+		const Element& element = m_elements[i];
+		const CollisionData data = CreateCollisionData(element);
+		handles[i] = (element.parentIndex < 0)
+			? pManager->AddCollisionData(data)
+			: pManager->AddCollisionData(data, handles[element.parentIndex]);
+	}
+}
+
+
+
+/**
+ * @brief XibvVbg̍쐬
+ *
+ * Փ˔ǗƓA[gɕׁAq𕝗D̏ɑBߓ_ ID ͗vf̔ԍɂ
+ *
+ * @param[in]  isStatic		ÓIȗvfΏۂɂ邩ǂ
+ * @param[out] pOutSnapshot	XibvVbgie͏㏑j
+ */
+void CollisionTestScene::CreateSnapshot(bool isStatic, CollisionSnapshot* pOutSnapshot) const
+{
+	pOutSnapshot->Clear();
+
+	auto createNode = [&](int index, CollisionSnapshotNode* pNode)
+		{
+			const Element& element = m_elements[index];
+			const CollisionData data = CreateCollisionData(element);
+			if (!CollisionSnapshot::WriteShape(*element.pCollider, &pNode->shape)) return false;
+
+			pNode->id			= index;
+			pNode->tagBitIndex	= data.tagBitIndex;
+			pNode->tag			= element.pObject->GetTag();
+			pNode->isActive		= element.pObject->IsActive();
+			pNode->childBegin	= 0;
+			pNode->childCount	= 0;
+			return true;
+		};
+
+	// [g
+	for (size_t i = 0; i < m_elements.size(); i++)
+	{
+		if (m_elements[i].parentIndex >= 0 || m_elements[i].isStatic != isStatic) continue;
+
+		CollisionSnapshotNode node;
+		if (createNode(static_cast<int>(i), &node)) { pOutSnapshot->AddNode(node); }
+	}
+	pOutSnapshot->SetRootCount(pOutSnapshot->GetNodeCount());
+
+	// qiǉߓ_ɏj
+	for (uint32_t nodeIndex = 0; nodeIndex < pOutSnapshot->GetNodeCount(); nodeIndex++)
+	{
+		const int parentIndex = pOutSnapshot->GetNode(nodeIndex).id;
+		const uint32_t childBegin = pOutSnapshot->GetNodeCount();
+
+		for (const int childIndex : m_children[parentIndex])
+		{
+			CollisionSnapshotNode node;
+			if (createNode(childIndex, &node)) { pOutSnapshot->AddNode(node); }
+		}
+
+		CollisionSnapshotNode& node = pOutSnapshot->GetNode(nodeIndex);
+		node.childBegin = childBegin;
+		node.childCount = pOutSnapshot->GetNodeCount() - childBegin;
+	}
+}
+
+
+
+/**
+ * @brief RC_[ő̔s
+ *
+ * XibvVbggO̍ƃXbhƓASẴRC_[ GetClone ŕA
+ * [g̑g𑍓Ŕ肷BÓIȂ̓m͔肵Ȃ
+ *
+ * @param[out] pOutContacts Փ˂gǐj
+ */
+void CollisionTestScene::DetectWithClones(std::vector<ContactRecord>* pOutContacts) const
+{
+	pOutContacts->clear();
+
+	std::vector<std::unique_ptr<ICollider>> clones;
+	std::vector<int> roots;
+	clones.reserve(m_elements.size());
+	for (size_t i = 0; i < m_elements.size(); i++)
+	{
+		clones.push_back(m_elements[i].pCollider->GetClone());
+
+		if (m_elements[i].parentIndex < 0) { roots.push_back(static_cast<int>(i)); }
+	}
+
+	for (size_t i = 0; i < roots.size(); i++)
+	{
+		for (size_t j = i + 1; j < roots.size(); j++)
+		{
+			if (m_elements[roots[i]].isStatic && m_elements[roots[j]].isStatic) continue;
+
+			CheckClonePair(clones, roots[i], roots[j], pOutContacts);
+		}
+	}
+}
+
+
+
+/**
+ * @brief Փ˔Ǘ1t[̔sAՓ˂g߂
+ *
+ * ˗Ēʒm󂯎Aʒm̏ɑgׂ
+ *
+ * @param[in]  pManager		Փ˔Ǘio^ς݁j
+ * @param[out] pOutContacts	Փ˂giʒm󂯎 A ɂj
+ */
+void CollisionTestScene::DetectWithManager(CollisionManager* pManager, std::vector<ContactRecord>* pOutContacts)
+{
+	m_log.clear();
+	pManager->RequestCollisionDetection();
+	pManager->UpdateTask(0.0f);
+
+	pOutContacts->clear();
+	for (size_t i = 0; i + 1 < m_log.size(); i += 2)
+	{
+		pOutContacts->push_back({ m_indices.at(m_log[i]), m_indices.at(m_log[i + 1]) });
+	}
+}
+
+
+
+/**
+ * @brief vf̒ǉ
+ *
+ * @param[in] tag			^O
+ * @param[in] collider		RC_[
+ * @param[in] isStatic		ÓIǂ
+ * @param[in] parentIndex	e̔ԍi[gȂ -1Bq͐e̎Lj
+ *
+ * @return vf̔ԍ
+ */
+int CollisionTestScene::AddElement(GameObjectTag tag, std::unique_ptr<ICollider> collider, bool isStatic, int parentIndex)
+{
+	RecordingObject* pObject = nullptr;
+	if (parentIndex < 0)
+	{
+		m_objects.push_back(std::make_unique<RecordingObject>(tag, &m_log));
+		pObject = m_objects.back().get();
+	}
+	else
+	{
+		pObject = m_elements[parentIndex].pObject;
+	}
+
+	const int index = static_cast<int>(m_elements.size());
+	m_elements.push_back({ pObject, collider.get(), isStatic, parentIndex });
+	m_children.emplace_back();
+	if (parentIndex >= 0) { m_children[parentIndex].push_back(index); }
+	m_indices.emplace(collider.get(), index);
+	m_colliders.push_back(std::move(collider));
+
+	return index;
+}
+
+
+
+/**
+ * @brief vf̏Փ˃f[^̍쐬
+ *
+ * @param[in] element vf
+ *
+ * @return Փ˃f[^
+ */
+CollisionData CollisionTestScene::CreateCollisionData(const Element& element) const
+{
+	return CollisionData(element.pObject, element.pCollider, element.isStatic);
+}
+
+
+
+/**
+ * @brief RC_[̑g̔
+ *
+ * ƃXbhƓAg̎q𑊎Ɣ肷iB ̎q A 𑊎ɂj
+ *
+ * @param[in]  clones		RC_[
+ * @param[in]  indexA		vfA̔ԍ
+ * @param[in]  indexB		vfB̔ԍ
+ * @param[out] pOutContacts	Փ˂gǐj
+ */
+void CollisionTestScene::CheckClonePair(
+	const std::vector<std::unique_ptr<ICollider>>& clones, int indexA, int indexB, std::vector<ContactRecord>* pOutContacts) const
+{
+	const CollisionData dataA = CreateCollisionData(m_elements[indexA]);
+	if (!m_matrix.ShouldCollide(dataA.tagBitIndex, m_elements[indexB].pObject->GetTag())) return;
+
+	if (!CollisionDispatcher::DetectCollision(clones[indexA].get(), clones[indexB].get())) return;
+
+	pOutContacts->push_back({ indexA, indexB });
+	pOutContacts->push_back({ indexB, indexA });
+
+	for (int child : m_children[indexA])
+	{
+		CheckClonePair(clones, child, indexB, pOutContacts);
+	}
+	for (int child : m_children[indexB])
+	{
+		CheckClonePair(clones, child, indexA, pOutContacts);
+	}
+}
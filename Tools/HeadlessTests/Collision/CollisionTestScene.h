@@ -0,0 +1,162 @@
+/*****************************************************************//**
+ * @file    CollisionTestScene.h
+ * @brief   蔻̃eXgp̏ʂɊւwb_[t@C
+ *
+ * ̎킩瓯zȕʁiGEeEC[EEǁEjA
+ * Փ˔Ǘւ̓o^AXibvVbg̍쐬A]̕RC_[ł̑蔻s
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionSnapshot/CollisionSnapshot.h"
+#include "Game/Common/Framework/Collision/CollisionMatrix/CollisionMatrix.h"
+
+
+
+
+// \̂̒` ===============================================================
+/**
+ * @brief Փ˂RC_[̑giʂ̗vf̔ԍj
+ */
+struct ContactRecord
+{
+	int indexA;	///< vfA̔ԍ
+	int indexB;	///< vfB̔ԍ
+
+	bool operator==(const ContactRecord& other) const { return indexA == other.indexA && indexB == other.indexB; }
+	bool operator<(const ContactRecord& other) const { return (indexA != other.indexA) ? (indexA < other.indexA) : (indexB < other.indexB); }
+};
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief 󂯎Փ˒ʒmL^IuWFNg
+ */
+class RecordingObject
+	: public GameObject
+{
+// f[^o̐錾 -----------------------------------------------
+private:
+	GameObjectTag					m_tag;	///< ^O
+	std::vector<const ICollider*>*	m_pLog;	///< ʒm̋L^ĩRC_[Ƒ̃RC_[݂ɐςށj
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	RecordingObject(GameObjectTag tag, std::vector<const ICollider*>* pLog)
+		: m_tag{ tag }
+		, m_pLog{ pLog }
+	{
+	}
+
+
+// 擾/ݒ
+public:
+	bool IsActive() const override { return true; }
+	GameObjectTag GetTag() const override { return m_tag; }
+
+
+// Փ
+public:
+	void OnCollision(const CollisionInfo& info) override
+	{
+		m_pLog->push_back(info.pMyCollider);
+		m_pLog->push_back(info.pOtherCollider);
+	}
+};
+
+
+
+/**
+ * @brief 蔻̃eXgp̏
+ *
+ * vf̔ԍ͍쐬ŁAq͐eɕԁB
+ * XibvVbgƏՓˌʂ ID ɂ͗vf̔ԍg
+ */
+class CollisionTestScene
+{
+// \̂̐錾
+public:
+	/**
+	 * @brief ʂ̗vf
+	 */
+	struct Element
+	{
+		RecordingObject*	pObject;		///< 
+		ICollider*			pCollider;		///< RC_[
+		bool				isStatic;		///< ÓIǂ
+		int					parentIndex;	///< e̔ԍi[gȂ -1j
+	};
+
+
+// f[^o̐錾 -----------------------------------------------
+private:
+	std::vector<std::unique_ptr<RecordingObject>>	m_objects;		///< 
+	std::vector<std::unique_ptr<ICollider>>			m_colliders;	///< RC_[
+	std::vector<Element>							m_elements;		///< vf
+	std::vector<std::vector<int>>					m_children;		///< vfƂ̎q̔ԍ
+	CollisionMatrix									m_matrix;		///< ՓˑΉ\
+	std::unordered_map<const ICollider*, int>		m_indices;		///< RC_[vf̔ԍ\
+	std::vector<const ICollider*>					m_log;			///< 󂯎ʒm̋L^
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	CollisionTestScene(uint32_t dynamicNum, uint32_t seed, uint32_t buildingNum = 0);
+
+
+// 
+public:
+	// Փ˔Ǘւ̓o^
+	void Register(CollisionManager* pManager) const;
+
+	// XibvVbg̍쐬iՓ˔ǗƓтɂj
+	void CreateSnapshot(bool isStatic, CollisionSnapshot* pOutSnapshot) const;
+
+	// RC_[ő̔siXibvVbggO̕j
+	void DetectWithClones(std::vector<ContactRecord>* pOutContacts) const;
+
+	// Փ˔Ǘ1t[̔sAՓ˂g߂
+	void DetectWithManager(CollisionManager* pManager, std::vector<ContactRecord>* pOutContacts);
+
+
+// 擾/ݒ
+public:
+	// vf̎擾
+	const std::vector<Element>& GetElements() const { return m_elements; }
+
+	// ՓˑΉ\̎擾
+	const CollisionMatrix& GetMatrix() const { return m_matrix; }
+
+
+// 
+private:
+	// vf̒ǉ
+	int AddElement(GameObjectTag tag, std::unique_ptr<ICollider> collider, bool isStatic, int parentIndex = -1);
+
+	// vf̏Փ˃f[^̍쐬
+	CollisionData CreateCollisionData(const Element& element) const;
+
+	// RC_[̑g̔iq肷j
+	void CheckClonePair(
+		const std::vector<std::unique_ptr<ICollider>>& clones, int indexA, int indexB, std::vector<ContactRecord>* pOutContacts) const;
+};
@@ -0,0 +1,55 @@
+/*****************************************************************//**
+ * @file    CollisionTests.cpp
+ * @brief   `Ȃ蔻̃eXg̃Gg[|Cg
+ *
+ * g
+ *   CollisionTests [--case NAME]... [--list]
+ *
+ * IR[h͑SĒʂ 0AʂȂeXg 1Aɖ肪 2
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+
+#include "Common/TestRunner.h"
+#include "CollisionTests.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	/// eXg̈ꗗ
+	constexpr TestCase TEST_CASES[] =
+	{
+		{ "broad_phase",	RunBroadPhaseBenchmark },
+		{ "narrow_phase",	RunNarrowPhaseThreadTest },
+		{ "snapshot",		RunSnapshotTest },
+		{ "query",			RunQueryBenchmark },
+		{ "dispatcher",		RunDispatcherBenchmark },
+		{ "batch",			RunBatchCollisionBenchmark },
+		{ "churn",			RunChurnBenchmark },
+		{ "contact_event",	RunContactEventBenchmark },
+		{ "contact_removal",	RunContactRemovalTest },
+		{ "continuous",		RunContinuousCollisionTest },
+	};
+}
+
+
+
+/**
+ * @brief Gg[|Cg
+ *
+ * @param[in] argc ̐
+ * @param[in] argv 
+ *
+ * @return IR[h
+ */
+int main(int argc, char* argv[])
+{
+	return RunTestCases(argc, argv, TEST_CASES, std::size(TEST_CASES));
+}
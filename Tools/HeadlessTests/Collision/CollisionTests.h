@@ -0,0 +1,44 @@
+/*****************************************************************//**
+ * @file    CollisionTests.h
+ * @brief   蔻̃eXgɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// ֐̐錾 =================================================================
+// L攻𑍓ƔׁAyAv邱Ƃm߂ĎԂv
+bool RunBroadPhaseBenchmark();
+
+// ڍהXbhςčsAʂƂm߂ĎԂv
+bool RunNarrowPhaseThreadTest();
+
+// XibvVbgł̔𕡐RC_[ł̔ƔׁA쐬̎Ԃv
+bool RunSnapshotTest();
+
+// ԌSƔׁAʂv邱Ƃm߂ĎԂv
+bool RunQueryBenchmark();
+
+// Փ˔̐U蕪]̐U蕪ƔׁAʂv邱Ƃm߂ĎԂv
+bool RunDispatcherBenchmark();
+
+// ꊇP̂̔ƔׁAʂv邱Ƃm߂ĎԂv
+bool RunBatchCollisionBenchmark();
+
+// Փ˃f[^̓o^ƍ폜JԂAnhɂȂ邱Ƃm߂ĎԂv
+bool RunChurnBenchmark();
+
+// Փ˒ʒm̎ނƂɒʒm̉񐔂m߁AԂv
+bool RunContactEventBenchmark();
+
+// ڐGĂg̕Е폜AcڐG̏I1x󂯎邱Ƃm߂
+bool RunContactRemovalTest();
+
+// ǂɑ݁AAIȈړŒʂ蔲Ƃm߂
+bool RunContinuousCollisionTest();
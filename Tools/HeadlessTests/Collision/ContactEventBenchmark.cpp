@@ -0,0 +1,211 @@
+/*****************************************************************//**
+ * @file    ContactEventBenchmark.cpp
+ * @brief   Փ˒ʒm̌vɊւ\[Xt@C
+ *
+ * ~܂ĂǦQꂪɐڐGʂՓ˔ǗŔ肵A
+ * St[̒ʒm󂯎ꍇƁAڐG̊JnEI󂯎ꍇ
+ * ʒm̉񐔂҂ǂɂȂ邱Ƃm߂ĎԂv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+#include "Game/Common/Framework/Collision/CollisionMatrix/CollisionMatrix.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	ENEMY_NUM			= 2000;		///< G̐
+	constexpr uint32_t	FRAME_NUM			= 600;		///< ڐGt[
+	constexpr uint32_t	ENEMY_PER_BUILDING	= 8;		///< 1̌͂ޓG̐
+	constexpr float		BUILDING_SPACING	= 10.0f;	///< ̊Ԋu
+	constexpr float		BUILDING_SIZE		= 2.0f;		///< ̕ӂ̒
+	constexpr float		ENEMY_DISTANCE		= 1.2f;		///< ̒SG̒S܂ł̐
+	constexpr float		ENEMY_RADIUS		= 0.5f;		///< G̔a
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief 󂯎ʒm𐔂IuWFNg
+	 */
+	class CountingObject
+		: public GameObject
+	{
+	public:
+		GameObjectTag	tag				= GameObjectTag::DEFAULT;
+		size_t			collisionNum	= 0;
+		size_t			enterNum		= 0;
+		size_t			stayNum			= 0;
+		size_t			exitNum			= 0;
+
+		bool IsActive() const override { return true; }
+		GameObjectTag GetTag() const override { return tag; }
+
+		void OnCollision(const CollisionInfo&) override			{ collisionNum++; }
+		void OnCollisionEnter(const CollisionInfo&) override	{ enterNum++; }
+		void OnCollisionStay(const CollisionInfo&) override		{ stayNum++; }
+		void OnCollisionExit(const CollisionInfo&) override		{ exitNum++; }
+	};
+
+
+
+	/**
+	 * @brief ʒm̉
+	 */
+	struct EventCount
+	{
+		size_t collisionNum	= 0;
+		size_t enterNum		= 0;
+		size_t stayNum		= 0;
+		size_t exitNum		= 0;
+
+		bool operator==(const EventCount&) const = default;
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief QꂪɐڐGɗʂ𔻒肵Aʒm̉񐔂𐔂
+	 *
+	 * @param[in]  eventFlags	SẴRC_[󂯎ʒm
+	 * @param[out] pOutMs		ڐGĂԂ1t[̎ԁi~bj
+	 *
+	 * @return SẴIuWFNg󂯎ʒm̉
+	 */
+	EventCount CountEvents(CollisionEventFlag eventFlags, double* pOutMs)
+	{
+		const uint32_t buildingNum = std::max(1u, ENEMY_NUM / ENEMY_PER_BUILDING);
+		const uint32_t columnNum = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(buildingNum))));
+
+		CollisionMatrix matrix;
+		matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::BUILDING);
+
+		CollisionManager manager;
+		manager.SetCollisionMatrix(&matrix);
+
+		std::vector<CountingObject> buildings(buildingNum);
+		std::vector<AABB> buildingColliders;
+		buildingColliders.reserve(buildingNum);
+		for (uint32_t i = 0; i < buildingNum; i++)
+		{
+			const Vector3 center(static_cast<float>(i % columnNum) * BUILDING_SPACING, 0.0f, static_cast<float>(i / columnNum) * BUILDING_SPACING);
+			buildingColliders.emplace_back(center, Vector3(BUILDING_SIZE));
+			buildings[i].tag = GameObjectTag::BUILDING;
+			manager.AddCollisionData(CollisionData(&buildings[i], &buildingColliders[i], true, eventFlags));
+		}
+
+		// G͌̎͂݁Aꂼ1̌ɐڐG
+		std::vector<CountingObject> enemies(ENEMY_NUM);
+		std::vector<Sphere> enemyColliders;
+		enemyColliders.reserve(ENEMY_NUM);
+		for (uint32_t i = 0; i < ENEMY_NUM; i++)
+		{
+			const float angle = DirectX::XM_2PI * static_cast<float>(i % ENEMY_PER_BUILDING) / ENEMY_PER_BUILDING;
+			const Vector3 offset(std::cos(angle) * ENEMY_DISTANCE, 0.0f, std::sin(angle) * ENEMY_DISTANCE);
+			enemyColliders.emplace_back(buildingColliders[(i / ENEMY_PER_BUILDING) % buildingNum].GetCenter() + offset, ENEMY_RADIUS);
+			enemies[i].tag = GameObjectTag::ENEMY;
+			manager.AddCollisionData(CollisionData(&enemies[i], &enemyColliders[i], false, eventFlags));
+		}
+
+		auto update = [&]()
+			{
+				manager.RequestCollisionDetection();
+				manager.UpdateTask(0.0f);
+			};
+
+		const double totalMs = MeasureMilliseconds([&]()
+			{
+				for (uint32_t frame = 0; frame < FRAME_NUM; frame++)
+				{
+					update();
+				}
+			});
+		*pOutMs = totalMs / FRAME_NUM;
+
+		// Ō̃t[͌Qꂪꂽ̂ƂĐڐG𖳂
+		for (Sphere& collider : enemyColliders)
+		{
+			collider.Transform(collider.GetPosition() + Vector3(0.0f, 100.0f, 0.0f));
+		}
+		update();
+
+		EventCount count;
+		for (const auto* pObjects : { &enemies, &buildings })
+		{
+			for (const auto& object : *pObjects)
+			{
+				count.collisionNum	+= object.collisionNum;
+				count.enterNum		+= object.enterNum;
+				count.stayNum		+= object.stayNum;
+				count.exitNum		+= object.exitNum;
+			}
+		}
+		return count;
+	}
+
+
+
+	/**
+	 * @brief ʒm̉񐔂҂ǂ肩m߂
+	 *
+	 * @param[in] name			O
+	 * @param[in] eventFlags	SẴRC_[󂯎ʒm
+	 * @param[in] expected		҂
+	 *
+	 * @returns true ҂ǂ肾
+	 */
+	bool CheckEvents(const char* name, CollisionEventFlag eventFlags, const EventCount& expected)
+	{
+		double ms = 0.0;
+		const EventCount count = CountEvents(eventFlags, &ms);
+		const size_t totalNum = count.collisionNum + count.enterNum + count.stayNum + count.exitNum;
+
+		std::printf("%-12s : OnCollision %zu, Enter %zu, Stay %zu, Exit %zu, total %zu callbacks, %.3f ms/frame\n",
+			name, count.collisionNum, count.enterNum, count.stayNum, count.exitNum, totalNum, ms);
+		return Check(count == expected, "%-12s : callbacks match the expected counts (OnCollision %zu, Enter %zu, Stay %zu, Exit %zu)",
+			name, expected.collisionNum, expected.enterNum, expected.stayNum, expected.exitNum);
+	}
+}
+
+
+
+/**
+ * @brief Փ˒ʒm̎ނƂɒʒm̉񐔂m߁AԂv
+ *
+ * ڐGĂg͓G̐ƓŁAʒm͑g̗ɑ
+ *
+ * @returns true  ǂ̏ꍇʒm̉񐔂҂ǂ肾
+ * @returns false 񐔂قȂꍇ
+ */
+bool RunContactEventBenchmark()
+{
+	std::printf("%u enemies, %u per building, %u frames\n", ENEMY_NUM, ENEMY_PER_BUILDING, FRAME_NUM);
+
+	const size_t notifyNum = static_cast<size_t>(ENEMY_NUM) * 2;
+
+	bool isPassed = true;
+	isPassed &= CheckEvents("every frame", CollisionEventFlag::ON_COLLISION, { notifyNum * FRAME_NUM, 0, 0, 0 });
+	isPassed &= CheckEvents("enter / exit", CollisionEventFlag::TRANSITION, { 0, notifyNum, 0, notifyNum });
+	return isPassed;
+}
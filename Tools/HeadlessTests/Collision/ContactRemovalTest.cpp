@@ -0,0 +1,186 @@
+/*****************************************************************//**
+ * @file    ContactRemovalTest.cpp
+ * @brief   ڐG̏Փ˃f[^̍폜̃eXgɊւ\[Xt@C
+ *
+ * ͂ޓGڐGĂԂɁAg̕Е폜B
+ * EG폜ƁAcڐG̏I1x󂯎邱
+ * E폜ƁA͂łGꂼڐG̏I1x󂯎邱
+ * Eqf[^폜ƁAqf[^Ƃ̑g̕ڐG̏I󂯎邱
+ * 폜鑤͒ʒm󂯎炸Ǎ̃t[łd˂ĒʒmȂƂm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+#include "Game/Common/Framework/Collision/CollisionMatrix/CollisionMatrix.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	BUILDING_NUM		= 3;		///< ̐
+	constexpr uint32_t	ENEMY_PER_BUILDING	= 4;		///< 1̌͂ޓG̐
+	constexpr uint32_t	FRAME_NUM			= 3;		///< 폜̑Oɔ肷t[
+	constexpr float		BUILDING_SPACING	= 10.0f;	///< ̊Ԋu
+	constexpr float		BUILDING_SIZE		= 2.0f;		///< ̕ӂ̒
+	constexpr float		ENEMY_DISTANCE		= 1.2f;		///< ̒SG̒S܂ł̐
+	constexpr float		ENEMY_RADIUS		= 0.5f;		///< G̔a
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief 󂯎ڐG̊JnƏI𐔂IuWFNg
+	 */
+	class CountingObject
+		: public GameObject
+	{
+	public:
+		GameObjectTag	tag			= GameObjectTag::DEFAULT;
+		size_t			enterNum	= 0;
+		size_t			exitNum		= 0;
+
+		bool IsActive() const override { return true; }
+		GameObjectTag GetTag() const override { return tag; }
+
+		void OnCollisionEnter(const CollisionInfo&) override	{ enterNum++; }
+		void OnCollisionExit(const CollisionInfo&) override		{ exitNum++; }
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief G󂯎ڐG̊JnƏỈ񐔂m߂
+	 *
+	 * @param[in] name		O
+	 * @param[in] enemies	m߂G
+	 * @param[in] enterNum	҂Jn̉
+	 * @param[in] exitNum	҂Ỉ
+	 *
+	 * @returns true SĂ̓G҂ǂ肾
+	 */
+	bool CheckEnemies(const char* name, const std::vector<const CountingObject*>& enemies, size_t enterNum, size_t exitNum)
+	{
+		bool isMatched = true;
+		for (const CountingObject* pEnemy : enemies)
+		{
+			isMatched = isMatched && (pEnemy->enterNum == enterNum) && (pEnemy->exitNum == exitNum);
+		}
+		return Check(isMatched, "%-28s : %zu enemies, Enter %zu, Exit %zu each", name, enemies.size(), enterNum, exitNum);
+	}
+}
+
+
+
+/**
+ * @brief ڐGĂg̕Е폜AcڐG̏I1x󂯎邱Ƃm߂
+ *
+ *  0 ͓G1̍폜A 1 ͌폜B 2 ͎qf[^Ae폜
+ *
+ * @returns true  SĂ̏ꍇŒʒm̉񐔂҂ǂ肾
+ * @returns false 񐔂قȂꍇ
+ */
+bool RunContactRemovalTest()
+{
+	CollisionMatrix matrix;
+	matrix.RegisterDetectionTarget(GameObjectTag::ENEMY, GameObjectTag::BUILDING);
+
+	CollisionManager manager;
+	manager.SetCollisionMatrix(&matrix);
+
+	std::vector<CountingObject> buildings(BUILDING_NUM);
+	std::vector<AABB> buildingColliders;
+	std::vector<CollisionHandle> buildingHandles;
+	buildingColliders.reserve(BUILDING_NUM + 1);
+	for (uint32_t i = 0; i < BUILDING_NUM; i++)
+	{
+		buildingColliders.emplace_back(Vector3(static_cast<float>(i) * BUILDING_SPACING, 0.0f, 0.0f), Vector3(BUILDING_SIZE));
+		buildings[i].tag = GameObjectTag::BUILDING;
+		buildingHandles.push_back(manager.AddCollisionData(CollisionData(&buildings[i], &buildingColliders[i], true, CollisionEventFlag::TRANSITION)));
+	}
+
+	// Ō͓̌`̎qf[^
+	buildingColliders.emplace_back(buildingColliders.back().GetCenter(), Vector3(BUILDING_SIZE));
+	manager.AddCollisionData(CollisionData(&buildings.back(), &buildingColliders.back(), true, CollisionEventFlag::TRANSITION), buildingHandles.back());
+
+	// G͌̎͂݁Aꂼ1̌ɐڐG
+	const uint32_t enemyNum = BUILDING_NUM * ENEMY_PER_BUILDING;
+	std::vector<CountingObject> enemies(enemyNum);
+	std::vector<Sphere> enemyColliders;
+	std::vector<CollisionHandle> enemyHandles;
+	enemyColliders.reserve(enemyNum);
+	for (uint32_t i = 0; i < enemyNum; i++)
+	{
+		const float angle = DirectX::XM_2PI * static_cast<float>(i % ENEMY_PER_BUILDING) / ENEMY_PER_BUILDING;
+		const Vector3 offset(std::cos(angle) * ENEMY_DISTANCE, 0.0f, std::sin(angle) * ENEMY_DISTANCE);
+		enemyColliders.emplace_back(buildingColliders[i / ENEMY_PER_BUILDING].GetCenter() + offset, ENEMY_RADIUS);
+		enemies[i].tag = GameObjectTag::ENEMY;
+		enemyHandles.push_back(manager.AddCollisionData(CollisionData(&enemies[i], &enemyColliders[i], false, CollisionEventFlag::TRANSITION)));
+	}
+
+	auto update = [&]()
+		{
+			for (uint32_t frame = 0; frame < FRAME_NUM; frame++)
+			{
+				manager.RequestCollisionDetection();
+				manager.UpdateTask(0.0f);
+			}
+		};
+
+	// Ƃ̓G
+	auto collectEnemies = [&](uint32_t building, uint32_t first)
+		{
+			std::vector<const CountingObject*> result;
+			for (uint32_t i = first; i < ENEMY_PER_BUILDING; i++) { result.push_back(&enemies[building * ENEMY_PER_BUILDING + i]); }
+			return result;
+		};
+
+	update();
+
+	bool isPassed = true;
+	isPassed &= CheckEnemies("before removal", collectEnemies(0, 0), 1, 0);
+
+	// G폜ƁAcI󂯎
+	const size_t buildingExitNum = buildings[0].exitNum;
+	manager.RemoveCollisionData(enemyHandles[0]);
+	isPassed &= Check(buildings[0].exitNum == buildingExitNum + 1 && enemies[0].exitNum == 0,
+		"%-28s : survivor Exit %zu, removed Exit %zu", "remove an enemy", buildings[0].exitNum - buildingExitNum, enemies[0].exitNum);
+
+	// 폜ƁA͂łGꂼI󂯎
+	manager.RemoveCollisionObjectData(&buildings[1], &buildingColliders[1]);
+	isPassed &= CheckEnemies("remove a building", collectEnemies(1, 0), 1, 1);
+	isPassed &= Check(buildings[1].exitNum == 0, "%-28s : removed Exit %zu", "remove a building", buildings[1].exitNum);
+
+	// qf[^폜ƁAqf[^Ƃ̑g̕I󂯎
+	manager.RemoveCollisionData(buildingHandles[2]);
+	isPassed &= CheckEnemies("remove a building with child", collectEnemies(2, 0), 2, 2);
+
+	// ̌̃t[ł͏d˂ĒʒmȂ
+	update();
+	isPassed &= Check(buildings[0].exitNum == buildingExitNum + 1 && enemies[0].exitNum == 0,
+		"%-28s : survivor Exit %zu, removed Exit %zu", "after removal (enemy)", buildings[0].exitNum - buildingExitNum, enemies[0].exitNum);
+	isPassed &= CheckEnemies("after removal (others)", collectEnemies(0, 1), 1, 0);
+	isPassed &= CheckEnemies("after removal (building)", collectEnemies(1, 0), 1, 1);
+	isPassed &= CheckEnemies("after removal (child)", collectEnemies(2, 0), 2, 2);
+
+	return isPassed;
+}
@@ -0,0 +1,264 @@
+/*****************************************************************//**
+ * @file    ContinuousCollisionTest.cpp
+ * @brief   AIȏՓ˔̃eXgɊւ\[Xt@C
+ *
+ * ǁi̖ Box2D ƁA 5cm  AABBjɁA1`200 m/s ̋ 60fps Ō݁A
+ * AIȈړŕǂʂ蔲ȂƂƁAƂm߂ĎԂvB
+ * ɏ߂荞ŗJvZ AABB ̕ǂɌĉɓAƏdȂ܂܂łǂʂ蔲ȂƂm߂
+ * iJvZ̔ AABB ƋɂΉĂj
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	SHOT_NUM		= 10000;		///< 񐔁iǂƁj
+	constexpr uint32_t	SEED			= 0;			///< ̎
+	constexpr float		DELTA_TIME		= 1.0f / 60.0f;	///< 1t[̎
+	constexpr float		MIN_SPEED		= 1.0f;			///< ̍Œ̑
+	constexpr float		MAX_SPEED		= 200.0f;		///< ̍ō̑
+	constexpr float		WALL_HALF_SIZE	= 5.0f;			///< ǂ̏c̔iǂ x = 0 ̖ʁj
+	constexpr float		AABB_THICKNESS	= 0.05f;		///< AABB ̕ǂ̌
+	constexpr float		TOI_TOLERANCE	= 1e-3f;		///< ʒűe덷
+	constexpr int		MAX_FRAME_NUM	= 8;			///< 1̎ˌœt[
+	constexpr float		CAPSULE_LENGTH	= 1.0f;			///< ɗJvZ̎̒
+	constexpr float		FLOOR_SINK		= 0.01f;		///< ɗJvZɂ߂荞ސ[ȉʂ y = 0j
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief n`Ƃēo^IuWFNg
+	 */
+	class TerrainObject
+		: public GameObject
+	{
+	public:
+		GameObjectTag tag = GameObjectTag::WALL;
+
+		bool IsActive() const override { return true; }
+		GameObjectTag GetTag() const override { return tag; }
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief 1̕ǂɋ݁Aʂ蔲Ɠm߂
+	 *
+	 * ʏ̔iړ̏dȂjŌmłȂƁA1̈ړɂԂ킹ďo͂
+	 *
+	 * @param[in] name			O
+	 * @param[in] pWallCollider	ǂ̃RC_[
+	 * @param[in] tag			ǂ̃^O
+	 * @param[in] isStatic		ǂÓIǂ
+	 * @param[in] wallBackX		ǂ̗ x Wizʂ蔲j
+	 *
+	 * @returns true ʂ蔲ASĐ
+	 */
+	bool RunShots(const char* name, ICollider* pWallCollider, GameObjectTag tag, bool isStatic, float wallBackX)
+	{
+		std::mt19937 random(SEED);
+		std::uniform_real_distribution<float> speedDistribution(MIN_SPEED, MAX_SPEED);
+		std::uniform_real_distribution<float> radiusDistribution(0.1f, 1.0f);
+		std::uniform_real_distribution<float> offsetDistribution(-0.5f, 0.5f);
+		std::uniform_real_distribution<float> targetDistribution(-WALL_HALF_SIZE * 0.6f, WALL_HALF_SIZE * 0.6f);
+		std::uniform_real_distribution<float> phaseDistribution(0.0f, 1.0f);
+
+		CollisionManager manager;
+		TerrainObject wall;
+		wall.tag = tag;
+		manager.AddCollisionData(CollisionData(&wall, pWallCollider, isStatic));
+
+		const QueryFilter filter(static_cast<uint32_t>(tag));
+
+		size_t tunnelNum = 0;
+		size_t discreteMissNum = 0;
+		size_t toiErrorNum = 0;
+		size_t moveNum = 0;
+		double moveMs = 0.0;
+
+		for (uint32_t shot = 0; shot < SHOT_NUM; shot++)
+		{
+			const float speed	= speedDistribution(random);
+			const float radius	= radiusDistribution(random);
+
+			Vector3 direction(1.0f, offsetDistribution(random), offsetDistribution(random));
+			direction.Normalize();
+
+			// ǂ̎OA1t[̈ړʂ̂ǂ猂it[̋؂ƕǂ̈ʒu炷j
+			const Vector3 target(0.0f, targetDistribution(random), targetDistribution(random));
+			const float startDistance = radius + 0.01f + speed * DELTA_TIME * (1.0f + phaseDistribution(random));
+			Vector3 position = target - direction * (startDistance / direction.x);
+			Vector3 velocity = direction * speed;
+
+			// ʏ̔î܂ܓAړɏdȂĂ邩ǂj
+			bool isDiscreteHit = false;
+			for (int frame = 1; frame <= MAX_FRAME_NUM && !isDiscreteHit; frame++)
+			{
+				isDiscreteHit = (manager.OverlapSphere(position + velocity * (DELTA_TIME * frame), radius, nullptr, filter) > 0);
+			}
+			if (!isDiscreteHit) discreteMissNum++;
+
+			bool isFirstHit = true;
+			for (int frame = 0; frame < MAX_FRAME_NUM; frame++)
+			{
+				const Vector3 displacement = velocity * DELTA_TIME;
+
+				QueryHit hit;
+				Vector3 moved;
+				moveMs += MeasureMilliseconds([&]() { moved = manager.CalcContinuousMove(Sphere(position, radius), displacement, filter, &velocity, &hit); });
+				moveNum++;
+
+				// ŏɖʂœ́ASǂ̎O radius ̈ʒuɗ鎞ƈv
+				if (hit.pCollider && isFirstHit)
+				{
+					isFirstHit = false;
+					const Vector3 hitCenter = position + displacement * hit.time;
+					if (std::abs(hitCenter.x + radius) > TOI_TOLERANCE) toiErrorNum++;
+				}
+
+				const Vector3 nextPosition = position + moved;
+				if (nextPosition.x > wallBackX)
+				{
+					tunnelNum++;
+					break;
+				}
+				position = nextPosition;
+			}
+		}
+
+		std::printf("%-15s : discrete miss %5zu / %u, %.3f us / move\n",
+			name, discreteMissNum, SHOT_NUM, (moveNum > 0) ? moveMs * 1000.0 / moveNum : 0.0);
+
+		bool isPassed = true;
+		isPassed &= Check(tunnelNum == 0, "%-15s : tunnel %zu / %u", name, tunnelNum, SHOT_NUM);
+		isPassed &= Check(toiErrorNum == 0, "%-15s : time of impact error %zu / %u", name, toiErrorNum, SHOT_NUM);
+		return isPassed;
+	}
+
+
+
+	/**
+	 * @brief ɗJvZ1̕ǂɌĉɓAʂ蔲ȂƂm߂
+	 *
+	 * JvZ͎n߂珰ƏdȂĂ邪Aɉēߏł͎~܂炸AǂŎ~܂
+	 *
+	 * @param[in] name			O
+	 * @param[in] pWallCollider	ǂ̃RC_[
+	 * @param[in] tag			ǂ̃^O
+	 * @param[in] isStatic		ǂÓIǂ
+	 * @param[in] wallBackX		ǂ̗ x Wizʂ蔲j
+	 *
+	 * @returns true ʂ蔲ASĂ̎ˌǂɓ
+	 */
+	bool RunRestingCapsuleShots(const char* name, ICollider* pWallCollider, GameObjectTag tag, bool isStatic, float wallBackX)
+	{
+		std::mt19937 random(SEED);
+		std::uniform_real_distribution<float> speedDistribution(MIN_SPEED, MAX_SPEED);
+		std::uniform_real_distribution<float> radiusDistribution(0.2f, 0.5f);
+		std::uniform_real_distribution<float> offsetDistribution(-0.5f, 0.5f);
+		std::uniform_real_distribution<float> targetDistribution(-WALL_HALF_SIZE * 0.6f, WALL_HALF_SIZE * 0.6f);
+		std::uniform_real_distribution<float> phaseDistribution(0.0f, 1.0f);
+
+		CollisionManager manager;
+		TerrainObject floor;
+		floor.tag = GameObjectTag::FLOOR;
+		AABB floorBox(Vector3(0.0f, -0.5f, 0.0f), Vector3(WALL_HALF_SIZE * 8.0f, 1.0f, WALL_HALF_SIZE * 8.0f));
+		manager.AddCollisionData(CollisionData(&floor, &floorBox, true));
+
+		TerrainObject wall;
+		wall.tag = tag;
+		manager.AddCollisionData(CollisionData(&wall, pWallCollider, isStatic));
+
+		const QueryFilter filter(static_cast<uint32_t>(GameObjectTag::FLOOR) | static_cast<uint32_t>(tag));
+
+		size_t tunnelNum = 0;
+		size_t wallMissNum = 0;
+
+		for (uint32_t shot = 0; shot < SHOT_NUM; shot++)
+		{
+			const float speed	= speedDistribution(random);
+			const float radius	= radiusDistribution(random);
+
+			Vector3 direction(1.0f, 0.0f, offsetDistribution(random));
+			direction.Normalize();
+
+			// ǂ̎OA1t[̈ړʂ̂ǂ珰ɉē
+			const Vector3 target(0.0f, radius + CAPSULE_LENGTH * 0.5f - FLOOR_SINK, targetDistribution(random));
+			const float startDistance = radius + 0.01f + speed * DELTA_TIME * (1.0f + phaseDistribution(random));
+			Vector3 position = target - direction * (startDistance / direction.x);
+			Vector3 velocity = direction * speed;
+
+			bool isWallHit = false;
+			for (int frame = 0; frame < MAX_FRAME_NUM; frame++)
+			{
+				QueryHit hit;
+				const Vector3 moved = manager.CalcContinuousMove(Capsule(Vector3::UnitY, CAPSULE_LENGTH, position, radius), velocity * DELTA_TIME, filter, &velocity, &hit);
+				if (hit.pCollider == pWallCollider) isWallHit = true;
+
+				const Vector3 nextPosition = position + moved;
+				if (nextPosition.x > wallBackX)
+				{
+					tunnelNum++;
+					break;
+				}
+				position = nextPosition;
+			}
+			if (!isWallHit) wallMissNum++;
+		}
+
+		bool isPassed = true;
+		isPassed &= Check(tunnelNum == 0, "%-15s : capsule on floor tunnel %zu / %u", name, tunnelNum, SHOT_NUM);
+		isPassed &= Check(wallMissNum == 0, "%-15s : capsule on floor missed wall %zu / %u", name, wallMissNum, SHOT_NUM);
+		return isPassed;
+	}
+}
+
+
+
+/**
+ * @brief ǂɑ݁AAIȈړŒʂ蔲Ƃm߂
+ *
+ * @returns true  ǂ̕ǂłʂ蔲AAɗJvZ AABB ̕ǂŎ~܂
+ * @returns false ʂ蔲AĂˌ
+ */
+bool RunContinuousCollisionTest()
+{
+	std::printf("%u shots, %.0f - %.0f m/s\n", SHOT_NUM, MIN_SPEED, MAX_SPEED);
+
+	Box2D wallBox(
+		Vector3(0.0f, -WALL_HALF_SIZE, -WALL_HALF_SIZE),
+		Vector3(0.0f,  WALL_HALF_SIZE, -WALL_HALF_SIZE),
+		Vector3(0.0f,  WALL_HALF_SIZE,  WALL_HALF_SIZE),
+		Vector3(0.0f, -WALL_HALF_SIZE,  WALL_HALF_SIZE));
+	AABB buildingBox(Vector3(AABB_THICKNESS * 0.5f, 0.0f, 0.0f), Vector3(AABB_THICKNESS, WALL_HALF_SIZE * 2.0f, WALL_HALF_SIZE * 2.0f));
+
+	bool isPassed = true;
+	isPassed &= RunShots("wall (Box2D)", &wallBox, GameObjectTag::WALL, false, 0.0f);
+	isPassed &= RunShots("building (AABB)", &buildingBox, GameObjectTag::BUILDING, true, AABB_THICKNESS);
+	isPassed &= RunRestingCapsuleShots("building (AABB)", &buildingBox, GameObjectTag::BUILDING, true, AABB_THICKNESS);
+	return isPassed;
+}
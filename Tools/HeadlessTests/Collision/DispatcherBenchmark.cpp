@@ -0,0 +1,452 @@
+/*****************************************************************//**
+ * @file    DispatcherBenchmark.cpp
+ * @brief   Փ˔̐U蕪̌vɊւ\[Xt@C
+ *
+ * ނ̍RC_[烉_ɑgIŔ肵A\ɂU蕪
+ * ] if  dynamic_cast ɂU蕪ƔׂāAʂv邱Ƃm߂ĎԂv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/CollisionDispatcher/CollisionDispatcher.h"
+#include "Game/Common/Utillities/Collision/Collision.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	DISPATCH_NUM	= 1000000;	///< ̉
+	constexpr int		COLLIDER_NUM	= 256;		///< RC_[̐
+	constexpr uint32_t	SEED			= 0;		///< ̎
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ] if  dynamic_cast ɂU蕪iv̔rpj
+	 */
+	bool DetectCollisionLegacy(const ICollider* pColliderA, const ICollider* pColliderB)
+	{
+		// RC_[̎ނʂȂ
+		if (pColliderA->GetColliderType() == ColliderType::Plane)
+		{
+			// ʂɃLXg
+			const Plane* pPlane = dynamic_cast<const Plane*>(pColliderA);
+			if (pPlane == nullptr) return false;
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Sphere)
+			{
+				// ɃLXg
+				const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
+				if (pSphere == nullptr) return false;
+
+				return (pPlane->CheckHit(*pSphere));
+
+			}
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Segment)
+			{
+				// ɃLXg
+				const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
+				if (pSegment == nullptr) return false;
+
+				return (pPlane->CheckHit(*pSegment));
+
+			}
+		}
+
+		// RC_[̎ނȂ
+		if (pColliderA->GetColliderType() == ColliderType::Sphere)
+		{
+			// ʂɃLXg
+			const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderA);
+			if (pSphere == nullptr) return false;
+
+			// Е̃RC_[̎ނʂȂ
+			if (pColliderB->GetColliderType() == ColliderType::Plane)
+			{
+				// ɃLXg
+				const Plane* pPlane = dynamic_cast<const Plane*>(pColliderB);
+				if (pPlane == nullptr) return false;
+
+				return (pSphere->CheckHit(*pPlane));
+
+			}
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Segment)
+			{
+				// ɃLXg
+				const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
+				if (pSegment == nullptr) return false;
+
+				return (pSphere->CheckHit(*pSegment));
+			}
+			// Е̃RC_[̎ނOp`Ȃ
+			if (pColliderB->GetColliderType() == ColliderType::Triangle)
+			{
+				// ɃLXg
+				const Triangle* pTriangle = dynamic_cast<const Triangle*>(pColliderB);
+				if (pTriangle == nullptr) return false;
+
+				return (pSphere->CheckHit(*pTriangle));
+			}
+
+			// Е̃RC_[̎ނOp`Ȃ
+			if (pColliderB->GetColliderType() == ColliderType::BOX2D)
+			{
+				// ɃLXg
+				const Box2D* pBox = dynamic_cast<const Box2D*>(pColliderB);
+				if (pBox == nullptr) return false;
+
+				return (pSphere->CheckHit(*pBox));
+			}
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Sphere)
+			{
+				// ɃLXg
+				const Sphere* pSphereB = dynamic_cast<const Sphere*>(pColliderB);
+				if (pSphereB == nullptr) return false;
+
+				return (pSphere->CheckHit(*pSphereB));
+			}
+
+			// Е̃RC_[AABBȂ
+			if (pColliderB->GetColliderType() == ColliderType::AABB)
+			{
+				// AABBɃLXg
+				const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
+				if (pAABB == nullptr) return false;
+
+				return (pSphere->CheckHit(*pAABB));
+			}
+			// Е̃RC_[̃JvZȂ
+			if (pColliderB->GetColliderType() == ColliderType::Capsule)
+			{
+				// CapsuleɃLXg
+				const Capsule* pCapsule = dynamic_cast<const Capsule*>(pColliderB);
+				if (pCapsule == nullptr) return false;
+
+				return (pSphere->CheckHit(*pCapsule));
+			}
+		}
+
+		// RC_[̎ނOp`Ȃ
+		if (pColliderA->GetColliderType() == ColliderType::Triangle)
+		{
+			// Op`ɃLXg
+			const Triangle* pTriangle = dynamic_cast<const Triangle*>(pColliderA);
+			if (pTriangle == nullptr) return false;
+
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Sphere)
+			{
+				// ɃLXg
+				const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
+				if (pSphere == nullptr) return false;
+
+				return (pTriangle->CheckHit(*pSphere));
+
+			}
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Segment)
+			{
+				// ɃLXg
+				const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
+				if (pSegment == nullptr) return false;
+
+				return (pTriangle->CheckHit(*pSegment));
+
+			}
+		}
+
+		// RC_[̎ނlp`Ȃ
+		if (pColliderA->GetColliderType() == ColliderType::BOX2D)
+		{
+			// Op`ɃLXg
+			const Box2D* pBox = dynamic_cast<const Box2D*>(pColliderA);
+			if (pBox == nullptr) return false;
+
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Sphere)
+			{
+				// ɃLXg
+				const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
+				if (pSphere == nullptr) return false;
+
+				return (pBox->CheckHit(*pSphere));
+
+			}
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Segment)
+			{
+				// ɃLXg
+				const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
+				if (pSegment == nullptr) return false;
+
+				return (pBox->CheckHit(*pSegment));
+
+			}
+		}
+
+		// RC_[̎ނȂ
+		if (pColliderA->GetColliderType() == ColliderType::Segment)
+		{
+			// Op`ɃLXg
+			const Segment* pSegment = dynamic_cast<const Segment*>(pColliderA);
+			if (pSegment == nullptr) return false;
+
+
+			// Е̃RC_[̎ނʂȂ
+			if (pColliderB->GetColliderType() == ColliderType::Plane)
+			{
+				// ɃLXg
+				const Plane* pPlane = dynamic_cast<const Plane*>(pColliderB);
+				if (pPlane == nullptr) return false;
+
+				return (pSegment->CheckHit(*pPlane));
+
+			}
+
+
+			// Е̃RC_[̎ނOp`Ȃ
+			if (pColliderB->GetColliderType() == ColliderType::Triangle)
+			{
+				// ɃLXg
+				const Triangle* pTriangle = dynamic_cast<const Triangle*>(pColliderB);
+				if (pTriangle == nullptr) return false;
+
+				return (pSegment->CheckHit(*pTriangle));
+			}
+
+			// Е̃RC_[̎ނlp`Ȃ
+			if (pColliderB->GetColliderType() == ColliderType::BOX2D)
+			{
+				// ɃLXg
+				const Box2D* pBox = dynamic_cast<const Box2D*>(pColliderB);
+				if (pBox == nullptr) return false;
+
+				return (pSegment->CheckHit(*pBox));
+			}
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Sphere)
+			{
+				// ɃLXg
+				const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
+				if (pSphere == nullptr) return false;
+
+				return (pSegment->CheckHit(*pSphere));
+			}
+
+
+			// Е̃RC_[AABBȂ
+			if (pColliderB->GetColliderType() == ColliderType::AABB)
+			{
+				// AABBɃLXg
+				const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
+				if (pAABB == nullptr) return false;
+
+				return (pSegment->CheckHit(*pAABB));
+			}
+
+		}
+
+		// RC_[̎ނAABBȂ
+		if (pColliderA->GetColliderType() == ColliderType::AABB)
+		{	// AABBɃLXg
+			const AABB* pAABB = dynamic_cast<const AABB*>(pColliderA);
+
+			// Е̃RC_[AABBȂ
+			if (pColliderB->GetColliderType() == ColliderType::AABB)
+			{
+				// AABBɃLXg
+				const AABB* pAABB_B = dynamic_cast<const AABB*>(pColliderB);
+				if (pAABB_B == nullptr) return false;
+
+				return (pAABB->CheckHit(*pAABB_B));
+			}
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Segment)
+			{
+				// ɃLXg
+				const Segment* pSegment = dynamic_cast<const Segment*>(pColliderB);
+				if (pSegment == nullptr) return false;
+
+				return (pAABB->CheckHit(*pSegment));
+
+			}
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Sphere)
+			{
+				// ɃLXg
+				const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
+				if (pSphere == nullptr) return false;
+
+				return (pAABB->CheckHit(*pSphere));
+
+			}
+
+			// Е̃RC_[̎ނȂ
+			if (pColliderB->GetColliderType() == ColliderType::Cylinder)
+			{
+				// ɃLXg
+				const Cylinder* pCylinder = dynamic_cast<const Cylinder*>(pColliderB);
+				if (pCylinder == nullptr) return false;
+
+				return (pAABB->CheckHit(*pCylinder));
+
+			}
+
+			// Е̃RC_[̎ނJvZȂ
+			if (pColliderB->GetColliderType() == ColliderType::Capsule)
+			{
+				// JvZɃLXg
+				const Capsule* pCapsule = dynamic_cast<const Capsule*>(pColliderB);
+				if (pCapsule == nullptr) return false;
+
+				return (pAABB->CheckHit(*pCapsule));
+
+			}
+		}
+
+		// RC_[̎ނȂ
+		if (pColliderA->GetColliderType() == ColliderType::Cylinder)
+		{	// AABBɃLXg
+			const Cylinder* pCylinder = dynamic_cast<const Cylinder*>(pColliderA);
+
+			// Е̃RC_[AABBȂ
+			if (pColliderB->GetColliderType() == ColliderType::AABB)
+			{
+				// AABBɃLXg
+				const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
+				if (pAABB == nullptr) return false;
+
+				return (pAABB->CheckHit(*pCylinder));
+			}
+		}
+
+		// RC_[̎ނJvZȂ
+		if (pColliderA->GetColliderType() == ColliderType::Capsule)
+		{	// AABBɃLXg
+			const Capsule* pCapsule = dynamic_cast<const Capsule*>(pColliderA);
+
+			// Е̃RC_[SphereȂ
+			if (pColliderB->GetColliderType() == ColliderType::Sphere)
+			{
+				// SphereɃLXg
+				const Sphere* pSphere = dynamic_cast<const Sphere*>(pColliderB);
+				if (pSphere == nullptr) return false;
+
+				return (pSphere->CheckHit(*pCapsule));
+			}
+
+			// Е̃RC_[AABBȂ
+			if (pColliderB->GetColliderType() == ColliderType::AABB)
+			{
+				// AABBɃLXg
+				const AABB* pAABB = dynamic_cast<const AABB*>(pColliderB);
+				if (pAABB == nullptr) return false;
+
+				return (pAABB->CheckHit(*pCapsule));
+			}
+		}
+
+		return false;
+	}
+}
+
+
+
+/**
+ * @brief Փ˔̐U蕪]̐U蕪ƔׁAʂv邱Ƃm߂ĎԂv
+ *
+ * @returns true  SĂ̑gŌʂv
+ * @returns false ʂHႤg
+ */
+bool RunDispatcherBenchmark()
+{
+	using namespace DirectX::SimpleMath;
+
+	std::mt19937 random(SEED);
+	auto randomValue = [&](float min, float max) { return std::uniform_real_distribution<float>(min, max)(random); };
+	auto randomPoint = [&]() { return Vector3(randomValue(-5.0f, 5.0f), randomValue(-5.0f, 5.0f), randomValue(-5.0f, 5.0f)); };
+
+	// ނ̍RC_[
+	std::vector<std::unique_ptr<ICollider>> colliders;
+	colliders.reserve(COLLIDER_NUM);
+	for (int i = 0; i < COLLIDER_NUM; i++)
+	{
+		const Vector3 position = randomPoint();
+		switch (i % 8)
+		{
+		case 0: colliders.push_back(std::make_unique<Sphere>(position, randomValue(0.5f, 2.0f))); break;
+		case 1: colliders.push_back(std::make_unique<AABB>(position, Vector3(randomValue(0.5f, 3.0f)))); break;
+		case 2: colliders.push_back(std::make_unique<Segment>(position, randomPoint())); break;
+		case 3: colliders.push_back(std::make_unique<Capsule>(Vector3::Up, randomValue(0.5f, 3.0f), position, randomValue(0.2f, 1.0f))); break;
+		case 4: colliders.push_back(std::make_unique<Cylinder>(Vector3::Up, randomValue(0.5f, 3.0f), position, randomValue(0.2f, 1.0f))); break;
+		case 5: colliders.push_back(std::make_unique<Triangle>(position, randomPoint(), randomPoint())); break;
+		case 6: colliders.push_back(std::make_unique<Box2D>(position, position + Vector3::Right, position + Vector3(1.0f, 0.0f, 1.0f), position + Vector3::Backward)); break;
+		default: colliders.push_back(std::make_unique<::Plane>(Vector3::Up, position)); break;
+		}
+	}
+
+	std::vector<std::pair<uint32_t, uint32_t>> pairs(DISPATCH_NUM);
+	for (auto& pair : pairs)
+	{
+		pair.first	= static_cast<uint32_t>(random() % COLLIDER_NUM);
+		pair.second = static_cast<uint32_t>(random() % COLLIDER_NUM);
+	}
+
+	auto measure = [&](const char* name, CollisionDispatcher::DetectFunction detect, std::vector<uint8_t>* pResults)
+		{
+			pResults->resize(DISPATCH_NUM);
+
+			size_t hitNum = 0;
+			const double ms = MeasureMilliseconds([&]()
+				{
+					for (uint32_t i = 0; i < DISPATCH_NUM; i++)
+					{
+						const bool isHit = detect(colliders[pairs[i].first].get(), colliders[pairs[i].second].get());
+						(*pResults)[i] = isHit;
+						hitNum += isHit;
+					}
+				});
+
+			std::printf("%-24s : %u dispatches, %6zu hits, %8.3f ms\n", name, DISPATCH_NUM, hitNum, ms);
+			return ms;
+		};
+
+	std::vector<uint8_t> legacyResults;
+	std::vector<uint8_t> tableResults;
+	const double legacyMs	= measure("if chain + dynamic_cast", &DetectCollisionLegacy, &legacyResults);
+	const double tableMs	= measure("function table", &CollisionDispatcher::DetectCollision, &tableResults);
+	std::printf("function table : x%.2f faster than if chain\n", legacyMs / tableMs);
+
+	size_t mismatchNum = 0;
+	for (uint32_t i = 0; i < DISPATCH_NUM; i++)
+	{
+		mismatchNum += (legacyResults[i] != tableResults[i]);
+	}
+
+	return Check(mismatchNum == 0, "function table equals if chain in %zu / %u dispatches", DISPATCH_NUM - mismatchNum, DISPATCH_NUM);
+}
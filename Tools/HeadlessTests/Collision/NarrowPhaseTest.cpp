@@ -0,0 +1,147 @@
+/*****************************************************************//**
+ * @file    NarrowPhaseTest.cpp
+ * @brief   ڍה̕񉻂̃eXgɊւ\[Xt@C
+ *
+ * ̎ŌŒ肵ʂ 1 / 2 / 4 / 8 XbhŔ肵A
+ * Փˌʂ̓eƏXbhɂ炸Ƃm߂ĎԂv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "CollisionTestScene.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionDetectionWorker/CollisionDetectionWorker.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	THREAD_NUMS[]	= { 1, 2, 4, 8 };	///< ڍהɎgXbh
+	constexpr uint32_t	DYNAMIC_NUM		= 4000;				///< vf̐
+	constexpr uint32_t	SEED			= 20261017;			///< ̎
+	constexpr int		FRAME_NUM		= 20;				///< vt[
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ՓˌʂeƏ܂œǂ
+	 *
+	 * @param[in] expected	̌
+	 * @param[in] results	ׂ錋
+	 *
+	 * @return ŏɈقȂʒuiȂ -1j
+	 */
+	long long FindFirstDifference(const std::vector<DetectedCollisonData>& expected, const std::vector<DetectedCollisonData>& results)
+	{
+		const size_t num = std::min(expected.size(), results.size());
+		for (size_t i = 0; i < num; i++)
+		{
+			if (expected[i].collisionDataIdA != results[i].collisionDataIdA || expected[i].collisionDataIdB != results[i].collisionDataIdB)
+			{
+				return static_cast<long long>(i);
+			}
+		}
+		return (expected.size() == results.size()) ? -1 : static_cast<long long>(num);
+	}
+}
+
+
+
+/**
+ * @brief ڍהXbhςčsAʂƂm߂ĎԂv
+ *
+ * ƃXbhɓXibvVbgJԂnA˗犮܂ł̎ԁiL攻܂ށj𕽋ς
+ *
+ * @returns true  SẴXbh 1 XbhƓʂɂȂ
+ * @returns false ʂقȂXbh
+ */
+bool RunNarrowPhaseThreadTest()
+{
+	const CollisionTestScene scene(DYNAMIC_NUM, SEED);
+
+	CollisionSnapshot staticSnapshot;
+	scene.CreateSnapshot(true, &staticSnapshot);
+	const std::shared_ptr<const StaticCollisionSet> staticSet = CollisionDetectionWorker::CreateStaticCollisionSet(std::move(staticSnapshot));
+
+	std::printf("%zu elements (%u dynamic roots), %u frames, hardware threads %u\n",
+		scene.GetElements().size(), DYNAMIC_NUM, FRAME_NUM, std::thread::hardware_concurrency());
+
+	bool isPassed = true;
+	std::vector<DetectedCollisonData> expected;
+	double baseMs = 0.0;
+
+	for (const uint32_t threadNum : THREAD_NUMS)
+	{
+		CollisionDetectionWorker worker;
+		worker.SetCollisionMatrix(scene.GetMatrix());
+		worker.SetThreadNum(threadNum);
+
+		// ƃXbhƌ݂ɎgXibvVbgiǂej
+		auto createSnapshot = [&]()
+			{
+				auto snapshot = std::make_unique<CollisionSnapshot>();
+				scene.CreateSnapshot(false, snapshot.get());
+				return snapshot;
+			};
+		std::unique_ptr<CollisionSnapshot> spare = createSnapshot();
+		std::unique_ptr<CollisionSnapshot> previous;
+		auto detect = [&]()
+			{
+				previous = worker.StartAsync(std::move(spare), staticSet);
+				worker.WaitForEndCalculation();
+			};
+		auto swapSnapshot = [&]() { spare = (previous) ? std::move(previous) : createSnapshot(); };
+
+		// ŏ1̓Xbh̍쐬Ɗmۂ܂ނߌvȂ
+		detect();
+		swapSnapshot();
+
+		bool isSame = true;
+		long long firstDifference = -1;
+		double totalMs = 0.0;
+		std::vector<DetectedCollisonData> results;
+		for (int frame = 0; frame < FRAME_NUM; frame++)
+		{
+			totalMs += MeasureMilliseconds(detect);
+			swapSnapshot();
+			results = worker.GetDetectionResults();
+
+			if (expected.empty()) { expected = results; }
+
+			const long long difference = FindFirstDifference(expected, results);
+			if (difference >= 0 && isSame)
+			{
+				isSame = false;
+				firstDifference = difference;
+			}
+		}
+
+		const double averageMs = totalMs / FRAME_NUM;
+		if (threadNum == 1) { baseMs = averageMs; }
+
+		if (isSame)
+		{
+			isPassed &= Check(!results.empty(), "%u threads : %6zu hits, %8.3f ms/frame (x%4.2f), same content and order as 1 thread",
+				threadNum, results.size(), averageMs, baseMs / averageMs);
+		}
+		else
+		{
+			isPassed &= Check(false, "%u threads : %6zu hits (1 thread %zu), first difference at %lld",
+				threadNum, results.size(), expected.size(), firstDifference);
+		}
+	}
+
+	return isPassed;
+}
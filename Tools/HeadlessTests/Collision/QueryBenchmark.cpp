@@ -0,0 +1,191 @@
+/*****************************************************************//**
+ * @file    QueryBenchmark.cpp
+ * @brief   Ԍ̌vɊւ\[Xt@C
+ *
+ * ̎ŌŒ肵Xe[Ŵ悤ȏʁiAvfȂjՓ˔Ǘɓo^ă_ȌsA
+ * ̏dȂSi] RetrieveCollisionData Ɠ@ǰʂƔׂāAނƂ̎Ԃv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "CollisionTestScene.h"
+#include "Game/Common/Framework/Collision/CollisionDispatcher/CollisionDispatcher.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	DYNAMIC_NUM		= 300;		///< vf̐
+	constexpr uint32_t	BUILDING_NUM	= 2000;		///< ̐iǂƍ͂̔j
+	constexpr uint32_t	QUERY_NUM		= 10000;	///< ނƂ̌̉
+	constexpr uint32_t	SEED			= 20261017;	///< ̎
+	constexpr float		QUERY_RADIUS	= 2.0f;		///< ̔aiAABB ͂2{̕Ӂj
+	constexpr float		QUERY_DISTANCE	= 50.0f;	///< Ƒ|̍ő勗
+	constexpr float		DISTANCE_EPSILON = 1.0e-4f;	///< ̔r̋e덷iő勗̈ႢŖ̌ςj
+
+	/// n`̃^OiQ[̘AIȏՓ˔Ɠi荞݁j
+	const uint32_t TERRAIN_TAGS = static_cast<uint32_t>(GameObjectTag::BUILDING | GameObjectTag::WALL | GameObjectTag::FLOOR);
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ̉񐔂Ԃ񏈗sAԂƓo͂
+	 *
+	 * @param[in] name		O
+	 * @param[in] function	i Ԗڂ̌sAԂ
+	 *
+	 * @return ԁi~bj
+	 */
+	template <typename TFunction>
+	double MeasureQueries(const char* name, TFunction&& function)
+	{
+		size_t hitNum = 0;
+		const double ms = MeasureMilliseconds([&]()
+			{
+				for (uint32_t i = 0; i < QUERY_NUM; i++)
+				{
+					hitNum += function(i);
+				}
+			});
+
+		std::printf("%-22s : %u queries, %7zu hits, %9.3f ms\n", name, QUERY_NUM, hitNum, ms);
+		return ms;
+	}
+}
+
+
+
+/**
+ * @brief ԌSƔׁAʂv邱Ƃm߂ĎԂv
+ *
+ * @returns true  ̏dȂ肪SƈvA̍ŏ̏Փ˂SĂ̏Փ˂̐擪ƈv
+ * @returns false vȂ
+ */
+bool RunQueryBenchmark()
+{
+	CollisionTestScene scene(DYNAMIC_NUM, SEED, BUILDING_NUM);
+	const auto& elements = scene.GetElements();
+
+	CollisionManager manager;
+	scene.Register(&manager);
+
+	// ͈́iÓIȃRC_[ޔ͈́j
+	Vector3 areaMin(FLT_MAX);
+	Vector3 areaMax(-FLT_MAX);
+	for (const auto& element : elements)
+	{
+		Vector3 min, max;
+		if (element.isStatic && CalcBoundingBox(*element.pCollider, &min, &max))
+		{
+			areaMin = Vector3::Min(areaMin, min);
+			areaMax = Vector3::Max(areaMax, max);
+		}
+	}
+
+	std::mt19937 random(SEED);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+	std::vector<Vector3> points(QUERY_NUM);
+	std::vector<Vector3> directions(QUERY_NUM);
+	for (uint32_t i = 0; i < QUERY_NUM; i++)
+	{
+		points[i] = Vector3(
+			std::uniform_real_distribution<float>(areaMin.x, areaMax.x)(random),
+			std::uniform_real_distribution<float>(areaMin.y, areaMax.y)(random),
+			std::uniform_real_distribution<float>(areaMin.z, areaMax.z)(random));
+		directions[i] = Vector3(unit(random), unit(random), unit(random));
+		directions[i].Normalize();
+	}
+
+	std::printf("%zu colliders, area (%.0f, %.0f, %.0f) - (%.0f, %.0f, %.0f)\n",
+		elements.size(), areaMin.x, areaMin.y, areaMin.z, areaMax.x, areaMax.y, areaMax.z);
+
+	// ŏ̌Ōp̊Kw邽߁Av̑Oɍς܂
+	manager.OverlapSphere(points[0], QUERY_RADIUS, nullptr);
+
+	// ʂ̔r ---------------------------------------------------------------
+	std::vector<QueryHit> hits;
+	std::vector<const ICollider*> expected;
+	std::vector<const ICollider*> actual;
+	uint32_t sphereMismatchNum = 0;
+	uint32_t rayMismatchNum = 0;
+	for (uint32_t i = 0; i < QUERY_NUM; i++)
+	{
+		// ̏dȂ
+		const Sphere sphere(points[i], QUERY_RADIUS);
+		expected.clear();
+		for (const auto& element : elements)
+		{
+			if (CollisionDispatcher::DetectCollision(element.pCollider, &sphere)) { expected.push_back(element.pCollider); }
+		}
+		hits.clear();
+		manager.OverlapSphere(points[i], QUERY_RADIUS, &hits);
+		actual.clear();
+		for (const QueryHit& hit : hits) { actual.push_back(hit.pCollider); }
+
+		std::sort(expected.begin(), expected.end());
+		std::sort(actual.begin(), actual.end());
+		if (expected != actual) { sphereMismatchNum++; }
+
+		// ̍ŏ̏Փ˂͑SĂ̏Փ˂̐擪Ɠ
+		QueryHit firstHit;
+		const bool isHit = manager.Raycast(points[i], directions[i], QUERY_DISTANCE, &firstHit);
+		hits.clear();
+		manager.RaycastAll(points[i], directions[i], QUERY_DISTANCE, &hits);
+		if (isHit != !hits.empty() || (isHit && std::abs(firstHit.distance - hits.front().distance) > DISTANCE_EPSILON * std::max(1.0f, firstHit.distance)))
+		{
+			rayMismatchNum++;
+		}
+	}
+
+	bool isPassed = true;
+	isPassed &= Check(sphereMismatchNum == 0, "sphere overlap equals brute force in %u / %u queries", QUERY_NUM - sphereMismatchNum, QUERY_NUM);
+	isPassed &= Check(rayMismatchNum == 0, "raycast equals the nearest raycast all hit in %u / %u queries", QUERY_NUM - rayMismatchNum, QUERY_NUM);
+
+	// v ---------------------------------------------------------------------
+	// Sirpj
+	auto bruteForceSphere = [&](uint32_t i, uint32_t tagMask)
+		{
+			const Sphere sphere(points[i], QUERY_RADIUS);
+			size_t hitNum = 0;
+			for (const auto& element : elements)
+			{
+				if ((static_cast<uint32_t>(element.pObject->GetTag()) & tagMask) == 0 || !element.pObject->IsActive()) continue;
+				if (CollisionDispatcher::DetectCollision(element.pCollider, &sphere)) { hitNum++; }
+			}
+			return hitNum;
+		};
+	const QueryFilter terrainFilter(TERRAIN_TAGS);
+
+	const double bruteForceMs	= MeasureQueries("sphere (brute force)", [&](uint32_t i) { return bruteForceSphere(i, QueryFilter::ALL_TAGS); });
+	const double sphereMs		= MeasureQueries("sphere", [&](uint32_t i) { return manager.OverlapSphere(points[i], QUERY_RADIUS, nullptr); });
+	const double terrainBruteMs	= MeasureQueries("terrain (brute force)", [&](uint32_t i) { return bruteForceSphere(i, TERRAIN_TAGS); });
+	const double terrainMs		= MeasureQueries("terrain sphere", [&](uint32_t i) { return manager.OverlapSphere(points[i], QUERY_RADIUS, nullptr, terrainFilter); });
+	MeasureQueries("aabb", [&](uint32_t i) { return manager.OverlapAABB(points[i], Vector3(QUERY_RADIUS * 2.0f), nullptr); });
+	MeasureQueries("raycast", [&](uint32_t i) { return manager.Raycast(points[i], directions[i], QUERY_DISTANCE, nullptr) ? 1 : 0; });
+	MeasureQueries("raycast all", [&](uint32_t i) { hits.clear(); return manager.RaycastAll(points[i], directions[i], QUERY_DISTANCE, &hits); });
+	MeasureQueries("capsule sweep", [&](uint32_t i)
+		{
+			const Capsule capsule(Vector3::Up, 1.0f, points[i], 0.5f);
+			return manager.SweepCapsule(capsule, directions[i], QUERY_DISTANCE, nullptr) ? 1 : 0;
+		});
+
+	// vf͊Kwɓꂸ񑖍邽߁Avfʂł͍k܂
+	std::printf("brute force / query : all tags x%.2f, terrain x%.2f\n", bruteForceMs / sphereMs, terrainBruteMs / terrainMs);
+
+	return isPassed;
+}
@@ -0,0 +1,145 @@
+/*****************************************************************//**
+ * @file    SnapshotTest.cpp
+ * @brief   Փ˔pXibvVbg̃eXgɊւ\[Xt@C
+ *
+ * ̎ŌŒ肵ʂՓ˔ǗiXibvVbgjƕRC_[̑Ŕ肵A
+ * Փ˂gv邱Ƃm߂B킹ăXibvVbg̍쐬ƕ̎Ԃv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "CollisionTests.h"
+
+#include "Common/TestRunner.h"
+#include "CollisionTestScene.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	DYNAMIC_NUMS[]		= { 500, 2000 };	///< vf̐
+	constexpr uint32_t	SEEDS[]				= { 1, 20261017 };	///< ̎
+	constexpr double	MIN_MEASURE_MS		= 200.0;			///< 1̕JԂvŒZ̎
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief JԂ1񂠂̎Ԃ߂
+	 *
+	 * @param[in] function 
+	 *
+	 * @return 1񂠂̃~b
+	 */
+	template <typename TFunction>
+	double MeasureAverage(TFunction&& function)
+	{
+		function();
+
+		int count = 0;
+		double totalMs = 0.0;
+		while (totalMs < MIN_MEASURE_MS)
+		{
+			totalMs += MeasureMilliseconds(function);
+			count++;
+		}
+		return totalMs / count;
+	}
+
+
+
+	/**
+	 * @brief XibvVbgƕRC_[ŏՓ˂gv邩m߂
+	 *
+	 * @param[in] dynamicNum	vf̐
+	 * @param[in] seed			̎
+	 *
+	 * @returns true v
+	 */
+	bool CheckSamePairs(uint32_t dynamicNum, uint32_t seed)
+	{
+		CollisionTestScene scene(dynamicNum, seed);
+
+		CollisionManager manager;
+		scene.Register(&manager);
+
+		std::vector<ContactRecord> snapshotContacts;
+		std::vector<ContactRecord> cloneContacts;
+		scene.DetectWithManager(&manager, &snapshotContacts);
+		scene.DetectWithClones(&cloneContacts);
+
+		// ͕̏ňقȂ邽߁Ag̏WŔׂ
+		std::sort(snapshotContacts.begin(), snapshotContacts.end());
+		std::sort(cloneContacts.begin(), cloneContacts.end());
+
+		return Check(!cloneContacts.empty() && snapshotContacts == cloneContacts,
+			"%5u dynamic, seed %8u : snapshot %5zu contacts equal GetClone %5zu contacts",
+			dynamicNum, seed, snapshotContacts.size(), cloneContacts.size());
+	}
+
+
+
+	/**
+	 * @brief XibvVbg̍쐬ƕ̎Ԃv
+	 *
+	 * @param[in] dynamicNum vf̐
+	 */
+	void MeasureCopy(uint32_t dynamicNum)
+	{
+		const CollisionTestScene scene(dynamicNum, SEEDS[0]);
+
+		// g񂷃XibvVbgiƃXbhƓeʂcj
+		CollisionSnapshot snapshot;
+		const double snapshotMs = MeasureAverage([&]() { scene.CreateSnapshot(false, &snapshot); });
+
+		// XibvVbggO̕iSẴRC_[𖈃t[j
+		std::vector<std::unique_ptr<ICollider>> clones;
+		const double cloneMs = MeasureAverage([&]()
+			{
+				clones.clear();
+				for (const auto& element : scene.GetElements())
+				{
+					if (!element.isStatic) { clones.push_back(element.pCollider->GetClone()); }
+				}
+			});
+
+		std::printf("%5u dynamic, %5u nodes : GetClone %7.3f ms / snapshot %7.3f ms (x%5.2f), snapshot %zu bytes\n",
+			dynamicNum, snapshot.GetNodeCount(), cloneMs, snapshotMs, cloneMs / snapshotMs, snapshot.GetAllocatedBytes());
+	}
+}
+
+
+
+/**
+ * @brief XibvVbgł̔𕡐RC_[ł̔ƔׁA쐬̎Ԃv
+ *
+ * @returns true  SĂ̏ʂŏՓ˂gv
+ * @returns false vȂʂ
+ */
+bool RunSnapshotTest()
+{
+	bool isPassed = true;
+	for (const uint32_t dynamicNum : DYNAMIC_NUMS)
+	{
+		for (const uint32_t seed : SEEDS)
+		{
+			isPassed &= CheckSamePairs(dynamicNum, seed);
+		}
+	}
+
+	for (const uint32_t dynamicNum : DYNAMIC_NUMS)
+	{
+		MeasureCopy(dynamicNum);
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,177 @@
+/*****************************************************************//**
+ * @file    TestRunner.cpp
+ * @brief   `ȂeXg̎sɊւ\[Xt@C
+ *
+ * 
+ *   --case NAME  w肵eXgsiwłj
+ *   --list       eXg̖Oo͂
+ *
+ * IR[h͑SĒʂ 0AʂȂeXg 1Aɖ肪 2
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "TestRunner.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+
+
+// \̂̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief s̐ݒ
+	 */
+	struct Options
+	{
+		std::vector<std::string>	caseNames;	///< seXg̖OiȂSāj
+		bool						isListing;	///< Ȍo͂sǂ
+
+		Options()
+			: caseNames{}
+			, isListing{ false }
+		{
+		}
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ̉
+	 *
+	 * @param[in]  argc		̐
+	 * @param[in]  argv		
+	 * @param[out] pOptions	s̐ݒ
+	 *
+	 * @returns true  ͂
+	 * @returns false sȈ
+	 */
+	bool ParseOptions(int argc, char* argv[], Options* pOptions)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			const bool hasValue = (i + 1 < argc);
+
+			if (std::strcmp(argv[i], "--case") == 0 && hasValue)	{ pOptions->caseNames.push_back(argv[++i]); }
+			else if (std::strcmp(argv[i], "--list") == 0)			{ pOptions->isListing = true; }
+			else { return false; }
+		}
+
+		return true;
+	}
+
+
+
+	/**
+	 * @brief eXgsǂ
+	 *
+	 * @param[in] options	s̐ݒ
+	 * @param[in] name		eXg̖O
+	 *
+	 * @returns true  s
+	 * @returns false sȂ
+	 */
+	bool IsSelected(const Options& options, const char* name)
+	{
+		if (options.caseNames.empty()) return true;
+
+		for (const std::string& caseName : options.caseNames)
+		{
+			if (caseName == name) return true;
+		}
+		return false;
+	}
+}
+
+
+
+/**
+ * @brief eXg̈ꗗs
+ *
+ * @param[in] argc		̐
+ * @param[in] argv		
+ * @param[in] pCases	eXg̈ꗗ
+ * @param[in] caseNum	eXg̐
+ *
+ * @return IR[hiSĒʂ 0AʂȂeXg 1Aɖ肪 2j
+ */
+int RunTestCases(int argc, char* argv[], const TestCase* pCases, size_t caseNum)
+{
+	Options options;
+	if (!ParseOptions(argc, argv, &options))
+	{
+		std::printf("usage: %s [--case NAME]... [--list]\n", argv[0]);
+		return 2;
+	}
+
+	if (options.isListing)
+	{
+		for (size_t i = 0; i < caseNum; i++) { std::printf("%s\n", pCases[i].name); }
+		return 0;
+	}
+
+	int exitCode = 0;
+	int selectedNum = 0;
+	int failedNum = 0;
+
+	for (size_t i = 0; i < caseNum; i++)
+	{
+		const TestCase& testCase = pCases[i];
+		if (!IsSelected(options, testCase.name)) continue;
+		selectedNum++;
+
+		std::printf("============ %s ============\n", testCase.name);
+		std::fflush(stdout);
+
+		if (!testCase.function())
+		{
+			failedNum++;
+			exitCode = 1;
+		}
+	}
+
+	if (selectedNum == 0)
+	{
+		std::printf("no test case selected\n");
+		return 2;
+	}
+
+	std::printf("%d / %d test cases passed\n", selectedNum - failedNum, selectedNum);
+	return exitCode;
+}
+
+
+
+/**
+ * @brief mF̌ʂo͂
+ *
+ * @param[in] isPassed	ʂǂ
+ * @param[in] format	iprintf Ɠj
+ *
+ * @return isPassed
+ */
+bool Check(bool isPassed, const char* format, ...)
+{
+	std::va_list arguments;
+	va_start(arguments, format);
+	std::vprintf(format, arguments);
+	va_end(arguments);
+
+	std::printf(" : %s\n", isPassed ? "OK" : "NG");
+	std::fflush(stdout);
+	return isPassed;
+}
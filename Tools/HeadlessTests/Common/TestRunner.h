@@ -0,0 +1,60 @@
+/*****************************************************************//**
+ * @file    TestRunner.h
+ * @brief   `ȂeXg̎sɊւwb_[t@C
+ *
+ * eeXg̎st@C̓eXg̈ꗗ RunTestCases ɓnB
+ * eXg͌ʂ1su... : OKvu... : NGvŏo͂ASĒʂ true Ԃ
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <chrono>
+#include <cstddef>
+
+
+
+
+// \̂̒` ===============================================================
+/**
+ * @brief eXg
+ */
+struct TestCase
+{
+	const char*	name;			///< Oi--case Ŏw肷j
+	bool		(*function)();	///< s֐iSĒʂ truej
+};
+
+
+
+
+// ֐̐錾 =================================================================
+// eXg̈ꗗsiIR[hԂj
+int RunTestCases(int argc, char* argv[], const TestCase* pCases, size_t caseNum);
+
+// mF̌ʂo͂ǐɁu : OKvu : NGvtj
+bool Check(bool isPassed, const char* format, ...);
+
+
+
+/**
+ * @brief ֐̎sɂԂ̌v
+ *
+ * @param[in] function v֐
+ *
+ * @return ԁi~bj
+ */
+template <typename TFunction>
+double MeasureMilliseconds(TFunction&& function)
+{
+	const auto start = std::chrono::high_resolution_clock::now();
+	function();
+	return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
@@ -0,0 +1,173 @@
+/*****************************************************************//**
+ * @file    ChannelBenchmark.cpp
+ * @brief   Cxg`l EventSystem ̌vɊւ\[Xt@C
+ *
+ * 1000 ̃IuWFNg1t[ 10 񂸂Cxg𑗂A100 t[ 100 ɂȂB
+ * EventSystem ̓CxgƂ EventData  new AXi[ std::function Ō^ typeid Ŋm߂B
+ * Cxg`l͒l̂܂ܔzɂ߁A֐|C^ŌĂяoB
+ * 󂯎_[Wƕ߂܂񐔂vACxg`lg@̌ɗ̈mۂȂƂm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "EventSystemTests.h"
+
+#include "Common/TestRunner.h"
+#include "ChannelReceiver.h"
+#include "Game/Common/Framework/EventSystem/EventSystem.h"
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief EventSystem ̃Cxg̎
+	 */
+	enum class LegacyEventType
+	{
+		HIT,
+		CAUGHT,
+	};
+}
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int FRAME_NUM				= 100;	///< t[
+	constexpr int EVENT_NUM_PER_OBJECT	= 10;	///< 1t[1̃IuWFNgCxg̐
+	constexpr int EVENT_NUM				= CHANNEL_OBJECT_NUM * EVENT_NUM_PER_OBJECT * FRAME_NUM;	///< Cxg̐
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief EventSystem ̃Cxgf[^ij
+	 */
+	struct LegacyHitEventData
+		: public EventData
+	{
+		int		senderIndex;	///< IuWFNg̔ԍ
+		float	damage;			///< _[W
+
+		LegacyHitEventData(int senderIndex, float damage) : senderIndex{ senderIndex }, damage{ damage } {}
+	};
+
+
+
+	/**
+	 * @brief EventSystem ̃Cxgf[^i߂܂j
+	 */
+	struct LegacyCaughtEventData
+		: public EventData
+	{
+		int captorIndex;	///< ߂܂IuWFNg̔ԍ
+
+		explicit LegacyCaughtEventData(int captorIndex) : captorIndex{ captorIndex } {}
+	};
+
+
+
+	/**
+	 * @brief EventSystem Ŏ󂯎IuWFNg
+	 */
+	struct LegacyReceiver
+	{
+		EventSystem<LegacyEventType>	events;				///< CxgVXe
+		float							totalDamage = 0.0f;	///< 󂯂_[W̍v
+		int								caughtNum = 0;		///< ߂܂
+	};
+}
+
+
+
+/**
+ * @brief 1000 ̃IuWFNg 100 ̃Cxg𑗂鎞Ԃ EventSystem ƔׂČv
+ *
+ * @returns true  󂯎_[Wƕ߂܂񐔂 EventSystem ƈvAg@̌ɗ̈mۂȂ
+ * @returns false ꂩ𖞂Ȃ
+ */
+bool RunChannelBenchmark()
+{
+	std::printf("%d objects, %d events\n", CHANNEL_OBJECT_NUM, EVENT_NUM);
+
+	// EventSystem
+	double legacyTime = 0.0;
+	float legacyDamage = 0.0f;
+	int legacyCaughtNum = 0;
+	{
+		std::vector<LegacyReceiver> receivers(CHANNEL_OBJECT_NUM);
+		for (LegacyReceiver& receiver : receivers)
+		{
+			LegacyReceiver* pReceiver = &receiver;
+			receiver.events.AddListener<LegacyHitEventData>(LegacyEventType::HIT,
+				[pReceiver](const LegacyHitEventData& data) { pReceiver->totalDamage += data.damage; });
+			receiver.events.AddListener<LegacyCaughtEventData>(LegacyEventType::CAUGHT,
+				[pReceiver](const LegacyCaughtEventData& data) { pReceiver->caughtNum += (data.captorIndex >= 0) ? 1 : 0; });
+		}
+
+		legacyTime = MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++)
+				{
+					for (int sender = 0; sender < CHANNEL_OBJECT_NUM; sender++)
+					{
+						for (int i = 0; i < EVENT_NUM_PER_OBJECT; i++)
+						{
+							const int receiverIndex = GetChannelReceiverIndex(sender, frame, i);
+							LegacyReceiver& receiver = receivers[receiverIndex];
+							if (IsCaughtEvent(receiverIndex, i)) { receiver.events.FireEvent(LegacyEventType::CAUGHT, std::make_unique<LegacyCaughtEventData>(sender)); }
+							else { receiver.events.FireEvent(LegacyEventType::HIT, std::make_unique<LegacyHitEventData>(sender, 1.0f)); }
+						}
+					}
+					for (LegacyReceiver& receiver : receivers) { receiver.events.ApplyEvents(); }
+				}
+			});
+
+		for (const LegacyReceiver& receiver : receivers) { legacyDamage += receiver.totalDamage; legacyCaughtNum += receiver.caughtNum; }
+	}
+
+	// Cxg`l
+	double channelTime = 0.0;
+	float channelDamage = 0.0f;
+	int channelCaughtNum = 0;
+	size_t warmUpCount = 0;
+	size_t steadyCount = 0;
+	{
+		std::vector<ChannelReceiver> receivers(CHANNEL_OBJECT_NUM);
+		for (ChannelReceiver& receiver : receivers) { RegisterChannelListeners(&receiver); }
+
+		channelTime = MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++)
+				{
+					SendChannelFrameEvents(&receivers, frame, EVENT_NUM_PER_OBJECT);
+					if (frame == 1) { warmUpCount = CountChannelAllocation(receivers); }
+				}
+			});
+		steadyCount = CountChannelAllocation(receivers) - warmUpCount;
+
+		for (const ChannelReceiver& receiver : receivers) { channelDamage += receiver.totalDamage; channelCaughtNum += receiver.caughtNum; }
+	}
+
+	std::printf("EventSystem  : %8.2f ms (%6.1f ns/event), new per event 1\n", legacyTime, legacyTime * 1.0e6 / EVENT_NUM);
+
+	bool isPassed = true;
+	isPassed &= Check((legacyDamage == channelDamage) && (legacyCaughtNum == channelCaughtNum),
+		"EventChannel : %8.2f ms (%6.1f ns/event), x%.1f, damage %.0f / %.0f, caught %d / %d",
+		channelTime, channelTime * 1.0e6 / EVENT_NUM, legacyTime / channelTime, channelDamage, legacyDamage, channelCaughtNum, legacyCaughtNum);
+	isPassed &= Check(steadyCount == 0, "EventChannel : allocations warm-up %zu / after %zu", warmUpCount, steadyCount);
+
+	return isPassed;
+}
@@ -0,0 +1,103 @@
+/*****************************************************************//**
+ * @file    ChannelReceiver.cpp
+ * @brief   Cxg`l̃eXgp̎󂯎IuWFNgɊւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "ChannelReceiver.h"
+
+
+
+
+// ֐̒` =================================================================
+/**
+ * @brief 󂯎IuWFNgɃXi[o^
+ *
+ * ̓Lv`Ȃ_A߂܂̓o֐œo^
+ *
+ * @param[in] pReceiver 󂯎IuWFNg
+ */
+void RegisterChannelListeners(ChannelReceiver* pReceiver)
+{
+	pReceiver->events.Get<HitPayload>().AddListener(pReceiver,
+		[](ChannelReceiver* self, const HitPayload& payload) { self->totalDamage += payload.damage; });
+	pReceiver->events.Get<CaughtPayload>().AddListener<&ChannelReceiver::OnCaught>(pReceiver);
+}
+
+
+
+/**
+ * @brief 1t[̃Cxg𑗂ēKp
+ *
+ * SẴIuWFNg eventNumPerObject 񂸂Aԍ̂ꂽIuWFNgɃCxg𑗂i81͕߂܂j
+ *
+ * @param[in] pReceivers		󂯎IuWFNg
+ * @param[in] frame				t[
+ * @param[in] eventNumPerObject	1̃IuWFNgCxg̐
+ */
+void SendChannelFrameEvents(std::vector<ChannelReceiver>* pReceivers, int frame, int eventNumPerObject)
+{
+	for (int sender = 0; sender < CHANNEL_OBJECT_NUM; sender++)
+	{
+		for (int i = 0; i < eventNumPerObject; i++)
+		{
+			const int receiverIndex = GetChannelReceiverIndex(sender, frame, i);
+			ChannelReceiver& receiver = (*pReceivers)[receiverIndex];
+			if (IsCaughtEvent(receiverIndex, i)) { receiver.events.Get<CaughtPayload>().Fire(CaughtPayload{ sender }); }
+			else { receiver.events.Get<HitPayload>().Fire(HitPayload{ sender, 1.0f }); }
+		}
+	}
+	for (ChannelReceiver& receiver : *pReceivers) { receiver.events.ApplyAll(); }
+}
+
+
+
+/**
+ * @brief ̔ԍ̎擾
+ *
+ * @param[in] sender		IuWFNg̔ԍ
+ * @param[in] frame			t[
+ * @param[in] eventIndex	
+ *
+ * @return ̔ԍ
+ */
+int GetChannelReceiverIndex(int sender, int frame, int eventIndex)
+{
+	return (sender * 31 + frame + eventIndex * 7) % CHANNEL_OBJECT_NUM;
+}
+
+
+
+/**
+ * @brief ߂܂̃Cxg𑗂邩ǂ
+ *
+ * @param[in] receiverIndex	̔ԍ
+ * @param[in] eventIndex	
+ *
+ * @returns true  ߂܂𑗂
+ * @returns false 𑗂
+ */
+bool IsCaughtEvent(int receiverIndex, int eventIndex)
+{
+	return (receiverIndex + eventIndex) % 8 == 0;
+}
+
+
+
+/**
+ * @brief 󂯎IuWFNg̔z̗̈mۂ񐔂̎擾i݌vj
+ *
+ * @param[in] receivers 󂯎IuWFNg
+ *
+ * @return mۂ
+ */
+size_t CountChannelAllocation(const std::vector<ChannelReceiver>& receivers)
+{
+	size_t count = 0;
+	for (const ChannelReceiver& receiver : receivers) { count += receiver.events.GetAllocationCount(); }
+	return count;
+}
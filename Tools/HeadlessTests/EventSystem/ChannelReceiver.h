@@ -0,0 +1,84 @@
+/*****************************************************************//**
+ * @file    ChannelReceiver.h
+ * @brief   Cxg`l̃eXgp̎󂯎IuWFNgɊւwb_[t@C
+ *
+ * 1000 ̃IuWFNgAԍ炵ɓE߂܂̃Cxg𖈃t[荇B
+ * ͑񂲂ƂɏdȂȂ̂ŁAeIuWFNg󂯎Cxg͖̐t[ɂȂ
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+
+#include "Game/Common/Framework/EventSystem/EventChannel/EventChannel.h"
+
+
+
+
+// 萔̒` =================================================================
+constexpr int CHANNEL_OBJECT_NUM = 1000;	///< Cxg󂯎IuWFNg̐
+
+
+
+
+// \̂̒` ===============================================================
+/**
+ * @brief eXgp̃Cxgf[^ij
+ */
+struct HitPayload
+{
+	int		senderIndex;	///< IuWFNg̔ԍ
+	float	damage;			///< _[W
+};
+
+
+
+/**
+ * @brief eXgp̃Cxgf[^i߂܂j
+ */
+struct CaughtPayload
+{
+	int captorIndex;	///< ߂܂IuWFNg̔ԍ
+};
+
+
+
+/**
+ * @brief Cxg`lŎ󂯎IuWFNg
+ */
+struct ChannelReceiver
+{
+	EventChannelSet<HitPayload, CaughtPayload>	events;				///< Cxg`l
+	float										totalDamage = 0.0f;	///< 󂯂_[W̍v
+	int											caughtNum = 0;		///< ߂܂
+
+	// ߂܂̏
+	void OnCaught(const CaughtPayload& payload) { caughtNum += (payload.captorIndex >= 0) ? 1 : 0; }
+};
+
+
+
+
+// ֐̐錾 =================================================================
+// 󂯎IuWFNgɃXi[o^
+void RegisterChannelListeners(ChannelReceiver* pReceiver);
+
+// 1t[̃Cxg𑗂ēKp
+void SendChannelFrameEvents(std::vector<ChannelReceiver>* pReceivers, int frame, int eventNumPerObject);
+
+// ̔ԍ̎擾
+int GetChannelReceiverIndex(int sender, int frame, int eventIndex);
+
+// ߂܂̃Cxg𑗂邩ǂ
+bool IsCaughtEvent(int receiverIndex, int eventIndex);
+
+// 󂯎IuWFNg̔z̗̈mۂ񐔂̎擾i݌vj
+size_t CountChannelAllocation(const std::vector<ChannelReceiver>& receivers);
@@ -0,0 +1,136 @@
+/*****************************************************************//**
+ * @file    ChannelTest.cpp
+ * @brief   Cxg`ľĂяȍԂƃmۂ̃eXgɊւ\[Xt@C
+ *
+ * EXi[ĂяoDxiDx͓o^jɌĂяo邱
+ * EKpɔ΂Cxg͎̓KpŌĂяo邱
+ * EKpɍ폜Xi[͂̌ĂяoȂ
+ * E1000 ̃IuWFNg2t[ځiւ2̔z̗̈悪łǰ́ACxg𑗂葱Ă̈mۂȂ
+ * m߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "EventSystemTests.h"
+
+#include "Common/TestRunner.h"
+#include "ChannelReceiver.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int FRAME_NUM				= 100;	///< g@̌ɑt[
+	constexpr int EVENT_NUM_PER_OBJECT	= 4;	///< 1t[1̃IuWFNgCxg̐
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief ĂяoꂽL^郊Xi[
+	 */
+	struct Recorder
+	{
+		EventChannel<int>*	pChannel;	///< o^`l
+		std::vector<int>	order;		///< Ăяoꂽ
+
+		void Record(int value) { order.push_back(value); }
+	};
+}
+
+
+
+/**
+ * @brief ΂ƓKpJԂĂmۂȂƂƁAĂяȍԂm߂
+ *
+ * @returns true  ԁEKp̔΂ƍ폜E͂Eg@̌̊mۂSĊ҂ǂ肾
+ * @returns false ҂ǂłȂڂ
+ */
+bool RunChannelTest()
+{
+	std::printf("%d objects, %d frames\n", CHANNEL_OBJECT_NUM, FRAME_NUM);
+
+	bool isPassed = true;
+
+	// ĂяoDx
+	{
+		EventChannel<int> channel;
+		Recorder recorder{ &channel, {} };
+		channel.AddListener(&recorder, [](Recorder* self, const int& value) { self->Record(value * 10 + 3); }, 1);
+		channel.AddListener(&recorder, [](Recorder* self, const int& value) { self->Record(value * 10 + 0); }, -1);
+		channel.AddListener(&recorder, [](Recorder* self, const int& value) { self->Record(value * 10 + 1); }, 0);
+		channel.AddListener(&recorder, [](Recorder* self, const int& value) { self->Record(value * 10 + 2); }, 0);
+		channel.Fire(1);
+		channel.Fire(2);
+		channel.Apply();
+
+		const std::vector<int> expected = { 10, 11, 12, 13, 20, 21, 22, 23 };
+		isPassed &= Check(recorder.order == expected, "listeners called in priority order, ties in registration order");
+	}
+
+	// Kp̔΂ƃXi[̍폜
+	{
+		EventChannel<int> channel;
+		Recorder forwarder{ &channel, {} };
+		Recorder once{ &channel, {} };
+
+		// 1 󂯎 2 𔭉΂
+		channel.AddListener(&forwarder, [](Recorder* self, const int& value)
+			{
+				self->Record(value);
+				if (value == 1) { self->pChannel->Fire(2); }
+			});
+		// 1󂯎玩폜
+		channel.AddListener(&once, [](Recorder* self, const int& value)
+			{
+				self->Record(value);
+				self->pChannel->RemoveListener(self);
+			});
+
+		channel.Fire(1);
+		channel.Apply();
+		const bool isDeferred = (forwarder.order.size() == 1) && (channel.GetQueuedNum() == 1) && (channel.GetListenerNum() == 1);
+		channel.Apply();
+
+		isPassed &= Check(isDeferred && (forwarder.order == std::vector<int>{ 1, 2 }) && (once.order.size() == 1),
+			"event fired while applying is delivered on the next apply, removed listener is not called again");
+	}
+
+	// Ԃ̗̈̊m
+	{
+		std::vector<ChannelReceiver> receivers(CHANNEL_OBJECT_NUM);
+		for (ChannelReceiver& receiver : receivers) { RegisterChannelListeners(&receiver); }
+
+		// 2t[œւ2̔z̗̈悪ł
+		SendChannelFrameEvents(&receivers, 0, EVENT_NUM_PER_OBJECT);
+		SendChannelFrameEvents(&receivers, 1, EVENT_NUM_PER_OBJECT);
+		const size_t warmUpCount = CountChannelAllocation(receivers);
+
+		for (int frame = 2; frame < FRAME_NUM + 2; frame++)
+		{
+			SendChannelFrameEvents(&receivers, frame, EVENT_NUM_PER_OBJECT);
+		}
+		const size_t steadyCount = CountChannelAllocation(receivers) - warmUpCount;
+
+		float totalDamage = 0.0f;
+		int caughtNum = 0;
+		for (const ChannelReceiver& receiver : receivers) { totalDamage += receiver.totalDamage; caughtNum += receiver.caughtNum; }
+		const int expectedNum = CHANNEL_OBJECT_NUM * EVENT_NUM_PER_OBJECT * (FRAME_NUM + 2);
+		const int deliveredNum = static_cast<int>(totalDamage) + caughtNum;
+
+		isPassed &= Check(deliveredNum == expectedNum, "delivered %d / %d events", deliveredNum, expectedNum);
+		isPassed &= Check(steadyCount == 0, "allocations warm-up %zu / steady %zu (%d events)",
+			warmUpCount, steadyCount, CHANNEL_OBJECT_NUM * EVENT_NUM_PER_OBJECT * FRAME_NUM);
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,49 @@
+/*****************************************************************//**
+ * @file    EventSystemTests.cpp
+ * @brief   `ȂCxg̃eXg̃Gg[|Cg
+ *
+ * g
+ *   EventSystemTests [--case NAME]... [--list]
+ *
+ * IR[h͑SĒʂ 0AʂȂeXg 1Aɖ肪 2
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+
+#include "Common/TestRunner.h"
+#include "EventSystemTests.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	/// eXg̈ꗗ
+	constexpr TestCase TEST_CASES[] =
+	{
+		{ "channel",		RunChannelTest },
+		{ "channel_speed",	RunChannelBenchmark },
+		{ "mpsc",			RunMPSCStressTest },
+		{ "mpsc_latency",	RunMPSCBenchmark },
+	};
+}
+
+
+
+/**
+ * @brief Gg[|Cg
+ *
+ * @param[in] argc ̐
+ * @param[in] argv 
+ *
+ * @return IR[h
+ */
+int main(int argc, char* argv[])
+{
+	return RunTestCases(argc, argv, TEST_CASES, std::size(TEST_CASES));
+}
@@ -0,0 +1,26 @@
+/*****************************************************************//**
+ * @file    EventSystemTests.h
+ * @brief   Cxg̃eXgɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// ֐̐錾 =================================================================
+// ΂ƓKpJԂĂmۂȂƂƁAĂяȍԂm߂
+bool RunChannelTest();
+
+// 1000 ̃IuWFNg 100 ̃Cxg𑗂鎞Ԃ EventSystem ƔׂČv
+bool RunChannelBenchmark();
+
+// 8XbhςłXbhԂ̃Cxg̗񂪎肱ڂAXbhƂ̏Ԃۂ邱Ƃm߂
+bool RunMPSCStressTest();
+
+// XbhԂ̃Cxg̗̒x1b̐ mutex  vector ̗ƔׂČv
+bool RunMPSCBenchmark();
@@ -0,0 +1,217 @@
+/*****************************************************************//**
+ * @file    MPSCBenchmark.cpp
+ * @brief   XbhԂ̃Cxǧ̗vɊւ\[Xt@C
+ *
+ * ςރXbh̐ 1 / 2 / 4 / 8 ɕςA킹 100 ςށB
+ * ĂяoXbh͎oAς񂾎o܂łxƂĕς 99 p[Z^Co͂B
+ * bNȂ̗ mutex Ŏ vector ̗iւĎojׁA
+ * ǂXbhƂɐς񂾏ɑSē͂Ƃm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "EventSystemTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/EventSystem/MPSCEventQueue/MPSCEventQueue.h"
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief vp̃Cxgf[^
+	 */
+	struct TimedPayload
+	{
+		int64_t		pushTime;		///< ς񂾎iimbj
+		uint32_t	producerIndex;	///< ς񂾃Xbh̔ԍ
+		uint32_t	value;			///< XbhƂ̒ʂԍ
+	};
+
+
+
+	/**
+	 * @brief v̌
+	 */
+	struct Result
+	{
+		double	rate;		///< 1b̐iSj
+		double	average;	///< x̕ρi}CNbj
+		double	p99;		///< x 99 p[Z^Ci}CNbj
+		bool	isOrdered;	///< XbhƂɐς񂾏ɑSē͂ǂ
+	};
+}
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	EVENT_NUM		= 1000000;			///< ςސ
+	constexpr uint32_t	PRODUCER_NUMS[]	= { 1, 2, 4, 8 };	///< ςރXbh̐
+	constexpr size_t	CAPACITY		= 4096;				///< bNȂ̗̗e
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief mutex Ŏ vector ̗irpj
+	 */
+	class MutexEventQueue
+	{
+	private:
+		std::mutex					m_mutex;	///<  mutex
+		std::vector<TimedPayload>	m_events;	///< ς񂾃Cxg
+
+	public:
+		void Push(const TimedPayload& payload)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_events.push_back(payload);
+		}
+
+		// ւĂoibNĂԂɊ֐Ă΂Ȃj
+		template <typename TFunction>
+		size_t Drain(std::vector<TimedPayload>* pWork, TFunction&& function)
+		{
+			pWork->clear();
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				std::swap(m_events, *pWork);
+			}
+			for (const TimedPayload& payload : *pWork) { function(payload); }
+			return pWork->size();
+		}
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ݂̎̎擾iimbj
+	 *
+	 * @return 
+	 */
+	int64_t GetNowNanoseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+
+
+	/**
+	 * @brief ςރXbh𓮂AoI܂łv
+	 *
+	 * @param[in] producerNum	ςރXbh̐
+	 * @param[in] push			ςފ֐
+	 * @param[in] drain			o֐i󂯎֐nAoԂj
+	 *
+	 * @return v̌
+	 */
+	template <typename TPush, typename TDrain>
+	Result Measure(uint32_t producerNum, const TPush& push, const TDrain& drain)
+	{
+		std::vector<uint32_t> latencies;
+		latencies.reserve(EVENT_NUM);
+		std::atomic<bool> isStart = false;
+
+		std::vector<std::thread> producers;
+		for (uint32_t producer = 0; producer < producerNum; producer++)
+		{
+			producers.emplace_back([&, producer]()
+				{
+					while (!isStart.load(std::memory_order_acquire)) { std::this_thread::yield(); }
+
+					const uint32_t num = EVENT_NUM / producerNum + ((producer < EVENT_NUM % producerNum) ? 1 : 0);
+					for (uint32_t i = 0; i < num; i++) { push(TimedPayload{ GetNowNanoseconds(), producer, i }); }
+				});
+		}
+
+		std::vector<uint32_t> nextValues(producerNum, 0);
+		bool isOrdered = true;
+		auto receive = [&](const TimedPayload& payload)
+			{
+				latencies.push_back(static_cast<uint32_t>(std::min<int64_t>(GetNowNanoseconds() - payload.pushTime, UINT32_MAX)));
+				isOrdered = isOrdered && (payload.value == nextValues[payload.producerIndex]);
+				nextValues[payload.producerIndex] = payload.value + 1;
+			};
+
+		Result result{};
+		const double seconds = MeasureMilliseconds([&]()
+			{
+				isStart.store(true, std::memory_order_release);
+				while (latencies.size() < EVENT_NUM)
+				{
+					if (drain(receive) == 0) { std::this_thread::yield(); }
+				}
+			}) / 1000.0;
+		for (std::thread& producer : producers) { producer.join(); }
+
+		result.rate = EVENT_NUM / seconds / 1.0e6;
+		result.isOrdered = isOrdered && (latencies.size() == EVENT_NUM);
+
+		// x̕ς 99 p[Z^C
+		uint64_t total = 0;
+		for (uint32_t latency : latencies) { total += latency; }
+		result.average = static_cast<double>(total) / latencies.size() / 1000.0;
+
+		auto p99 = latencies.begin() + latencies.size() * 99 / 100;
+		std::nth_element(latencies.begin(), p99, latencies.end());
+		result.p99 = *p99 / 1000.0;
+
+		return result;
+	}
+}
+
+
+
+/**
+ * @brief ςło܂ł̎Ԃ1b̐ mutex  vector ̗ƔׂČv
+ *
+ * @returns true  ǂ̃Xbh̐łAǂ̗XbhƂɐς񂾏ɑSē͂
+ * @returns false ͂ȂA܂͏Ԃςꍇ
+ */
+bool RunMPSCBenchmark()
+{
+	std::printf("%u events, capacity %zu, %u hardware threads\n", EVENT_NUM, CAPACITY, std::thread::hardware_concurrency());
+
+	bool isPassed = true;
+
+	for (const uint32_t producerNum : PRODUCER_NUMS)
+	{
+		// bNȂ̗
+		MPSCEventQueue<TimedPayload> queue(CAPACITY);
+		const Result lockFree = Measure(producerNum,
+			[&](const TimedPayload& payload) { queue.Push(payload); },
+			[&](const auto& receive) { return queue.Drain(receive); });
+
+		// mutex  vector ̗
+		MutexEventQueue mutexQueue;
+		std::vector<TimedPayload> work;
+		const Result mutex = Measure(producerNum,
+			[&](const TimedPayload& payload) { mutexQueue.Push(payload); },
+			[&](const auto& receive) { return mutexQueue.Drain(&work, receive); });
+
+		isPassed &= Check(lockFree.isOrdered && mutex.isOrdered,
+			"%u producers : lock-free %6.2f M/s (latency avg %8.2f us, p99 %8.2f us, waits %8llu) / mutex %6.2f M/s (latency avg %8.2f us, p99 %8.2f us), in order",
+			producerNum, lockFree.rate, lockFree.average, lockFree.p99, static_cast<unsigned long long>(queue.GetWaitNum()),
+			mutex.rate, mutex.average, mutex.p99);
+	}
+
+	return isPassed;
+}
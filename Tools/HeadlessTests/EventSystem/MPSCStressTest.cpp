@@ -0,0 +1,137 @@
+/*****************************************************************//**
+ * @file    MPSCStressTest.cpp
+ * @brief   XbhԂ̃Cxg̗̃eXgɊւ\[Xt@C
+ *
+ * 8Xbhςł肱ڂAXbhƂ̏Ԃۂ邱Ƃm߂B
+ * E󂭂܂ő҂ĐςޏꍇFSē͂AXbhƂɒʂԍ1邱
+ * Eɑ҂ɐςޏꍇF͂ƈꂽ̍vςƂɂȂAXbhƂɒʂԍ邱
+ * o͌ĂяoXbhŐςނ̂ƕsčs
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "EventSystemTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/EventSystem/MPSCEventQueue/MPSCEventQueue.h"
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief eXgp̃Cxgf[^
+	 */
+	struct SequencePayload
+	{
+		uint32_t producerIndex;	///< ς񂾃Xbh̔ԍ
+		uint32_t sequence;		///< XbhƂ̒ʂԍ
+	};
+}
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	PRODUCER_NUM			= 8;		///< ςރXbh̐
+	constexpr int		EVENT_NUM_PER_THREAD	= 200000;	///< 1Xbhςސ
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ςރXbhƕsĎoA͂ƏԂm߂
+	 *
+	 * @param[in] capacity	̗e
+	 * @param[in] isWait	󂭂܂ő҂Đςނǂ
+	 *
+	 * @returns true  ͂ƈꂽςƂƍAXbhƂ̏Ԃۂꂽ
+	 * @returns false ꂩ𖞂Ȃ
+	 */
+	bool CheckProducers(size_t capacity, bool isWait)
+	{
+		MPSCEventQueue<SequencePayload> queue(capacity);
+		std::atomic<uint64_t> acceptedNum = 0;
+		std::atomic<uint32_t> finishedNum = 0;
+
+		std::vector<std::thread> producers;
+		for (uint32_t producer = 0; producer < PRODUCER_NUM; producer++)
+		{
+			producers.emplace_back([&, producer]()
+				{
+					uint64_t accepted = 0;
+					for (int i = 0; i < EVENT_NUM_PER_THREAD; i++)
+					{
+						const SequencePayload payload{ producer, static_cast<uint32_t>(i) };
+						if (isWait) { queue.Push(payload); accepted++; }
+						else if (queue.TryPush(payload)) { accepted++; }
+					}
+					acceptedNum.fetch_add(accepted);
+					finishedNum.fetch_add(1, std::memory_order_release);
+				});
+		}
+
+		// XbhƂɎɓׂ͂ʂԍi҂Ȃꍇ͔ł悢߂Ȃj
+		std::vector<int64_t> nextSequences(PRODUCER_NUM, 0);
+		uint64_t receivedNum = 0;
+		bool isOrdered = true;
+		auto receive = [&](const SequencePayload& payload)
+			{
+				const int64_t sequence = payload.sequence;
+				int64_t& next = nextSequences[payload.producerIndex];
+				isOrdered = isOrdered && (isWait ? (sequence == next) : (sequence >= next));
+				next = sequence + 1;
+				receivedNum++;
+			};
+
+		while (finishedNum.load(std::memory_order_acquire) < PRODUCER_NUM)
+		{
+			if (queue.Drain(receive) == 0) { std::this_thread::yield(); }
+		}
+		for (std::thread& producer : producers) { producer.join(); }
+		queue.Drain(receive);
+
+		const uint64_t attemptNum = static_cast<uint64_t>(PRODUCER_NUM) * EVENT_NUM_PER_THREAD;
+		const bool isCountPassed =
+			(receivedNum == acceptedNum) &&
+			(queue.GetPushedNum() == acceptedNum) &&
+			(queue.GetDrainedNum() == receivedNum) &&
+			(queue.GetPushedNum() + queue.GetOverflowNum() == attemptNum) &&
+			(!isWait || receivedNum == attemptNum);
+
+		return Check(isOrdered && isCountPassed,
+			"%s (capacity %5zu) : received %8llu / %8llu, overflow %8llu, waits %8llu, max depth %5zu, order %s",
+			isWait ? "Push   " : "TryPush", queue.GetCapacity(), static_cast<unsigned long long>(receivedNum), static_cast<unsigned long long>(attemptNum),
+			static_cast<unsigned long long>(queue.GetOverflowNum()), static_cast<unsigned long long>(queue.GetWaitNum()), queue.GetMaxDepth(),
+			isOrdered ? "OK" : "NG");
+	}
+}
+
+
+
+/**
+ * @brief 8Xbhςł肱ڂAXbhƂ̏Ԃۂ邱Ƃm߂
+ *
+ * @returns true  ҂Đςޏꍇ҂ɐςޏꍇA͂ƏԂ҂ǂ肾
+ * @returns false ҂ǂłȂꍇ
+ */
+bool RunMPSCStressTest()
+{
+	std::printf("%u producers, %d events each\n", PRODUCER_NUM, EVENT_NUM_PER_THREAD);
+
+	bool isPassed = true;
+	isPassed &= CheckProducers(1024, true);
+	isPassed &= CheckProducers(64, false);
+	return isPassed;
+}
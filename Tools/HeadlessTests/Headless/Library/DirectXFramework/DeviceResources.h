@@ -0,0 +1,12 @@
+/*****************************************************************//**
+ * @file    DeviceResources.h
+ * @brief   foCX\[X̑
+ *
+ * Collision.h `֐̈̌^̂߂ɓǂݍށBeXgł͌^̐錾 pch.h ɒu
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
@@ -0,0 +1,31 @@
+/*****************************************************************//**
+ * @file    intrin.h
+ * @brief   MSVC ̑gݍ݊֐̑
+ *
+ * CollisionTypes.h ǂݍ <intrin.h> ̂AgĂ֐ GCC / Clang ̑gݍ݊֐Œ`
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+/**
+ * @brief Ăł̃rbg̈ʒu߂
+ *
+ * @param[out] pIndex rbg̈ʒu
+ * @param[in]  mask   ׂl
+ *
+ * @return rbgĂ 0 ȊO
+ */
+inline unsigned char _BitScanForward(unsigned long* pIndex, unsigned long mask)
+{
+	if (mask == 0) { return 0; }
+
+	*pIndex = static_cast<unsigned long>(__builtin_ctzl(mask));
+	return 1;
+}
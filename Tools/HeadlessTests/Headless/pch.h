@@ -0,0 +1,577 @@
+/*****************************************************************//**
+ * @file    pch.h
+ * @brief   `ȂeXgp̃vRpCς݃wb_[̑
+ *
+ * Q[ pch.h  Windows  Direct3D Ɉˑ邽߁AeXgł͂ɓǂݍ܂B
+ * WCuƁA蔻EXPBDE^XNECxg̃R[hg DirectXMath / SimpleMath ̈ꕔ
+ * _̉ZiXMVECTOR  SSEjŒ`B
+ * s DirectXTK ƓsxNg̋Kiv * MjŁAO -Z Ƃ
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include <xmmintrin.h>
+#include <emmintrin.h>
+
+#include "intrin.h"
+
+
+
+
+// }N̒` ===============================================================
+#define UNREFERENCED_PARAMETER(P) (void)(P)
+
+
+
+
+// Windows ̊֐̑ =====================================================
+// fobOóieXgł͏o͂ȂBʂ͊eeXgWo͂ɏoj
+inline void OutputDebugString(const wchar_t*) {}
+inline void OutputDebugStringA(const char*) {}
+
+// z̑傫󂯎 swprintf
+template <size_t N, typename... TArgs>
+inline int swprintf_s(wchar_t (&buffer)[N], const wchar_t* format, TArgs... args)
+{
+	return std::swprintf(buffer, N, format, args...);
+}
+
+// libstdc++  std OԂɒuȂ float ł̐w֐
+namespace std
+{
+	using ::sqrtf;
+	using ::acosf;
+	using ::sinf;
+	using ::cosf;
+	using ::fabsf;
+}
+
+
+
+
+// DirectXMath ̑ =======================================================
+namespace DirectX
+{
+	constexpr float XM_PI		= 3.141592654f;
+	constexpr float XM_2PI		= 6.283185307f;
+	constexpr float XM_PIDIV2	= 1.570796327f;
+	constexpr float XM_PIDIV4	= 0.785398163f;
+
+	inline constexpr float XMConvertToRadians(float degrees) noexcept { return degrees * (XM_PI / 180.0f); }
+	inline constexpr float XMConvertToDegrees(float radians) noexcept { return radians * (180.0f / XM_PI); }
+
+	/**
+	 * @brief 2vf̕_
+	 */
+	struct XMFLOAT2
+	{
+		float x;
+		float y;
+
+		XMFLOAT2() = default;
+		constexpr XMFLOAT2(float _x, float _y) noexcept : x(_x), y(_y) {}
+	};
+
+	/**
+	 * @brief 3vf̕_
+	 */
+	struct XMFLOAT3
+	{
+		float x;
+		float y;
+		float z;
+
+		XMFLOAT3() = default;
+		constexpr XMFLOAT3(float _x, float _y, float _z) noexcept : x(_x), y(_y), z(_z) {}
+	};
+
+	/**
+	 * @brief 4vf̕_
+	 */
+	struct XMFLOAT4
+	{
+		float x;
+		float y;
+		float z;
+		float w;
+
+		XMFLOAT4() = default;
+		constexpr XMFLOAT4(float _x, float _y, float _z, float _w) noexcept : x(_x), y(_y), z(_z), w(_w) {}
+	};
+
+	/**
+	 * @brief 16oCgEɑ4vf̕_
+	 */
+	struct alignas(16) XMFLOAT4A : public XMFLOAT4
+	{
+		XMFLOAT4A() = default;
+		constexpr XMFLOAT4A(float _x, float _y, float _z, float _w) noexcept : XMFLOAT4(_x, _y, _z, _w) {}
+	};
+
+	/**
+	 * @brief 4vf̕Ȃ
+	 */
+	struct XMUINT4
+	{
+		uint32_t x;
+		uint32_t y;
+		uint32_t z;
+		uint32_t w;
+	};
+
+	/**
+	 * @brief 4x4 ̕_
+	 */
+	struct XMFLOAT4X4
+	{
+		union
+		{
+			struct
+			{
+				float _11, _12, _13, _14;
+				float _21, _22, _23, _24;
+				float _31, _32, _33, _34;
+				float _41, _42, _43, _44;
+			};
+			float m[4][4];
+		};
+	};
+
+
+	// SIMD xNg -------------------------------------------------------
+	using XMVECTOR	= __m128;
+	using FXMVECTOR	= const XMVECTOR;
+	using GXMVECTOR	= const XMVECTOR;
+	using HXMVECTOR	= const XMVECTOR&;
+	using CXMVECTOR	= const XMVECTOR&;
+
+	inline XMVECTOR XMVectorZero() noexcept { return _mm_setzero_ps(); }
+	inline XMVECTOR XMVectorFalseInt() noexcept { return _mm_setzero_ps(); }
+	inline XMVECTOR XMVectorReplicate(float value) noexcept { return _mm_set_ps1(value); }
+	inline XMVECTOR XMVectorSet(float x, float y, float z, float w) noexcept { return _mm_set_ps(w, z, y, x); }
+
+	inline XMVECTOR XMVectorAdd(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_add_ps(v1, v2); }
+	inline XMVECTOR XMVectorSubtract(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_sub_ps(v1, v2); }
+	inline XMVECTOR XMVectorMultiply(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_mul_ps(v1, v2); }
+	inline XMVECTOR XMVectorDivide(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_div_ps(v1, v2); }
+	inline XMVECTOR XMVectorReciprocal(FXMVECTOR v) noexcept { return _mm_div_ps(_mm_set_ps1(1.0f), v); }
+	inline XMVECTOR XMVectorSqrt(FXMVECTOR v) noexcept { return _mm_sqrt_ps(v); }
+	inline XMVECTOR XMVectorMin(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_min_ps(v1, v2); }
+	inline XMVECTOR XMVectorMax(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_max_ps(v1, v2); }
+
+	inline XMVECTOR XMVectorLess(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_cmplt_ps(v1, v2); }
+	inline XMVECTOR XMVectorGreater(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_cmpgt_ps(v1, v2); }
+	inline XMVECTOR XMVectorGreaterOrEqual(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_cmpge_ps(v1, v2); }
+	inline XMVECTOR XMVectorOrInt(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_or_ps(v1, v2); }
+	inline XMVECTOR XMVectorAndInt(FXMVECTOR v1, FXMVECTOR v2) noexcept { return _mm_and_ps(v1, v2); }
+
+	// control ̃rbgĂvf v2AȊO v1
+	inline XMVECTOR XMVectorSelect(FXMVECTOR v1, FXMVECTOR v2, FXMVECTOR control) noexcept
+	{
+		return _mm_or_ps(_mm_andnot_ps(control, v1), _mm_and_ps(control, v2));
+	}
+
+	inline bool XMVector4EqualInt(FXMVECTOR v1, FXMVECTOR v2) noexcept
+	{
+		const __m128i equal = _mm_cmpeq_epi32(_mm_castps_si128(v1), _mm_castps_si128(v2));
+		return _mm_movemask_ps(_mm_castsi128_ps(equal)) == 0xF;
+	}
+
+	inline XMVECTOR XMLoadFloat4A(const XMFLOAT4A* pSource) noexcept { return _mm_load_ps(&pSource->x); }
+	inline void XMStoreFloat4A(XMFLOAT4A* pDestination, FXMVECTOR v) noexcept { _mm_store_ps(&pDestination->x, v); }
+	inline void XMStoreUInt4(XMUINT4* pDestination, FXMVECTOR v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination), _mm_castps_si128(v)); }
+}
+
+
+
+
+// SimpleMath ̑ ========================================================
+namespace DirectX
+{
+	namespace SimpleMath
+	{
+		struct Matrix;
+		struct Quaternion;
+
+		/**
+		 * @brief 2xNg
+		 */
+		struct Vector2 : public XMFLOAT2
+		{
+			Vector2() noexcept : XMFLOAT2(0.0f, 0.0f) {}
+			constexpr Vector2(float ix, float iy) noexcept : XMFLOAT2(ix, iy) {}
+			Vector2(const XMFLOAT2& v) noexcept : XMFLOAT2(v) {}
+		};
+
+		/**
+		 * @brief 3xNg
+		 */
+		struct Vector3 : public XMFLOAT3
+		{
+			Vector3() noexcept : XMFLOAT3(0.0f, 0.0f, 0.0f) {}
+			constexpr explicit Vector3(float ix) noexcept : XMFLOAT3(ix, ix, ix) {}
+			constexpr Vector3(float ix, float iy, float iz) noexcept : XMFLOAT3(ix, iy, iz) {}
+			Vector3(const XMFLOAT3& v) noexcept : XMFLOAT3(v) {}
+
+			// r
+			bool operator==(const Vector3& v) const noexcept { return x == v.x && y == v.y && z == v.z; }
+			bool operator!=(const Vector3& v) const noexcept { return !(*this == v); }
+
+			// Z
+			Vector3& operator+=(const Vector3& v) noexcept { x += v.x; y += v.y; z += v.z; return *this; }
+			Vector3& operator-=(const Vector3& v) noexcept { x -= v.x; y -= v.y; z -= v.z; return *this; }
+			Vector3& operator*=(const Vector3& v) noexcept { x *= v.x; y *= v.y; z *= v.z; return *this; }
+			Vector3& operator*=(float s) noexcept { x *= s; y *= s; z *= s; return *this; }
+			Vector3& operator/=(float s) noexcept { return *this *= (1.0f / s); }
+
+			// PZ
+			Vector3 operator+() const noexcept { return *this; }
+			Vector3 operator-() const noexcept { return Vector3(-x, -y, -z); }
+
+			// xNgZ
+			float Length() const noexcept { return std::sqrt(LengthSquared()); }
+			float LengthSquared() const noexcept { return Dot(*this); }
+			float Dot(const Vector3& v) const noexcept { return (x * v.x + y * v.y) + z * v.z; }
+			Vector3 Cross(const Vector3& v) const noexcept { return Vector3(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x); }
+
+			// Ki 0 Ȃ 0 ̂܂܁j
+			void Normalize() noexcept
+			{
+				const float length = Length();
+				if (length > 0.0f) { x /= length; y /= length; z /= length; }
+			}
+			void Normalize(Vector3& result) const noexcept { result = *this; result.Normalize(); }
+
+			// ͈͂Ɏ߂
+			void Clamp(const Vector3& vmin, const Vector3& vmax) noexcept { *this = Min(Max(*this, vmin), vmax); }
+
+			// ÓI֐
+			static float Distance(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v2.x - v1.x, v2.y - v1.y, v2.z - v1.z).Length(); }
+			static float DistanceSquared(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v2.x - v1.x, v2.y - v1.y, v2.z - v1.z).LengthSquared(); }
+			static Vector3 Min(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(std::min(v1.x, v2.x), std::min(v1.y, v2.y), std::min(v1.z, v2.z)); }
+			static Vector3 Max(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(std::max(v1.x, v2.x), std::max(v1.y, v2.y), std::max(v1.z, v2.z)); }
+			static Vector3 Lerp(const Vector3& v1, const Vector3& v2, float t) noexcept { return Vector3(v1.x + (v2.x - v1.x) * t, v1.y + (v2.y - v1.y) * t, v1.z + (v2.z - v1.z) * t); }
+			static Vector3 Transform(const Vector3& v, const Matrix& m) noexcept;
+			static Vector3 Transform(const Vector3& v, const Quaternion& q) noexcept;
+			static Vector3 TransformNormal(const Vector3& v, const Matrix& m) noexcept;
+
+			// 萔
+			static const Vector3 Zero;
+			static const Vector3 One;
+			static const Vector3 UnitX;
+			static const Vector3 UnitY;
+			static const Vector3 UnitZ;
+			static const Vector3 Up;
+			static const Vector3 Down;
+			static const Vector3 Right;
+			static const Vector3 Left;
+			static const Vector3 Forward;
+			static const Vector3 Backward;
+		};
+
+		// 񍀉Z
+		inline Vector3 operator+(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z); }
+		inline Vector3 operator-(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z); }
+		inline Vector3 operator*(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z); }
+		inline Vector3 operator/(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z); }
+		inline Vector3 operator*(const Vector3& v, float s) noexcept { return Vector3(v.x * s, v.y * s, v.z * s); }
+		inline Vector3 operator*(float s, const Vector3& v) noexcept { return Vector3(v.x * s, v.y * s, v.z * s); }
+		inline Vector3 operator/(const Vector3& v, float s) noexcept { return v * (1.0f / s); }
+
+		// 萔̒`iEWnőO -Zj
+		inline const Vector3 Vector3::Zero		= { 0.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::One		= { 1.0f, 1.0f, 1.0f };
+		inline const Vector3 Vector3::UnitX		= { 1.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::UnitY		= { 0.0f, 1.0f, 0.0f };
+		inline const Vector3 Vector3::UnitZ		= { 0.0f, 0.0f, 1.0f };
+		inline const Vector3 Vector3::Up		= { 0.0f, 1.0f, 0.0f };
+		inline const Vector3 Vector3::Down		= { 0.0f, -1.0f, 0.0f };
+		inline const Vector3 Vector3::Right		= { 1.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::Left		= { -1.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::Forward	= { 0.0f, 0.0f, -1.0f };
+		inline const Vector3 Vector3::Backward	= { 0.0f, 0.0f, 1.0f };
+
+		/**
+		 * @brief 4xNg
+		 */
+		struct Vector4 : public XMFLOAT4
+		{
+			Vector4() noexcept : XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f) {}
+			constexpr Vector4(float ix, float iy, float iz, float iw) noexcept : XMFLOAT4(ix, iy, iz, iw) {}
+			Vector4(const Vector3& v, float iw) noexcept : XMFLOAT4(v.x, v.y, v.z, iw) {}
+			Vector4(const XMFLOAT4& v) noexcept : XMFLOAT4(v) {}
+
+			bool operator==(const Vector4& v) const noexcept { return x == v.x && y == v.y && z == v.z && w == v.w; }
+			bool operator!=(const Vector4& v) const noexcept { return !(*this == v); }
+
+			float LengthSquared() const noexcept { return x * x + y * y + z * z + w * w; }
+
+			static const Vector4 Zero;
+		};
+
+		inline const Vector4 Vector4::Zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+		/**
+		 * @brief l
+		 */
+		struct Quaternion : public XMFLOAT4
+		{
+			Quaternion() noexcept : XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f) {}
+			constexpr Quaternion(float ix, float iy, float iz, float iw) noexcept : XMFLOAT4(ix, iy, iz, iw) {}
+			Quaternion(const XMFLOAT4& q) noexcept : XMFLOAT4(q) {}
+
+			bool operator==(const Quaternion& q) const noexcept { return x == q.x && y == q.y && z == q.z && w == q.w; }
+			bool operator!=(const Quaternion& q) const noexcept { return !(*this == q); }
+
+			// Ɗpxi͐Kj
+			static Quaternion CreateFromAxisAngle(const Vector3& axis, float angle) noexcept
+			{
+				Vector3 normal = axis;
+				normal.Normalize();
+				const float s = std::sin(angle * 0.5f);
+				return Quaternion(normal.x * s, normal.y * s, normal.z * s, std::cos(angle * 0.5f));
+			}
+
+			static const Quaternion Identity;
+		};
+
+		// q1 ̉]̌ q2 ̉]siXMQuaternionMultiply Ɠj
+		inline Quaternion operator*(const Quaternion& q1, const Quaternion& q2) noexcept
+		{
+			return Quaternion(
+				q2.w * q1.x + q2.x * q1.w + q2.y * q1.z - q2.z * q1.y,
+				q2.w * q1.y - q2.x * q1.z + q2.y * q1.w + q2.z * q1.x,
+				q2.w * q1.z + q2.x * q1.y - q2.y * q1.x + q2.z * q1.w,
+				q2.w * q1.w - q2.x * q1.x - q2.y * q1.y - q2.z * q1.z);
+		}
+
+		inline const Quaternion Quaternion::Identity = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+		/**
+		 * @brief 4x4 sisxNgɉE|j
+		 */
+		struct Matrix : public XMFLOAT4X4
+		{
+			Matrix() noexcept : Matrix(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f) {}
+			Matrix(float m00, float m01, float m02, float m03,
+				float m10, float m11, float m12, float m13,
+				float m20, float m21, float m22, float m23,
+				float m30, float m31, float m32, float m33) noexcept
+			{
+				_11 = m00; _12 = m01; _13 = m02; _14 = m03;
+				_21 = m10; _22 = m11; _23 = m12; _24 = m13;
+				_31 = m20; _32 = m21; _33 = m22; _34 = m23;
+				_41 = m30; _42 = m31; _43 = m32; _44 = m33;
+			}
+
+			Matrix& operator*=(const Matrix& other) noexcept;
+
+			// sړ̎擾
+			Vector3 Translation() const noexcept { return Vector3(_41, _42, _43); }
+
+			static Matrix CreateTranslation(const Vector3& position) noexcept
+			{
+				Matrix result;
+				result._41 = position.x; result._42 = position.y; result._43 = position.z;
+				return result;
+			}
+			static Matrix CreateTranslation(float x, float y, float z) noexcept { return CreateTranslation(Vector3(x, y, z)); }
+			static Matrix CreateScale(const Vector3& scale) noexcept
+			{
+				Matrix result;
+				result._11 = scale.x; result._22 = scale.y; result._33 = scale.z;
+				return result;
+			}
+			static Matrix CreateScale(float scale) noexcept { return CreateScale(Vector3(scale)); }
+			static Matrix CreateRotationX(float radians) noexcept
+			{
+				const float c = std::cos(radians), s = std::sin(radians);
+				return Matrix(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, c, s, 0.0f, 0.0f, -s, c, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+			}
+			static Matrix CreateRotationY(float radians) noexcept
+			{
+				const float c = std::cos(radians), s = std::sin(radians);
+				return Matrix(c, 0.0f, -s, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, s, 0.0f, c, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+			}
+			static Matrix CreateRotationZ(float radians) noexcept
+			{
+				const float c = std::cos(radians), s = std::sin(radians);
+				return Matrix(c, s, 0.0f, 0.0f, -s, c, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+			}
+			static Matrix CreateFromQuaternion(const Quaternion& q) noexcept
+			{
+				const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+				const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+				const float xw = q.x * q.w, yw = q.y * q.w, zw = q.z * q.w;
+				return Matrix(
+					1.0f - 2.0f * (yy + zz), 2.0f * (xy + zw), 2.0f * (xz - yw), 0.0f,
+					2.0f * (xy - zw), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + xw), 0.0f,
+					2.0f * (xz + yw), 2.0f * (yz - xw), 1.0f - 2.0f * (xx + yy), 0.0f,
+					0.0f, 0.0f, 0.0f, 1.0f);
+			}
+			// [iZjAsb`iXjA[iYj̏ɉ
+			static Matrix CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept;
+			// angles  (sb`, [, [)
+			static Matrix CreateFromYawPitchRoll(const Vector3& angles) noexcept { return CreateFromYawPitchRoll(angles.y, angles.x, angles.z); }
+
+			static const Matrix Identity;
+		};
+
+		inline Matrix operator*(const Matrix& m1, const Matrix& m2) noexcept
+		{
+			Matrix result;
+			for (int row = 0; row < 4; row++)
+			{
+				for (int column = 0; column < 4; column++)
+				{
+					result.m[row][column] =
+						m1.m[row][0] * m2.m[0][column] + m1.m[row][1] * m2.m[1][column] +
+						m1.m[row][2] * m2.m[2][column] + m1.m[row][3] * m2.m[3][column];
+				}
+			}
+			return result;
+		}
+
+		inline Matrix& Matrix::operator*=(const Matrix& other) noexcept { *this = *this * other; return *this; }
+
+		inline Matrix Matrix::CreateFromYawPitchRoll(float yaw, float pitch, float roll) noexcept
+		{
+			return CreateRotationZ(roll) * CreateRotationX(pitch) * CreateRotationY(yaw);
+		}
+
+		inline const Matrix Matrix::Identity = Matrix();
+
+		inline Vector3 Vector3::Transform(const Vector3& v, const Matrix& m) noexcept
+		{
+			const float x = v.x * m._11 + v.y * m._21 + v.z * m._31 + m._41;
+			const float y = v.x * m._12 + v.y * m._22 + v.z * m._32 + m._42;
+			const float z = v.x * m._13 + v.y * m._23 + v.z * m._33 + m._43;
+			const float w = v.x * m._14 + v.y * m._24 + v.z * m._34 + m._44;
+			return Vector3(x / w, y / w, z / w);
+		}
+
+		inline Vector3 Vector3::Transform(const Vector3& v, const Quaternion& q) noexcept
+		{
+			return TransformNormal(v, Matrix::CreateFromQuaternion(q));
+		}
+
+		inline Vector3 Vector3::TransformNormal(const Vector3& v, const Matrix& m) noexcept
+		{
+			return Vector3(
+				v.x * m._11 + v.y * m._21 + v.z * m._31,
+				v.x * m._12 + v.y * m._22 + v.z * m._32,
+				v.x * m._13 + v.y * m._23 + v.z * m._33);
+		}
+
+		/**
+		 * @brief ʁi@ƌ_̋j
+		 */
+		struct Plane : public XMFLOAT4
+		{
+			Plane() noexcept : XMFLOAT4(0.0f, 1.0f, 0.0f, 0.0f) {}
+
+			// 3_ʂ镽ʁiXMPlaneFromPoints Ɠj
+			Plane(const Vector3& point1, const Vector3& point2, const Vector3& point3) noexcept
+			{
+				Vector3 normal = (point2 - point1).Cross(point3 - point1);
+				normal.Normalize();
+				x = normal.x; y = normal.y; z = normal.z;
+				w = -normal.Dot(point1);
+			}
+
+			Vector3 Normal() const noexcept { return Vector3(x, y, z); }
+			float D() const noexcept { return w; }
+		};
+
+		/**
+		 * @brief F
+		 */
+		struct Color : public XMFLOAT4
+		{
+			Color() noexcept : XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f) {}
+			constexpr Color(float r, float g, float b, float a = 1.0f) noexcept : XMFLOAT4(r, g, b, a) {}
+			Color(const XMFLOAT4& c) noexcept : XMFLOAT4(c) {}
+		};
+	}
+
+	namespace Colors
+	{
+		inline constexpr XMFLOAT4 White		= { 1.0f, 1.0f, 1.0f, 1.0f };
+		inline constexpr XMFLOAT4 Red		= { 1.0f, 0.0f, 0.0f, 1.0f };
+		inline constexpr XMFLOAT4 Yellow	= { 1.0f, 1.0f, 0.0f, 1.0f };
+	}
+}
+
+
+
+
+// `̌^̐錾 =============================================================
+// eXgł͕`悵Ȃ߁A^̐錾ƉȂ}`u
+struct ID3D11DeviceContext;
+struct ID3D11DeviceContext1;
+struct ID3D11InputLayout;
+
+namespace DirectX
+{
+	template <typename TVertex> class PrimitiveBatch;
+	struct VertexPositionColor;
+	class BasicEffect;
+	class Model;
+
+	/**
+	 * @brief }`i`悵Ȃj
+	 */
+	class GeometricPrimitive
+	{
+	public:
+		static std::unique_ptr<GeometricPrimitive> CreateCylinder(ID3D11DeviceContext1*, float, float) { return std::make_unique<GeometricPrimitive>(); }
+		static std::unique_ptr<GeometricPrimitive> CreateSphere(ID3D11DeviceContext1*, float) { return std::make_unique<GeometricPrimitive>(); }
+		static std::unique_ptr<GeometricPrimitive> CreateBox(ID3D11DeviceContext1*, const XMFLOAT3&) { return std::make_unique<GeometricPrimitive>(); }
+
+		void Draw(const SimpleMath::Matrix&, const SimpleMath::Matrix&, const SimpleMath::Matrix&, const XMFLOAT4& = Colors::White, const void* = nullptr, bool = false) const {}
+	};
+}
+
+namespace Microsoft::WRL
+{
+	template <typename T> class ComPtr { T* m_ptr = nullptr; };
+}
@@ -0,0 +1,181 @@
+/*****************************************************************//**
+ * @file    DrawOrderBenchmark.cpp
+ * @brief   ^XNǗ̕`揇Ǘe[ǔvɊւ\[Xt@C
+ *
+ * 1000 / 10000 / 50000 ̃^XNi`揇 0 ` 7jŁA1t[̎ԂvB
+ * Et[ ot̒l̔r multiset ɑOɓo^iȑÔj
+ * EύX̂Ȃt[̕ג
+ * E1̃^XN̕`揇ςt[̕ג
+ * E1̃^XNǉA1̃^XN폜t[̕ג
+ * ŌɁA`揇Ǘe[ȕԂȑÔƈv邱Ƃm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "TaskManagerTests.h"
+
+#include "Common/TestRunner.h"
+#include "TaskManagerTestAccess.h"
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief ȑO̕`揇Ǘe[u̔riot̒lׁAꍇ͓o^j
+	 */
+	struct LegacyGreaterOt
+	{
+		bool operator()(Task* a, Task* b) const { return a->GetOt() > b->GetOt(); }
+	};
+}
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int		FRAME_NUM		= 300;						///< vt[
+	constexpr uint32_t	TASK_NUMS[]		= { 1000, 10000, 50000 };	///< ^XN̐
+	constexpr uint32_t	CHILD_NUM		= 99;						///< [g̎q̃^XNꂼ̎q̃^XN̐
+	constexpr int		OT_NUM			= 8;						///< `揇̎
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ^XNOɏW߂
+	 *
+	 * @param[in]  pTask	W߂^XN̐e
+	 * @param[out] pTasks	W߂^XN
+	 */
+	void CollectPreorder(Task* pTask, std::vector<Task*>* pTasks)
+	{
+		for (Task* child : *pTask->GetTaskConnectInfo().GetChildList())
+		{
+			pTasks->push_back(child);
+			CollectPreorder(child, pTasks);
+		}
+	}
+
+
+
+	/**
+	 * @brief 1t[̏JԂA1t[̎Ԃv
+	 *
+	 * @param[in] frame 1t[̏
+	 *
+	 * @return 1t[̎ԁi}CNbj
+	 */
+	double MeasurePerFrame(const std::function<void()>& frame)
+	{
+		return MeasureMilliseconds([&]()
+			{
+				for (int i = 0; i < FRAME_NUM; i++) { frame(); }
+			}) * 1000.0 / FRAME_NUM;
+	}
+}
+
+
+
+/**
+ * @brief 1000 / 10000 / 50000 ̃^XNŕ`揇Ǘe[u1t[̈ێ̎Ԃv
+ *
+ * @returns true  ǂ̃^XN̐ł`揇Ǘe[ȕԂȑÔƈv
+ * @returns false vȂꍇ
+ */
+bool RunDrawOrderBenchmark()
+{
+	std::printf("%d frames\n", FRAME_NUM);
+
+	bool isPassed = true;
+
+	for (const uint32_t taskNum : TASK_NUMS)
+	{
+		std::mt19937 random(12345);
+
+		TaskManager taskManager;
+		std::vector<std::unique_ptr<Task>> tasks;
+		tasks.reserve(taskNum + FRAME_NUM);
+
+		// [g̉ taskNum / (CHILD_NUM + 1) Aꂼ̉ CHILD_NUM ̃^XNu
+		std::vector<Task*> groups;
+		for (uint32_t i = 0; i < taskNum; i++)
+		{
+			auto task = std::make_unique<Task>();
+			task->SetOt(static_cast<int>(random() % OT_NUM));
+			task->SetName("Task");
+			taskManager.AddTask(task.get());
+
+			if (i % (CHILD_NUM + 1) == 0) { groups.push_back(task.get()); }
+			else { task->ChangeParent(groups.back()); }
+
+			tasks.push_back(std::move(task));
+		}
+		TaskManagerTestAccess::FlushOt(&taskManager);
+
+		std::vector<Task*> preorderTasks;
+		CollectPreorder(taskManager.GetRootTask(), &preorderTasks);
+
+		// ȑÔ
+		std::multiset<Task*, LegacyGreaterOt> legacyOt;
+		const double legacyTime = MeasurePerFrame([&]()
+			{
+				legacyOt.clear();
+				for (Task* task : preorderTasks) { legacyOt.insert(task); }
+			});
+
+		// ύX̂Ȃt[
+		const double steadyTime = MeasurePerFrame([&]() { TaskManagerTestAccess::FlushOt(&taskManager); });
+
+		// 1̃^XN̕`揇ςt[
+		const double otChangeTime = MeasurePerFrame([&]()
+			{
+				Task* task = preorderTasks[random() % preorderTasks.size()];
+				task->SetOt((task->GetOt() + 1) % OT_NUM);
+				TaskManagerTestAccess::FlushOt(&taskManager);
+			});
+
+		// 1̃^XNǉA1̃^XN폜t[iǉ^XNÂɍ폜j
+		size_t oldestIndex = tasks.size();
+		const double addRemoveTime = MeasurePerFrame([&]()
+			{
+				auto task = std::make_unique<Task>();
+				task->SetOt(static_cast<int>(random() % OT_NUM));
+				task->SetName("Task");
+				TaskManagerTestAccess::AddTask(&taskManager, groups[random() % groups.size()], task.get());
+				tasks.push_back(std::move(task));
+
+				if (tasks.size() - oldestIndex > 1)
+				{
+					taskManager.DeleteTask(tasks[oldestIndex].get());
+					tasks[oldestIndex++].reset();
+				}
+
+				TaskManagerTestAccess::FlushOt(&taskManager);
+			});
+
+		// ȑÔƏԂׂ
+		preorderTasks.clear();
+		CollectPreorder(taskManager.GetRootTask(), &preorderTasks);
+		legacyOt.clear();
+		for (Task* task : preorderTasks) { legacyOt.insert(task); }
+
+		const std::vector<Task*>& ot = TaskManagerTestAccess::GetOt(taskManager);
+		isPassed &= Check(std::equal(legacyOt.begin(), legacyOt.end(), ot.begin(), ot.end()),
+			"%6u tasks : rebuild multiset %9.2f us, steady %6.3f us, 1 ot change %8.2f us, 1 add + 1 delete %8.2f us, order matches",
+			taskNum, legacyTime, steadyTime, otChangeTime, addRemoveTime);
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,139 @@
+/*****************************************************************//**
+ * @file    JobBenchmark.cpp
+ * @brief   ^XNǗ̃Wu[ȟvɊւ\[Xt@C
+ *
+ * [g̉ 100 Aꂼ̉ 99 ̃^XNuA1̃^XNǂޒl̐iˑ̖xjςāA
+ * ̍XVƃXbhƂ̃Wu[h1t[̎ԁAˑ֌W̐Ałˑ̘AȂA
+ * Ot鎞ԂvBSẴ^XNLf[^錾ȂꍇvB
+ * ǂ̏ꍇWu[hōXVl̍XVƈv邱Ƃm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "TaskManagerTests.h"
+
+#include "Common/TestRunner.h"
+#include "SyntheticTaskTree.h"
+#include "TaskManagerTestAccess.h"
+#include "Game/Common/Framework/TaskManager/TaskScheduler/TaskScheduler.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int		FRAME_NUM		= 60;					///< vt[
+	constexpr float		DELTA_TIME		= 1.0f / 60.0f;			///< 1t[̌oߎ
+	constexpr uint32_t	READ_NUMS[]		= { 0, 1, 2, 4, 8 };	///< 1̃^XNǂޒl̐
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief 1t[̍XV̎Ԃv
+	 *
+	 * ŏ̍XVŃOtAXbhNĂ
+	 *
+	 * @param[in] pTaskManager ^XNǗ
+	 *
+	 * @return 1t[̎ԁi}CNbj
+	 */
+	double MeasureUpdate(TaskManager* pTaskManager)
+	{
+		pTaskManager->Update(DELTA_TIME);
+
+		return MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++) { pTaskManager->Update(DELTA_TIME); }
+			}) * 1000.0 / FRAME_NUM;
+	}
+}
+
+
+
+/**
+ * @brief ˑ̖xƂ 10000 ̃^XN̍XVԂv
+ *
+ * @returns true  ǂ̏ꍇWu[hōXVl̍XVƈv
+ * @returns false vȂꍇ
+ */
+bool RunJobBenchmark()
+{
+	using UpdateMode = TaskManager::UpdateMode;
+
+	SyntheticTreeSetting setting{};
+	setting.groupNum		= 100;
+	setting.childNum		= 99;
+	setting.workNum			= 200;
+	setting.predecessorRate	= 0.0f;
+	setting.undeclaredRate	= 0.0f;
+	setting.mortalRate		= 0.0f;
+	setting.maxLifeFrame	= 1;
+	setting.isGroupToggling	= false;
+	setting.seed			= 12345;
+
+	const uint32_t hardwareThreadNum = std::min(std::thread::hardware_concurrency(), TaskScheduler::MAX_THREAD_NUM);
+	std::vector<uint32_t> threadNums = { 1, 2, 4 };
+	if (hardwareThreadNum > threadNums.back()) { threadNums.push_back(hardwareThreadNum); }
+
+	std::printf("%u tasks, %d frames, %u hardware threads\n",
+		setting.groupNum * (setting.childNum + 1), FRAME_NUM, std::thread::hardware_concurrency());
+
+	bool isPassed = true;
+
+	for (int caseIndex = 0; caseIndex <= static_cast<int>(std::size(READ_NUMS)); caseIndex++)
+	{
+		const bool isAllUndeclared = (caseIndex == static_cast<int>(std::size(READ_NUMS)));
+		setting.readNum			= isAllUndeclared ? 1 : READ_NUMS[caseIndex];
+		setting.isAllUndeclared	= isAllUndeclared;
+
+		char caseName[32];
+		if (isAllUndeclared) { std::snprintf(caseName, sizeof(caseName), "undeclared"); }
+		else { std::snprintf(caseName, sizeof(caseName), "reads %u per task", setting.readNum); }
+
+		// ̍XV
+		std::vector<uint64_t> sequentialValues;
+		double sequentialTime = 0.0;
+		{
+			TaskManager taskManager;
+			std::vector<std::unique_ptr<SyntheticTask>> tasks;
+			BuildSyntheticTree(setting, &taskManager, &tasks, &sequentialValues);
+			sequentialTime = MeasureUpdate(&taskManager);
+		}
+
+		std::printf("%-17s : sequential %8.1f us/frame\n", caseName, sequentialTime);
+
+		// Wu[h
+		for (const uint32_t threadNum : threadNums)
+		{
+			TaskManager taskManager;
+			taskManager.SetUpdateMode(UpdateMode::PARALLEL);
+			taskManager.SetThreadNum(threadNum);
+
+			std::vector<std::unique_ptr<SyntheticTask>> tasks;
+			std::vector<uint64_t> values;
+			BuildSyntheticTree(setting, &taskManager, &tasks, &values);
+
+			// Ot鎞
+			const double buildTime = MeasureMilliseconds([&]() { TaskManagerTestAccess::BuildGraph(&taskManager); }) * 1000.0;
+
+			const double parallelTime = MeasureUpdate(&taskManager);
+			const TaskScheduler* scheduler = taskManager.GetScheduler();
+
+			isPassed &= Check(values == sequentialValues,
+				"    threads %2u    : parallel   %8.1f us/frame (%.2fx), %zu dependencies, critical path %u, build %.0f us, %llu steals, values match sequential",
+				threadNum, parallelTime, sequentialTime / parallelTime, scheduler->GetDependencyNum(), scheduler->GetCriticalPathLength(),
+				buildTime, static_cast<unsigned long long>(scheduler->GetStealNum()));
+		}
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,184 @@
+/*****************************************************************//**
+ * @file    ParallelTest.cpp
+ * @brief   ^XNǗ̃Wu[ȟ؂Ɋւ\[Xt@C
+ *
+ * ˑ֌W𐳂錾^XN̖؁iLf[^̓ǂݏEɍXVIׂ^XNE錾Ȃ^XNE
+ * rŏ^XNELƖ؂ւ^XN܂ށj𒀎ɍXVʂƁA
+ * XbhςăWu[hōXVʂׂB
+ * r܂ŒɍXViLoXV̔zĂjWu[hɐ؂ւꍇƁA
+ * XVɃ^XN폜EǉAeςꍇׂB
+ * ŌɁA񂷂ˑ֌W̍XVɖ߂邱Ƃm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "TaskManagerTests.h"
+
+#include "Common/TestRunner.h"
+#include "SyntheticTaskTree.h"
+#include "Game/Common/Framework/TaskManager/TaskScheduler/TaskScheduler.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int		FRAME_NUM		= 30;				///< XVt[
+	constexpr int		SWITCH_FRAME	= 10;				///< rŃWu[hɐ؂ւt[
+	constexpr float		DELTA_TIME		= 1.0f / 60.0f;		///< 1t[̌oߎ
+	constexpr uint32_t	THREAD_NUMS[]	= { 1, 2, 4, 8 };	///< Wu[h̃Xbh
+}
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief XV
+	 */
+	struct Result
+	{
+		std::vector<uint64_t>	values;				///< SẴ^XN̒l
+		std::vector<uint32_t>	aliveTasks;			///< c^XN̒l̈ʒuiOj
+		bool					isGraphValid;		///< ˑ֌W̃Ot񂵂ĂȂǂ
+		uint64_t				graphBuildNum;		///< Ot蒼
+		size_t					dependencyNum;		///< ˑ֌W̐
+		uint32_t				criticalPathLength;	///< łˑ̘AȂ
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ^XN̖؂čXV
+	 *
+	 * @param[in] setting		^XN̖؂̍
+	 * @param[in] threadNum		Wu[h̃Xbhi0 Ȃ璀ɍXVj
+	 * @param[in] switchFrame	Wu[hɐ؂ւt[
+	 *
+	 * @return XV
+	 */
+	Result UpdateTree(const SyntheticTreeSetting& setting, uint32_t threadNum, int switchFrame)
+	{
+		TaskManager taskManager;
+		if (threadNum > 0) { taskManager.SetThreadNum(threadNum); }
+
+		std::vector<std::unique_ptr<SyntheticTask>> tasks;
+		Result result;
+		BuildSyntheticTree(setting, &taskManager, &tasks, &result.values);
+		for (int frame = 0; frame < FRAME_NUM; frame++)
+		{
+			if (threadNum > 0 && frame == switchFrame) { taskManager.SetUpdateMode(TaskManager::UpdateMode::PARALLEL); }
+			taskManager.Update(DELTA_TIME);
+		}
+		CollectAliveTasks(taskManager.GetRootTask(), &result.aliveTasks);
+
+		result.isGraphValid			= taskManager.GetScheduler()->IsValid();
+		result.graphBuildNum		= taskManager.GetGraphBuildCount();
+		result.dependencyNum		= taskManager.GetScheduler()->GetDependencyNum();
+		result.criticalPathLength	= taskManager.GetScheduler()->GetCriticalPathLength();
+		return result;
+	}
+
+
+
+	/**
+	 * @brief Wu[hōXVʂ̍XVƈv邱Ƃm߂
+	 *
+	 * @param[in] pLabel		o͂閼O
+	 * @param[in] setting		^XN̖؂̍
+	 * @param[in] switchFrame	Wu[hɐ؂ւt[
+	 *
+	 * @returns true  ǂ̃XbhłlƎc^XN̍XVƈv
+	 * @returns false vȂꍇ
+	 */
+	bool CheckMatchesSequential(const char* pLabel, const SyntheticTreeSetting& setting, int switchFrame)
+	{
+		const Result sequential = UpdateTree(setting, 0, 0);
+
+		bool isPassed = true;
+		for (const uint32_t threadNum : THREAD_NUMS)
+		{
+			const Result parallel = UpdateTree(setting, threadNum, switchFrame);
+
+			size_t mismatchNum = 0;
+			for (size_t i = 0; i < parallel.values.size(); i++)
+			{
+				if (parallel.values[i] != sequential.values[i]) { mismatchNum++; }
+			}
+
+			isPassed &= Check((mismatchNum == 0) && (parallel.aliveTasks == sequential.aliveTasks) && parallel.isGraphValid,
+				"%-8s threads %u : %zu tasks, %zu alive, %zu mismatched values, %llu graph builds, %zu dependencies, critical path %u",
+				pLabel, threadNum, parallel.values.size(), parallel.aliveTasks.size(), mismatchNum, static_cast<unsigned long long>(parallel.graphBuildNum),
+				parallel.dependencyNum, parallel.criticalPathLength);
+		}
+		return isPassed;
+	}
+}
+
+
+
+/**
+ * @brief Wu[hƒ̍XV̌ʂv邱Ƃm߂
+ *
+ * @returns true  ǂ̃XbhłlƎc^XN̍XVƈvA񂷂ˑ֌W̍XVɖ߂
+ * @returns false ꂩ𖞂Ȃ
+ */
+bool RunParallelTest()
+{
+	SyntheticTreeSetting setting{};
+	setting.groupNum		= 20;
+	setting.childNum		= 49;
+	setting.readNum			= 3;
+	setting.workNum			= 16;
+	setting.predecessorRate	= 0.2f;
+	setting.undeclaredRate	= 0.02f;
+	setting.mortalRate		= 0.1f;
+	setting.maxLifeFrame	= FRAME_NUM;
+	setting.isGroupToggling	= true;
+	setting.isAllUndeclared	= false;
+	setting.seed			= 12345;
+
+	bool isPassed = true;
+	isPassed &= CheckMatchesSequential("parallel", setting, 0);
+
+	// rŐ؂ւꍇ́A̍XVōXV̔z񂪎c悤^XNuȂ
+	SyntheticTreeSetting switchSetting = setting;
+	switchSetting.mortalRate = 0.0f;
+	isPassed &= CheckMatchesSequential("switched", switchSetting, SWITCH_FRAME);
+
+	// XVɃ^XN폜EǉAeς
+	SyntheticTreeSetting restructureSetting = setting;
+	restructureSetting.isRestructuring = true;
+	isPassed &= CheckMatchesSequential("reparent", restructureSetting, 0);
+
+	// 񂷂ˑ֌W͒̍XVɖ߂
+	{
+		std::vector<uint64_t> values = { 1, 2 };
+		SyntheticTask taskA(&values, 0, 1);
+		SyntheticTask taskB(&values, 1, 1);
+
+		TaskManager taskManager;
+		taskManager.SetUpdateMode(TaskManager::UpdateMode::PARALLEL);
+		taskManager.SetThreadNum(2);
+		taskManager.AddTask(&taskA);
+		taskManager.AddTask(&taskB);
+		taskA.AddPredecessor(&taskB);
+		taskB.AddPredecessor(&taskA);
+		taskManager.Update(DELTA_TIME);
+
+		isPassed &= Check(!taskManager.GetScheduler()->IsValid() && taskA.frame == 1 && taskB.frame == 1, "cycle : fell back to sequential update");
+	}
+
+	return isPassed;
+}
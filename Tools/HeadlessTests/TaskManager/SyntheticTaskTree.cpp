@@ -0,0 +1,225 @@
+/*****************************************************************//**
+ * @file    SyntheticTaskTree.cpp
+ * @brief   ^XNǗ̃eXgp̃^XN̖؂Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "SyntheticTaskTree.h"
+
+
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ *
+ * @param[in] values		SẴ^XN̒l
+ * @param[in] valueIndex	̒l̈ʒu
+ * @param[in] workNum		
+ */
+SyntheticTask::SyntheticTask(std::vector<uint64_t>* values, uint32_t valueIndex, int workNum)
+	: values{ values }
+	, valueIndex{ valueIndex }
+	, reads{}
+	, workNum{ workNum }
+	, lifeFrame{ -1 }
+	, isToggling{ false }
+	, frame{ 0 }
+	, restructureFrame{ -1 }
+	, deleteTarget{ nullptr }
+	, moveTarget{ nullptr }
+	, moveParent{ nullptr }
+	, spawnTask{ nullptr }
+	, spawnParent{ nullptr }
+{
+}
+
+
+
+/**
+ * @brief XV
+ *
+ * @param[in] deltaTime oߎ
+ *
+ * @returns true  ^XNc
+ * @returns false ߂
+ */
+bool SyntheticTask::UpdateTask(float deltaTime)
+{
+	UNREFERENCED_PARAMETER(deltaTime);
+
+	uint64_t value = (*values)[valueIndex];
+	for (const uint32_t read : reads)
+	{
+		value = MixValue(value ^ (*values)[read]);
+	}
+	for (int i = 0; i < workNum; i++)
+	{
+		value = MixValue(value);
+	}
+	(*values)[valueIndex] = value;
+
+	frame++;
+	if (isToggling)
+	{
+		if (frame % 3 == 0) { DisableTask(); }
+		else { EnableTask(); }
+	}
+
+	// ǉĂɐeςiǉ^XN̎qɂȂĂڂj
+	if (frame == restructureFrame)
+	{
+		GetTaskManager()->DeleteTask(deleteTarget);
+		moveTarget->ChangeParent(moveParent);
+		GetTaskManager()->AddTask(spawnTask);
+		spawnTask->ChangeParent(spawnParent);
+	}
+
+	return lifeFrame < 0 || frame < lifeFrame;
+}
+
+
+
+
+// ֐̒` =================================================================
+/**
+ * @brief liSplitMix64j
+ *
+ * @param[in] value l
+ *
+ * @return l
+ */
+uint64_t MixValue(uint64_t value)
+{
+	value += 0x9E3779B97F4A7C15ull;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
+
+
+/**
+ * @brief ؗp̃^XN̖؂
+ *
+ * ^XN͑Oɍ̂ŁA^XN̔ԍƒl̈ʒuƑOvB
+ * ؂ςꍇ́A2ڂ̃[g̎q̃^XNiO[vj̍ŏ̎qA1ÕO[v̍Ō̎q폜A
+ * ̑O̎q2ÕO[vɈڂA؂̊OōĂ^XN1ÕO[vɒǉB
+ * ǂOŐɂ^XNւ̕ύXŁAύX^XN͍폜^XNƈڂ^XŇɍXVB
+ * ǉ^XN͖؂̃^XŇɕׁAl̈ʒu
+ *
+ * @param[in]  setting		
+ * @param[in]  pTaskManager	^XNǗ
+ * @param[out] pTasks		^XN
+ * @param[out] pValues		SẴ^XN̒l
+ */
+void BuildSyntheticTree(const SyntheticTreeSetting& setting, TaskManager* pTaskManager, std::vector<std::unique_ptr<SyntheticTask>>* pTasks, std::vector<uint64_t>* pValues)
+{
+	std::mt19937 random(setting.seed);
+	std::uniform_real_distribution<float> rate(0.0f, 1.0f);
+
+	const uint32_t taskNum = setting.groupNum * (setting.childNum + 1);
+	const uint32_t spawnNum = setting.isRestructuring ? setting.groupNum - 2 : 0;
+	pValues->assign(taskNum + spawnNum, 0);
+	for (uint32_t i = 0; i < taskNum + spawnNum; i++) { (*pValues)[i] = MixValue(i); }
+
+	pTasks->clear();
+	pTasks->reserve(taskNum + spawnNum);
+
+	Task* group = nullptr;
+	for (uint32_t i = 0; i < taskNum; i++)
+	{
+		const bool isGroup = (i % (setting.childNum + 1) == 0);
+
+		auto task = std::make_unique<SyntheticTask>(pValues, i, setting.workNum);
+		pTaskManager->AddTask(task.get());
+
+		if (isGroup)
+		{
+			group = task.get();
+			task->isToggling = setting.isGroupToggling && (i / (setting.childNum + 1)) % 5 == 1;
+		}
+		else
+		{
+			task->ChangeParent(group);
+		}
+
+		if (rate(random) < setting.mortalRate)
+		{
+			task->lifeFrame = 1 + static_cast<int>(random() % setting.maxLifeFrame);
+		}
+
+		// ؂ς鎞ɑÕO[vɈڂ^XNiڂƑOőOɂȂ^XN̂ŁAɍXVIׂ^XN錾Ȃj
+		const uint32_t groupIndex = i / (setting.childNum + 1);
+		const bool isMoved = setting.isRestructuring && (i + 2) % (setting.childNum + 1) == 0 && groupIndex >= 1 && groupIndex + 2 <= setting.groupNum;
+
+		// ǂޒliɍXVIׂ^XNŐ錾ꍇ͑OőÕ^XNIԁj
+		const bool isUndeclared = setting.isAllUndeclared || rate(random) < setting.undeclaredRate;
+		for (uint32_t r = 0; r < setting.readNum; r++)
+		{
+			const bool isPredecessor = (i > 0) && rate(random) < setting.predecessorRate && !isMoved;
+			const uint32_t read = isPredecessor ? static_cast<uint32_t>(random() % i) : static_cast<uint32_t>(random() % taskNum);
+
+			task->reads.push_back(read);
+
+			if (isUndeclared) { continue; }
+
+			if (isPredecessor) { task->AddPredecessor((*pTasks)[read].get()); }
+			else { task->AddReadResource(&(*pValues)[read]); }
+		}
+
+		if (!isUndeclared)
+		{
+			task->AddWriteResource(&(*pValues)[i]);
+		}
+
+		pTasks->push_back(std::move(task));
+	}
+
+	// ؂ς^XNi폜^XNƈڂ^XN͎ŏȂ悤ɂj
+	for (uint32_t spawn = 0; spawn < spawnNum; spawn++)
+	{
+		const uint32_t group = (spawn + 2) * (setting.childNum + 1);
+		const uint32_t previousGroup = group - (setting.childNum + 1);
+
+		SyntheticTask* restructurer = (*pTasks)[group + 1].get();
+		SyntheticTask* deleteTarget = (*pTasks)[group - 1].get();
+		SyntheticTask* moveTarget = (*pTasks)[group - 2].get();
+		deleteTarget->lifeFrame = -1;
+		moveTarget->lifeFrame = -1;
+
+		auto spawnTask = std::make_unique<SyntheticTask>(pValues, taskNum + spawn, setting.workNum);
+
+		restructurer->restructureFrame = 2 + static_cast<int>(spawn % 7);
+		restructurer->deleteTarget = deleteTarget;
+		restructurer->moveTarget = moveTarget;
+		restructurer->moveParent = (*pTasks)[previousGroup - (setting.childNum + 1)].get();
+		restructurer->spawnTask = spawnTask.get();
+		restructurer->spawnParent = (*pTasks)[previousGroup].get();
+		restructurer->AddPredecessor(deleteTarget);
+		restructurer->AddPredecessor(moveTarget);
+
+		pTasks->push_back(std::move(spawnTask));
+	}
+}
+
+
+
+/**
+ * @brief cĂ^XN̒l̈ʒuOɏW߂
+ *
+ * @param[in]  pTask		W߂^XN̐e
+ * @param[out] pAliveTasks	cĂ^XN̒l̈ʒu
+ */
+void CollectAliveTasks(Task* pTask, std::vector<uint32_t>* pAliveTasks)
+{
+	for (Task* child : *pTask->GetTaskConnectInfo().GetChildList())
+	{
+		pAliveTasks->push_back(static_cast<SyntheticTask*>(child)->valueIndex);
+		CollectAliveTasks(child, pAliveTasks);
+	}
+}
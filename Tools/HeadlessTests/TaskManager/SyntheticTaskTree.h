@@ -0,0 +1,104 @@
+/*****************************************************************//**
+ * @file    SyntheticTaskTree.h
+ * @brief   ^XNǗ̃eXgp̃^XN̖؂Ɋւwb_[t@C
+ *
+ * ̃^XN̒lǂł^XNA̎킩瓯`̖؂ɕׂB
+ * ˑ֌WiLf[^̓ǂݏEɍXVIׂ^XNj̐錾Arŏ^XNA
+ * LƖ؂ւ^XNAXVɑ̃^XN폜EǉĐeς^XNőI
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Game/Common/Framework/TaskManager/TaskManager.h"
+
+
+
+
+// \̂̒` ===============================================================
+/**
+ * @brief ؗp̃^XN̖؂̍
+ */
+struct SyntheticTreeSetting
+{
+	uint32_t	groupNum;			///< [g̎q̃^XN̐
+	uint32_t	childNum;			///< ꂼ̎q̃^XN̐
+	uint32_t	readNum;			///< 1̃^XNǂޒl̐
+	int			workNum;			///< 
+	float		predecessorRate;	///< ǂޒlɍXVIׂ^XNŐ錾銄
+	float		undeclaredRate;		///< Lf[^錾Ȃ^XN̊
+	float		mortalRate;			///< ̂^XN̊
+	int			maxLifeFrame;		///< ̍ől
+	bool		isGroupToggling;	///< [g̎q̃^XN̈ꕔLƖŐ؂ւ邩ǂ
+	bool		isAllUndeclared;	///< SẴ^XNŋLf[^錾Ȃǂ
+	bool		isRestructuring;	///< XVɃ^XN폜EǉAeς邩ǂ
+	uint32_t	seed;				///< ̎
+};
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief ؗp̃^XN
+ *
+ * ̃^XN̒lǂłA̒lɏB߂ false ԂA؂ւꍇ 3 t[1xɂȂB
+ * ؂ςt[ɂ́A^XN폜Aʂ̃^XN̐eςA^XNǉĂeς
+ */
+class SyntheticTask
+	: public Task
+{
+// f[^o̐錾 -----------------------------------------------
+public:
+	std::vector<uint64_t>*	values;		///< SẴ^XN̒l
+	uint32_t				valueIndex;	///< ̒l̈ʒu
+	std::vector<uint32_t>	reads;		///< ǂޒl̈ʒu
+	int						workNum;	///< 
+	int						lifeFrame;	///< iȂȂj
+	bool					isToggling;	///< LƖ؂ւ邩ǂ
+	int						frame;		///< XV
+
+	int						restructureFrame;	///< ؂ςt[iȂςȂj
+	Task*					deleteTarget;		///< 폜^XN
+	Task*					moveTarget;			///< eς^XN
+	Task*					moveParent;			///< eς^XN̐Ve
+	Task*					spawnTask;			///< ǉ^XN
+	Task*					spawnParent;		///< ǉ^XN̐e
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	SyntheticTask(std::vector<uint64_t>* values, uint32_t valueIndex, int workNum);
+
+
+// 
+public:
+	// XV
+	bool UpdateTask(float deltaTime) override;
+};
+
+
+
+
+// ֐̐錾 =================================================================
+// liSplitMix64j
+uint64_t MixValue(uint64_t value);
+
+// ؗp̃^XN̖؂
+void BuildSyntheticTree(const SyntheticTreeSetting& setting, TaskManager* pTaskManager, std::vector<std::unique_ptr<SyntheticTask>>* pTasks, std::vector<uint64_t>* pValues);
+
+// cĂ^XN̒l̈ʒuOɏW߂
+void CollectAliveTasks(Task* pTask, std::vector<uint32_t>* pAliveTasks);
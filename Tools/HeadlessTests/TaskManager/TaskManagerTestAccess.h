@@ -0,0 +1,60 @@
+/*****************************************************************//**
+ * @file    TaskManagerTestAccess.h
+ * @brief   ^XNǗ̓̏eXgĂԂ߂̃wb_[t@C
+ *
+ * XV̈ꕔiOt̍쐬E`揇Ǘe[u̕גEċAƍXV̔z̍XVjv邽߁A
+ * TaskManager  friend Ƃē̊֐Ă
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include "Game/Common/Framework/TaskManager/TaskManager.h"
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief ^XNǗ̓̏eXgĂ
+ */
+class TaskManagerTestAccess
+{
+// o֐̐錾 -------------------------------------------------
+public:
+	// ˑ֌W̃Ot
+	static void BuildGraph(TaskManager* pTaskManager) { pTaskManager->BuildGraph(); }
+
+	// `揇Ǘe[uג
+	static void FlushOt(TaskManager* pTaskManager) { pTaskManager->FlushOt(); }
+
+	// s̃^XN̎qƂă^XNǉiXVɒǉꍇƓj
+	static void AddTask(TaskManager* pTaskManager, Task* pCurrentTask, Task* pTask)
+	{
+		pTaskManager->m_currentTask = pCurrentTask;
+		pTaskManager->AddTask(pTask);
+		pTaskManager->m_currentTask = pTaskManager->GetRootTask();
+	}
+
+	// `揇Ǘe[u̎擾
+	static const std::vector<Task*>& GetOt(const TaskManager& taskManager) { return taskManager.m_ot; }
+
+	// q^XNXgċAłǂčXV
+	static void ChildTaskUpdate(TaskManager* pTaskManager, float deltaTime) { pTaskManager->ChildTaskUpdate(pTaskManager->GetRootTask(), deltaTime); }
+
+	// XV̔zɏ]čXV
+	static void FlatUpdate(TaskManager* pTaskManager, float deltaTime) { pTaskManager->FlatUpdate(deltaTime); }
+
+	// XV̔z蒼
+	static void RebuildFlat(TaskManager* pTaskManager) { pTaskManager->RebuildFlat(); }
+
+	// XV̔ẑĂiL͐eǂĒׂj
+	static void DiscardFlat(TaskManager* pTaskManager) { pTaskManager->m_isFlatDirty = true; }
+};
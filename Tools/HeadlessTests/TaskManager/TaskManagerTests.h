@@ -0,0 +1,26 @@
+/*****************************************************************//**
+ * @file    TaskManagerTests.h
+ * @brief   ^XNǗ̃eXgɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// ֐̐錾 =================================================================
+// Wu[hƒ̍XV̌ʂv邱Ƃm߂
+bool RunParallelTest();
+
+// ˑ̖xƂ 10000 ̃^XN̍XVԂv
+bool RunJobBenchmark();
+
+// 1000 / 10000 / 50000 ̃^XNŕ`揇Ǘe[u1t[̈ێ̎Ԃv
+bool RunDrawOrderBenchmark();
+
+// [ 10 / 1000 ̖؂ōXVEL̐؂ւE폜̎Ԃv
+bool RunTreeBenchmark();
@@ -0,0 +1,250 @@
+/*****************************************************************//**
+ * @file    TreeBenchmark.cpp
+ * @brief   ^XNǗ̖؂̍XVEL̐؂ւE폜̌vɊւ\[Xt@C
+ *
+ * [g̉ 10000 / [ {̃^XN̍ui4{1{2Ԗڂ̃^XN𖳌ɂjA̎ԂvB
+ * E1t[̍XViq^XNXg̍ċAƍXV̔zj
+ * ESĂ̍3Ԗڂ̃^XN𖳌ɂđSẴ^XN̗L𒲂ׁALɖ߂čĂђׂieǂꍇƊoLj
+ * ESĂ̍sɍ폜iq^XNXgTꍇƊoʒuŊOꍇj
+ * XV񐔂ƗLȃ^XN̐ꂼv邱Ƃm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "TaskManagerTests.h"
+
+#include "Common/TestRunner.h"
+#include "TaskManagerTestAccess.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int		FRAME_NUM	= 100;				///< vt[
+	constexpr uint32_t	TASK_NUM	= 10000;			///< ^XN̐
+	constexpr uint32_t	DEPTHS[]	= { 10, 1000 };		///< ̐[
+	constexpr float		DELTA_TIME	= 1.0f / 60.0f;		///< 1t[̌oߎ
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief XV񐔂𐔂^XN
+	 */
+	class CountingTask
+		: public Task
+	{
+	public:
+		uint64_t* pCount;	///< XV
+
+		explicit CountingTask(uint64_t* pCount)
+			: pCount{ pCount }
+		{
+		}
+
+		bool UpdateTask(float deltaTime) override
+		{
+			UNREFERENCED_PARAMETER(deltaTime);
+			(*pCount)++;
+			return true;
+		}
+	};
+
+
+
+	/**
+	 * @brief ׂ
+	 */
+	struct ChainTree
+	{
+		TaskManager taskManager;
+		std::vector<std::unique_ptr<CountingTask>> tasks;
+		std::vector<Task*> heads;		///< ̐擪̃^XN
+		std::vector<Task*> toggles;		///< L؂ւ3Ԗڂ̃^XN
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ׂ؂A1xXV
+	 *
+	 * @param[in]  depth		̐[
+	 * @param[in]  pCount		XV
+	 * @param[out] pTree		
+	 */
+	void BuildChainTree(uint32_t depth, uint64_t* pCount, ChainTree* pTree)
+	{
+		const uint32_t chainNum = TASK_NUM / depth;
+		for (uint32_t chain = 0; chain < chainNum; chain++)
+		{
+			Task* parent = nullptr;
+			for (uint32_t level = 0; level < depth; level++)
+			{
+				auto task = std::make_unique<CountingTask>(pCount);
+				task->SetName("Task");
+				pTree->taskManager.AddTask(task.get());
+				if (parent) { task->ChangeParent(parent); }
+				else { pTree->heads.push_back(task.get()); }
+
+				// 4{1{2Ԗڂ̃^XN𖳌ɂ
+				if (level == 1 && chain % 4 == 0) { task->DisableTask(); }
+				if (level == 2) { pTree->toggles.push_back(task.get()); }
+
+				parent = task.get();
+				pTree->tasks.push_back(std::move(task));
+			}
+		}
+		pTree->taskManager.Update(DELTA_TIME);
+	}
+
+
+
+	/**
+	 * @brief 3Ԗڂ̃^XN𖳌ɂėLȃ^XN𐔂ALɖ߂čĂѐ
+	 *
+	 * @param[in] pTree 
+	 *
+	 * @return Lȃ^XN̐̍v
+	 */
+	uint64_t ToggleAndCount(ChainTree* pTree)
+	{
+		uint64_t enabledNum = 0;
+		for (Task* task : pTree->toggles) { task->DisableTask(); }
+		for (const auto& task : pTree->tasks) { enabledNum += task->IsEnabled() ? 1 : 0; }
+		for (Task* task : pTree->toggles) { task->EnableTask(); }
+		for (const auto& task : pTree->tasks) { enabledNum += task->IsEnabled() ? 1 : 0; }
+		return enabledNum;
+	}
+
+
+
+	/**
+	 * @brief JԂA1񂠂̎Ԃv
+	 *
+	 * @param[in] function 
+	 *
+	 * @return 1񂠂̎ԁi}CNbj
+	 */
+	double MeasurePerFrame(const std::function<void()>& function)
+	{
+		return MeasureMilliseconds([&]()
+			{
+				for (int i = 0; i < FRAME_NUM; i++) { function(); }
+			}) * 1000.0 / FRAME_NUM;
+	}
+
+
+
+	/**
+	 * @brief ȑO̍폜ie̎qXgTĊOj
+	 *
+	 * @param[in] pTask 폜^XN
+	 */
+	void LegacyDelete(Task* pTask)
+	{
+		auto childList = pTask->GetTaskConnectInfo().GetChildList();
+		while (!childList->empty()) { LegacyDelete(childList->back()); }
+
+		auto parentChildList = pTask->GetParent()->GetTaskConnectInfo().GetChildList();
+		auto it = std::find(parentChildList->begin(), parentChildList->end(), pTask);
+		if (it != parentChildList->end()) { parentChildList->erase(it); }
+	}
+
+
+
+	/**
+	 * @brief SĂ̍sɍ폜鎞Ԃv
+	 *
+	 * @param[in] depth		̐[
+	 * @param[in] isLegacy	ȑO̍폜gǂ
+	 *
+	 * @return ԁi}CNbj
+	 */
+	double MeasureDelete(uint32_t depth, bool isLegacy)
+	{
+		uint64_t updateCount = 0;
+		ChainTree tree;
+		BuildChainTree(depth, &updateCount, &tree);
+		std::shuffle(tree.heads.begin(), tree.heads.end(), std::mt19937(12345));
+
+		return MeasureMilliseconds([&]()
+			{
+				for (Task* head : tree.heads)
+				{
+					if (isLegacy) { LegacyDelete(head); }
+					else { tree.taskManager.DeleteTask(head); }
+				}
+			}) * 1000.0;
+	}
+}
+
+
+
+/**
+ * @brief [ 10 / 1000 ̖؂ōXVEL̐؂ւE폜̎Ԃv
+ *
+ * @returns true  ǂ̐[łċAƍXV̔zōXV񐔁AeǂꍇƊoLŗLȃ^XN̐v
+ * @returns false vȂꍇ
+ */
+bool RunTreeBenchmark()
+{
+	std::printf("%u tasks, %d frames\n", TASK_NUM, FRAME_NUM);
+
+	bool isPassed = true;
+
+	for (const uint32_t depth : DEPTHS)
+	{
+		const uint32_t chainNum = TASK_NUM / depth;
+		uint64_t updateCount = 0;
+
+		// XVƗL̐؂ւ
+		double recursiveTime = 0.0, flatTime = 0.0, walkTime = 0.0, cachedTime = 0.0;
+		uint64_t recursiveCount = 0, flatCount = 0, walkEnabledNum = 0, cachedEnabledNum = 0;
+		{
+			ChainTree tree;
+			BuildChainTree(depth, &updateCount, &tree);
+
+			// q^XNXg̍ċAiL͐eǂĒׂj
+			TaskManagerTestAccess::DiscardFlat(&tree.taskManager);
+			updateCount = 0;
+			recursiveTime = MeasurePerFrame([&]() { TaskManagerTestAccess::ChildTaskUpdate(&tree.taskManager, DELTA_TIME); });
+			recursiveCount = updateCount;
+			walkTime = MeasurePerFrame([&]() { walkEnabledNum += ToggleAndCount(&tree); });
+
+			// XV̔z
+			TaskManagerTestAccess::RebuildFlat(&tree.taskManager);
+			updateCount = 0;
+			flatTime = MeasurePerFrame([&]() { TaskManagerTestAccess::FlatUpdate(&tree.taskManager, DELTA_TIME); });
+			flatCount = updateCount;
+			cachedTime = MeasurePerFrame([&]() { cachedEnabledNum += ToggleAndCount(&tree); });
+		}
+
+		// 폜
+		const double findDeleteTime = MeasureDelete(depth, true);
+		const double iteratorDeleteTime = MeasureDelete(depth, false);
+
+		std::printf("depth %4u (%4u chains) : update recursive %8.1f us / flat %7.1f us, toggle + query walk %9.1f us / cached %7.1f us, delete all find %8.1f us / iterator %7.1f us\n",
+			depth, chainNum, recursiveTime, flatTime, walkTime, cachedTime, findDeleteTime, iteratorDeleteTime);
+
+		isPassed &= Check(recursiveCount == flatCount, "depth %4u : updates recursive %llu / flat %llu",
+			depth, static_cast<unsigned long long>(recursiveCount), static_cast<unsigned long long>(flatCount));
+		isPassed &= Check(walkEnabledNum == cachedEnabledNum, "depth %4u : enabled tasks walk %llu / cached %llu",
+			depth, static_cast<unsigned long long>(walkEnabledNum), static_cast<unsigned long long>(cachedEnabledNum));
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,184 @@
+/*****************************************************************//**
+ * @file    AdaptiveIterationBenchmark.cpp
+ * @brief   cɂ锽̑ł؂̌vɊւ\[Xt@C
+ *
+ * C[ƓdEd͂ŁA[ɏdt 50 ̃p[eBÑ[v
+ * EÎ~F^ɒ݂邵Ď~߂Ă
+ * EhFU艺낷
+ * EグF^ɒ݂邵AŒ_̑ňグ
+ * 3̏󋵂ŁA񐔂Œ肵ꍇƎcőł؂ꍇ
+ * 1t[̔񐔁iSẴTuXebv̍vjEcEő̐LсEԂvB
+ * 񐔂Œ肵ĂLт܂Ȃݒł͑ł؂肪NȂ߁ATuXebvg
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/XPBDSimulator.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief 
+	 */
+	enum class Scenario
+	{
+		IDLE,		///< Î~
+		SWING,		///< h
+		TAUT_PULL,	///< グ
+	};
+
+
+
+	/**
+	 * @brief v
+	 */
+	struct Measurement
+	{
+		double	iterationSum	= 0.0;	///< 񐔂̍v
+		double	residualSum		= 0.0;	///< c̍v
+		float	maxStretch		= 0.0f;	///< ő̐LсiRƂ̔j
+		double	ms				= 0.0;	///< ԁi~bj
+	};
+}
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int	PARTICLE_NUM		= 50;				///< p[eBN̐
+	constexpr float SEGMENT_LENGTH		= 0.4f;				///< p[eBN̊Ԋu
+	constexpr float PARTICLE_MASS		= 5.0f;				///< p[eBN̎
+	constexpr float LOAD_MASS			= 60.0f;			///< [̏diԂ牺vC[j̎
+	constexpr float FLEXIBILITY			= 0.000000006f;		///< _iC[Ɠj
+	constexpr float DELTA_TIME			= 1.0f / 60.0f;		///< 1t[̌oߎ
+	constexpr int	FRAME_NUM			= 600;				///< i߂t[
+	constexpr int	SUBSTEPS			= 10;				///< TuXebviLт܂ݒj
+	constexpr int	MAX_ITERATIONS		= 10;				///< TuXebvƂ̔񐔁ił؂ꍇ͍őlj
+	constexpr int	MIN_ITERATIONS		= 2;				///< ł؂ꍇ̔񐔂̍ŏl
+	constexpr float RESIDUAL_TOLERANCE	= 0.001f;			///< ł؂ci1mmj
+	constexpr float PULL_SPEED			= 4.0f;				///< グ鑬
+
+	constexpr Scenario		SCENARIOS[]			= { Scenario::IDLE, Scenario::SWING, Scenario::TAUT_PULL };
+	constexpr const char*	SCENARIO_NAMES[]	= { "idle", "swing", "taut pull" };
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief 1̏󋵂Ń[vi߁A񐔁EcELсEԂ߂
+	 *
+	 * @param[in] scenario		
+	 * @param[in] isAdaptive	cőł؂邩ǂ
+	 *
+	 * @return v
+	 */
+	Measurement Measure(Scenario scenario, bool isAdaptive)
+	{
+		// 擪Œ肵[vih͐AȊO͐^ɒ݂邷j
+		std::vector<std::unique_ptr<ParticleObject>> particleObjects(PARTICLE_NUM);
+		std::vector<ParticleObject*> ropeParticles(PARTICLE_NUM);
+		for (int i = 0; i < PARTICLE_NUM; i++)
+		{
+			const Vector3 offset = (scenario == Scenario::SWING) ? Vector3(SEGMENT_LENGTH * i, 0.0f, 0.0f) : Vector3(0.0f, -SEGMENT_LENGTH * i, 0.0f);
+			particleObjects[i] = std::make_unique<ParticleObject>();
+			particleObjects[i]->SetPosition(Vector3(0.0f, 30.0f, 0.0f) + offset);
+			particleObjects[i]->SetVelocity(Vector3::Zero);
+			particleObjects[i]->SetMass((i == PARTICLE_NUM - 1) ? LOAD_MASS : PARTICLE_MASS);
+			ropeParticles[i] = particleObjects[i].get();
+		}
+
+		XPBDSimulator::Parameter parameter;
+		parameter.flexibility			= FLEXIBILITY;
+		parameter.gravity				= Vector3(0.0f, -9.8f / 2.0f, 0.0f);
+		parameter.iterations			= MAX_ITERATIONS;
+		parameter.substeps				= SUBSTEPS;
+		parameter.isAdaptiveIterations	= isAdaptive;
+		parameter.minIterations			= MIN_ITERATIONS;
+		parameter.residualTolerance		= RESIDUAL_TOLERANCE;
+
+		XPBDSimulator simulator;
+		simulator.AddConstraint(std::make_unique<DistanceConstraintFactory>());
+		simulator.Initialize(parameter, ropeParticles);
+
+		Measurement measurement;
+		for (int frame = 0; frame < FRAME_NUM; frame++)
+		{
+			if (scenario == Scenario::TAUT_PULL)
+			{
+				particleObjects[0]->SetPosition(particleObjects[0]->GetPosition() + Vector3(0.0f, PULL_SPEED * DELTA_TIME, 0.0f));
+			}
+
+			measurement.ms += MeasureMilliseconds([&]() { simulator.Update(DELTA_TIME); });
+
+			measurement.iterationSum += simulator.GetLastSolveResult().iterations;
+			measurement.residualSum += simulator.GetLastSolveResult().residual;
+
+			// v̊OŐLт߂
+			for (int i = 0; i + 1 < PARTICLE_NUM; i++)
+			{
+				const float distance = Vector3::Distance(simulator.GetParticlePosition(i), simulator.GetParticlePosition(i + 1));
+				measurement.maxStretch = std::max(measurement.maxStretch, distance / SEGMENT_LENGTH - 1.0f);
+			}
+		}
+
+		return measurement;
+	}
+}
+
+
+
+/**
+ * @brief cɂ锽̑ł؂Ō񐔂󋵂ƂɌv
+ *
+ * @returns true  ǂ̏󋵂ł񐔂Œ肵ꍇ茸Ac̕ςł؂cɎ܂
+ * @returns false ꂩ𖞂Ȃ
+ */
+bool RunAdaptiveIterationBenchmark()
+{
+	std::printf("%d particles, %d frames, substeps %d, iterations %d-%d, tolerance %.4f\n",
+		PARTICLE_NUM, FRAME_NUM, SUBSTEPS, MIN_ITERATIONS, MAX_ITERATIONS, RESIDUAL_TOLERANCE);
+
+	bool isPassed = true;
+
+	for (const Scenario scenario : SCENARIOS)
+	{
+		const char* name = SCENARIO_NAMES[static_cast<int>(scenario)];
+
+		const Measurement fixed		= Measure(scenario, false);
+		const Measurement adaptive	= Measure(scenario, true);
+
+		const double fixedIterations	= fixed.iterationSum / FRAME_NUM;
+		const double adaptiveIterations	= adaptive.iterationSum / FRAME_NUM;
+
+		std::printf("%-9s fixed    : iterations %5.2f, residual %.5f, stretch max %.4f, %.2f us/frame\n",
+			name, fixedIterations, fixed.residualSum / FRAME_NUM, fixed.maxStretch, fixed.ms * 1000.0 / FRAME_NUM);
+		std::printf("%-9s adaptive : iterations %5.2f, residual %.5f, stretch max %.4f, %.2f us/frame (%.1f%% iterations saved)\n",
+			name, adaptiveIterations, adaptive.residualSum / FRAME_NUM, adaptive.maxStretch, adaptive.ms * 1000.0 / FRAME_NUM,
+			100.0 * (1.0 - adaptiveIterations / fixedIterations));
+
+		isPassed &= Check(adaptiveIterations < fixedIterations, "%-9s : adaptive iterations %.2f < fixed %.2f", name, adaptiveIterations, fixedIterations);
+		isPassed &= Check(adaptive.residualSum / FRAME_NUM <= RESIDUAL_TOLERANCE, "%-9s : adaptive residual %.5f <= %.4f", name, adaptive.residualSum / FRAME_NUM, RESIDUAL_TOLERANCE);
+	}
+
+	return isPassed;
+}
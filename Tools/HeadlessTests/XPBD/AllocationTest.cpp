@@ -0,0 +1,112 @@
+/*****************************************************************//**
+ * @file    AllocationTest.cpp
+ * @brief   XPBDSimulator ̃mۂ̃eXgɊւ\[Xt@C
+ *
+ * ̏ɒ݂邵[vƏՓːŗh炵Aŏ̐t[ig@ǰ
+ * p[eBNE̔zƐ̃v[xmۂȂƂm߂B
+ * Ԍ̓Ŋmۂ镪͐Ȃ
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/XPBDSimulator.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/CollisionConstraint/CollisionConstraintFactory.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int	PARTICLE_NUM		= 20;			///< p[eBN̐
+	constexpr float PARTICLE_DISTANCE	= 0.5f;			///< p[eBN̊Ԋu
+	constexpr int	WARM_UP_FRAME_NUM	= 120;			///< g@̃t[
+	constexpr int	FRAME_NUM			= 600;			///< g@̌ɐi߂t[
+	constexpr float DELTA_TIME			= 1.0f / 60.0f;	///< 1t[̌oߎ
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief Ƃēo^IuWFNg
+	 */
+	class FloorObject
+		: public GameObject
+	{
+	public:
+		bool IsActive() const override { return true; }
+		GameObjectTag GetTag() const override { return GameObjectTag::BUILDING; }
+	};
+}
+
+
+
+/**
+ * @brief [vh炵Ă̐ŃmۂȂƂm߂
+ *
+ * @returns true  g@̌ɈxmۂȂ
+ * @returns false g@̌Ƀmۂ
+ */
+bool RunAllocationTest()
+{
+	// 
+	CollisionManager collisionManager;
+	FloorObject floor;
+	AABB floorBox(Vector3(0.0f, -0.5f, 0.0f), Vector3(40.0f, 1.0f, 40.0f));
+	collisionManager.AddCollisionData(CollisionData(&floor, &floorBox, true));
+
+	// ɓ͂̃[vɒA擪Œ肵ĐU艺낷
+	std::vector<std::unique_ptr<ParticleObject>> particleObjects(PARTICLE_NUM);
+	std::vector<ParticleObject*> ropeParticles(PARTICLE_NUM);
+	for (int i = 0; i < PARTICLE_NUM; i++)
+	{
+		particleObjects[i] = std::make_unique<ParticleObject>();
+		particleObjects[i]->SetPosition(Vector3(PARTICLE_DISTANCE * i, 5.0f, 0.0f));
+		particleObjects[i]->SetVelocity(Vector3::Zero);
+		particleObjects[i]->SetMass(1.0f);
+		ropeParticles[i] = particleObjects[i].get();
+	}
+
+	XPBDSimulator::Parameter parameter;
+	parameter.gravity = Vector3(0.0f, -9.8f, 0.0f);
+
+	XPBDSimulator simulator;
+	simulator.AddConstraint(std::make_unique<DistanceConstraintFactory>());
+	simulator.AddConstraint(std::make_unique<CollisionConstraintFactory>(&collisionManager));
+	simulator.Initialize(parameter, ropeParticles);
+
+	// g@i̐őɂȂ܂Ŋmۂj
+	for (int frame = 0; frame < WARM_UP_FRAME_NUM; frame++)
+	{
+		simulator.Update(DELTA_TIME);
+	}
+
+	const size_t warmUpAllocationCount = simulator.GetAllocationCount();
+
+	size_t maxConstraintNum = 0;
+	for (int frame = 0; frame < FRAME_NUM; frame++)
+	{
+		simulator.Update(DELTA_TIME);
+		maxConstraintNum = std::max(maxConstraintNum, simulator.GetConstraintNum());
+	}
+
+	const size_t steadyAllocationNum = simulator.GetAllocationCount() - warmUpAllocationCount;
+
+	return Check(steadyAllocationNum == 0, "warm up %zu allocations, steady %zu allocations in %d frames (max %zu constraints)",
+		warmUpAllocationCount, steadyAllocationNum, FRAME_NUM, maxConstraintNum);
+}
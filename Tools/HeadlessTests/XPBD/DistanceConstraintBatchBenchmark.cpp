@@ -0,0 +1,212 @@
+/*****************************************************************//**
+ * @file    DistanceConstraintBatchBenchmark.cpp
+ * @brief   ̔ž؂ƌvɊւ\[Xt@C
+ *
+ * 50 q[v 2000 {ׁAʒu
+ * EDistanceConstraint  IConstraint ƂďɉiXPBDSimulator Ɠj
+ * ESolveSequential ŏɉ
+ * E2FɕAFƂ SolveIndependent ŉ
+ * 3ʂŔAŏIʒuv邱Ƃm߂1bɉ񐔂vB
+ * FƂɉꍇ́A DistanceConstraint ʂƔׂ
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/SimParticle/SimParticle.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraint.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintBatch.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	ROPE_NUM		= 2000;			///< [v̐
+	constexpr uint32_t	PARTICLE_NUM	= 50;			///< [v1{̃p[eBN̐
+	constexpr float		SEGMENT_LENGTH	= 0.2f;			///< R
+	constexpr float		COMPLIANCE		= 0.000001f;	///< _
+	constexpr float		DELTA_TIME		= 1.0f / 60.0f;	///< oߎ
+	constexpr int		ITERATION_NUM	= 100;			///< 
+	constexpr float		TOLERANCE		= 1e-4f;		///< FƂɉꍇ̍̋el
+}
+
+
+
+/**
+ * @brief ̔z DistanceConstraint ƔׁA1bɉ񐔂v
+ *
+ * @returns true  ɉʂSɈvAFƂɉʂ̍elɎ܂
+ * @returns false ꂩ𖞂Ȃ
+ */
+bool RunDistanceConstraintBatchBenchmark()
+{
+	const uint32_t particleNum = ROPE_NUM * PARTICLE_NUM;
+
+	// RL΂Ah炵ʒu
+	std::vector<Vector3> initialPositions(particleNum);
+	for (uint32_t r = 0; r < ROPE_NUM; r++)
+	{
+		for (uint32_t i = 0; i < PARTICLE_NUM; i++)
+		{
+			const float t = static_cast<float>(r * PARTICLE_NUM + i);
+			initialPositions[r * PARTICLE_NUM + i] = Vector3(static_cast<float>(r), SEGMENT_LENGTH * 1.5f * i, 0.05f * std::sin(t));
+		}
+	}
+
+	// **** IConstraint Ƃĉ ****
+	std::vector<SimParticle> simParticles(particleNum);
+	for (uint32_t i = 0; i < particleNum; i++)
+	{
+		simParticles[i].SetFixed(i % PARTICLE_NUM == 0);
+		simParticles[i].SetX(initialPositions[i]);
+		simParticles[i].SetXi(initialPositions[i]);
+		simParticles[i].SetMass(1.0f);
+		simParticles[i].SetInvMass(1.0f);
+	}
+
+	std::vector<std::unique_ptr<DistanceConstraint>> constraints;
+	std::vector<IConstraint*> sequentialOrder;
+	std::vector<IConstraint*> coloredOrder;
+	std::vector<uint32_t> coloredIndices;
+	for (uint32_t r = 0; r < ROPE_NUM; r++)
+	{
+		for (uint32_t i = 0; i + 1 < PARTICLE_NUM; i++)
+		{
+			auto constraint = std::make_unique<DistanceConstraint>(&simParticles[r * PARTICLE_NUM + i], &simParticles[r * PARTICLE_NUM + i + 1]);
+			constraint->ResetConstraintParam(COMPLIANCE);
+			sequentialOrder.push_back(constraint.get());
+			constraints.push_back(std::move(constraint));
+		}
+	}
+
+	// דmq̂ŁA[v̒ŋԖڂƊԖڂ2Fɕ
+	size_t colorSize = 0;	///< 1Fڂ̐
+	for (uint32_t color = 0; color < 2; color++)
+	{
+		for (uint32_t c = 0; c < sequentialOrder.size(); c++)
+		{
+			if ((c % (PARTICLE_NUM - 1)) % 2 != color) continue;
+			coloredOrder.push_back(sequentialOrder[c]);
+			coloredIndices.push_back(c);
+		}
+		if (color == 0) colorSize = coloredIndices.size();
+	}
+
+	// XPBDSimulator::IterateConstraints Ɠ
+	auto solveVirtual = [&](const std::vector<IConstraint*>& order)
+		{
+			for (int iteration = 0; iteration < ITERATION_NUM; iteration++)
+			{
+				for (IConstraint* pConstraint : order)
+				{
+					ConstraintParam param = pConstraint->GetConstraintParam();
+					const float C = pConstraint->EvaluateConstraint();
+					if (C <= 0.0f) { continue; }
+					const float  = pConstraint->ComputeLambdaCorrection(DELTA_TIME, C);
+					param. = param. + ;
+					pConstraint->SetConstraintParam(param);
+					pConstraint->ApplyPositionCorrection();
+				}
+			}
+		};
+
+	auto resetVirtual = [&]()
+		{
+			for (uint32_t i = 0; i < particleNum; i++)
+			{
+				simParticles[i].SetXi(initialPositions[i]);
+			}
+			for (auto& constraint : constraints)
+			{
+				constraint->ResetConstraintParam(COMPLIANCE);
+			}
+		};
+
+	// **** zŉ ****
+	std::vector<float> xiX(particleNum), xiY(particleNum), xiZ(particleNum), invMass(particleNum);
+	const DistanceConstraintBatch::ParticleArrays particles = { xiX.data(), xiY.data(), xiZ.data(), invMass.data() };
+
+	DistanceConstraintBatch batch;
+	batch.Reserve(static_cast<uint32_t>(sequentialOrder.size()));
+	for (uint32_t r = 0; r < ROPE_NUM; r++)
+	{
+		for (uint32_t i = 0; i + 1 < PARTICLE_NUM; i++)
+		{
+			const uint32_t index = r * PARTICLE_NUM + i;
+			batch.Add(index, index + 1, Vector3::Distance(initialPositions[index], initialPositions[index + 1]));
+		}
+	}
+
+	auto resetBatch = [&]()
+		{
+			for (uint32_t i = 0; i < particleNum; i++)
+			{
+				xiX[i] = initialPositions[i].x;
+				xiY[i] = initialPositions[i].y;
+				xiZ[i] = initialPositions[i].z;
+				invMass[i] = 1.0f;
+			}
+			batch.ResetParameters(0, batch.GetSize(), COMPLIANCE);
+		};
+
+	auto maxDifference = [&]()
+		{
+			float difference = 0.0f;
+			for (uint32_t i = 0; i < particleNum; i++)
+			{
+				difference = std::max(difference, Vector3::Distance(simParticles[i].GetXi(), Vector3(xiX[i], xiY[i], xiZ[i])));
+			}
+			return difference;
+		};
+
+	const double solvedNum = static_cast<double>(sequentialOrder.size()) * ITERATION_NUM;
+	auto constraintsPerSecond = [&](double ms) { return solvedNum / std::max(ms, 0.001) / 1000.0; };
+
+	std::printf("%u constraints, %d iterations\n", static_cast<uint32_t>(sequentialOrder.size()), ITERATION_NUM);
+
+	// ɉ
+	resetVirtual();
+	const double virtualMs = MeasureMilliseconds([&] { solveVirtual(sequentialOrder); });
+	resetBatch();
+	const double sequentialMs = MeasureMilliseconds([&]
+		{
+			for (int iteration = 0; iteration < ITERATION_NUM; iteration++)
+			{
+				batch.SolveSequential(0, batch.GetSize(), particles, DELTA_TIME);
+			}
+		});
+	const float sequentialDifference = maxDifference();
+
+	// FƂɉ
+	resetVirtual();
+	const double coloredVirtualMs = MeasureMilliseconds([&] { solveVirtual(coloredOrder); });
+	resetBatch();
+	const double independentMs = MeasureMilliseconds([&]
+		{
+			for (int iteration = 0; iteration < ITERATION_NUM; iteration++)
+			{
+				batch.SolveIndependent(coloredIndices.data(), colorSize, particles, DELTA_TIME);
+				batch.SolveIndependent(coloredIndices.data() + colorSize, coloredIndices.size() - colorSize, particles, DELTA_TIME);
+			}
+		});
+	const float independentDifference = maxDifference();
+
+	std::printf("IConstraint sequential : %.1f M/s\n", constraintsPerSecond(virtualMs));
+	std::printf("IConstraint colored    : %.1f M/s\n", constraintsPerSecond(coloredVirtualMs));
+
+	bool isPassed = true;
+	isPassed &= Check(sequentialDifference == 0.0f, "batch sequential       : %.1f M/s, max difference %g",
+		constraintsPerSecond(sequentialMs), sequentialDifference);
+	isPassed &= Check(independentDifference <= TOLERANCE, "batch SIMD colored     : %.1f M/s, max difference %g",
+		constraintsPerSecond(independentMs), independentDifference);
+	return isPassed;
+}
@@ -0,0 +1,180 @@
+/*****************************************************************//**
+ * @file    IdleRopeBenchmark.cpp
+ * @brief   ~܂[v̖Əڍדx̌vɊւ\[Xt@C
+ *
+ * ^ɒ݂邵 50 ̃p[eBÑ[v 500 {ׁA
+ * ESċN܂
+ * E点
+ * Eɒu RopeLOD Ō炷i点Ȃj
+ * ERopeLOD Ō炵Ė点iJ̋߂ł[v͌炷j
+ * 4̏ꍇŁA1t[ XPBDSimulator::Update  RopeLOD::Update ̎ԁA
+ * Ă{A1{̃p[eBN̐v
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/RopeLOD/RopeLOD.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief vꍇ
+	 */
+	struct Case
+	{
+		const char* pName;			///< O
+		bool isSleepEnabled;		///< 点邩ǂ
+		bool isLodEnabled;			///< RopeLOD Ō炷ǂ
+		float viewDistance;			///< J̋
+		bool isAllSleeping;			///< SĖ͂ǂifalse ȂSċNĂ͂j
+		int expectedParticleNum;	///< 1{̃p[eBN̐
+	};
+
+
+
+	/**
+	 * @brief ~܂[v
+	 */
+	struct IdleRope
+	{
+		std::vector<std::unique_ptr<ParticleObject>> particleObjects;
+		std::vector<ParticleObject*> ropeParticles;
+		XPBDSimulator simulator;
+		RopeLOD lod;
+	};
+}
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int	ROPE_NUM			= 500;				///< [v̖{
+	constexpr int	FRAME_NUM			= 300;				///< vt[
+	constexpr int	HIGH_PARTICLE_NUM	= 50;				///< ڍדxƂ̃p[eBN̐
+	constexpr int	LOW_PARTICLE_NUM	= 10;				///< ڍדxႢƂ̃p[eBN̐
+	constexpr float SEGMENT_LENGTH		= 0.4f;				///< p[eBN̊Ԋu
+	constexpr float FLEXIBILITY			= 0.000000006f;		///< _iC[Ɠj
+	constexpr float DELTA_TIME			= 1.0f / 60.0f;		///< 1t[̌oߎ
+	constexpr int	SUBSTEPS			= 10;				///< TuXebviLт܂ݒj
+	constexpr int	ITERATIONS			= 2;				///< TuXebvƂ̔
+	constexpr int	SETTLE_FRAME_NUM	= 600;				///< v̑Oɗt[
+	constexpr float NEAR_DISTANCE		= 30.0f;			///< J̋߂ɒuꍇ̋
+	constexpr float FAR_DISTANCE		= 120.0f;			///< ɒuꍇ̋
+
+	constexpr Case CASES[] =
+	{
+		{ "awake",			false,	false,	NEAR_DISTANCE,	false,	HIGH_PARTICLE_NUM },
+		{ "sleep",			true,	false,	NEAR_DISTANCE,	true,	HIGH_PARTICLE_NUM },
+		{ "lod far",		false,	true,	FAR_DISTANCE,	false,	LOW_PARTICLE_NUM },
+		{ "lod + sleep",	true,	true,	NEAR_DISTANCE,	true,	LOW_PARTICLE_NUM },
+	};
+}
+
+
+
+/**
+ * @brief ~܂[v𑽐ׁA点ꍇƗq炵ꍇ̎Ԃv
+ *
+ * @returns true  ǂ̏ꍇĂ{1{̃p[eBN̐zǂ肾
+ * @returns false zƈႤꍇ
+ */
+bool RunIdleRopeBenchmark()
+{
+	std::printf("%d ropes x %d particles, %d frames, substeps %d, iterations %d\n",
+		ROPE_NUM, HIGH_PARTICLE_NUM, FRAME_NUM, SUBSTEPS, ITERATIONS);
+
+	bool isPassed = true;
+	double awakeTime = 0.0;
+
+	for (const Case& benchmarkCase : CASES)
+	{
+		RopeLOD::Setting setting;
+		setting.highParticleNum = HIGH_PARTICLE_NUM;
+		setting.lowParticleNum	= LOW_PARTICLE_NUM;
+
+		XPBDSimulator::Parameter parameter;
+		parameter.flexibility		= FLEXIBILITY;
+		parameter.gravity			= Vector3(0.0f, -9.8f / 2.0f, 0.0f);
+		parameter.substeps			= SUBSTEPS;
+		parameter.iterations		= ITERATIONS;
+		parameter.isSleepEnabled	= benchmarkCase.isSleepEnabled;
+
+		// ^ɒ݂邵[viqɕׂ
+		std::vector<std::unique_ptr<IdleRope>> ropes(ROPE_NUM);
+		for (int r = 0; r < ROPE_NUM; r++)
+		{
+			ropes[r] = std::make_unique<IdleRope>();
+			IdleRope& rope = *ropes[r];
+
+			rope.lod = RopeLOD(setting);
+			rope.particleObjects.resize(HIGH_PARTICLE_NUM);
+			for (int i = 0; i < HIGH_PARTICLE_NUM; i++)
+			{
+				rope.particleObjects[i] = std::make_unique<ParticleObject>();
+				rope.particleObjects[i]->SetPosition(Vector3(2.0f * (r % 32), 30.0f - SEGMENT_LENGTH * i, 2.0f * (r / 32)));
+				rope.particleObjects[i]->SetVelocity(Vector3::Zero);
+				rope.particleObjects[i]->SetMass(1.0f);
+				rope.ropeParticles.push_back(rope.particleObjects[i].get());
+			}
+
+			rope.simulator.AddConstraint(std::make_unique<DistanceConstraintFactory>());
+			rope.simulator.Initialize(parameter, rope.ropeParticles);
+			rope.lod.Initialize(RopeLOD::CalculateLength(rope.ropeParticles));
+		}
+
+		auto step = [&]()
+			{
+				for (auto& pRope : ropes)
+				{
+					pRope->simulator.Update(DELTA_TIME);
+
+					if (!benchmarkCase.isLodEnabled) { continue; }
+
+					pRope->lod.Update(benchmarkCase.viewDistance, &pRope->simulator, &pRope->particleObjects, &pRope->ropeParticles);
+				}
+			};
+
+		for (int frame = 0; frame < SETTLE_FRAME_NUM; frame++) { step(); }
+
+		const double ms = MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++) { step(); }
+			});
+
+		int sleepingNum = 0;
+		size_t particleSum = 0;
+		for (const auto& pRope : ropes)
+		{
+			if (pRope->simulator.IsSleeping()) { sleepingNum++; }
+			particleSum += pRope->simulator.GetParticleNum();
+		}
+
+		const double microsecondsPerFrame = ms * 1000.0 / FRAME_NUM;
+		if (awakeTime <= 0.0) { awakeTime = microsecondsPerFrame; }
+
+		const int expectedSleepingNum = benchmarkCase.isAllSleeping ? ROPE_NUM : 0;
+		const double particlesPerRope = static_cast<double>(particleSum) / ROPE_NUM;
+		isPassed &= Check(sleepingNum == expectedSleepingNum && particleSum == static_cast<size_t>(benchmarkCase.expectedParticleNum) * ROPE_NUM,
+			"%-11s : %9.1f us/frame (%.1fx), %d / %d sleeping, %.1f / %d particles per rope",
+			benchmarkCase.pName, microsecondsPerFrame, awakeTime / microsecondsPerFrame,
+			sleepingNum, expectedSleepingNum, particlesPerRope, benchmarkCase.expectedParticleNum);
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,194 @@
+/*****************************************************************//**
+ * @file    ParallelWorldTest.cpp
+ * @brief   XPBD ̃[h̐FvZ̃eXgɊւ\[Xt@C
+ *
+ * ؁F݂邵[vQɉꍇƐFĕɉꍇŐi߁AŏI`̍ƃ[v̐Lтo͂B
+ *       FʂXbhɈ˂炸v邱ƁAדmq[v2Fɕ邱Ƃm߂B
+ * vF[v̐ƃXbhς1Xebv̎Ԃo͂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDWorld/XPBDWorld.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int		PARTICLE_NUM		= 50;					///< [v1{̃p[eBN̐
+	constexpr float		SEGMENT_LENGTH		= 0.2f;					///< p[eBN̊Ԋu
+	constexpr float		DELTA_TIME			= 1.0f / 60.0f;			///< 1t[̌oߎ
+	constexpr int		FRAME_NUM			= 300;					///< i߂t[
+	constexpr float		SHAPE_TOLERANCE		= 0.05f;				///< ɉꍇƂ̍ŏI`̍̋eli[v̒ɑ΂j
+	constexpr int		VERIFY_ROPE_NUM		= 64;					///< ؂郍[v̐
+	constexpr int		ROPE_NUMS[]			= { 16, 64, 256, 1024 };	///< v郍[v̐
+	constexpr uint32_t	THREAD_NUMS[]		= { 1, 2, 4, 8 };		///< vXbh
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief ɒ[vׂ[h
+	 *
+	 * @param[out] pWorld		[h
+	 * @param[in]  ropeNum		[v̐
+	 * @param[in]  threadNum	Xbh
+	 */
+	void CreateWorld(XPBDWorld* pWorld, int ropeNum, uint32_t threadNum)
+	{
+		pWorld->SetThreadNum(threadNum);
+		std::vector<Vector3> positions(PARTICLE_NUM);
+		for (int r = 0; r < ropeNum; r++)
+		{
+			XPBDSimulator::Parameter parameter;
+			parameter.iterations	= 5 + r % 11;
+			parameter.flexibility	= 0.000001f * static_cast<float>(1 + r % 4);
+			parameter.gravity		= Vector3(0.0f, -9.8f, 0.0f);
+
+			const Vector3 anchor(static_cast<float>(r % 32) * 2.0f, 20.0f, static_cast<float>(r / 32) * 2.0f);
+			for (int i = 0; i < PARTICLE_NUM; i++)
+			{
+				positions[i] = anchor + Vector3(SEGMENT_LENGTH * static_cast<float>(i), 0.0f, 0.0f);
+			}
+			pWorld->AddRope(parameter, positions, 1.0f);
+		}
+	}
+
+
+
+	/**
+	 * @brief SẴp[eBN̍WW߂
+	 *
+	 * @param[in] world [h
+	 *
+	 * @return i[̏ɕׂW
+	 */
+	std::vector<Vector3> CollectPositions(const XPBDWorld& world)
+	{
+		std::vector<Vector3> positions;
+		const ParticleStore* pStore = world.GetParticleStore();
+		for (uint32_t i = 0; i < pStore->GetSize(); i++)
+		{
+			positions.push_back(pStore->GetX(i));
+		}
+		return positions;
+	}
+
+
+
+	/**
+	 * @brief דm̊Ԋu̎R̐Lт̍őlij߂
+	 *
+	 * @param[in] positions	SẴp[eBN̍W
+	 * @param[in] ropeNum	[v̐
+	 *
+	 * @return Lт̍ől
+	 */
+	float CalculateMaxStretch(const std::vector<Vector3>& positions, int ropeNum)
+	{
+		const uint32_t storeParticleNum = (PARTICLE_NUM + ParticleStore::LANE_NUM - 1) / ParticleStore::LANE_NUM * ParticleStore::LANE_NUM;
+		float maxStretch = 0.0f;
+		for (int r = 0; r < ropeNum; r++)
+		{
+			for (int i = 0; i + 1 < PARTICLE_NUM; i++)
+			{
+				const uint32_t index = r * storeParticleNum + i;
+				maxStretch = std::max(maxStretch, Vector3::Distance(positions[index], positions[index + 1]) / SEGMENT_LENGTH - 1.0f);
+			}
+		}
+		return maxStretch;
+	}
+}
+
+
+
+/**
+ * @brief FvZɉꍇƔׁAXbhςČv
+ *
+ * @returns true  2FɕAXbhɈ˂炸ʂvAɉꍇƂ̍elɎ܂
+ * @returns false ꂩ𖞂Ȃ
+ */
+bool RunParallelWorldTest()
+{
+	const uint32_t hardwareThreadNum = std::clamp(std::thread::hardware_concurrency(), 2u, XPBDWorld::MAX_THREAD_NUM);
+
+	// ****  ****
+	auto sequentialWorld	= std::make_unique<XPBDWorld>();
+	auto twoThreadWorld		= std::make_unique<XPBDWorld>();
+	auto parallelWorld		= std::make_unique<XPBDWorld>();
+	CreateWorld(sequentialWorld.get(), VERIFY_ROPE_NUM, 1);
+	CreateWorld(twoThreadWorld.get(), VERIFY_ROPE_NUM, 2);
+	CreateWorld(parallelWorld.get(), VERIFY_ROPE_NUM, hardwareThreadNum);
+
+	for (int frame = 0; frame < FRAME_NUM; frame++)
+	{
+		sequentialWorld->Simulate(DELTA_TIME);
+		twoThreadWorld->Simulate(DELTA_TIME);
+		parallelWorld->Simulate(DELTA_TIME);
+	}
+
+	const std::vector<Vector3> sequentialPositions	= CollectPositions(*sequentialWorld);
+	const std::vector<Vector3> twoThreadPositions	= CollectPositions(*twoThreadWorld);
+	const std::vector<Vector3> parallelPositions	= CollectPositions(*parallelWorld);
+
+	float maxDifference = 0.0f;
+	float maxThreadDifference = 0.0f;
+	for (size_t i = 0; i < sequentialPositions.size(); i++)
+	{
+		maxDifference		= std::max(maxDifference, Vector3::Distance(sequentialPositions[i], parallelPositions[i]));
+		maxThreadDifference = std::max(maxThreadDifference, Vector3::Distance(twoThreadPositions[i], parallelPositions[i]));
+	}
+
+	const float ropeLength = SEGMENT_LENGTH * (PARTICLE_NUM - 1);
+
+	std::printf("ropes %d x %d particles, %d frames : max stretch sequential %.4f colored %.4f\n",
+		VERIFY_ROPE_NUM, PARTICLE_NUM, FRAME_NUM, CalculateMaxStretch(sequentialPositions, VERIFY_ROPE_NUM), CalculateMaxStretch(parallelPositions, VERIFY_ROPE_NUM));
+
+	bool isPassed = true;
+	isPassed &= Check(parallelWorld->GetColorNum() == 2, "colors %u", parallelWorld->GetColorNum());
+	isPassed &= Check(maxThreadDifference == 0.0f, "2 / %u threads difference %g", hardwareThreadNum, maxThreadDifference);
+	isPassed &= Check(maxDifference <= ropeLength * SHAPE_TOLERANCE, "max difference from sequential %g m (rope %.1f m)", maxDifference, ropeLength);
+
+	// **** v ****
+	for (const int ropeNum : ROPE_NUMS)
+	{
+		std::printf("ropes %4d x %d particles :", ropeNum, PARTICLE_NUM);
+
+		for (const uint32_t threadNum : THREAD_NUMS)
+		{
+			auto world = std::make_unique<XPBDWorld>();
+			CreateWorld(world.get(), ropeNum, threadNum);
+
+			// `Xbh̋NvO
+			world->Simulate(DELTA_TIME);
+
+			const double ms = MeasureMilliseconds([&]()
+				{
+					for (int frame = 0; frame < FRAME_NUM; frame++)
+					{
+						world->Simulate(DELTA_TIME);
+					}
+				});
+
+			std::printf(" %u threads %.1f us/step%s", threadNum, ms * 1000.0 / FRAME_NUM,
+				(threadNum > 1 && world->GetConstraintNum() < XPBDWorld::MIN_PARALLEL_CONSTRAINT_NUM) ? " (sequential)" : "");
+		}
+		std::printf("\n");
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,113 @@
+/*****************************************************************//**
+ * @file    ParticleStoreBenchmark.cpp
+ * @brief   \̔z̃p[eBN̐ϕ̌vɊւ\[Xt@C
+ *
+ * Ȃ XPBDSimulatori\Ɗm肾jƁAp[eBNl߂ ParticleStore 
+ * 50E1000E100000 Ői߁AŏIʒuv邱Ƃm߂1bɐi߂p[eBNv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleStore/ParticleStore.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/XPBDSimulator.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr uint32_t	PARTICLE_NUMS[]		= { 50, 1000, 100000 };	///< vp[eBN̐
+	constexpr float		DELTA_TIME			= 1.0f / 60.0f;			///< 1t[̌oߎ
+	constexpr int		FRAME_NUM			= 100;					///< i߂t[
+	constexpr float		POSITION_TOLERANCE	= 1.0e-3f;				///< ŏIʒu̍̋eliSIMD ƉZ̏قȂ邽߁j
+}
+
+
+
+/**
+ * @brief \̔z̃p[eBN̐ϕ SimParticle ̔zƔׁAԂv
+ *
+ * @returns true  SĂ̐ōŏIʒu̍elɎ܂
+ * @returns false el𒴂
+ */
+bool RunParticleStoreBenchmark()
+{
+	bool isPassed = true;
+
+	for (const uint32_t particleNum : PARTICLE_NUMS)
+	{
+		// 1{̃[vƂĕׂi擪Œ肷j
+		std::vector<std::unique_ptr<ParticleObject>> particleObjects(particleNum);
+		std::vector<ParticleObject*> ropeParticles(particleNum);
+		for (uint32_t i = 0; i < particleNum; i++)
+		{
+			const float t = static_cast<float>(i);
+			particleObjects[i] = std::make_unique<ParticleObject>();
+			particleObjects[i]->SetPosition(Vector3(t * 0.1f, 20.0f, 0.0f));
+			particleObjects[i]->SetVelocity(Vector3(std::sin(t), std::cos(t), 0.5f));
+			particleObjects[i]->SetMass(1.0f);
+			ropeParticles[i] = particleObjects[i].get();
+		}
+
+		// \̂̔zi񖳂j
+		XPBDSimulator::Parameter parameter;
+		parameter.iterations = 0;
+		XPBDSimulator simulator;
+		simulator.Initialize(parameter, ropeParticles);
+
+		// \̔z
+		ParticleStore store;
+		const uint32_t begin = store.Allocate(particleNum);
+		for (uint32_t i = 0; i < particleNum; i++)
+		{
+			store.SetFixed(begin + i, i == 0);
+			store.SetX(begin + i, particleObjects[i]->GetPosition());
+			store.SetV(begin + i, particleObjects[i]->GetVelocity());
+			store.SetMass(begin + i, particleObjects[i]->GetMass());
+		}
+
+		const double aosMs = MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++)
+				{
+					simulator.Simulate(DELTA_TIME);
+				}
+			});
+
+		const double soaMs = MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++)
+				{
+					store.PredictNextPositions(DELTA_TIME);
+					store.FinalizeVelocitiesAndPositions(begin, particleNum, parameter.gravity, DELTA_TIME);
+				}
+			});
+
+		// ŏIʒu̍iParticleObject ֔fĔׂj
+		simulator.Update(DELTA_TIME);
+		store.PredictNextPositions(DELTA_TIME);
+		store.FinalizeVelocitiesAndPositions(begin, particleNum, parameter.gravity, DELTA_TIME);
+		float maxDifference = 0.0f;
+		for (uint32_t i = 0; i < particleNum; i++)
+		{
+			maxDifference = std::max(maxDifference, Vector3::Distance(particleObjects[i]->GetPosition(), store.GetX(begin + i)));
+		}
+
+		auto particlesPerSecond = [&](double ms) { return static_cast<double>(particleNum) * FRAME_NUM / std::max(ms, 0.001) / 1000.0; };
+
+		isPassed &= Check(maxDifference <= POSITION_TOLERANCE, "%6u particles : SimParticle %7.1f M/s, SoA %7.1f M/s (x%5.2f), max difference %g",
+			particleNum, particlesPerSecond(aosMs), particlesPerSecond(soaMs), aosMs / soaMs, maxDifference);
+	}
+
+	return isPassed;
+}
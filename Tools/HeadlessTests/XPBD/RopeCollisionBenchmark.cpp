@@ -0,0 +1,236 @@
+/*****************************************************************//**
+ * @file    RopeCollisionBenchmark.cpp
+ * @brief   [v̏Փː̐̌vɊւ\[Xt@C
+ *
+ * 30 x 30 ̌ԊX̉̏Ƀ[v𐅕ɒA擪Œ肵ėƂB
+ * 50 / 500 ̃p[eBÑ[vŁA[̏Փ˂ƑSẴp[eBN̏Փ˂ׁA
+ * Փː̍쐬ɂ鎞ԁA쐬̐A
+ * ɂ߂荞񂾃p[eBN̐it[̏IɒS̒ɂ́jv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/Framework/Collision/CollisionManager/CollisionManager.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/XPBDSimulator.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/CollisionConstraint/CollisionConstraintFactory.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int	CITY_SIZE		= 30;				///< 1ӂɕԌ̐
+	constexpr float BLOCK_PITCH		= 12.0f;			///< ̊Ԋu
+	constexpr float BUILDING_WIDTH	= 8.0f;				///< ̕
+	constexpr float SEGMENT_LENGTH	= 0.5f;				///< p[eBN̊Ԋu
+	constexpr float DELTA_TIME		= 1.0f / 60.0f;		///< 1t[̌oߎ
+	constexpr int	FRAME_NUM		= 300;				///< i߂t[
+	constexpr int	PARTICLE_NUMS[]	= { 50, 500 };		///< [ṽp[eBN̐
+}
+
+
+
+
+// NX̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief Ƃēo^IuWFNg
+	 */
+	class BuildingObject
+		: public GameObject
+	{
+	public:
+		bool IsActive() const override { return true; }
+		GameObjectTag GetTag() const override { return GameObjectTag::BUILDING; }
+	};
+
+
+
+	/**
+	 * @brief Փː̍쐬ɂ鎞Ԃ𑪂鐶
+	 */
+	class TimedFactory
+		: public ConstraintFactoryBase
+	{
+	public:
+		CollisionConstraintFactory* pFactory = nullptr;
+		double ms = 0.0;				///< vԁi~bj
+		size_t constraintNum = 0;		///< 쐬̍v
+
+		TimedFactory() : ConstraintFactoryBase{ true } {}
+
+		void CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints) override
+		{
+			const size_t startSize = pOutConstraints->size();
+			ms += MeasureMilliseconds([&]() { pFactory->CreateConstraint(pParticles, paramater, pOutConstraints); });
+			constraintNum += pOutConstraints->size() - startSize;
+		}
+	};
+
+
+
+	/**
+	 * @brief 1̃[hł̌v
+	 */
+	struct Measurement
+	{
+		double collisionUs		= 0.0;	///< Փː̍쐬̎ԁi1t[j
+		double updateUs			= 0.0;	///< XV̎ԁi1t[j
+		double constraintNum	= 0.0;	///< 쐬̐i1t[j
+		double nearbyBoxNum		= 0.0;	///< ̌̐i1t[j
+		double penetrationNum	= 0.0;	///< ̒ɂp[eBN̐i1t[j
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief X̏Ƀ[v𗎂ƂAՓː̍쐬Ƃ߂荞݂v
+	 *
+	 * @param[in] collisionManager	Xo^Փ˔Ǘ
+	 * @param[in] boxes				̌`
+	 * @param[in] particleNum		[ṽp[eBN̐
+	 * @param[in] mode				Փ˂𒲂ׂp[eBN
+	 *
+	 * @return v
+	 */
+	Measurement MeasureMode(CollisionManager* pCollisionManager, const std::vector<std::unique_ptr<AABB>>& boxes, int particleNum, CollisionConstraintFactory::Mode mode)
+	{
+		// ԍ̏ォA̕тɉĐɒ
+		std::vector<std::unique_ptr<ParticleObject>> particleObjects(particleNum);
+		std::vector<ParticleObject*> ropeParticles(particleNum);
+		for (int i = 0; i < particleNum; i++)
+		{
+			particleObjects[i] = std::make_unique<ParticleObject>();
+			particleObjects[i]->SetPosition(Vector3(SEGMENT_LENGTH * i, 32.0f, BLOCK_PITCH * 4.0f + 1.0f));
+			particleObjects[i]->SetVelocity(Vector3::Zero);
+			particleObjects[i]->SetMass(5.0f);
+			ropeParticles[i] = particleObjects[i].get();
+		}
+
+		XPBDSimulator::Parameter parameter;
+		parameter.flexibility	= 0.000000006f;
+		parameter.gravity		= Vector3(0.0f, -9.8f / 2.0f, 0.0f);
+		parameter.iterations	= 2;
+		parameter.substeps		= 4;
+
+		auto collisionFactory = std::make_unique<CollisionConstraintFactory>(pCollisionManager, mode);
+		auto timedFactory = std::make_unique<TimedFactory>();
+		timedFactory->pFactory = collisionFactory.get();
+		TimedFactory* pTimedFactory = timedFactory.get();
+
+		XPBDSimulator simulator;
+		simulator.AddConstraint(std::make_unique<DistanceConstraintFactory>());
+		simulator.AddConstraint(std::move(timedFactory));
+		simulator.Initialize(parameter, ropeParticles);
+
+		double updateMs = 0.0;
+		size_t penetrationNum = 0;
+		size_t nearbyBoxNum = 0;
+		for (int frame = 0; frame < FRAME_NUM; frame++)
+		{
+			updateMs += MeasureMilliseconds([&]() { simulator.Update(DELTA_TIME); });
+
+			nearbyBoxNum += collisionFactory->GetNearbyBoxCount();
+
+			// S̒ɂp[eBN𐔂
+			for (const auto& particleObject : particleObjects)
+			{
+				const Vector3 position = particleObject->GetPosition();
+				for (const auto& box : boxes)
+				{
+					const Vector3 boxMin = box->GetCenter() - box->GetExtend() * 0.5f;
+					const Vector3 boxMax = box->GetCenter() + box->GetExtend() * 0.5f;
+					if (position.x > boxMin.x && position.x < boxMax.x &&
+						position.y > boxMin.y && position.y < boxMax.y &&
+						position.z > boxMin.z && position.z < boxMax.z)
+					{
+						penetrationNum++;
+						break;
+					}
+				}
+			}
+		}
+
+		Measurement measurement;
+		measurement.collisionUs		= pTimedFactory->ms * 1000.0 / FRAME_NUM;
+		measurement.updateUs		= updateMs * 1000.0 / FRAME_NUM;
+		measurement.constraintNum	= static_cast<double>(pTimedFactory->constraintNum) / FRAME_NUM;
+		measurement.nearbyBoxNum	= static_cast<double>(nearbyBoxNum) / FRAME_NUM;
+		measurement.penetrationNum	= static_cast<double>(penetrationNum) / FRAME_NUM;
+		return measurement;
+	}
+}
+
+
+
+/**
+ * @brief [̏Փ˂ƑSẴp[eBN̏Փ˂ 50 / 500 ̃[vŌv
+ *
+ * @returns true  SẴp[eBN̏Փ˂ŁA[̏ꍇ߂荞݂
+ * @returns false ߂荞݂Ȃ
+ */
+bool RunRopeCollisionBenchmark()
+{
+	using Mode = CollisionConstraintFactory::Mode;
+
+	// **** X ****
+	CollisionManager collisionManager;
+	BuildingObject building;
+	std::vector<std::unique_ptr<AABB>> boxes;
+	for (int z = 0; z < CITY_SIZE; z++)
+	{
+		for (int x = 0; x < CITY_SIZE; x++)
+		{
+			const float height = 10.0f + static_cast<float>((x * 7 + z * 13) % 5) * 5.0f;
+			const Vector3 center(x * BLOCK_PITCH, height * 0.5f, z * BLOCK_PITCH);
+			boxes.push_back(std::make_unique<AABB>(center, Vector3(BUILDING_WIDTH, height, BUILDING_WIDTH)));
+			collisionManager.AddCollisionData(CollisionData(&building, boxes.back().get(), true));
+		}
+	}
+
+	std::printf("%zu buildings, %d frames\n", boxes.size(), FRAME_NUM);
+
+	bool isPassed = true;
+
+	for (int particleNum : PARTICLE_NUMS)
+	{
+		Measurement measurements[2];
+		for (Mode mode : { Mode::TIP_ONLY, Mode::WHOLE_ROPE })
+		{
+			const Measurement& measurement = measurements[static_cast<int>(mode == Mode::WHOLE_ROPE)] = MeasureMode(&collisionManager, boxes, particleNum, mode);
+
+			std::printf("%4d particles %-10s : collision %8.2f us/frame, update %8.2f us/frame, %6.1f constraints, %5.1f boxes, %6.1f particles inside buildings\n",
+				particleNum,
+				(mode == Mode::TIP_ONLY) ? "tip only" : "whole rope",
+				measurement.collisionUs,
+				measurement.updateUs,
+				measurement.constraintNum,
+				measurement.nearbyBoxNum,
+				measurement.penetrationNum);
+		}
+
+		const Measurement& tipOnly		= measurements[0];
+		const Measurement& wholeRope	= measurements[1];
+		isPassed &= Check(wholeRope.penetrationNum < tipOnly.penetrationNum, "%4d particles : whole rope %.1f < tip only %.1f particles inside buildings",
+			particleNum, wholeRope.penetrationNum, tipOnly.penetrationNum);
+	}
+
+	return isPassed;
+}
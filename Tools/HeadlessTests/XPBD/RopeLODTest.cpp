@@ -0,0 +1,204 @@
+/*****************************************************************//**
+ * @file    RopeLODTest.cpp
+ * @brief   [v̏ڍדx̍蒼Ɩ̃eXgɊւ\[Xt@C
+ *
+ * ~ʂɋȂC[Ɠʂ̃[vi50 j 10 Ɍ炵A50 ɖ߂B
+ * 蒼т
+ * E[̈ʒuƈv邱
+ * EŜ̎RisegmentLength ~ Ԃ̐jƎʂ̍vۂ邱
+ * m߁A݂邵ė̃[v̒R 1% ȓɎ܂邱Ƃm߂B
+ * ɁAŌ炵[vŒ_}ɈグĒƌ̐ɖ߂邱Ƃm߂B
+ * ŌɁA^ɒ݂邵[vAĂԂ͓AŒ_𓮂ƋN邱
+ * i1t[̈ړʂĂAƂ̈ʒu痣΋N邱Ɓjm߂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/RopeLOD/RopeLOD.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int	HIGH_PARTICLE_NUM	= 50;				///< ڍדxƂ̃p[eBN̐
+	constexpr int	LOW_PARTICLE_NUM	= 10;				///< ڍדxႢƂ̃p[eBN̐
+	constexpr float SEGMENT_LENGTH		= 0.4f;				///< p[eBN̊Ԋu
+	constexpr float BEND_RADIUS			= 8.0f;				///< Ȃ~ʂ̔a
+	constexpr float FLEXIBILITY			= 0.000000006f;		///< _iC[Ɠj
+	constexpr float DELTA_TIME			= 1.0f / 60.0f;		///< 1t[̌oߎ
+	constexpr int	SETTLE_FRAME_NUM	= 600;				///< ݂邵ėt[
+	constexpr float LENGTH_TOLERANCE	= 0.01f;			///< ̒̋eliRƂ̔j
+	constexpr float PULL_SPEED			= 60.0f;			///< ƂɌŒ_グ鑬
+	constexpr int	TENSION_FRAME_NUM	= 60;				///< Ă猳ɖ߂܂ő҂t[
+	constexpr float DRIFT_RATIO			= 0.4f;				///< 蓮Ƃ1t[̈ړʁiwakeDistance Ƃ̔j
+	constexpr int	DRIFT_FRAME_NUM		= 10;				///< 蓮t[
+}
+
+
+
+/**
+ * @brief 蒼Ń[v̒Ɨ[ۂ邱ƂƁA[vŒ_̈ړŋN邱Ƃm߂
+ *
+ * @returns true  SĂ̊mFʂ
+ * @returns false ʂȂmF
+ */
+bool RunRopeLODTest()
+{
+	using Level = RopeLOD::Level;
+
+	// ~ʂɋȂ[vi̒ SEGMENT_LENGTH ɂj
+	const float restLength = SEGMENT_LENGTH * (HIGH_PARTICLE_NUM - 1);
+	const float segmentAngle = 2.0f * std::asin(SEGMENT_LENGTH / (2.0f * BEND_RADIUS));
+
+	std::vector<std::unique_ptr<ParticleObject>> particleObjects(HIGH_PARTICLE_NUM);
+	std::vector<ParticleObject*> ropeParticles;
+	float massSum = 0.0f;
+	for (int i = 0; i < HIGH_PARTICLE_NUM; i++)
+	{
+		const float angle = segmentAngle * i;
+		const float n = static_cast<float>(HIGH_PARTICLE_NUM);
+
+		particleObjects[i] = std::make_unique<ParticleObject>();
+		particleObjects[i]->SetPosition(Vector3(BEND_RADIUS * std::sin(angle), 30.0f - BEND_RADIUS * (1.0f - std::cos(angle)), 0.0f));
+		particleObjects[i]->SetVelocity(Vector3::Zero);
+		particleObjects[i]->SetMass(5.0f + (5.0f / n) * (1.0f + n - i));
+		ropeParticles.push_back(particleObjects[i].get());
+		massSum += particleObjects[i]->GetMass();
+	}
+
+	XPBDSimulator::Parameter parameter;
+	parameter.flexibility	= FLEXIBILITY;
+	parameter.gravity		= Vector3(0.0f, -9.8f / 2.0f, 0.0f);
+	parameter.substeps		= 10;
+	parameter.iterations	= 2;
+
+	XPBDSimulator simulator;
+	simulator.AddConstraint(std::make_unique<DistanceConstraintFactory>());
+	simulator.Initialize(parameter, ropeParticles);
+
+	RopeLOD lod;
+	lod.Initialize(RopeLOD::CalculateLength(ropeParticles));
+
+	bool isPassed = true;
+
+	// **** 蒼 ****
+	auto checkRebuild = [&](const char* pLabel, int particleNum)
+		{
+			const Vector3 front	= ropeParticles.front()->GetPosition();
+			const Vector3 back	= ropeParticles.back()->GetPosition();
+
+			const bool isRebuilt = lod.Rebuild(particleNum, &simulator, &particleObjects, &ropeParticles);
+
+			float rebuiltMass = 0.0f;
+			for (const ParticleObject* pParticle : ropeParticles) { rebuiltMass += pParticle->GetMass(); }
+
+			const float segmentRestLength = simulator.GetParameter().segmentLength * (particleNum - 1);
+			const bool isEndpointKept	= (ropeParticles.front()->GetPosition() == front && ropeParticles.back()->GetPosition() == back);
+			const float shapeLength		= RopeLOD::CalculateLength(ropeParticles);
+
+			// ݂邵ė
+			for (int frame = 0; frame < SETTLE_FRAME_NUM; frame++)
+			{
+				simulator.Update(DELTA_TIME);
+			}
+
+			const float settledLength = RopeLOD::CalculateLength(ropeParticles);
+
+			std::printf("%-10s %2d particles : shape %.4f, settled %.4f (%+.3f%%)\n",
+				pLabel, particleNum, shapeLength, settledLength, 100.0f * (settledLength / restLength - 1.0f));
+
+			isPassed &= Check(isRebuilt && static_cast<int>(ropeParticles.size()) == particleNum, "%-10s : rebuilt to %zu particles", pLabel, ropeParticles.size());
+			isPassed &= Check(isEndpointKept, "%-10s : endpoints kept", pLabel);
+			isPassed &= Check(std::abs(segmentRestLength - restLength) <= restLength * 1e-5f, "%-10s : rest length %.5f / %.5f", pLabel, segmentRestLength, restLength);
+			isPassed &= Check(std::abs(rebuiltMass - massSum) <= massSum * 1e-5f, "%-10s : mass %.3f / %.3f", pLabel, rebuiltMass, massSum);
+			isPassed &= Check(std::abs(settledLength / restLength - 1.0f) <= LENGTH_TOLERANCE, "%-10s : settled length within %.0f%%", pLabel, LENGTH_TOLERANCE * 100.0f);
+		};
+
+	checkRebuild("downsample", LOW_PARTICLE_NUM);
+	checkRebuild("upsample", HIGH_PARTICLE_NUM);
+
+	// **** Ƃɖ߂ ****
+	// Ō炵[v́AŒ_}ɈグĒƌɖ߂
+	lod.Rebuild(LOW_PARTICLE_NUM, &simulator, &particleObjects, &ropeParticles);
+	lod.Initialize(restLength, Level::LOW);
+
+	int tenseFrame = -1;
+	for (int frame = 0; frame < TENSION_FRAME_NUM && tenseFrame < 0; frame++)
+	{
+		ropeParticles.front()->SetPosition(ropeParticles.front()->GetPosition() + Vector3(0.0f, PULL_SPEED * DELTA_TIME, 0.0f));
+		simulator.Update(DELTA_TIME);
+
+		if (lod.Update(lod.GetSetting().lowDistance * 2.0f, &simulator, &particleObjects, &ropeParticles)) { tenseFrame = frame; }
+	}
+
+	isPassed &= Check((tenseFrame >= 0) && lod.GetLevel() == Level::HIGH && static_cast<int>(ropeParticles.size()) == lod.GetSetting().highParticleNum,
+		"tension : back to %zu particles at frame %d while far", ropeParticles.size(), tenseFrame);
+
+	// ****  ****
+	// hꑱ邽߁A^ɒ݂邵Ď~߂Ă疰点
+	XPBDSimulator::Parameter sleepParameter = simulator.GetParameter();
+	sleepParameter.isSleepEnabled = true;
+
+	auto hangAndSleep = [&]()
+		{
+			const float hangSegmentLength = simulator.GetParameter().segmentLength;
+			for (size_t i = 1; i < ropeParticles.size(); i++)
+			{
+				ropeParticles[i]->SetPosition(ropeParticles[0]->GetPosition() - Vector3(0.0f, hangSegmentLength * i, 0.0f));
+				ropeParticles[i]->SetVelocity(Vector3::Zero);
+			}
+			simulator.Initialize(sleepParameter, ropeParticles);
+
+			for (int frame = 0; frame < SETTLE_FRAME_NUM; frame++)
+			{
+				simulator.Update(DELTA_TIME);
+				if (simulator.IsSleeping()) { return frame; }
+			}
+			return -1;
+		};
+
+	// [v͌Œ_𓮂ƋN
+	const int sleepFrame = hangAndSleep();
+
+	const Vector3 sleepingBack = ropeParticles.back()->GetPosition();
+	simulator.Update(DELTA_TIME);
+	const bool isStillWhileSleeping = (ropeParticles.back()->GetPosition() == sleepingBack);
+
+	ropeParticles.front()->SetPosition(ropeParticles.front()->GetPosition() + Vector3(0.1f, 0.0f, 0.0f));
+	simulator.Update(DELTA_TIME);
+	const bool isAwakened = !simulator.IsSleeping();
+
+	isPassed &= Check(sleepFrame >= 0, "sleep : fell asleep at frame %d (energy %.6f)", sleepFrame, simulator.GetKineticEnergy());
+	isPassed &= Check(isStillWhileSleeping, "sleep : still while sleeping");
+	isPassed &= Check(isAwakened, "sleep : woken by anchor");
+
+	// 1t[̈ړʂ wakeDistance ɖȂĂAƂ̈ʒu痣΋N
+	const int driftSleepFrame = hangAndSleep();
+	const float driftStep = sleepParameter.wakeDistance * DRIFT_RATIO;
+	const int expectedWakeFrame = static_cast<int>(std::ceil(1.0f / DRIFT_RATIO));
+
+	int driftWakeFrame = -1;
+	for (int frame = 1; frame <= DRIFT_FRAME_NUM && driftWakeFrame < 0; frame++)
+	{
+		ropeParticles.front()->SetPosition(ropeParticles.front()->GetPosition() + Vector3(driftStep, 0.0f, 0.0f));
+		simulator.Update(DELTA_TIME);
+		if (!simulator.IsSleeping()) { driftWakeFrame = frame; }
+	}
+
+	isPassed &= Check(driftSleepFrame >= 0 && driftWakeFrame == expectedWakeFrame, "sleep : woken by slow anchor drift (%.4f m/frame) at frame %d / %d",
+		driftStep, driftWakeFrame, expectedWakeFrame);
+
+	return isPassed;
+}
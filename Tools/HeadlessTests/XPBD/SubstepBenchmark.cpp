@@ -0,0 +1,185 @@
+/*****************************************************************//**
+ * @file    SubstepBenchmark.cpp
+ * @brief   XPBDSimulator ̔񐔂ƃTuXebv̌vɊւ\[Xt@C
+ *
+ * C[ƓdEd͂ŁA[ɏdt 50 ̃p[eBÑ[v𐅕U艺낵A
+ * gݍ킹ƂɃt[Ƃ̍ő̐LсiRƂ̔j1t[̎Ԃo͂B
+ * ŌɁALт̕ςelɎ܂钆ōłgݍ킹o͂
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/XPBDSimulator.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// ^̒` ===================================================================
+namespace
+{
+	/**
+	 * @brief gݍ킹
+	 */
+	struct Setting
+	{
+		int iterations;	///< 
+		int substeps;	///< TuXebv
+	};
+
+
+
+	/**
+	 * @brief gݍ킹Ƃ̌
+	 */
+	struct Result
+	{
+		float	maxStretch		= 0.0f;	///< Lт̍ől
+		double	averageStretch	= 0.0;	///< Lт̕
+		double	usPerFrame		= 0.0;	///< 1t[̎ԁi}CNbj
+	};
+}
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int	PARTICLE_NUM		= 50;				///< p[eBN̐
+	constexpr float SEGMENT_LENGTH		= 0.4f;				///< p[eBN̊Ԋu
+	constexpr float PARTICLE_MASS		= 5.0f;				///< p[eBN̎
+	constexpr float LOAD_MASS			= 60.0f;			///< [̏diԂ牺vC[j̎
+	constexpr float FLEXIBILITY			= 0.000000006f;		///< _iC[Ɠj
+	constexpr float DELTA_TIME			= 1.0f / 60.0f;		///< 1t[̌oߎ
+	constexpr int	FRAME_NUM			= 600;				///< i߂t[
+	constexpr float STRETCH_TOLERANCE	= 0.01f;			///< Lт̕ς̋el
+
+	constexpr Setting SETTINGS[] =
+	{
+		{ 10, 1 }, { 20, 1 }, { 40, 1 }, { 80, 1 },
+		{ 1, 5 }, { 1, 10 }, { 1, 15 }, { 1, 20 }, { 1, 40 },
+		{ 2, 10 }, { 5, 4 },
+	};
+
+	constexpr Setting ITERATION_SETTING	= { 20, 1 };	///< ōdogݍ킹
+	constexpr Setting SUBSTEP_SETTING	= { 1, 20 };	///< 񐔂TuXebvɉ񂵂gݍ킹
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief 1̑gݍ킹Ń[vU艺낵ALтƎԂ߂
+	 *
+	 * @param[in] setting gݍ킹
+	 *
+	 * @return 
+	 */
+	Result MeasureSetting(const Setting& setting)
+	{
+		// ɒ[vi擪Œ肷j
+		std::vector<std::unique_ptr<ParticleObject>> particleObjects(PARTICLE_NUM);
+		std::vector<ParticleObject*> ropeParticles(PARTICLE_NUM);
+		for (int i = 0; i < PARTICLE_NUM; i++)
+		{
+			particleObjects[i] = std::make_unique<ParticleObject>();
+			particleObjects[i]->SetPosition(Vector3(SEGMENT_LENGTH * i, 30.0f, 0.0f));
+			particleObjects[i]->SetVelocity(Vector3::Zero);
+			particleObjects[i]->SetMass((i == PARTICLE_NUM - 1) ? LOAD_MASS : PARTICLE_MASS);
+			ropeParticles[i] = particleObjects[i].get();
+		}
+
+		XPBDSimulator::Parameter parameter;
+		parameter.flexibility	= FLEXIBILITY;
+		parameter.gravity		= Vector3(0.0f, -9.8f / 2.0f, 0.0f);
+		parameter.iterations	= setting.iterations;
+		parameter.substeps		= setting.substeps;
+
+		XPBDSimulator simulator;
+		simulator.AddConstraint(std::make_unique<DistanceConstraintFactory>());
+		simulator.Initialize(parameter, ropeParticles);
+
+		Result result;
+		double stretchSum = 0.0;
+		double simulateMs = 0.0;
+		for (int frame = 0; frame < FRAME_NUM; frame++)
+		{
+			simulateMs += MeasureMilliseconds([&]() { simulator.Simulate(DELTA_TIME); });
+
+			// v̊OŐLт߂
+			float frameStretch = 0.0f;
+			for (int i = 0; i + 1 < PARTICLE_NUM; i++)
+			{
+				const float distance = Vector3::Distance(simulator.GetParticlePosition(i), simulator.GetParticlePosition(i + 1));
+				frameStretch = std::max(frameStretch, distance / SEGMENT_LENGTH - 1.0f);
+			}
+			result.maxStretch = std::max(result.maxStretch, frameStretch);
+			stretchSum += frameStretch;
+		}
+
+		result.averageStretch	= stretchSum / FRAME_NUM;
+		result.usPerFrame		= simulateMs * 1000.0 / FRAME_NUM;
+		return result;
+	}
+}
+
+
+
+/**
+ * @brief 񐔂ƃTuXebv̑gݍ킹ƂɃ[v̐LтƏԂv
+ *
+ * @returns true  elɎ܂gݍ킹A񐔂Ȃ甽TuXebv̕Lт
+ * @returns false ꂩ𖞂Ȃ
+ */
+bool RunSubstepBenchmark()
+{
+	std::printf("%d particles, %d frames\n", PARTICLE_NUM, FRAME_NUM);
+
+	const Setting* pBestSetting = nullptr;
+	double bestTime = 0.0;
+	double iterationStretch = 0.0;
+	double substepStretch = 0.0;
+
+	for (const Setting& setting : SETTINGS)
+	{
+		const Result result = MeasureSetting(setting);
+
+		const bool isWithinTolerance = (result.averageStretch <= STRETCH_TOLERANCE);
+		if (isWithinTolerance && (pBestSetting == nullptr || result.usPerFrame < bestTime))
+		{
+			pBestSetting = &setting;
+			bestTime = result.usPerFrame;
+		}
+
+		if (setting.iterations == ITERATION_SETTING.iterations && setting.substeps == ITERATION_SETTING.substeps) { iterationStretch = result.averageStretch; }
+		if (setting.iterations == SUBSTEP_SETTING.iterations && setting.substeps == SUBSTEP_SETTING.substeps) { substepStretch = result.averageStretch; }
+
+		std::printf("iterations %2d x substeps %2d : stretch max %.4f average %.4f, %.2f us/frame%s\n",
+			setting.iterations, setting.substeps, result.maxStretch, result.averageStretch, result.usPerFrame, isWithinTolerance ? "" : " (over tolerance)");
+	}
+
+	if (pBestSetting)
+	{
+		std::printf("cheapest within average stretch %.3f : iterations %d x substeps %d (%.2f us/frame)\n",
+			STRETCH_TOLERANCE, pBestSetting->iterations, pBestSetting->substeps, bestTime);
+	}
+
+	bool isPassed = true;
+	isPassed &= Check(pBestSetting != nullptr, "some setting within average stretch %.3f", STRETCH_TOLERANCE);
+	isPassed &= Check(substepStretch < iterationStretch, "substeps %d stretch %.4f < iterations %d stretch %.4f",
+		SUBSTEP_SETTING.substeps, substepStretch, ITERATION_SETTING.iterations, iterationStretch);
+	return isPassed;
+}
@@ -0,0 +1,142 @@
+/*****************************************************************//**
+ * @file    WorldBenchmark.cpp
+ * @brief   XPBD ̃[ȟvɊւ\[Xt@C
+ *
+ * 50 ̃p[eBN[v 1 { 256 {܂Ŕ{Xɑ₵A
+ * 1{ XPBDSimulator Ői߂ꍇƃ[hł܂Ƃ߂Đi߂ꍇ̍ŏIʒuv邱Ƃm߂āA
+ * 1Xebv̎Ԃv
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "XPBDTests.h"
+
+#include "Common/TestRunner.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDWorld/XPBDWorld.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr int	MAX_ROPE_NUM		= 256;			///< [v̍ő吔
+	constexpr int	PARTICLE_NUM		= 50;			///< [v1{̃p[eBN̐
+	constexpr float SEGMENT_LENGTH		= 0.2f;			///< p[eBN̊Ԋu
+	constexpr float PARTICLE_MASS		= 1.0f;			///< p[eBN̎
+	constexpr float DELTA_TIME			= 1.0f / 60.0f;	///< 1t[̌oߎ
+	constexpr int	FRAME_NUM			= 300;			///< i߂t[
+	constexpr float POSITION_TOLERANCE	= 1.0e-3f;		///< ŏIʒu̍̋eliZ̏̈Ⴂɂ덷j
+}
+
+
+
+/**
+ * @brief [v̐ς1{ꍇƃ[hł܂Ƃ߂ĉꍇׁAԂv
+ *
+ * [vƂɔ񐔂Ə_ς
+ *
+ * @returns true  SẴ[v̐ōŏIʒu̍elɎ܂
+ * @returns false el𒴂
+ */
+bool RunWorldBenchmark()
+{
+	bool isPassed = true;
+
+	for (int ropeNum = 1; ropeNum <= MAX_ROPE_NUM; ropeNum *= 2)
+	{
+		std::vector<XPBDSimulator::Parameter> parameters(ropeNum);
+		for (int r = 0; r < ropeNum; r++)
+		{
+			parameters[r].iterations	= 5 + r % 11;
+			parameters[r].flexibility	= 0.0005f * static_cast<float>(1 + r % 4);
+		}
+
+		// ɒ[vA1{Ƃ܂Ƃ߂ĉŕʁXɍ
+		auto initialPositions = [](int r)
+			{
+				const Vector3 anchor(static_cast<float>(r) * 2.0f, 20.0f, 0.0f);
+				std::vector<Vector3> positions(PARTICLE_NUM);
+				for (int i = 0; i < PARTICLE_NUM; i++)
+				{
+					positions[i] = anchor + Vector3(0.0f, 0.0f, SEGMENT_LENGTH * static_cast<float>(i));
+				}
+				return positions;
+			};
+
+		// 1{
+		std::vector<std::unique_ptr<ParticleObject>> particleObjects;
+		particleObjects.reserve(ropeNum * PARTICLE_NUM);
+		std::vector<std::unique_ptr<XPBDSimulator>> simulators(ropeNum);
+		for (int r = 0; r < ropeNum; r++)
+		{
+			std::vector<ParticleObject*> ropeParticles;
+			for (const Vector3& position : initialPositions(r))
+			{
+				auto particle = std::make_unique<ParticleObject>();
+				particle->SetPosition(position);
+				particle->SetVelocity(Vector3::Zero);
+				particle->SetMass(PARTICLE_MASS);
+				ropeParticles.push_back(particle.get());
+				particleObjects.push_back(std::move(particle));
+			}
+
+			simulators[r] = std::make_unique<XPBDSimulator>();
+			simulators[r]->AddConstraint(std::make_unique<DistanceConstraintFactory>());
+			simulators[r]->Initialize(parameters[r], ropeParticles);
+		}
+
+		const double simulatorMs = MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++)
+				{
+					for (auto& simulator : simulators)
+					{
+						simulator->Update(DELTA_TIME);
+					}
+				}
+			});
+
+		// ܂Ƃ߂ĉ
+		XPBDWorld world;
+		std::vector<XPBDWorld::RopeHandle> handles(ropeNum);
+		for (int r = 0; r < ropeNum; r++)
+		{
+			handles[r] = world.AddRope(parameters[r], initialPositions(r), PARTICLE_MASS);
+		}
+
+		const double worldMs = MeasureMilliseconds([&]()
+			{
+				for (int frame = 0; frame < FRAME_NUM; frame++)
+				{
+					world.Simulate(DELTA_TIME);
+				}
+			});
+
+		// ŏIʒu̍
+		float maxDifference = 0.0f;
+		for (int r = 0; r < ropeNum; r++)
+		{
+			uint32_t particleBegin = 0;
+			uint32_t particleNum = 0;
+			world.GetParticleRange(handles[r], &particleBegin, &particleNum);
+			for (uint32_t i = 0; i < particleNum; i++)
+			{
+				const Vector3 simulatorPosition = particleObjects[r * PARTICLE_NUM + i]->GetPosition();
+				maxDifference = std::max(maxDifference, Vector3::Distance(simulatorPosition, world.GetParticleStore()->GetX(particleBegin + i)));
+			}
+		}
+
+		isPassed &= Check(maxDifference <= POSITION_TOLERANCE, "ropes %3d x %d particles : simulators %8.1f us/step, world %8.1f us/step (x%5.2f), max difference %g",
+			ropeNum, PARTICLE_NUM, simulatorMs * 1000.0 / FRAME_NUM, worldMs * 1000.0 / FRAME_NUM, simulatorMs / worldMs, maxDifference);
+	}
+
+	return isPassed;
+}
@@ -0,0 +1,55 @@
+/*****************************************************************//**
+ * @file    XPBDTests.cpp
+ * @brief   `Ȃ XPBD ̃eXg̃Gg[|Cg
+ *
+ * g
+ *   XPBDTests [--case NAME]... [--list]
+ *
+ * IR[h͑SĒʂ 0AʂȂeXg 1Aɖ肪 2
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+
+#include "Common/TestRunner.h"
+#include "XPBDTests.h"
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	/// eXg̈ꗗ
+	constexpr TestCase TEST_CASES[] =
+	{
+		{ "world",			RunWorldBenchmark },
+		{ "particle_store",	RunParticleStoreBenchmark },
+		{ "allocation",		RunAllocationTest },
+		{ "parallel_world",	RunParallelWorldTest },
+		{ "substep",		RunSubstepBenchmark },
+		{ "distance_batch",	RunDistanceConstraintBatchBenchmark },
+		{ "adaptive",		RunAdaptiveIterationBenchmark },
+		{ "rope_collision",	RunRopeCollisionBenchmark },
+		{ "rope_lod",		RunRopeLODTest },
+		{ "idle_rope",		RunIdleRopeBenchmark },
+	};
+}
+
+
+
+/**
+ * @brief Gg[|Cg
+ *
+ * @param[in] argc ̐
+ * @param[in] argv 
+ *
+ * @return IR[h
+ */
+int main(int argc, char* argv[])
+{
+	return RunTestCases(argc, argv, TEST_CASES, std::size(TEST_CASES));
+}
@@ -0,0 +1,44 @@
+/*****************************************************************//**
+ * @file    XPBDTests.h
+ * @brief   XPBD ̃eXgɊւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/17
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// ֐̐錾 =================================================================
+// [v̐ς1{ꍇƃ[hł܂Ƃ߂ĉꍇׁAԂv
+bool RunWorldBenchmark();
+
+// \̔z̃p[eBN̐ϕ SimParticle ̔zƔׁAԂv
+bool RunParticleStoreBenchmark();
+
+// [vh炵Ă̐ŃmۂȂƂm߂
+bool RunAllocationTest();
+
+// FvZɉꍇƔׁAXbhςČv
+bool RunParallelWorldTest();
+
+// 񐔂ƃTuXebv̑gݍ킹ƂɃ[v̐LтƏԂv
+bool RunSubstepBenchmark();
+
+// ̔z DistanceConstraint ƔׁA1bɉ񐔂v
+bool RunDistanceConstraintBatchBenchmark();
+
+// cɂ锽̑ł؂Ō񐔂󋵂ƂɌv
+bool RunAdaptiveIterationBenchmark();
+
+// [̏Փ˂ƑSẴp[eBN̏Փ˂ 50 / 500 ̃[vŌv
+bool RunRopeCollisionBenchmark();
+
+// 蒼Ń[v̒Ɨ[ۂ邱ƂƁA[vŒ_̈ړŋN邱Ƃm߂
+bool RunRopeLODTest();
+
+// ~܂[v𑽐ׁA点ꍇƗq炵ꍇ̎Ԃv
+bool RunIdleRopeBenchmark();
@@ -0,0 +1,162 @@
+/*****************************************************************//**
+ * @file    pch.h
+ * @brief   `Ȃ؊p̃vRpCς݃wb_[̑
+ *
+ * Q[ pch.h  Windows  Direct3D Ɉˑ邽߁A[v̌؊ł͂ɓǂݍ܂B
+ * WCuƁAXPBD ̃R[hg DirectX::SimpleMath ̈ꕔ𕂓_̉ZŒ`B
+ * Z̏ DirectXTK  SSE ̎ɍ킹Ă邪Ǎ܂ňv邱Ƃ͕ۏ؂Ȃ
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cwchar>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+
+
+
+// }N̒` ===============================================================
+#define UNREFERENCED_PARAMETER(P) (void)(P)
+
+
+
+
+// DirectXMath / SimpleMath ̑ ==========================================
+namespace DirectX
+{
+	/**
+	 * @brief 3vf̕_
+	 */
+	struct XMFLOAT3
+	{
+		float x;
+		float y;
+		float z;
+
+		XMFLOAT3() = default;
+		constexpr XMFLOAT3(float _x, float _y, float _z) noexcept : x(_x), y(_y), z(_z) {}
+	};
+
+	namespace SimpleMath
+	{
+		/**
+		 * @brief 3xNg
+		 */
+		struct Vector3 : public XMFLOAT3
+		{
+			Vector3() noexcept : XMFLOAT3(0.0f, 0.0f, 0.0f) {}
+			constexpr explicit Vector3(float ix) noexcept : XMFLOAT3(ix, ix, ix) {}
+			constexpr Vector3(float ix, float iy, float iz) noexcept : XMFLOAT3(ix, iy, iz) {}
+			Vector3(const XMFLOAT3& v) noexcept : XMFLOAT3(v) {}
+
+			// r
+			bool operator==(const Vector3& v) const noexcept { return x == v.x && y == v.y && z == v.z; }
+			bool operator!=(const Vector3& v) const noexcept { return !(*this == v); }
+
+			// Z
+			Vector3& operator+=(const Vector3& v) noexcept { x += v.x; y += v.y; z += v.z; return *this; }
+			Vector3& operator-=(const Vector3& v) noexcept { x -= v.x; y -= v.y; z -= v.z; return *this; }
+			Vector3& operator*=(const Vector3& v) noexcept { x *= v.x; y *= v.y; z *= v.z; return *this; }
+			Vector3& operator*=(float s) noexcept { x *= s; y *= s; z *= s; return *this; }
+			Vector3& operator/=(float s) noexcept { return *this *= (1.0f / s); }
+
+			// PZ
+			Vector3 operator+() const noexcept { return *this; }
+			Vector3 operator-() const noexcept { return Vector3(-x, -y, -z); }
+
+			// xNgZ
+			float Length() const noexcept { return std::sqrt(LengthSquared()); }
+			float LengthSquared() const noexcept { return Dot(*this); }
+			float Dot(const Vector3& v) const noexcept { return (x * v.x + y * v.y) + z * v.z; }
+			Vector3 Cross(const Vector3& v) const noexcept { return Vector3(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x); }
+
+			// Ki 0 Ȃ 0 ̂܂܁j
+			void Normalize() noexcept
+			{
+				const float length = Length();
+				if (length > 0.0f) { x /= length; y /= length; z /= length; }
+			}
+			void Normalize(Vector3& result) const noexcept { result = *this; result.Normalize(); }
+
+			// ÓI֐
+			static float Distance(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v2.x - v1.x, v2.y - v1.y, v2.z - v1.z).Length(); }
+			static float DistanceSquared(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v2.x - v1.x, v2.y - v1.y, v2.z - v1.z).LengthSquared(); }
+			static Vector3 Min(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(std::min(v1.x, v2.x), std::min(v1.y, v2.y), std::min(v1.z, v2.z)); }
+			static Vector3 Max(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(std::max(v1.x, v2.x), std::max(v1.y, v2.y), std::max(v1.z, v2.z)); }
+			static Vector3 Lerp(const Vector3& v1, const Vector3& v2, float t) noexcept { return Vector3(v1.x + (v2.x - v1.x) * t, v1.y + (v2.y - v1.y) * t, v1.z + (v2.z - v1.z) * t); }
+
+			// 萔
+			static const Vector3 Zero;
+			static const Vector3 One;
+			static const Vector3 UnitX;
+			static const Vector3 UnitY;
+			static const Vector3 UnitZ;
+			static const Vector3 Up;
+			static const Vector3 Down;
+			static const Vector3 Right;
+			static const Vector3 Left;
+			static const Vector3 Forward;
+			static const Vector3 Backward;
+		};
+
+		// 񍀉Z
+		inline Vector3 operator+(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z); }
+		inline Vector3 operator-(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z); }
+		inline Vector3 operator*(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z); }
+		inline Vector3 operator/(const Vector3& v1, const Vector3& v2) noexcept { return Vector3(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z); }
+		inline Vector3 operator*(const Vector3& v, float s) noexcept { return Vector3(v.x * s, v.y * s, v.z * s); }
+		inline Vector3 operator*(float s, const Vector3& v) noexcept { return Vector3(v.x * s, v.y * s, v.z * s); }
+		inline Vector3 operator/(const Vector3& v, float s) noexcept { return v * (1.0f / s); }
+
+		// 萔̒`iEWnőO -Zj
+		inline const Vector3 Vector3::Zero		= { 0.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::One		= { 1.0f, 1.0f, 1.0f };
+		inline const Vector3 Vector3::UnitX		= { 1.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::UnitY		= { 0.0f, 1.0f, 0.0f };
+		inline const Vector3 Vector3::UnitZ		= { 0.0f, 0.0f, 1.0f };
+		inline const Vector3 Vector3::Up		= { 0.0f, 1.0f, 0.0f };
+		inline const Vector3 Vector3::Down		= { 0.0f, -1.0f, 0.0f };
+		inline const Vector3 Vector3::Right		= { 1.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::Left		= { -1.0f, 0.0f, 0.0f };
+		inline const Vector3 Vector3::Forward	= { 0.0f, 0.0f, -1.0f };
+		inline const Vector3 Vector3::Backward	= { 0.0f, 0.0f, 1.0f };
+	}
+}
+
+
+
+
+// `̌^̐錾 =============================================================
+// RopeObject.h ̃ǒ^B؊ł RopeObject Ȃߐ錾ɂ
+namespace DirectX
+{
+	template <typename TVertex> class PrimitiveBatch;
+	struct VertexPositionColor;
+	class BasicEffect;
+	class Model;
+}
+
+struct ID3D11InputLayout;
+
+namespace Microsoft::WRL
+{
+	template <typename T> class ComPtr { T* m_ptr = nullptr; };
+}
@@ -0,0 +1,524 @@
+/*****************************************************************//**
+ * @file    RopeSimulationHarness.cpp
+ * @brief   `Ȃ[ṽV~[V̌؊Ɋւ\[Xt@C
+ *
+ * [v𒼐ڑgݗāAŒ_̓Ƒǂ̓͂{ŗ^ XPBDSimulator i߂B
+ * Hi\EEEmjƂ̎Ԃo͂A߂t[̃p[eBN̈ʒu
+ * ۑĂ̋OՁiGoldenjƔׂB
+ *
+ * g
+ *   RopeSimulationHarness [--record] [--frames N] [--tolerance T] [--golden DIR] [--scenario NAME]
+ *   --record    ̋OՂL^iׂȂj
+ *   --frames    i߂t[i 3000j
+ *   --tolerance Ƃ̍̋eli[gB 0.001j
+ *   --golden    ̋OՂutH_i Goldenj
+ *   --scenario  w肵󋵂s
+ *
+ * IR[h͑SĈv 0Ael𒴂 1A̋OՂɖ肪 2
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/XPBDSimulator.h"
+#include "Game/Common/GameplayLogic/XPBD/ParticleObject/ParticleObject.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/DistanceConstraint/DistanceConstraintFactory.h"
+#include "ScriptedSteeringConstraintFactory.h"
+
+#ifndef XPBDSIMULATOR_PROFILE
+#error "XPBDSIMULATOR_PROFILE `ărh邱ƁiMakefile QƁj"
+#endif
+
+using namespace DirectX::SimpleMath;
+
+
+
+
+// 萔̒` =================================================================
+namespace
+{
+	constexpr float		DELTA_TIME			= 1.0f / 60.0f;	///< 1t[̌oߎ
+	constexpr int		DEFAULT_FRAME_NUM	= 3000;			///< i߂t[̊l
+	constexpr float		DEFAULT_TOLERANCE	= 0.001f;		///< Ƃ̍̋el̊li[gj
+	constexpr int		CHECKPOINT_INTERVAL	= 500;			///< ʒuL^t[̊Ԋu
+	constexpr float		WIRE_FLEXIBILITY	= 0.000000006f;	///< C[̏_iQ[Ɠj
+	constexpr float		WIRE_GRAVITY		= -9.8f / 2.0f;	///< C[̏d́iQ[Ɠj
+}
+
+
+
+
+// \̂̒` ===============================================================
+namespace
+{
+	/**
+	 * @brief 
+	 */
+	struct Scenario
+	{
+		const char*					name;			///< Oi̋OՂ̃t@Cj
+		int							particleNum;	///< p[eBN̐
+		float						segmentLength;	///< p[eBN̊Ԋu
+		bool						isHorizontal;	///< ɒ邩ǂifalse Ȃ^ɒ݂邷j
+		bool						useSteering;	///< ǐgǂ
+		XPBDSimulator::Parameter	parameter;		///< p[^
+
+		/// Œ_̈ʒuit[ԍƍŏ̈ʒu狁߂j
+		std::function<Vector3(int frame, const Vector3& startPosition)> anchorScript;
+
+		/// ǂ̓́iJ̐ʃxNgƈړ͂ݒ肷j
+		std::function<void(int frame, Vector3* pCameraForward, Vector3* pInput)> steeringScript;
+	};
+
+	/**
+	 * @brief ʒuL^t[
+	 */
+	struct Checkpoint
+	{
+		int						frame;		///< t[ԍi1 琔j
+		std::vector<Vector3>	positions;	///< p[eBN̈ʒu
+	};
+
+	/**
+	 * @brief s̐ݒ
+	 */
+	struct Options
+	{
+		bool		isRecording		= false;				///< ̋OՂL^ǂ
+		int			frameNum		= DEFAULT_FRAME_NUM;	///< i߂t[
+		float		tolerance		= DEFAULT_TOLERANCE;	///< Ƃ̍̋el
+		std::string	goldenDirectory	= "Golden";				///< ̋OՂutH_
+		std::string	scenarioName;							///< s󋵁iȂSāj
+	};
+}
+
+
+
+
+// ֐̒` =================================================================
+namespace
+{
+	/**
+	 * @brief Q[̃C[Ɠp[^
+	 *
+	 * @return p[^
+	 */
+	XPBDSimulator::Parameter MakeWireParameter()
+	{
+		XPBDSimulator::Parameter parameter;
+		parameter.flexibility	= WIRE_FLEXIBILITY;
+		parameter.gravity		= Vector3(0.0f, WIRE_GRAVITY, 0.0f);
+		parameter.iterations	= 1;
+		return parameter;
+	}
+
+
+
+	/**
+	 * @brief 󋵂̈ꗗ̍쐬
+	 *
+	 * @return 󋵂̈ꗗ
+	 */
+	std::vector<Scenario> MakeScenarios()
+	{
+		std::vector<Scenario> scenarios;
+
+		// ~߂ĂŒ_
+		auto fixedAnchor = [](int, const Vector3& startPosition) { return startPosition; };
+
+		// Î~F^ɒ݂邵C[
+		{
+			Scenario scenario{ "idle", 30, 0.5f, false, false, MakeWireParameter(), fixedAnchor, nullptr };
+			scenarios.push_back(scenario);
+		}
+
+		// hFU艺낷C[iTuXebvōdoj
+		{
+			Scenario scenario{ "swing", 30, 0.5f, true, false, MakeWireParameter(), fixedAnchor, nullptr };
+			scenario.parameter.substeps = 10;
+			scenarios.push_back(scenario);
+		}
+
+		// Œ_̈ړF~`Ȃ㉺Œ_ɒ݂邵C[
+		{
+			Scenario scenario{ "anchor_motion", 40, 0.4f, false, false, MakeWireParameter(), nullptr, nullptr };
+			scenario.parameter.iterations	= 2;
+			scenario.parameter.substeps		= 10;
+			scenario.anchorScript = [](int frame, const Vector3& startPosition)
+				{
+					const float time = frame * DELTA_TIME;
+					const float angle = time * (2.0f * 3.14159265f / 4.0f);
+					return startPosition + Vector3(3.0f * std::sin(angle), 1.5f * std::sin(angle * 0.5f), 3.0f * (std::cos(angle) - 1.0f));
+				};
+			scenarios.push_back(scenario);
+		}
+
+		// ǁFJ񂵂Ȃ͂؂ւ
+		{
+			Scenario scenario{ "steering", 30, 0.5f, true, true, MakeWireParameter(), fixedAnchor, nullptr };
+			scenario.steeringScript = [](int frame, Vector3* pCameraForward, Vector3* pInput)
+				{
+					const float time = frame * DELTA_TIME;
+					*pCameraForward = Vector3(std::sin(time * 0.5f), 0.0f, -std::cos(time * 0.5f));
+
+					// 2 bƂ OEȂEEȂEEE JԂ
+					constexpr int INPUT_PERIOD = 120;
+					switch ((frame / INPUT_PERIOD) % 6)
+					{
+					case 0:		*pInput = Vector3::Forward;		break;
+					case 2:		*pInput = Vector3::Left;		break;
+					case 4:		*pInput = Vector3::Right;		break;
+					case 5:		*pInput = Vector3::Backward;	break;
+					default:	*pInput = Vector3::Zero;		break;
+					}
+				};
+			scenarios.push_back(scenario);
+		}
+
+		return scenarios;
+	}
+
+
+
+	/**
+	 * @brief 󋵂i߂
+	 *
+	 * @param[in]  scenario		
+	 * @param[in]  frameNum		i߂t[
+	 * @param[out] pCheckpoints	L^ʒu
+	 *
+	 * @return Ȃ
+	 */
+	void RunScenario(const Scenario& scenario, int frameNum, std::vector<Checkpoint>* pCheckpoints)
+	{
+		// **** [v̑gݗāi擪Œ_Bʂ̓Q[̃C[ƓقǏdj ****
+		const Vector3 anchorStart(0.0f, 30.0f, 0.0f);
+		const Vector3 direction = scenario.isHorizontal ? Vector3::UnitX : Vector3::Down;
+
+		std::vector<std::unique_ptr<ParticleObject>> particleObjects;
+		std::vector<ParticleObject*> ropeParticles;
+		for (int i = 0; i < scenario.particleNum; i++)
+		{
+			const float n = static_cast<float>(scenario.particleNum);
+
+			particleObjects.push_back(std::make_unique<ParticleObject>());
+			particleObjects.back()->SetPosition(anchorStart + direction * (scenario.segmentLength * i));
+			particleObjects.back()->SetVelocity(Vector3::Zero);
+			particleObjects.back()->SetMass(5.0f + (5.0f / n) * (1.0f + n - i));
+			ropeParticles.push_back(particleObjects.back().get());
+		}
+
+		// **** V~[^[̍쐬iQ[̃C[ƓŐo^j ****
+		XPBDSimulator simulator;
+		ScriptedSteeringConstraintFactory* pSteeringFactory = nullptr;
+		if (scenario.useSteering)
+		{
+			auto steeringFactory = std::make_unique<ScriptedSteeringConstraintFactory>();
+			pSteeringFactory = steeringFactory.get();
+			simulator.AddConstraint(std::move(steeringFactory));
+		}
+		simulator.AddConstraint(std::make_unique<DistanceConstraintFactory>());
+		simulator.Initialize(scenario.parameter, ropeParticles);
+
+		// **** i߂ ****
+		XPBDSimulator::PhaseTimes phaseTimeSum;
+		double updateTimeSum = 0.0;
+		double maxUpdateTime = 0.0;
+		long long iterationSum = 0;
+
+		for (int frame = 1; frame <= frameNum; frame++)
+		{
+			// {̓
+			particleObjects.front()->SetPosition(scenario.anchorScript(frame, anchorStart));
+			if (pSteeringFactory)
+			{
+				Vector3 cameraForward = Vector3::Forward;
+				Vector3 input = Vector3::Zero;
+				scenario.steeringScript(frame, &cameraForward, &input);
+				pSteeringFactory->SetInput(DELTA_TIME, cameraForward, input);
+			}
+
+			const auto start = std::chrono::steady_clock::now();
+			simulator.Update(DELTA_TIME);
+			const double updateTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+			// v
+			const XPBDSimulator::PhaseTimes& phaseTimes = simulator.GetLastPhaseTimes();
+			phaseTimeSum.predict	+= phaseTimes.predict;
+			phaseTimeSum.generate	+= phaseTimes.generate;
+			phaseTimeSum.iterate	+= phaseTimes.iterate;
+			phaseTimeSum.finalize	+= phaseTimes.finalize;
+			updateTimeSum += updateTime;
+			maxUpdateTime = std::max(maxUpdateTime, updateTime);
+			iterationSum += simulator.GetLastSolveResult().iterations;
+
+			// ʒűL^
+			if (frame % CHECKPOINT_INTERVAL == 0 || frame == frameNum)
+			{
+				Checkpoint checkpoint;
+				checkpoint.frame = frame;
+				for (const ParticleObject* pParticle : ropeParticles)
+				{
+					checkpoint.positions.push_back(pParticle->GetPosition());
+				}
+				pCheckpoints->push_back(std::move(checkpoint));
+			}
+		}
+
+		const double frames = static_cast<double>(frameNum);
+		std::printf("[%s] %d frames, %d particles, substeps %d, %.1f iterations/frame\n",
+			scenario.name, frameNum, scenario.particleNum, scenario.parameter.substeps, iterationSum / frames);
+		std::printf("  predict %.2f us, generate %.2f us, iterate %.2f us, finalize %.2f us, update %.2f us/frame (max %.2f us)\n",
+			phaseTimeSum.predict / frames, phaseTimeSum.generate / frames, phaseTimeSum.iterate / frames, phaseTimeSum.finalize / frames,
+			updateTimeSum / frames, maxUpdateTime);
+	}
+
+
+
+	/**
+	 * @brief ̋OՂ̃t@C
+	 *
+	 * @param[in] options	s̐ݒ
+	 * @param[in] scenario	
+	 *
+	 * @return t@C
+	 */
+	std::string GetGoldenPath(const Options& options, const Scenario& scenario)
+	{
+		return options.goldenDirectory + "/" + scenario.name + ".txt";
+	}
+
+
+
+	/**
+	 * @brief ̋OՂ̏
+	 *
+	 * @param[in] path			t@C
+	 * @param[in] checkpoints	L^ʒu
+	 *
+	 * @returns true  
+	 * @returns false JȂ
+	 */
+	bool WriteGolden(const std::string& path, const std::vector<Checkpoint>& checkpoints)
+	{
+		std::ofstream file(path);
+		if (!file) return false;
+
+		char line[128];
+		file << "# XPBD rope golden trajectory (x y z per particle)\n";
+		for (const Checkpoint& checkpoint : checkpoints)
+		{
+			file << "checkpoint " << checkpoint.frame << " " << checkpoint.positions.size() << "\n";
+			for (const Vector3& position : checkpoint.positions)
+			{
+				std::snprintf(line, sizeof(line), "%.9g %.9g %.9g\n", position.x, position.y, position.z);
+				file << line;
+			}
+		}
+		return static_cast<bool>(file);
+	}
+
+
+
+	/**
+	 * @brief ̋OՂ̓ǂݍ
+	 *
+	 * @param[in]  path				t@C
+	 * @param[out] pCheckpoints		L^ʒu
+	 *
+	 * @returns true  ǂݍ
+	 * @returns false JȂE`Ⴄ
+	 */
+	bool ReadGolden(const std::string& path, std::vector<Checkpoint>* pCheckpoints)
+	{
+		std::ifstream file(path);
+		if (!file) return false;
+
+		std::string token;
+		while (file >> token)
+		{
+			// Rgs
+			if (token[0] == '#')
+			{
+				std::getline(file, token);
+				continue;
+			}
+
+			if (token != "checkpoint") return false;
+
+			Checkpoint checkpoint;
+			size_t particleNum = 0;
+			if (!(file >> checkpoint.frame >> particleNum)) return false;
+
+			checkpoint.positions.resize(particleNum);
+			for (Vector3& position : checkpoint.positions)
+			{
+				if (!(file >> position.x >> position.y >> position.z)) return false;
+			}
+			pCheckpoints->push_back(std::move(checkpoint));
+		}
+
+		return !pCheckpoints->empty();
+	}
+
+
+
+	/**
+	 * @brief ̋OՂƂ̔r
+	 *
+	 * t[ŋL^ʒumׁA̍őlelȉȂvƂ
+	 *
+	 * @param[in] golden		̋O
+	 * @param[in] checkpoints	L^ʒu
+	 * @param[in] tolerance		el
+	 *
+	 * @returns true  v
+	 * @returns false el𒴂Eׂt[
+	 */
+	bool CompareWithGolden(const std::vector<Checkpoint>& golden, const std::vector<Checkpoint>& checkpoints, float tolerance)
+	{
+		float maxDifference = 0.0f;
+		int maxDifferenceFrame = 0;
+		int firstFailedFrame = 0;
+		int comparedNum = 0;
+
+		for (const Checkpoint& checkpoint : checkpoints)
+		{
+			auto it = std::find_if(golden.begin(), golden.end(), [&](const Checkpoint& g) { return g.frame == checkpoint.frame; });
+			if (it == golden.end()) continue;
+
+			if (it->positions.size() != checkpoint.positions.size())
+			{
+				std::printf("  golden: particle count differs at frame %d (%zu / %zu) : NG\n", checkpoint.frame, it->positions.size(), checkpoint.positions.size());
+				return false;
+			}
+
+			for (size_t i = 0; i < checkpoint.positions.size(); i++)
+			{
+				const float difference = Vector3::Distance(it->positions[i], checkpoint.positions[i]);
+				if (!(difference < maxDifference)) { maxDifference = difference; maxDifferenceFrame = checkpoint.frame; }
+				if (!(difference <= tolerance) && firstFailedFrame == 0) { firstFailedFrame = checkpoint.frame; }
+			}
+			comparedNum++;
+		}
+
+		if (comparedNum == 0)
+		{
+			std::printf("  golden: no checkpoint in common : NG\n");
+			return false;
+		}
+
+		const bool isMatched = (firstFailedFrame == 0);
+		std::printf("  golden: %d checkpoints, max difference %.6f m at frame %d", comparedNum, maxDifference, maxDifferenceFrame);
+		if (isMatched)	std::printf(" : OK\n");
+		else			std::printf(", first over %.6f m at frame %d : NG\n", tolerance, firstFailedFrame);
+		return isMatched;
+	}
+
+
+
+	/**
+	 * @brief ̉
+	 *
+	 * @param[in]  argc		̐
+	 * @param[in]  argv		
+	 * @param[out] pOptions	s̐ݒ
+	 *
+	 * @returns true  ͂
+	 * @returns false sȈ
+	 */
+	bool ParseOptions(int argc, char* argv[], Options* pOptions)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			const bool hasValue = (i + 1 < argc);
+
+			if (std::strcmp(argv[i], "--record") == 0)						{ pOptions->isRecording = true; }
+			else if (std::strcmp(argv[i], "--frames") == 0 && hasValue)		{ pOptions->frameNum = std::atoi(argv[++i]); }
+			else if (std::strcmp(argv[i], "--tolerance") == 0 && hasValue)	{ pOptions->tolerance = static_cast<float>(std::atof(argv[++i])); }
+			else if (std::strcmp(argv[i], "--golden") == 0 && hasValue)		{ pOptions->goldenDirectory = argv[++i]; }
+			else if (std::strcmp(argv[i], "--scenario") == 0 && hasValue)	{ pOptions->scenarioName = argv[++i]; }
+			else { return false; }
+		}
+
+		return pOptions->frameNum > 0;
+	}
+}
+
+
+
+/**
+ * @brief Gg[|Cg
+ *
+ * @param[in] argc ̐
+ * @param[in] argv 
+ *
+ * @return IR[h
+ */
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, &options))
+	{
+		std::printf("usage: %s [--record] [--frames N] [--tolerance T] [--golden DIR] [--scenario NAME]\n", argv[0]);
+		return 2;
+	}
+
+	int exitCode = 0;
+	int scenarioNum = 0;
+
+	for (const Scenario& scenario : MakeScenarios())
+	{
+		if (!options.scenarioName.empty() && options.scenarioName != scenario.name) continue;
+		scenarioNum++;
+
+		std::vector<Checkpoint> checkpoints;
+		RunScenario(scenario, options.frameNum, &checkpoints);
+
+		const std::string goldenPath = GetGoldenPath(options, scenario);
+
+		// L^
+		if (options.isRecording)
+		{
+			if (!WriteGolden(goldenPath, checkpoints))
+			{
+				std::printf("  golden: cannot write %s\n", goldenPath.c_str());
+				exitCode = 2;
+				continue;
+			}
+			std::printf("  golden: recorded %zu checkpoints to %s\n", checkpoints.size(), goldenPath.c_str());
+			continue;
+		}
+
+		// ׂ
+		std::vector<Checkpoint> golden;
+		if (!ReadGolden(goldenPath, &golden))
+		{
+			std::printf("  golden: cannot read %s (run with --record first)\n", goldenPath.c_str());
+			exitCode = 2;
+			continue;
+		}
+		if (!CompareWithGolden(golden, checkpoints, options.tolerance) && exitCode == 0)
+		{
+			exitCode = 1;
+		}
+	}
+
+	if (scenarioNum == 0)
+	{
+		std::printf("no scenario named %s\n", options.scenarioName.c_str());
+		return 2;
+	}
+
+	return exitCode;
+}
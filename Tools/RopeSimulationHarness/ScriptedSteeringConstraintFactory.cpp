@@ -0,0 +1,90 @@
+/*****************************************************************//**
+ * @file    ScriptedSteeringConstraintFactory.cpp
+ * @brief   {̓͂őǐ鐶Ɋւ\[Xt@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// wb_t@C̓ǂݍ ===================================================
+#include "pch.h"
+#include "ScriptedSteeringConstraintFactory.h"
+
+
+
+using namespace DirectX;
+
+
+// o֐̒` ===========================================================
+/**
+ * @brief RXgN^
+ */
+ScriptedSteeringConstraintFactory::ScriptedSteeringConstraintFactory()
+	: ConstraintFactoryBase{ true }
+	, m_generator{ nullptr }
+	, m_deltaTime{ 0.0f }
+	, m_cameraForward{ SimpleMath::Vector3::Forward }
+	, m_input{}
+{
+}
+
+
+
+/**
+ * @brief fXgN^
+ */
+ScriptedSteeringConstraintFactory::~ScriptedSteeringConstraintFactory()
+{
+}
+
+
+
+/**
+ * @brief Zbg
+ */
+void ScriptedSteeringConstraintFactory::Reset()
+{
+	m_generator.Reset();
+}
+
+
+
+/**
+ * @brief ̍쐬
+ *
+ * ͂ SteeringConstraintFactory ƓKĎgAg 0 ɖ߂
+ *
+ * @param[in]  pParticles		p[eBN
+ * @param[in]  paramater		p[^
+ * @param[out] pOutConstraints	쐬ǐiǋLj
+ */
+void ScriptedSteeringConstraintFactory::CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints)
+{
+	UNREFERENCED_PARAMETER(paramater);
+
+	m_input.Normalize();
+
+	m_generator.Generate(pParticles, m_deltaTime, m_cameraForward, m_input, pOutConstraints);
+
+	m_input = SimpleMath::Vector3::Zero;
+}
+
+
+
+/**
+ * @brief ̍쐬Ŏg͂̐ݒ
+ *
+ * @param[in] deltaTime		Ot[̌oߎ
+ * @param[in] cameraForward	J̐ʃxNgiɂĐKj
+ * @param[in] input			ړ́iX EAZ Oj
+ */
+void ScriptedSteeringConstraintFactory::SetInput(float deltaTime, const DirectX::SimpleMath::Vector3& cameraForward, const DirectX::SimpleMath::Vector3& input)
+{
+	m_deltaTime = deltaTime;
+
+	m_cameraForward = cameraForward;
+	m_cameraForward.y = 0.0f;
+	m_cameraForward.Normalize();
+
+	m_input = input;
+}
@@ -0,0 +1,70 @@
+/*****************************************************************//**
+ * @file    ScriptedSteeringConstraintFactory.h
+ * @brief   {̓͂őǐ鐶Ɋւwb_[t@C
+ *
+ * @author  
+ * @date    2026/10/16
+ *********************************************************************/
+
+// dCN[h̖h~ =====================================================
+#pragma once
+
+
+
+
+// wb_t@C̓ǂݍ ===================================================
+#include <vector>
+
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/ConstraintFactory.h"
+#include "Game/Common/GameplayLogic/XPBD/XPBDSimulator/Constraint/SteeringConstraint/SteeringConstraintGenerator.h"
+
+
+
+
+// NX̒` ===============================================================
+/**
+ * @brief {̓͂őǐ鐶
+ *
+ * SteeringConstraintFactory ̃JƓ͂̎擾At[ݒ肷lɒúB
+ * 쐬͓̏ SteeringConstraintGenerator g
+ */
+class ScriptedSteeringConstraintFactory
+	: public ConstraintFactoryBase
+{
+// f[^o̐錾 -----------------------------------------------
+private:
+
+	SteeringConstraintGenerator m_generator;	///< ǐ̍쐬
+
+	float m_deltaTime;								///< Ot[̌oߎ
+	DirectX::SimpleMath::Vector3 m_cameraForward;	///< J̐ʃxNg
+	DirectX::SimpleMath::Vector3 m_input;			///< ړ
+
+
+// o֐̐錾 -------------------------------------------------
+// RXgN^/fXgN^
+public:
+	// RXgN^
+	ScriptedSteeringConstraintFactory();
+
+	// fXgN^
+	~ScriptedSteeringConstraintFactory();
+
+
+// 
+public:
+	// Zbg
+	void Reset() override;
+
+	// ̍쐬
+	void CreateConstraint(std::vector<XPBDSimulator::Particle>* pParticles, XPBDSimulator::Parameter paramater, std::vector<IConstraint*>* pOutConstraints) override;
+
+
+// 擾/ݒ
+public:
+	// ̍쐬Ŏg͂̐ݒ
+	void SetInput(float deltaTime, const DirectX::SimpleMath::Vector3& cameraForward, const DirectX::SimpleMath::Vector3& input);
+
+	// ̂߂Ƀmۂ񐔂̎擾
+	size_t GetAllocationCount() const override { return m_generator.GetAllocationCount(); }
+};